@@ -0,0 +1,27 @@
+#ifndef EFFORT_TICKS_HPP
+#define EFFORT_TICKS_HPP
+
+#include <cstddef>
+
+namespace budget
+{
+	/*
+	 * Deterministic measure of the effort of the search and the simplifications: A tick approximates the access of a single cache line, thus the number of ticks of a computation only depends on its input
+	 * while (unlike the wall-clock time) being independent of the machine and its load. Budgets and schedules defined in ticks therefore produce the same results on every machine.
+	 */
+	inline constexpr std::size_t CACHE_LINE_SIZE_IN_BYTES = 64;
+
+	// A scan of n contiguous elements touches the cache line of the first element and every further cache line spanned by the elements
+	template <typename ElementType>
+	[[nodiscard]] constexpr std::size_t determineNumTicksOfSequentialAccess(std::size_t numElements) noexcept
+	{
+		return 1 + numElements * sizeof(ElementType) / CACHE_LINE_SIZE_IN_BYTES;
+	}
+
+	// Every element of a node based container (e.g. std::unordered_set) is stored in its own allocation and thus touches a separate cache line
+	[[nodiscard]] constexpr std::size_t determineNumTicksOfNodeBasedAccess(std::size_t numElements) noexcept
+	{
+		return 1 + numElements;
+	}
+}
+#endif
@@ -0,0 +1,112 @@
+#ifndef RESOURCE_BUDGET_HPP
+#define RESOURCE_BUDGET_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace budget
+{
+	/*
+	 * Bounds the work of the parser, the preprocessing and the search by a wall-clock, conflict, tick and memory limit as well as by an interrupt. The hot loops poll isExhausted() which only reads atomic counters
+	 * on every call while the clock and the resident set size of the process are only sampled every NUM_POLLS_PER_CLOCK_SAMPLE-th (respectively NUM_POLLS_PER_MEMORY_SAMPLE-th) poll of a thread.
+	 *
+	 * The counters are shared by all threads charging the budget (e.g. the workers of a portfolio), thus the conflict and tick limits bound the total work of all of them. Once the budget is exhausted it remains
+	 * exhausted (with the reason determined first) until it is restarted.
+	 */
+	class ResourceBudget
+	{
+	public:
+		using ptr = std::unique_ptr<ResourceBudget>;
+
+		enum ExhaustionReason : char
+		{
+			None,
+			Interrupted,
+			WallClockLimit,
+			ConflictLimit,
+			TickLimit,
+			MemoryLimit
+		};
+
+		struct Limits
+		{
+			std::optional<std::chrono::milliseconds> optionalWallClockLimit;
+			std::optional<std::size_t> optionalConflictLimit;
+			std::optional<std::size_t> optionalTickLimit;
+			// Limit for the resident set size of the whole process
+			std::optional<std::size_t> optionalMemoryLimitInBytes;
+		};
+
+		static constexpr std::size_t NUM_POLLS_PER_CLOCK_SAMPLE = 128;
+		static constexpr std::size_t NUM_POLLS_PER_MEMORY_SAMPLE = 8192;
+
+		explicit ResourceBudget(const Limits& limits);
+		ResourceBudget()
+			: ResourceBudget(Limits()) {}
+
+		ResourceBudget(const ResourceBudget&) = delete;
+		ResourceBudget& operator=(const ResourceBudget&) = delete;
+
+		void chargeConflicts(std::size_t numConflicts) noexcept;
+		void chargeTicks(std::size_t numTicks) noexcept;
+		// Can be called by any thread, the budget is exhausted at the next poll
+		void interrupt() noexcept;
+		// Resets the consumed resources (as well as the start of the wall-clock limit) and the exhaustion reason, an interrupt signal received by the process is not reset
+		void restart() noexcept;
+
+		[[nodiscard]] bool isExhausted() noexcept;
+		[[nodiscard]] ExhaustionReason getExhaustionReason() const noexcept;
+		[[nodiscard]] std::size_t getNumConsumedConflicts() const noexcept;
+		[[nodiscard]] std::size_t getNumConsumedTicks() const noexcept;
+		[[nodiscard]] std::chrono::milliseconds getElapsedTime() const noexcept;
+		[[nodiscard]] const Limits& getLimits() const noexcept;
+
+		/*
+		 * Installs handlers for SIGINT and SIGTERM that only set a lock-free flag (and are thus async-signal-safe), every budget of the process is exhausted once the flag is set. The default handlers are restored
+		 * by the first received signal, thus a second signal terminates the process if the search does not stop in time.
+		 */
+		static void installInterruptSignalHandlers();
+		[[nodiscard]] static bool wasInterruptSignalReceived() noexcept;
+		static void resetInterruptSignal() noexcept;
+		// Returns the current resident set size of the process if it can be determined on the current platform
+		[[nodiscard]] static std::optional<std::size_t> determineResidentSetSizeInBytes();
+
+		[[nodiscard]] static std::string stringifyExhaustionReason(ExhaustionReason exhaustionReason)
+		{
+			switch (exhaustionReason)
+			{
+				case ExhaustionReason::None:
+					return "none";
+				case ExhaustionReason::Interrupted:
+					return "interrupted";
+				case ExhaustionReason::WallClockLimit:
+					return "wall-clock limit";
+				case ExhaustionReason::ConflictLimit:
+					return "conflict limit";
+				case ExhaustionReason::TickLimit:
+					return "tick limit";
+				case ExhaustionReason::MemoryLimit:
+					return "memory limit";
+				default:
+					return "unknown";
+			}
+		}
+
+	protected:
+		using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+		Limits limits;
+		std::atomic<TimePoint::rep> startTimeInTicksOfClock;
+		std::atomic_size_t numConsumedConflicts;
+		std::atomic_size_t numConsumedTicks;
+		std::atomic<char> exhaustionReason;
+		std::atomic_bool isInterruptRequested;
+
+		bool markAsExhausted(ExhaustionReason reason) noexcept;
+		[[nodiscard]] bool isSampledLimitExceeded(std::size_t numPollsOfThread) noexcept;
+	};
+}
+#endif
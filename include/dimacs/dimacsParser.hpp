@@ -3,7 +3,9 @@
 
 #include <optional>
 #include <string>
+#include <budget/resourceBudget.hpp>
 #include <dimacs/problemDefinition.hpp>
+#include <proof/proofWriter.hpp>
 #include <vector>
 
 namespace dimacs
@@ -51,8 +53,19 @@ namespace dimacs
 		[[nodiscard]] ParseResult readProblemFromFile(const std::string& dimacsFilePath);
 		[[nodiscard]] ParseResult readProblemFromString(const std::string& dimacsContent);
 
+		/*
+		 * The simplifications of the formula performed during parsing (units determined by unit propagation, clauses shortened by falsified literals as well as deleted satisfied clauses) are recorded in the proof
+		 * such that the proof of the solver is valid for the original formula. The empty clause is added to the proof if the formula was determined to be unsatisfiable during parsing.
+		 */
+		void setProofWriter(proof::ProofWriter* proofWriter) noexcept;
+
+		/*
+		 * The budget is polled prior to the parsing of every clause, the parsing is aborted with an error once the budget is exhausted.
+		 */
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept;
+
 		DimacsParser(ParserConfiguration configuration)
-			: foundErrorsDuringCurrentParsingAttempt(false), configuration(configuration) {}
+			: foundErrorsDuringCurrentParsingAttempt(false), configuration(configuration), proofWriter(nullptr), resourceBudget(nullptr) {}
 
 		DimacsParser()
 			: DimacsParser(ParserConfiguration({true, true})) {}
@@ -66,17 +79,20 @@ namespace dimacs
 		bool foundErrorsDuringCurrentParsingAttempt;
 		std::vector<ProcessingError> foundErrors;
 		ParserConfiguration configuration;
+		proof::ProofWriter* proofWriter;
+		budget::ResourceBudget* resourceBudget;
 
 		void recordError(std::size_t line, std::size_t column, const std::string& errorText);
 		void resetInternals();
 
 		[[nodiscard]] std::optional<ProblemDefinition::ptr> parseDimacsContent(std::basic_istream<char>& stream, bool& wasFormulaDeterminedToBeUnsat);
 		[[maybe_unused]] static bool removeClausesSatisfiedByUnitPropagation(ProblemDefinition& problemDefinition, long literal);
+		void logSimplificationOfClausesByAssignment(const ProblemDefinition& problemDefinition, long assignedLiteral) const;
 		[[nodiscard]] static std::size_t skipCommentLines(std::basic_istream<char>& inputStream);
 		[[nodiscard]] static std::vector<std::string_view> splitStringAtDelimiter(const std::string_view& stringToSplit, char delimiter);
 		[[nodiscard]] static std::optional<long> tryConvertStringToLong(const std::string_view& stringToConvert, ProcessingError* optionalFoundError);
 		[[nodiscard]] static std::optional<ProblemDefinitionConfiguration> processProblemDefinitionLine(std::basic_istream<char>& inputStream, ProcessingError* optionalFoundError);
-		[[nodiscard]] static std::optional<ProblemDefinition::Clause> parseClauseDefinition(std::basic_istream<char>& inputStream, std::size_t numDefinedVariablesInCnf, const ProblemDefinition& variableValueLookupGateway, ProcessingError* optionalFoundErrors, bool& wasClauseDeterminedToBeUnsat);
+		[[nodiscard]] static std::optional<ProblemDefinition::Clause> parseClauseDefinition(std::basic_istream<char>& inputStream, std::size_t numDefinedVariablesInCnf, const ProblemDefinition& variableValueLookupGateway, ProcessingError* optionalFoundErrors, bool& wasClauseDeterminedToBeUnsat, std::vector<long>* optionalParsedClauseLiterals);
 	};
 
 	inline std::ostream& operator<<(std::ostream& os, const dimacs::DimacsParser::ProcessingError& processingError)
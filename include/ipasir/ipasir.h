@@ -0,0 +1,32 @@
+#ifndef IPASIR_H
+#define IPASIR_H
+
+#include <stdint.h>
+
+/*
+ * Re-entrant incremental SAT solver API (IPASIR) as defined for the incremental track of the SAT competition (https://github.com/biotomas/ipasir), every solver instance is
+ * backed by an incremental CDCL solver that keeps its learned clauses and heuristic state between calls of ipasir_solve.
+ *
+ * Internal errors (e.g. a failed allocation) cannot be reported through the C interface. The first one puts the solver instance permanently into an error state in which further clauses and
+ * assumptions are ignored and every call of ipasir_solve returns 0 (unknown) for the remaining lifetime of the instance. ipasir_init returns NULL if the solver cannot be created.
+ * The callbacks passed to ipasir_set_terminate and ipasir_set_learn must not throw exceptions.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const char* ipasir_signature(void);
+void* ipasir_init(void);
+void ipasir_release(void* solver);
+void ipasir_add(void* solver, int32_t lit_or_zero);
+void ipasir_assume(void* solver, int32_t lit);
+int ipasir_solve(void* solver);
+int32_t ipasir_val(void* solver, int32_t lit);
+int ipasir_failed(void* solver, int32_t lit);
+void ipasir_set_terminate(void* solver, void* data, int (*terminate)(void* data));
+void ipasir_set_learn(void* solver, void* data, int max_length, void (*learn)(void* data, int32_t* clause));
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -1,6 +1,8 @@
 #ifndef BASE_BLOCKED_CLAUSE_ELIMINATIOR_HPP
 #define BASE_BLOCKED_CLAUSE_ELIMINATIOR_HPP
 
+#include <budget/effortTicks.hpp>
+#include <budget/resourceBudget.hpp>
 #include <dimacs/problemDefinition.hpp>
 #include <optimizations/blockedClauseElimination/blockingLiteralGenerator.hpp>
 
@@ -11,28 +13,51 @@ namespace blockedClauseElimination
 	public:
 		virtual ~BaseBlockedClauseEliminator() = default;
 		BaseBlockedClauseEliminator(dimacs::ProblemDefinition::ptr problemDefinition)
-			: problemDefinition(std::move(problemDefinition)) {}
+			: problemDefinition(std::move(problemDefinition)), resourceBudget(nullptr), numTicks(0) {}
+
+		/*
+		 * The budget is polled prior to the check of every candidate blocking literal, the clause is reported as not being blocked once the budget is exhausted.
+		 */
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+		{
+			this->resourceBudget = resourceBudget;
+		}
 
 		[[nodiscard]] std::optional<long> determineBlockingLiteralOfClause(std::size_t clauseIndexInFormula, BlockingLiteralGenerator& blockingLiteralGenerator) const;
 
+		/*
+		 * Returns the ticks (see budget/effortTicks.hpp) spent by all checks of the eliminator, which are also charged to the resource budget after every candidate blocking literal. The enumeration of a candidate,
+		 * the lookup of its resolution environment as well as the access of every clause of the resolution environment are accounted for.
+		 */
+		[[nodiscard]] std::size_t getNumTicks() const noexcept
+		{
+			return numTicks;
+		}
+
 	protected:
 		dimacs::ProblemDefinition::ptr problemDefinition;
+		budget::ResourceBudget* resourceBudget;
+		mutable std::size_t numTicks;
 
 		// Adepted from: https://devblogs.microsoft.com/oldnewthing/20190619-00/?p=102599
 		template <typename Container, typename ElementType = std::decay_t<decltype(*begin(std::declval<Container>()))>>
 		[[nodiscard]] bool doesEveryClauseInGenericResolutionEnvironmentContainerFullfillLiteralBlockedCondition(const dimacs::ProblemDefinition::Clause& clauseToCheck, long potentiallyBlockingLiteral, const Container& containerOfIndicesOfClausesContainingNegatedBlockingLiteral) const
 		{
+			++numTicks;
 			return std::distance(containerOfIndicesOfClausesContainingNegatedBlockingLiteral.cbegin(), containerOfIndicesOfClausesContainingNegatedBlockingLiteral.cend())
 				&& std::none_of(
 					containerOfIndicesOfClausesContainingNegatedBlockingLiteral.cbegin(),
 					containerOfIndicesOfClausesContainingNegatedBlockingLiteral.cend(),
 					[&](const ElementType clauseIndex)
 					{
+						// The entry of the clause index in the resolution environment and the clause itself are both stored in separate allocations
 						const dimacs::ProblemDefinition::Clause* referencedClause = problemDefinition->getClauseByIndexInFormula(clauseIndex);
+						numTicks += 1 + (referencedClause ? budget::determineNumTicksOfSequentialAccess<long>(referencedClause->literals.size()) : 1);
 						return !referencedClause || !checkLiteralBlockedCondition(clauseToCheck, potentiallyBlockingLiteral, referencedClause->literals);
 					});
 		}
 
+		void chargeTicksToResourceBudget(std::size_t& numTicksAtLastCharge) const noexcept;
 		[[nodiscard]] virtual bool doesEveryClauseInResolutionEnvironmentFullfillLiteralBlockedCondition(const dimacs::ProblemDefinition::Clause& clauseToCheck, long potentiallyBlockingLiteral) const = 0;
 		[[nodiscard]] static bool checkLiteralBlockedCondition(const dimacs::ProblemDefinition::Clause& clauseToCheck, long potentiallyBlockingLiteral, const std::vector<long>& literalOfClauseInResolutionEnvironment);
 	};
@@ -3,6 +3,7 @@
 
 #include <dimacs/literalOccurrenceLookup.hpp>
 
+#include <memory>
 #include <optional>
 #include <random>
 #include <vector>
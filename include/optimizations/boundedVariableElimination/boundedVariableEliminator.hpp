@@ -0,0 +1,108 @@
+#ifndef BOUNDED_VARIABLE_ELIMINATOR_HPP
+#define BOUNDED_VARIABLE_ELIMINATOR_HPP
+
+#include "budget/resourceBudget.hpp"
+#include "dimacs/problemDefinition.hpp"
+#include "optimizations/modelReconstruction/modelReconstructionStack.hpp"
+#include "proof/proofWriter.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace boundedVariableElimination
+{
+	/*
+	 * Bounded variable elimination by clause distribution (https://doi.org/10.1007/11499107_5): A variable x is eliminated by replacing the clauses containing x or -x with all non-tautological resolvents on x,
+	 * as long as the number of resolvents does not exceed the number of replaced clauses (plus the configured bound). The candidates are processed in ascending order of the product of the number of occurrences
+	 * of their literals, variables whose occurrences change are rescheduled. Every resolvent is used to remove the clauses it subsumes (backward subsumption).
+	 *
+	 * The replaced clauses are recorded on the model reconstruction stack with the literal of the eliminated variable as witness, thus a model of the reduced formula can be extended to a model of the original formula.
+	 */
+	class BoundedVariableEliminator
+	{
+	public:
+		using ptr = std::unique_ptr<BoundedVariableEliminator>;
+
+		struct EliminationConfiguration
+		{
+			// Variables with more occurrences of either literal are not eliminated since the number of resolvents that need to be checked is the product of the number of occurrences of both literals
+			std::size_t maximumNumOccurrencesPerLiteral = 32;
+			// The elimination of a variable is aborted if any resolvent contains more literals
+			std::size_t maximumResolventSize = 100;
+			// Number of clauses by which the elimination of a single variable may increase the size of the formula
+			std::size_t maximumNumAdditionalClauses = 0;
+		};
+
+		struct EliminationStatistics
+		{
+			std::size_t numEliminatedVariables;
+			std::size_t numRemovedClauses;
+			std::size_t numAddedResolvents;
+			// Clauses removed by the backward subsumption of the resolvents
+			std::size_t numSubsumedClauses;
+			std::size_t numTicks;
+		};
+
+		BoundedVariableEliminator() = delete;
+		BoundedVariableEliminator(dimacs::ProblemDefinition::ptr problemDefinition, const EliminationConfiguration& configuration);
+
+		// The budget is polled prior to the elimination of every candidate variable
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept;
+		// The resolvents are added to the proof prior to the deletion of the replaced clauses
+		void setProofWriter(proof::ProofWriter* proofWriter) noexcept;
+
+		/*
+		 * Eliminates variables of the formula until no candidate remains or the budget is exhausted, the resolvents are added to the formula with identifiers larger than the identifiers of all existing clauses.
+		 * Returns false if the empty clause was derived as a resolvent, i.e. the formula is unsatisfiable.
+		 */
+		[[nodiscard]] bool eliminateVariables(modelReconstruction::ModelReconstructionStack& modelReconstructionStack);
+
+		[[nodiscard]] const std::vector<std::size_t>& getEliminatedVariables() const noexcept;
+		[[nodiscard]] const EliminationStatistics& getStatistics() const noexcept;
+
+	protected:
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		EliminationConfiguration configuration;
+		budget::ResourceBudget* resourceBudget;
+		proof::ProofWriter* proofWriter;
+		std::size_t numVariables;
+		std::size_t nextClauseIdentifier;
+
+		// Binary min-heap of the candidate variables ordered by the product of the number of occurrences of their literals
+		std::vector<std::size_t> candidateQueue;
+		std::vector<std::size_t> positionsInCandidateQueue;
+		std::vector<char> isVariableEliminated;
+		std::vector<char> isLiteralMarked;
+		std::vector<std::size_t> eliminatedVariables;
+		EliminationStatistics statistics;
+
+		[[nodiscard]] bool tryToEliminateVariable(std::size_t variable, modelReconstruction::ModelReconstructionStack& modelReconstructionStack, bool& wasEmptyResolventDerived);
+		[[nodiscard]] std::vector<std::size_t> determineSortedOccurrencesOfLiteral(long literal);
+		[[nodiscard]] bool resolve(const std::vector<long>& positiveClauseLiterals, const std::vector<long>& negativeClauseLiterals, std::size_t variable, std::vector<long>& resolventLiterals);
+		void removeClausesSubsumedByResolvent(std::size_t resolventIdentifier, const std::vector<long>& resolventLiterals, std::vector<std::size_t>& touchedVariables);
+		void rescheduleVariables(const std::vector<std::size_t>& touchedVariables);
+
+		[[nodiscard]] std::size_t determineNumOccurrencesOfLiteral(long literal) const;
+		[[nodiscard]] std::size_t determineOccurrenceProduct(std::size_t variable) const;
+		void pushCandidate(std::size_t variable);
+		[[nodiscard]] std::size_t popCandidate();
+		void moveCandidateUp(std::size_t position);
+		void moveCandidateDown(std::size_t position);
+		void swapCandidates(std::size_t lPosition, std::size_t rPosition);
+
+		[[nodiscard]] static std::size_t literalToVariable(long literal) noexcept
+		{
+			return static_cast<std::size_t>(std::labs(literal));
+		}
+
+		[[nodiscard]] static std::size_t literalToIndex(long literal) noexcept
+		{
+			return (literalToVariable(literal) << 1) | static_cast<std::size_t>(literal < 0);
+		}
+
+		static constexpr std::size_t NOT_IN_CANDIDATE_QUEUE = SIZE_MAX;
+	};
+}
+#endif
@@ -0,0 +1,95 @@
+#ifndef EQUIVALENT_LITERAL_SUBSTITUTOR_HPP
+#define EQUIVALENT_LITERAL_SUBSTITUTOR_HPP
+
+#include "budget/resourceBudget.hpp"
+#include "dimacs/problemDefinition.hpp"
+#include "optimizations/modelReconstruction/modelReconstructionStack.hpp"
+#include "proof/proofWriter.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace equivalentLiteralSubstitution
+{
+	/*
+	 * Equivalent literal substitution: Every binary clause (a b) contributes the implications -a -> b and -b -> a to the binary implication graph, all literals of a strongly connected component (SCC) of this graph
+	 * are equivalent. The SCCs are determined by Tarjan's algorithm and every literal of an SCC is replaced by the representative of the SCC (the literal with the smallest variable) in all clauses of the formula.
+	 * Since the SCC of the negated literals is the negation of an SCC, the representative of -l is the negation of the representative of l. An SCC containing both literals of a variable proves the formula unsatisfiable.
+	 *
+	 * The equivalence of every substituted variable x with its representative r is recorded on the model reconstruction stack as the clauses (x -r) and (-x r) with the literal of x as witness, thus x is assigned
+	 * the value of r during the model reconstruction.
+	 */
+	class EquivalentLiteralSubstitutor
+	{
+	public:
+		using ptr = std::unique_ptr<EquivalentLiteralSubstitutor>;
+
+		struct SubstitutionStatistics
+		{
+			// SCCs with more than one literal, every SCC is only counted once for both polarities
+			std::size_t numEquivalenceClasses;
+			std::size_t numSubstitutedVariables;
+			std::size_t numRewrittenClauses;
+			// Clauses that became tautologies after the substitution
+			std::size_t numRemovedClauses;
+			std::size_t numTicks;
+		};
+
+		EquivalentLiteralSubstitutor() = delete;
+		explicit EquivalentLiteralSubstitutor(dimacs::ProblemDefinition::ptr problemDefinition);
+
+		// The budget is polled prior to the start of the depth-first search from every unvisited literal, the SCCs found up to that point are still substituted
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept;
+		// The equivalences are added to the proof as binary clauses prior to the rewritten clauses and are deleted once no clause references the substituted variables
+		void setProofWriter(proof::ProofWriter* proofWriter) noexcept;
+
+		/*
+		 * The rewritten clauses replace the original clauses using the same identifier. Returns false if a literal is equivalent to its negation, i.e. the formula is unsatisfiable.
+		 */
+		[[nodiscard]] bool substituteEquivalentLiterals(modelReconstruction::ModelReconstructionStack& modelReconstructionStack);
+
+		// The representative of every literal (the literal itself if it was not substituted), indexed by 2 * variable + (literal < 0)
+		[[nodiscard]] const std::vector<long>& getRepresentativeLiterals() const noexcept;
+		[[nodiscard]] const SubstitutionStatistics& getStatistics() const noexcept;
+
+	protected:
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		budget::ResourceBudget* resourceBudget;
+		proof::ProofWriter* proofWriter;
+		std::size_t numVariables;
+		SubstitutionStatistics statistics;
+
+		// The successors of the literal with index i in the binary implication graph are stored between the i-th and the (i+1)-th offset
+		std::vector<std::size_t> implicationGraphOffsets;
+		std::vector<long> implicationGraphSuccessors;
+		std::vector<long> representativeLiterals;
+		std::vector<std::size_t> substitutedVariables;
+		std::vector<char> isLiteralMarked;
+
+		void buildBinaryImplicationGraph();
+		[[nodiscard]] bool determineStronglyConnectedComponents(long& literalEquivalentToItsNegation);
+		[[nodiscard]] bool assignRepresentativeOfComponent(const std::vector<long>& literalsOfComponent, long& literalEquivalentToItsNegation);
+		void rewriteClauses();
+
+		[[nodiscard]] static std::size_t literalToVariable(long literal) noexcept
+		{
+			return static_cast<std::size_t>(std::labs(literal));
+		}
+
+		[[nodiscard]] static std::size_t literalToIndex(long literal) noexcept
+		{
+			return (literalToVariable(literal) << 1) | static_cast<std::size_t>(literal < 0);
+		}
+
+		[[nodiscard]] static long indexToLiteral(std::size_t literalIndex) noexcept
+		{
+			const auto variable = static_cast<long>(literalIndex >> 1);
+			return literalIndex & 1 ? -variable : variable;
+		}
+
+		static constexpr std::size_t UNVISITED = SIZE_MAX;
+	};
+}
+#endif
@@ -0,0 +1,37 @@
+#ifndef MODEL_CHECKER_HPP
+#define MODEL_CHECKER_HPP
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace modelReconstruction
+{
+	/*
+	 * Validates an assignment against the clauses of a formula. The literals of all clauses are stored in a single zero-terminated buffer that is scanned sequentially, thus the check
+	 * does not depend on any data structure of the solver or the preprocessing that could be affected by the bugs the check should detect.
+	 */
+	class ModelChecker
+	{
+	public:
+		using ptr = std::unique_ptr<ModelChecker>;
+
+		ModelChecker() = default;
+
+		void addClause(const std::vector<long>& clauseLiterals);
+
+		/*
+		 * Returns the index (in the order of their addition) of the first clause not satisfied by the model, variables not assigned by the model falsify all of their literals.
+		 */
+		[[nodiscard]] std::optional<std::size_t> determineFirstFalsifiedClause(const std::vector<long>& model) const;
+		[[nodiscard]] bool isModelOfFormula(const std::vector<long>& model) const;
+		[[nodiscard]] std::vector<long> getLiteralsOfClause(std::size_t clauseIndex) const;
+		[[nodiscard]] std::size_t getNumClauses() const noexcept;
+
+	protected:
+		std::vector<long> flatClauseLiterals;
+		std::vector<std::size_t> clauseOffsets;
+		std::size_t largestReferencedVariable = 0;
+	};
+}
+#endif
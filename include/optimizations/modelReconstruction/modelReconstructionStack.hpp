@@ -0,0 +1,54 @@
+#ifndef MODEL_RECONSTRUCTION_STACK_HPP
+#define MODEL_RECONSTRUCTION_STACK_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace modelReconstruction
+{
+	/*
+	 * Records the clauses removed from a formula together with the witness (the literals that can be flipped to satisfy the removed clause) of every removed clause. A model of the reduced formula is extended to a model of the original formula by
+	 * processing the entries in the reverse order of their addition and flipping the witness literals of every entry whose clause is falsified by the current assignment (see https://doi.org/10.1007/978-3-642-31365-3_28).
+	 *
+	 * The literals of all entries are stored in a single contiguous buffer, thus the replay is linear in the number of stored literals.
+	 */
+	class ModelReconstructionStack
+	{
+	public:
+		using ptr = std::unique_ptr<ModelReconstructionStack>;
+
+		ModelReconstructionStack() = default;
+
+		// A clause C blocked by the literal l is satisfied by flipping l
+		void addBlockedClause(long blockingLiteral, const std::vector<long>& clauseLiterals);
+		// A clause C blocked by the set L is satisfied by flipping all literals of L since the literals of C \ L are falsified if C is falsified
+		void addSetBlockedClause(const std::vector<long>& blockingSet, const std::vector<long>& clauseLiterals);
+		void addEliminatedClause(const std::vector<long>& witness, const std::vector<long>& clauseLiterals);
+
+		/*
+		 * Extends the model (the literals assigned to the variables 1..n) of the reduced formula to a model of the original formula, variables only referenced by the entries of the stack are assigned the value false unless their value is determined by a witness.
+		 */
+		[[nodiscard]] std::vector<long> reconstructModel(const std::vector<long>& modelOfReducedFormula) const;
+
+		[[nodiscard]] std::vector<long> getWitnessOfEntry(std::size_t entryIndex) const;
+		[[nodiscard]] std::vector<long> getClauseOfEntry(std::size_t entryIndex) const;
+		[[nodiscard]] std::size_t getNumEntries() const noexcept;
+		[[nodiscard]] bool isEmpty() const noexcept;
+		void clear() noexcept;
+
+	protected:
+		struct ReconstructionEntry
+		{
+			std::size_t literalsOffset;
+			std::uint32_t numWitnessLiterals;
+			std::uint32_t numClauseLiterals;
+		};
+
+		std::vector<ReconstructionEntry> entries;
+		// The witness literals of every entry are directly followed by the literals of its clause
+		std::vector<long> entryLiterals;
+		std::size_t largestReferencedVariable = 0;
+	};
+}
+#endif
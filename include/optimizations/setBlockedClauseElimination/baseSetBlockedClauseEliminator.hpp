@@ -1,6 +1,8 @@
 #ifndef BASE_SET_BLOCKED_CLAUSE_ELIMINATOR_HPP
 #define BASE_SET_BLOCKED_CLAUSE_ELIMINATOR_HPP
 
+#include "budget/effortTicks.hpp"
+#include "budget/resourceBudget.hpp"
 #include "dimacs/problemDefinition.hpp"
 #include "optimizations/setBlockedClauseElimination/baseBlockingSetCandidateGenerator.hpp"
 
@@ -14,6 +16,7 @@ namespace setBlockedClauseElimination {
 
 		// TODO: Pure literal elimination in parser or problemDefinition class?
 		explicit BaseSetBlockedClauseEliminator(dimacs::ProblemDefinition::ptr problemDefinition)
+			: resourceBudget(nullptr), numTicks(0)
 		{
 			if (!problemDefinition)
 				throw std::invalid_argument("Problem definition cannot be null");
@@ -21,6 +24,23 @@ namespace setBlockedClauseElimination {
 			this->problemDefinition = std::move(problemDefinition);
 		}
 
+		/*
+		 * The budget is polled prior to the check of every candidate blocking set, the clause is reported as not being set blocked once the budget is exhausted.
+		 */
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+		{
+			this->resourceBudget = resourceBudget;
+		}
+
+		/*
+		 * Returns the ticks (see budget/effortTicks.hpp) spent by all checks of the eliminator, which are also charged to the resource budget after every candidate blocking set. The enumeration of a candidate,
+		 * the determination of its resolution environment as well as the access of every clause of the resolution environment are accounted for.
+		 */
+		[[nodiscard]] std::size_t getNumTicks() const noexcept
+		{
+			return numTicks;
+		}
+
 		[[nodiscard]] virtual std::optional<FoundBlockingSet> determineBlockingSet(std::size_t clauseIdxInFormula, BaseBlockingSetCandidateGenerator& candidateGenerator)
 		{
 			return determineBlockingSet(clauseIdxInFormula, candidateGenerator, std::nullopt);
@@ -32,14 +52,26 @@ namespace setBlockedClauseElimination {
 				return std::nullopt;
 
 			const std::vector<long>& clauseLiterals = dataOfAccessedClause->literals;
+			// The initialization of the generator looks up the occurrences of every literal of the clause
+			std::size_t numTicksAtLastCharge = numTicks;
+			numTicks += budget::determineNumTicksOfSequentialAccess<long>(clauseLiterals.size()) + clauseLiterals.size();
 			candidateGenerator.init(clauseLiterals, problemDefinition->getLiteralOccurrenceLookup(), optionalCandidateSizeRestriction);
 
 			std::optional<BaseBlockingSetCandidateGenerator::BlockingSetCandidate> candidateBlockingSet;
 			bool foundBlockingSet = false;
 			do
 			{
+				if (resourceBudget && resourceBudget->isExhausted())
+				{
+					chargeTicksToResourceBudget(numTicksAtLastCharge);
+					return std::nullopt;
+				}
+
 				candidateBlockingSet = candidateGenerator.generateNextCandidate();
+				if (candidateBlockingSet.has_value())
+					numTicks += budget::determineNumTicksOfNodeBasedAccess(candidateBlockingSet->size());
 				foundBlockingSet |= candidateBlockingSet.has_value() && doesEveryClauseInResolutionEnvironmentFullfillSetBlockedCondition(*dataOfAccessedClause, *candidateBlockingSet);
+				chargeTicksToResourceBudget(numTicksAtLastCharge);
 			} while (!foundBlockingSet && candidateBlockingSet.has_value());
 
 			if (foundBlockingSet && candidateBlockingSet.has_value())
@@ -50,6 +82,15 @@ namespace setBlockedClauseElimination {
 
 	protected:
 		dimacs::ProblemDefinition::ptr problemDefinition;
+		budget::ResourceBudget* resourceBudget;
+		mutable std::size_t numTicks;
+
+		void chargeTicksToResourceBudget(std::size_t& numTicksAtLastCharge) const noexcept
+		{
+			if (resourceBudget)
+				resourceBudget->chargeTicks(numTicks - numTicksAtLastCharge);
+			numTicksAtLastCharge = numTicks;
+		}
 
 		[[nodiscard]] virtual std::unordered_set<std::size_t> determineIndicesOfOverlappingClausesForLiteral(long literal) const = 0;
 		[[nodiscard]] bool doesEveryClauseInResolutionEnvironmentFullfillSetBlockedCondition(const dimacs::ProblemDefinition::Clause& clauseToCheck, const BaseBlockingSetCandidateGenerator::BlockingSetCandidate& potentialBlockingSet) const
@@ -62,12 +103,15 @@ namespace setBlockedClauseElimination {
 			for (auto literalIterator = potentialBlockingSet.begin(); doesConditionHold && literalIterator != potentialBlockingSet.end(); ++literalIterator)
 			{
 				const std::unordered_set<std::size_t>& indicesOfClauesContainingNegatedLiteral = determineIndicesOfOverlappingClausesForLiteral(-*literalIterator);
+				// The indices of the resolution environment are copied into a separate set, every copied index is stored in its own node
+				numTicks += budget::determineNumTicksOfNodeBasedAccess(indicesOfClauesContainingNegatedLiteral.size());
 				didResolutionEnvironmentContaingAtleastOneEntry |= !indicesOfClauesContainingNegatedLiteral.empty();
 
 				for (auto clauseIndexIterator = indicesOfClauesContainingNegatedLiteral.begin(); doesConditionHold && clauseIndexIterator != indicesOfClauesContainingNegatedLiteral.end(); ++clauseIndexIterator)
 				{
 					const std::size_t clauseIdx = *clauseIndexIterator;
 					const dimacs::ProblemDefinition::Clause* dataOfClause = problemDefinition->getClauseByIndexInFormula(clauseIdx);
+					numTicks += dataOfClause ? budget::determineNumTicksOfSequentialAccess<long>(dataOfClause->literals.size()) : 1;
 					doesConditionHold &= dataOfClause && (!alreadyCheckedClauseIndicesInResolutionEnvironment.count(clauseIdx) ? isClauseSetBlocked(clauseToCheck, *dataOfClause, potentialBlockingSet) : true);
 					alreadyCheckedClauseIndicesInResolutionEnvironment.emplace(clauseIdx);
 				}
@@ -0,0 +1,111 @@
+#ifndef BACKWARD_SUBSUMPTION_ELIMINATOR_HPP
+#define BACKWARD_SUBSUMPTION_ELIMINATOR_HPP
+
+#include "budget/resourceBudget.hpp"
+#include "dimacs/problemDefinition.hpp"
+#include "proof/proofWriter.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace subsumption
+{
+	/*
+	 * Removes clauses subsumed by another clause of the formula and strengthens clauses by self-subsuming resolution, i.e. the clause (-l R S) is replaced by (R S) if the formula contains the clause (l R).
+	 * Every clause is only connected to the occurrence list (one-watch list) of its literal whose variable occurs least often in the formula, thus the potential subsumers of a clause D are found by visiting
+	 * the one-watch lists of the literals of D and their negations. Candidates whose variable signature is not a subset of the signature of D are skipped without visiting their literals.
+	 *
+	 * All candidates of a round are checked against the clauses of the formula at the start of the round, thus the candidates can be split into disjoint ranges that are checked in parallel. The outcomes
+	 * are merged in the order of the candidates, a clause only subsumes clauses that are ordered after it (by size and identifier) to prevent equal clauses from subsuming each other.
+	 *
+	 * Since the resulting formula is equivalent to the original one, no entries need to be recorded on the model reconstruction stack.
+	 */
+	class BackwardSubsumptionEliminator
+	{
+	public:
+		using ptr = std::unique_ptr<BackwardSubsumptionEliminator>;
+
+		struct SubsumptionConfiguration
+		{
+			std::size_t numThreads = 1;
+			// Strengthened clauses can subsume further clauses, thus another round is started as long as the previous one strengthened any clause
+			std::size_t maximumNumRounds = 3;
+		};
+
+		struct SubsumptionStatistics
+		{
+			std::size_t numRounds;
+			std::size_t numSubsumedClauses;
+			std::size_t numStrengthenedClauses;
+			// Candidates whose signature check failed and whose literals thus were not visited
+			std::size_t numSignatureRejections;
+			std::size_t numTicks;
+		};
+
+		BackwardSubsumptionEliminator() = delete;
+		BackwardSubsumptionEliminator(dimacs::ProblemDefinition::ptr problemDefinition, const SubsumptionConfiguration& configuration);
+
+		// The budget is polled prior to every round and every candidate clause
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept;
+		// The strengthened clauses are added to the proof prior to the deletion of any clause of the round
+		void setProofWriter(proof::ProofWriter* proofWriter) noexcept;
+
+		/*
+		 * The strengthened clauses replace the original clauses using the same identifier. Returns false if a clause was strengthened to the empty clause, i.e. the formula is unsatisfiable.
+		 */
+		[[nodiscard]] bool subsumeAndStrengthenClauses();
+		[[nodiscard]] const SubsumptionStatistics& getStatistics() const noexcept;
+
+	protected:
+		using CandidateIndex = std::uint32_t;
+
+		struct CandidateOutcome
+		{
+			bool isSubsumed;
+			// The literal removed by self-subsuming resolution (zero if the clause was not strengthened)
+			long removedLiteral;
+		};
+
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		SubsumptionConfiguration configuration;
+		budget::ResourceBudget* resourceBudget;
+		proof::ProofWriter* proofWriter;
+		std::size_t numVariables;
+		SubsumptionStatistics statistics;
+
+		// The literals of the candidates (ordered by their size and identifier) are stored in a flat arena, the literals of the i-th candidate are stored between the i-th and the (i+1)-th offset
+		std::vector<std::size_t> candidateIdentifiers;
+		std::vector<long> candidateLiteralArena;
+		std::vector<std::size_t> candidateOffsets;
+		std::vector<std::uint64_t> candidateSignatures;
+		std::vector<std::vector<CandidateIndex>> oneWatchLists;
+
+		[[nodiscard]] bool performRound(bool& wasAnyClauseStrengthened);
+		void initializeCandidates();
+		void checkCandidatesInRange(CandidateIndex firstCandidate, CandidateIndex lastCandidate, std::vector<char>& isLiteralMarked, std::vector<CandidateOutcome>& candidateOutcomes, std::size_t& numSignatureRejections, std::size_t& numTicks) const;
+		[[nodiscard]] CandidateOutcome checkCandidate(CandidateIndex candidate, std::vector<char>& isLiteralMarked, std::size_t& numSignatureRejections, std::size_t& numTicks) const;
+
+		[[nodiscard]] std::size_t getNumLiteralsOfCandidate(CandidateIndex candidate) const noexcept
+		{
+			return candidateOffsets[candidate + 1] - candidateOffsets[candidate];
+		}
+
+		[[nodiscard]] static std::size_t literalToVariable(long literal) noexcept
+		{
+			return static_cast<std::size_t>(std::labs(literal));
+		}
+
+		[[nodiscard]] static std::size_t literalToIndex(long literal) noexcept
+		{
+			return (literalToVariable(literal) << 1) | static_cast<std::size_t>(literal < 0);
+		}
+
+		[[nodiscard]] static std::uint64_t determineSignatureOfVariable(std::size_t variable) noexcept
+		{
+			return static_cast<std::uint64_t>(1) << (variable & 63);
+		}
+	};
+}
+#endif
@@ -0,0 +1,111 @@
+#ifndef TRANSITIVE_BINARY_CLAUSE_ELIMINATOR_HPP
+#define TRANSITIVE_BINARY_CLAUSE_ELIMINATOR_HPP
+
+#include "budget/resourceBudget.hpp"
+#include "dimacs/problemDefinition.hpp"
+#include "proof/proofWriter.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace unhiding
+{
+	/*
+	 * Unhiding based on randomized depth-first search time stamps of the binary implication graph (https://doi.org/10.1007/978-3-642-22438-6_17): Every literal is assigned the time at which it was discovered and finished by the search,
+	 * a literal w reaches the literal v via edges of the search tree if the stamp interval of v is contained in the interval of w. Thus reachability queries are answered in constant time.
+	 *
+	 * - A binary clause (-u v) is transitive if u has another successor w whose interval contains the interval of v, such clauses are removed as long as neither of their two implications is an edge of the search tree.
+	 *   Since edges of the search tree are never removed, the formula without the removed clauses still implies them by unit propagation.
+	 * - A literal x reached while its negation was discovered after an ancestor a of x (that is still on the search stack) implies both x and -x via a, thus a is a failed literal and its negation is added as a unit clause.
+	 *
+	 * The roots of the search are the literals without predecessors, followed by the remaining unvisited literals, the order of the roots and of the successors of every literal is randomized in every round.
+	 * Since the resulting formula is equivalent to the original one, no entries need to be recorded on the model reconstruction stack.
+	 */
+	class TransitiveBinaryClauseEliminator
+	{
+	public:
+		using ptr = std::unique_ptr<TransitiveBinaryClauseEliminator>;
+
+		struct UnhidingConfiguration
+		{
+			std::size_t randomSeed = 0;
+			// Every round uses a different order of the search, another round is only started if the previous one removed a clause or derived a failed literal
+			std::size_t maximumNumRounds = 3;
+		};
+
+		struct UnhidingStatistics
+		{
+			std::size_t numRounds;
+			std::size_t numRemovedTransitiveClauses;
+			std::size_t numFailedLiterals;
+			std::size_t numTicks;
+		};
+
+		TransitiveBinaryClauseEliminator() = delete;
+		TransitiveBinaryClauseEliminator(dimacs::ProblemDefinition::ptr problemDefinition, const UnhidingConfiguration& configuration);
+
+		// The budget is polled prior to every round and every root of the search, the transitive clauses of a round are only removed if its search was completed
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept;
+		// The negations of the failed literals are added to the proof prior to the deletion of the transitive clauses
+		void setProofWriter(proof::ProofWriter* proofWriter) noexcept;
+
+		/*
+		 * The negations of the failed literals are added to the formula as unit clauses with identifiers larger than the identifiers of all existing clauses. Returns false if both literals of a variable failed, i.e. the formula is unsatisfiable.
+		 */
+		[[nodiscard]] bool eliminateTransitiveBinaryClausesAndFailedLiterals();
+		[[nodiscard]] const std::vector<long>& getFailedLiterals() const noexcept;
+		[[nodiscard]] const UnhidingStatistics& getStatistics() const noexcept;
+
+	protected:
+		struct Implication
+		{
+			long consequentLiteral;
+			std::size_t clauseIdentifier;
+		};
+
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		UnhidingConfiguration configuration;
+		budget::ResourceBudget* resourceBudget;
+		proof::ProofWriter* proofWriter;
+		std::size_t numVariables;
+		std::size_t nextClauseIdentifier;
+		std::mt19937 randomNumberGenerator;
+		UnhidingStatistics statistics;
+
+		// The implications of the literal with index i are stored between the i-th and the (i+1)-th offset
+		std::vector<std::size_t> implicationGraphOffsets;
+		std::vector<Implication> implications;
+		std::vector<std::size_t> discoveryStamps;
+		std::vector<std::size_t> finishStamps;
+		std::vector<std::size_t> parentLiteralIndices;
+		std::vector<char> isLiteralFailed;
+		std::vector<long> failedLiterals;
+
+		void buildBinaryImplicationGraph();
+		[[nodiscard]] bool stampLiterals(std::vector<long>& failedLiteralsOfRound);
+		[[nodiscard]] std::size_t removeTransitiveClauses();
+		[[nodiscard]] bool isEdgeOfSearchTree(long antecedentLiteral, long consequentLiteral) const;
+
+		[[nodiscard]] static std::size_t literalToVariable(long literal) noexcept
+		{
+			return static_cast<std::size_t>(std::labs(literal));
+		}
+
+		[[nodiscard]] static std::size_t literalToIndex(long literal) noexcept
+		{
+			return (literalToVariable(literal) << 1) | static_cast<std::size_t>(literal < 0);
+		}
+
+		[[nodiscard]] static long indexToLiteral(std::size_t literalIndex) noexcept
+		{
+			const auto variable = static_cast<long>(literalIndex >> 1);
+			return literalIndex & 1 ? -variable : variable;
+		}
+
+		static constexpr std::size_t UNSTAMPED = SIZE_MAX;
+	};
+}
+#endif
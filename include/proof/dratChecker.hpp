@@ -0,0 +1,157 @@
+#ifndef DRAT_CHECKER_HPP
+#define DRAT_CHECKER_HPP
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace proof
+{
+	/*
+	 * Verifies binary DRAT proofs (as written by the ProofWriter) of the formula defined by the added original clauses. Every added lemma needs to be either a reverse unit propagation (RUP) or a resolution asymmetric tautology (RAT) on its first literal
+	 * with respect to the active clauses while deletions of clauses are not checked. Deletions of unit clauses are ignored (as done by DRAT-trim, see https://doi.org/10.1007/978-3-319-09284-3_31) and the unit propagation is performed on
+	 * two watched literals per clause.
+	 *
+	 * The forward mode checks every lemma in the order of the proof while the backward mode first applies the proof up to the first added empty clause and then only checks the lemmas that were required to derive the empty clause
+	 * (the core lemmas) in reverse order, the antecedents of every check are determined by a conflict analysis on the trail of the unit propagation.
+	 */
+	class DratChecker
+	{
+	public:
+		using ptr = std::unique_ptr<DratChecker>;
+
+		enum CheckingMode : char
+		{
+			Forward,
+			Backward
+		};
+
+		struct CheckResult
+		{
+			bool isProofValid;
+			bool wasEmptyClauseDerived;
+			std::size_t numLemmas;
+			std::size_t numCheckedLemmas;
+			std::size_t numResolutionAsymmetricTautologies;
+			std::size_t numDeletions;
+			std::size_t numIgnoredDeletions;
+			// Only determined in the backward mode since the forward mode does not determine the antecedents of its checks
+			std::size_t numCoreOriginalClauses;
+			std::optional<std::size_t> optionalIndexOfFirstInvalidProofLine;
+		};
+
+		explicit DratChecker(std::size_t numVariables);
+
+		void addOriginalClause(const std::vector<long>& clauseLiterals);
+
+		/*
+		 * Applies the proof to the clauses of the checker, thus only one proof can be verified by a checker instance. Malformed proofs (i.e. unknown line markers or truncated lines) throw.
+		 */
+		[[nodiscard]] CheckResult verifyProof(std::istream& binaryProofStream, CheckingMode checkingMode);
+
+		[[nodiscard]] bool isClauseImpliedByUnitPropagation(const std::vector<long>& clauseLiterals);
+
+		/*
+		 * Checks whether the clause C is propagation redundant (PR, see https://doi.org/10.1007/s10817-019-09516-0) with respect to the witness assignment and the active clauses other than C, i.e. whether the witness satisfies C and every clause D
+		 * touched but not satisfied by the witness is implied by unit propagation from the assignment falsifying C once the literals of D falsified by the witness are removed. The witness of a clause blocked by the set L is L together with
+		 * the negated literals of C \ L.
+		 */
+		[[nodiscard]] bool isClauseRedundantWithRespectToWitness(const std::vector<long>& clauseLiterals, const std::vector<long>& witness);
+
+		[[nodiscard]] std::size_t getNumActiveClauses() const noexcept;
+
+	protected:
+		using ClauseIndex = std::size_t;
+		constexpr static ClauseIndex NO_CLAUSE = SIZE_MAX;
+
+		enum LiteralValue : char
+		{
+			Unassigned,
+			Satisfied,
+			Falsified
+		};
+
+		struct CheckedClause
+		{
+			std::size_t literalsOffset;
+			std::uint32_t numLiterals;
+			std::size_t hash;
+			bool isActive;
+			bool isCore;
+			bool isLemma;
+		};
+
+		struct ProofLine
+		{
+			bool isAddition;
+			std::vector<long> literals;
+		};
+
+		std::size_t numVariables;
+		std::vector<long> clauseLiteralArena;
+		std::vector<CheckedClause> clauses;
+		std::vector<std::vector<ClauseIndex>> watchers;
+		std::vector<std::vector<ClauseIndex>> literalOccurrences;
+		std::vector<ClauseIndex> unitClauses;
+		std::unordered_map<std::size_t, std::vector<ClauseIndex>> activeClausesPerHash;
+		std::size_t numActiveEmptyClauses;
+
+		std::vector<LiteralValue> literalValues;
+		std::vector<ClauseIndex> reasons;
+		std::vector<char> isVariableSeen;
+		std::vector<long> trail;
+		std::vector<char> isLiteralOfCheckedClause;
+		std::vector<char> isLiteralOfWitness;
+		std::vector<std::size_t> clauseVisitStamps;
+		std::size_t currentClauseVisitStamp;
+
+		void increaseNumVariables(std::size_t numVariables);
+		[[nodiscard]] ClauseIndex addClause(std::vector<long> clauseLiterals, bool isLemma);
+		void activateClause(ClauseIndex clauseIndex);
+		void deactivateClause(ClauseIndex clauseIndex);
+		[[nodiscard]] ClauseIndex findActiveClause(std::vector<long> clauseLiterals) const;
+		void detachWatcher(long watchedLiteral, ClauseIndex clauseIndex);
+
+		[[nodiscard]] bool isResolutionAsymmetricTautology(const std::vector<long>& clauseLiterals, bool shouldAntecedentsBeMarked);
+		[[nodiscard]] bool isRedundantWithRespectToWitness(const std::vector<long>& clauseLiterals, const std::vector<long>& witness, bool shouldAntecedentsBeMarked);
+		[[nodiscard]] bool isReverseUnitPropagation(const std::vector<long>& clauseLiterals, bool shouldAntecedentsBeMarked);
+		[[nodiscard]] ClauseIndex propagate(std::size_t& propagationQueueHead);
+		void assignLiteral(long literal, ClauseIndex reason);
+		void markAntecedentsOfConflict(ClauseIndex conflictingClause);
+		void resetAssignment();
+
+		[[nodiscard]] CheckResult verifyProofInForwardMode(const std::vector<ProofLine>& proofLines);
+		[[nodiscard]] CheckResult verifyProofInBackwardMode(const std::vector<ProofLine>& proofLines, std::size_t indexOfEmptyClause);
+		[[nodiscard]] static std::vector<ProofLine> readBinaryProof(std::istream& binaryProofStream);
+		[[nodiscard]] static std::size_t computeHash(const std::vector<long>& sortedClauseLiterals) noexcept;
+
+		[[nodiscard]] static std::size_t literalToVariable(long literal) noexcept
+		{
+			return static_cast<std::size_t>(literal < 0 ? -literal : literal);
+		}
+
+		[[nodiscard]] static std::size_t literalToIndex(long literal) noexcept
+		{
+			return (literalToVariable(literal) << 1) | (literal < 0);
+		}
+
+		[[nodiscard]] LiteralValue getLiteralValue(long literal) const noexcept
+		{
+			return literalValues[literalToIndex(literal)];
+		}
+
+		[[nodiscard]] long* getLiteralsOfClause(ClauseIndex clauseIndex) noexcept
+		{
+			return clauseLiteralArena.data() + clauses[clauseIndex].literalsOffset;
+		}
+
+		[[nodiscard]] const long* getLiteralsOfClause(ClauseIndex clauseIndex) const noexcept
+		{
+			return clauseLiteralArena.data() + clauses[clauseIndex].literalsOffset;
+		}
+	};
+}
+#endif
@@ -0,0 +1,98 @@
+#ifndef PROOF_WRITER_HPP
+#define PROOF_WRITER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace proof
+{
+	/*
+	 * Writes a clausal proof in the binary DRAT or LRAT format (see https://github.com/marijnheule/drat-trim and https://doi.org/10.1007/978-3-319-63046-5_14). Every line of the proof starts with either the byte 'a' (addition) or 'd' (deletion)
+	 * followed by the variable-length (7 bits per byte) encoding of the mapped literals (2 * variable + (literal < 0)) and is terminated by the byte 0.
+	 *
+	 * The lines are encoded into a large buffer that is handed over to a background thread writing the buffer to the output stream while the producer continues to fill a second buffer, the producer thus only
+	 * waits for the writer if it filled the second buffer before the first one was written.
+	 */
+	class ProofWriter
+	{
+	public:
+		using ptr = std::unique_ptr<ProofWriter>;
+		using ClauseId = std::uint64_t;
+
+		enum ProofFormat : char
+		{
+			Drat,
+			/*
+			 * Additions additionally define the identifier of the added clause as well as the hints (identifiers of the clauses used during unit propagation) required to verify the addition
+			 * while deletions only reference the identifiers of the deleted clauses.
+			 */
+			Lrat
+		};
+
+		static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+		ProofWriter(std::ostream& outputStream, ProofFormat proofFormat, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+		~ProofWriter();
+
+		ProofWriter(const ProofWriter&) = delete;
+		ProofWriter& operator=(const ProofWriter&) = delete;
+
+		void addClause(const long* clauseLiterals, std::size_t numLiterals);
+		void addClause(const std::vector<long>& clauseLiterals);
+		void addEmptyClause();
+		void deleteClause(const long* clauseLiterals, std::size_t numLiterals);
+		void deleteClause(const std::vector<long>& clauseLiterals);
+
+		void addClause(ClauseId clauseId, const std::vector<long>& clauseLiterals, const std::vector<long>& hints);
+		void deleteClauses(const std::vector<ClauseId>& clauseIds);
+
+		/*
+		 * Writes the remaining content of the buffers to the output stream and stops the background writer thread, no further lines can be added to the proof afterwards.
+		 * Returns whether the whole proof was successfully written to the output stream.
+		 */
+		[[nodiscard]] bool close();
+
+		[[nodiscard]] ProofFormat getProofFormat() const noexcept;
+		[[nodiscard]] std::size_t getNumAddedClauses() const noexcept;
+		[[nodiscard]] std::size_t getNumDeletedClauses() const noexcept;
+		[[nodiscard]] std::size_t getNumWrittenBytes() const noexcept;
+
+	protected:
+		std::ostream& outputStream;
+		ProofFormat proofFormat;
+		std::size_t bufferSize;
+
+		std::vector<char> fillBuffer;
+		std::vector<char> flushBuffer;
+		bool isFlushBufferPending;
+		bool isClosed;
+		std::atomic_bool hasWriteFailed;
+		std::mutex bufferHandoverMutex;
+		std::condition_variable bufferHandoverConditionVariable;
+		std::thread writerThread;
+
+		std::size_t numAddedClauses;
+		std::size_t numDeletedClauses;
+		std::size_t numWrittenBytes;
+
+		void writeLiterals(const long* clauseLiterals, std::size_t numLiterals);
+		void writeMappedNumber(std::uint64_t mappedNumber);
+		void writeSignedNumber(long number);
+		void handOverFillBuffer();
+		void writeHandedOverBuffers();
+
+		void writeByte(char byte)
+		{
+			if (fillBuffer.size() == bufferSize)
+				handOverFillBuffer();
+			fillBuffer.push_back(byte);
+		}
+	};
+}
+#endif
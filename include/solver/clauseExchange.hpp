@@ -0,0 +1,80 @@
+#ifndef CLAUSE_EXCHANGE_HPP
+#define CLAUSE_EXCHANGE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace solver
+{
+	/*
+	 * Exchange of learned clauses between the workers of a portfolio: Every worker owns an export ring to which only the worker itself appends clauses (single producer) while all other workers
+	 * read the ring concurrently (multiple consumers) without any locks. Every slot of a ring is guarded by a sequence number (seqlock), a consumer that is overtaken by the producer skips the
+	 * overwritten clauses instead of blocking the producer. Every worker additionally keeps a table of the hashes of the clauses it exported or imported to suppress duplicates.
+	 */
+	class ClauseExchange
+	{
+	public:
+		using ptr = std::unique_ptr<ClauseExchange>;
+
+		static constexpr std::size_t MAXIMUM_CLAUSE_SIZE = 32;
+		static constexpr std::size_t DEFAULT_RING_CAPACITY = 4096;
+		static constexpr std::size_t NUM_CLAUSE_HASH_TABLE_ENTRIES = static_cast<std::size_t>(1) << 16;
+
+		struct ExchangedClause
+		{
+			std::vector<long> literals;
+			std::uint32_t literalBlockDistance;
+		};
+
+		ClauseExchange() = delete;
+		explicit ClauseExchange(std::size_t numWorkers, std::size_t ringCapacity = DEFAULT_RING_CAPACITY);
+
+		/*
+		 * Appends the clause to the export ring of the given worker and returns whether the clause was exported, clauses larger than the maximum clause size and clauses
+		 * previously exported or imported by the worker are not exported. Must only be called by the thread of the given worker.
+		 */
+		[[nodiscard]] bool exportClause(std::size_t workerIndex, const long* clauseLiterals, std::size_t numLiterals, std::uint32_t literalBlockDistance);
+
+		/*
+		 * Collects the clauses exported by all other workers since the last import of the given worker while suppressing clauses already known to the worker.
+		 * Must only be called by the thread of the given worker, returns the number of clauses that were skipped since they were overwritten before they could be read.
+		 */
+		std::size_t importClauses(std::size_t workerIndex, std::vector<ExchangedClause>& importedClauses);
+
+		[[nodiscard]] std::size_t getNumWorkers() const noexcept;
+
+	protected:
+		struct Slot
+		{
+			// Odd while the producer writes the slot, 2 * (t + 1) once the t-th clause of the ring was completely written
+			std::atomic<std::uint64_t> sequenceNumber;
+			std::atomic<std::uint32_t> numLiterals;
+			std::atomic<std::uint32_t> literalBlockDistance;
+			std::array<std::atomic<long>, MAXIMUM_CLAUSE_SIZE> literals;
+		};
+
+		struct ExportRing
+		{
+			std::unique_ptr<Slot[]> slots;
+			alignas(64) std::atomic<std::uint64_t> numPublishedClauses;
+		};
+
+		struct WorkerLocalData
+		{
+			// Number of clauses read from the export ring of every worker
+			std::vector<std::uint64_t> numReadClausesPerRing;
+			std::vector<std::uint64_t> knownClauseHashes;
+		};
+
+		std::size_t ringCapacity;
+		std::vector<ExportRing> exportRings;
+		std::vector<WorkerLocalData> workerLocalData;
+
+		[[nodiscard]] bool recordClauseHash(std::size_t workerIndex, std::uint64_t clauseHash);
+		[[nodiscard]] static std::uint64_t computeClauseHash(const long* clauseLiterals, std::size_t numLiterals) noexcept;
+	};
+}
+#endif
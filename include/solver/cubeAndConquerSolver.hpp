@@ -0,0 +1,105 @@
+#ifndef CUBE_AND_CONQUER_SOLVER_HPP
+#define CUBE_AND_CONQUER_SOLVER_HPP
+
+#include <dimacs/problemDefinition.hpp>
+#include "solver/clauseExchange.hpp"
+#include "solver/lookaheadCuber.hpp"
+#include "solver/sharedFormula.hpp"
+#include "solver/solver.hpp"
+#include "solver/workStealingDeque.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace solver
+{
+	/*
+	 * Splits the formula with a lookahead cuber into cubes that are solved as assumptions by a pool of incremental CDCL workers (https://doi.org/10.1007/978-3-642-34188-5_8), every worker keeps its
+	 * learned clauses between cubes. The initial cubes are distributed evenly over the work-stealing queues of the workers, a worker without cubes steals the oldest cube of another worker.
+	 * A cube that is not solved within the configured number of conflicts is considered to be stalled and split again by the cuber of its worker.
+	 *
+	 * The formula is satisfiable as soon as a single cube is satisfiable and unsatisfiable once all cubes were refuted.
+	 */
+	class CubeAndConquerSolver
+	{
+	public:
+		using ptr = std::unique_ptr<CubeAndConquerSolver>;
+
+		struct CubeAndConquerConfiguration
+		{
+			// The formula is initially split into at most 2^depth cubes
+			std::size_t initialCubeDepth = 6;
+			// Stalled cubes are split into at most 2^depth cubes
+			std::size_t resplitCubeDepth = 1;
+			std::size_t numConflictsUntilCubeIsStalled = 2000;
+			std::size_t maximumNumLookaheadCandidates = LookaheadCuber::DEFAULT_MAXIMUM_NUM_LOOKAHEAD_CANDIDATES;
+			bool isClauseSharingEnabled = true;
+		};
+
+		struct CubeAndConquerStatistics
+		{
+			std::size_t numInitialCubes;
+			std::size_t numRefutedCubes;
+			std::size_t numStalledCubes;
+			// Cubes generated by splitting stalled cubes
+			std::size_t numResplitCubes;
+			std::size_t numStolenCubes;
+		};
+
+		CubeAndConquerSolver() = delete;
+		CubeAndConquerSolver(const dimacs::ProblemDefinition& problemDefinition, std::size_t numWorkers, Solver::SolverConfiguration solverConfiguration, CubeAndConquerConfiguration cubeAndConquerConfiguration)
+			: CubeAndConquerSolver(SharedFormula::fromProblemDefinition(problemDefinition), numWorkers, std::move(solverConfiguration), cubeAndConquerConfiguration) {}
+
+		CubeAndConquerSolver(SharedFormula::ptr sharedFormula, std::size_t numWorkers, Solver::SolverConfiguration solverConfiguration, CubeAndConquerConfiguration cubeAndConquerConfiguration);
+
+		[[nodiscard]] Solver::SolverResult solve();
+		[[nodiscard]] std::vector<long> getModel() const;
+		[[nodiscard]] std::size_t getNumWorkers() const noexcept;
+		[[nodiscard]] std::optional<std::size_t> getIndexOfWinningWorker() const noexcept;
+		[[nodiscard]] const Solver::SolverStatistics& getStatisticsOfWorker(std::size_t workerIndex) const;
+		[[nodiscard]] CubeAndConquerStatistics getStatistics() const noexcept;
+
+		// The budget is shared by all workers, every worker stops once the budget is exhausted and the remaining cubes are left unsolved. The budget needs to outlive the solver
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept;
+
+	protected:
+		using Cube = std::vector<long>;
+
+		SharedFormula::ptr sharedFormula;
+		Solver::SolverConfiguration solverConfiguration;
+		CubeAndConquerConfiguration cubeAndConquerConfiguration;
+		std::vector<Solver::ptr> workers;
+		std::vector<LookaheadCuber::ptr> cubersOfWorkers;
+		std::vector<WorkStealingDeque<Cube>::ptr> cubeQueuesOfWorkers;
+		ClauseExchange::ptr clauseExchange;
+		// Number of cubes that are either queued or currently solved by a worker
+		std::atomic_size_t numPendingCubes;
+		std::atomic_bool isSearchCancelled;
+		/*
+		 * Workers without a cube block until cubes are enqueued, the number of pending cubes drops or the search is cancelled. Every such event increments the number of wake-ups while holding the mutex,
+		 * an idle worker thus only waits if no event happened since it last tried to acquire a cube.
+		 */
+		std::mutex idleWorkersMutex;
+		std::condition_variable idleWorkersConditionVariable;
+		std::atomic_size_t numWakeUpsOfIdleWorkers;
+		budget::ResourceBudget* resourceBudget;
+		std::optional<std::size_t> indexOfWinningWorker;
+		Solver::SolverResult result;
+
+		std::size_t numInitialCubes;
+		std::atomic_size_t numRefutedCubes;
+		std::atomic_size_t numStalledCubes;
+		std::atomic_size_t numResplitCubes;
+		std::atomic_size_t numStolenCubes;
+
+		void runWorker(std::size_t workerIndex);
+		[[nodiscard]] std::optional<Cube> acquireCube(std::size_t workerIndex);
+		void enqueueCubes(std::size_t workerIndex, std::vector<Cube> cubes, bool areCubesDistributedOverAllWorkers);
+		void wakeUpIdleWorkers();
+	};
+}
+#endif
@@ -0,0 +1,48 @@
+#ifndef BASE_DECISION_HEURISTIC_HPP
+#define BASE_DECISION_HEURISTIC_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+
+namespace decisionHeuristics
+{
+	/*
+	 * Interface between the CDCL search and the strategy selecting the next branching variable. The solver notifies the heuristic about assigned variables, about the variables that were
+	 * part of the conflict analysis (bumped), about completed conflicts and about variables that became unassigned during backtracking.
+	 *
+	 * While another heuristic is active (i.e. in the other search mode of the solver), a heuristic does not receive any notifications. The solver backtracks to the root decision level before
+	 * a heuristic is activated again, thus every variable not assigned on the root decision level needs to be considered as a branching candidate after the activation.
+	 *
+	 * Peeking at the next branching variable and comparing the priorities of two variables allows the solver to reuse the part of the trail that would be reconstructed after a restart.
+	 *
+	 * Clauses added to an incremental solver can introduce new variables, which are appended to the variables of the heuristic on the root decision level. Heuristics that do not
+	 * override this notification are reinitialized and thus lose their state.
+	 */
+	class BaseDecisionHeuristic {
+	public:
+		using ptr = std::unique_ptr<BaseDecisionHeuristic>;
+		using VariableAssignmentCheck = std::function<bool(std::size_t)>;
+
+		virtual ~BaseDecisionHeuristic() = default;
+
+		virtual void init(std::size_t numVariables) = 0;
+
+		virtual void onNumVariablesIncreased(std::size_t numVariables)
+		{
+			init(numVariables);
+		}
+
+		virtual void onActivation() = 0;
+		virtual void onVariableAssigned(std::size_t variable) = 0;
+		virtual void onVariableBumpedDuringConflictAnalysis(std::size_t variable) = 0;
+		virtual void onConflict() = 0;
+		virtual void onVariableUnassigned(std::size_t variable) = 0;
+		[[nodiscard]] virtual std::optional<std::size_t> pickBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) = 0;
+		[[nodiscard]] virtual std::optional<std::size_t> peekBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) = 0;
+		[[nodiscard]] virtual bool hasHigherPriority(std::size_t variable, std::size_t otherVariable) const = 0;
+	};
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef EVSIDS_DECISION_HEURISTIC_HPP
+#define EVSIDS_DECISION_HEURISTIC_HPP
+
+#include "solver/decisionHeuristics/baseDecisionHeuristic.hpp"
+#include "solver/decisionHeuristics/variableActivityHeap.hpp"
+
+#include <vector>
+
+// http://minisat.se/downloads/MiniSat.pdf
+// https://www.cs.cmu.edu/~mheule/publications/evsids.pdf
+namespace decisionHeuristics
+{
+	/*
+	 * Exponential variable state independent decaying sum (EVSIDS) heuristic: Instead of decaying the activity of every variable after a conflict, the increment used to bump
+	 * variables grows exponentially, which results in the same relative order of the activities. Once an activity exceeds the rescaling threshold, all activities as well as the
+	 * increment are scaled down to prevent an overflow.
+	 *
+	 * Assigned variables are not removed from the heap eagerly, instead they are skipped when picking the next branching variable and are reinserted into the heap once they become unassigned.
+	 */
+	class EvsidsDecisionHeuristic : public BaseDecisionHeuristic {
+	public:
+		constexpr static double DEFAULT_ACTIVITY_DECAY_FACTOR = 0.95;
+
+		EvsidsDecisionHeuristic()
+			: EvsidsDecisionHeuristic(DEFAULT_ACTIVITY_DECAY_FACTOR) {}
+
+		explicit EvsidsDecisionHeuristic(double activityDecayFactor);
+
+		void init(std::size_t numVariables) override;
+		void onNumVariablesIncreased(std::size_t numVariables) override;
+		void onActivation() override;
+		void onVariableAssigned(std::size_t) override {}
+		void onVariableBumpedDuringConflictAnalysis(std::size_t variable) override;
+		void onConflict() override;
+		void onVariableUnassigned(std::size_t variable) override;
+		[[nodiscard]] std::optional<std::size_t> pickBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) override;
+		[[nodiscard]] std::optional<std::size_t> peekBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) override;
+		[[nodiscard]] bool hasHigherPriority(std::size_t variable, std::size_t otherVariable) const override;
+
+		[[nodiscard]] double getActivityOfVariable(std::size_t variable) const;
+
+	protected:
+		constexpr static double ACTIVITY_RESCALING_THRESHOLD = 1e100;
+		constexpr static double ACTIVITY_RESCALING_FACTOR = 1e-100;
+
+		double activityDecayFactor;
+		double activityIncrement;
+		std::vector<double> activities;
+		VariableActivityHeap variableActivityHeap;
+
+		void rescaleActivities();
+	};
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef LEARNING_RATE_BRANCHING_DECISION_HEURISTIC_HPP
+#define LEARNING_RATE_BRANCHING_DECISION_HEURISTIC_HPP
+
+#include "solver/decisionHeuristics/baseDecisionHeuristic.hpp"
+#include "solver/decisionHeuristics/variableActivityHeap.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// https://cs.uwaterloo.ca/~ppoupart/publications/sat/learning-rate-branching-heuristic-SAT.pdf
+// https://cs.uwaterloo.ca/~ppoupart/publications/sat/exponential-recency-weighted-average-branching-heuristic-SAT.pdf
+namespace decisionHeuristics
+{
+	/*
+	 * Learning rate based branching (LRB) heuristic: Branching is modelled as a multi-armed bandit problem in which the reward of a variable is its learning rate, i.e. the number of conflicts
+	 * in which the variable participated divided by the number of conflicts generated while it was assigned. The reward is incorporated into the score (Q) of a variable as an exponential
+	 * recency weighted average once the variable is unassigned, with a step size (alpha) decreasing over the course of the search.
+	 *
+	 * The locality extension decays the score of variables that were not assigned for a number of conflicts. It is applied lazily to the variable with the highest score when picking
+	 * the next branching variable.
+	 */
+	class LearningRateBranchingDecisionHeuristic : public BaseDecisionHeuristic {
+	public:
+		struct Configuration
+		{
+			double initialStepSize = 0.4;
+			double minimumStepSize = 0.06;
+			double stepSizeDecrementPerConflict = 1e-6;
+			double localityDecayFactor = 0.95;
+		};
+
+		LearningRateBranchingDecisionHeuristic()
+			: LearningRateBranchingDecisionHeuristic(Configuration()) {}
+
+		explicit LearningRateBranchingDecisionHeuristic(Configuration configuration);
+
+		void init(std::size_t numVariables) override;
+		void onNumVariablesIncreased(std::size_t numVariables) override;
+		void onActivation() override;
+		void onVariableAssigned(std::size_t variable) override;
+		void onVariableBumpedDuringConflictAnalysis(std::size_t variable) override;
+		void onConflict() override;
+		void onVariableUnassigned(std::size_t variable) override;
+		[[nodiscard]] std::optional<std::size_t> pickBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) override;
+		[[nodiscard]] std::optional<std::size_t> peekBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) override;
+		[[nodiscard]] bool hasHigherPriority(std::size_t variable, std::size_t otherVariable) const override;
+
+		[[nodiscard]] double getScoreOfVariable(std::size_t variable) const;
+		[[nodiscard]] double getStepSize() const noexcept;
+
+	protected:
+		struct VariableData
+		{
+			double score;
+			std::uint64_t conflictCountAtAssignment;
+			std::uint64_t conflictCountAtLastScoreUpdate;
+			std::uint64_t numParticipatedConflicts;
+		};
+
+		Configuration configuration;
+		double stepSize;
+		std::uint64_t numConflicts;
+		std::vector<VariableData> variableData;
+		VariableActivityHeap variableScoreHeap;
+
+		void applyLocalityDecayToVariablesWithHighestScore();
+	};
+}
+
+#endif
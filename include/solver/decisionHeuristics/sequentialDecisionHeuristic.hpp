@@ -0,0 +1,68 @@
+#ifndef SEQUENTIAL_DECISION_HEURISTIC_HPP
+#define SEQUENTIAL_DECISION_HEURISTIC_HPP
+
+#include "solver/decisionHeuristics/baseDecisionHeuristic.hpp"
+
+#include <algorithm>
+
+namespace decisionHeuristics
+{
+	// Selects the unassigned variable with the smallest identifier, mainly used as the baseline when benchmarking other decision heuristics
+	class SequentialDecisionHeuristic : public BaseDecisionHeuristic {
+	public:
+		SequentialDecisionHeuristic()
+			: numVariables(0), nextCandidateVariable(1) {}
+
+		void init(std::size_t numVariables) override
+		{
+			this->numVariables = numVariables;
+			nextCandidateVariable = 1;
+		}
+
+		void onNumVariablesIncreased(std::size_t numVariables) override
+		{
+			nextCandidateVariable = std::min(nextCandidateVariable, this->numVariables + 1);
+			this->numVariables = numVariables;
+		}
+
+		void onActivation() override
+		{
+			nextCandidateVariable = 1;
+		}
+
+		void onVariableAssigned(std::size_t) override {}
+		void onVariableBumpedDuringConflictAnalysis(std::size_t) override {}
+		void onConflict() override {}
+
+		void onVariableUnassigned(std::size_t variable) override
+		{
+			nextCandidateVariable = std::min(nextCandidateVariable, variable);
+		}
+
+		[[nodiscard]] std::optional<std::size_t> pickBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) override
+		{
+			return peekBranchingVariable(isVariableAssigned);
+		}
+
+		[[nodiscard]] std::optional<std::size_t> peekBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) override
+		{
+			while (nextCandidateVariable <= numVariables && isVariableAssigned(nextCandidateVariable))
+				++nextCandidateVariable;
+
+			if (nextCandidateVariable > numVariables)
+				return std::nullopt;
+			return nextCandidateVariable;
+		}
+
+		[[nodiscard]] bool hasHigherPriority(std::size_t variable, std::size_t otherVariable) const override
+		{
+			return variable < otherVariable;
+		}
+
+	protected:
+		std::size_t numVariables;
+		std::size_t nextCandidateVariable;
+	};
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef VARIABLE_ACTIVITY_HEAP_HPP
+#define VARIABLE_ACTIVITY_HEAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace decisionHeuristics
+{
+	/*
+	 * Indexed 4-ary max-heap of variables ordered by their activity. The activity of a variable is stored next to the variable in the heap entries so that the comparisons
+	 * performed while sifting only access the contiguous entry array (all children of a node are stored in adjacent entries) instead of an additional activity lookup.
+	 * The position of every variable in the heap is tracked to allow for the update of the activity of a variable in logarithmic time.
+	 * Variables with equal activity are ordered by their identifier (smaller identifiers first) to keep the order deterministic.
+	 */
+	class VariableActivityHeap {
+	public:
+		VariableActivityHeap()
+			: VariableActivityHeap(0) {}
+
+		explicit VariableActivityHeap(std::size_t numVariables)
+			: positionsInHeap(numVariables + 1, NOT_IN_HEAP)
+		{
+			heapEntries.reserve(numVariables);
+		}
+
+		[[nodiscard]] bool empty() const noexcept;
+		[[nodiscard]] std::size_t size() const noexcept;
+		[[nodiscard]] bool contains(std::size_t variable) const noexcept;
+		[[nodiscard]] std::optional<std::size_t> getVariableWithMaximumActivity() const noexcept;
+
+		// Increases the number of variables that can be stored in the heap, the new variables are not inserted
+		void increaseNumVariables(std::size_t numVariables);
+		void insert(std::size_t variable, double activity);
+		void increaseActivity(std::size_t variable, double activity);
+		void updateActivity(std::size_t variable, double activity);
+		[[nodiscard]] std::optional<std::size_t> popVariableWithMaximumActivity();
+		void rescaleActivities(double scalingFactor);
+
+	protected:
+		constexpr static std::size_t ARITY = 4;
+		constexpr static std::size_t NOT_IN_HEAP = SIZE_MAX;
+
+		struct HeapEntry
+		{
+			double activity;
+			std::size_t variable;
+		};
+
+		std::vector<HeapEntry> heapEntries;
+		std::vector<std::size_t> positionsInHeap;
+
+		void siftUp(std::size_t heapPosition);
+		void siftDown(std::size_t heapPosition);
+
+		[[nodiscard]] static bool hasHigherPriority(const HeapEntry& lEntry, const HeapEntry& rEntry) noexcept
+		{
+			return lEntry.activity > rEntry.activity || (lEntry.activity == rEntry.activity && lEntry.variable < rEntry.variable);
+		}
+	};
+}
+
+#endif
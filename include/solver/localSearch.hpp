@@ -0,0 +1,150 @@
+#ifndef LOCAL_SEARCH_HPP
+#define LOCAL_SEARCH_HPP
+
+#include "budget/resourceBudget.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace solver
+{
+	/*
+	 * Stochastic local search that repeatedly flips a variable of a randomly picked falsified clause of a complete assignment, starting from the given phases of the variables. The literals of the clauses are stored
+	 * in a flat arena while every clause only records the number of its satisfied literals and the XOR of the variables of these literals. The latter determines the only satisfied literal of a clause in constant time,
+	 * allowing the break counts (the number of clauses that only the current polarity of a variable satisfies) to be cached and updated incrementally on every flip.
+	 *
+	 * The effort of a search is measured in ticks (see budget/effortTicks.hpp), thus the phases determined by a search with the same seed only depend on the clauses and the given phases.
+	 */
+	class LocalSearch
+	{
+	public:
+		using ptr = std::unique_ptr<LocalSearch>;
+
+		/*
+		 * ProbSAT (https://doi.org/10.1007/978-3-642-31612-8_3) picks a literal of the falsified clause with a probability proportional to (1 + break count)^-cb while WalkSAT (https://doi.org/10.1609/aaai.v12i1.8958)
+		 * flips a literal without breaks if one exists and otherwise either a random literal (with the given noise probability) or the literal with the fewest breaks.
+		 */
+		enum Algorithm : char
+		{
+			ProbSat,
+			WalkSat
+		};
+
+		struct LocalSearchConfiguration
+		{
+			Algorithm algorithm = Algorithm::ProbSat;
+			// The exponent cb of the polynomial break function of ProbSAT
+			double probSatBreakExponent = 2.3;
+			double walkSatNoise = 0.567;
+			std::uint32_t randomSeed = 0;
+		};
+
+		struct LocalSearchStatistics
+		{
+			std::size_t numSearches;
+			std::size_t numFlips;
+			std::size_t numTicks;
+			// Searches whose best assignment satisfied every clause
+			std::size_t numFoundModels;
+		};
+
+		// Break counts above the given bound share the score of the bound in ProbSAT
+		static constexpr std::size_t MAXIMUM_DISTINGUISHED_BREAK_COUNT = 64;
+		// The budget is polled (and charged with the ticks spent in the meantime) every n-th flip
+		static constexpr std::size_t NUM_FLIPS_PER_BUDGET_POLL = 256;
+
+		LocalSearch() = delete;
+		LocalSearch(std::size_t numVariables, const LocalSearchConfiguration& configuration);
+
+		/*
+		 * Duplicate literals are removed while tautological clauses are ignored since they are satisfied by every assignment. Throws if the clause is empty or contains a literal that is not a literal of the formula.
+		 */
+		void addClause(const long* clauseLiterals, std::size_t numLiterals);
+		void addClause(const std::vector<long>& clauseLiterals);
+		// The budget is polled during the search, which stops once the budget is exhausted
+		void setResourceBudget(budget::ResourceBudget* resourceBudget);
+
+		/*
+		 * Searches for an assignment satisfying every clause starting from the given phases (stored as flags for the positive polarity of every variable, thus containing an unused entry for the index 0) until either
+		 * every clause is satisfied or the given number of ticks was spent. The phases are overwritten with the assignment falsifying the fewest clauses found during the search, whose number of falsified clauses is returned.
+		 */
+		[[nodiscard]] std::size_t search(std::vector<char>& phases, std::size_t maximumNumTicks);
+
+		[[nodiscard]] std::size_t getNumClauses() const noexcept;
+		[[nodiscard]] const LocalSearchStatistics& getStatistics() const noexcept;
+
+		[[nodiscard]] static std::string stringifyAlgorithm(Algorithm algorithm)
+		{
+			switch (algorithm)
+			{
+				case Algorithm::ProbSat:
+					return "probsat";
+				default:
+					return "walksat";
+			}
+		}
+
+	protected:
+		using ClauseIndex = std::uint32_t;
+
+		struct ClauseState
+		{
+			std::uint32_t numSatisfiedLiterals;
+			// XOR of the variables of the satisfied literals, which is the variable of the only satisfied literal if the clause contains exactly one
+			std::size_t satisfiedVariablesXor;
+		};
+
+		std::size_t numVariables;
+		LocalSearchConfiguration configuration;
+		budget::ResourceBudget* resourceBudget;
+		std::mt19937 randomNumberGenerator;
+		std::vector<double> probSatScoresPerBreakCount;
+
+		std::vector<long> clauseLiteralArena;
+		// The literals of the i-th clause are stored between the i-th and the (i+1)-th offset
+		std::vector<std::size_t> clauseOffsets;
+		// Occurrence lists stored in a single array, the clauses containing the i-th literal are stored between the i-th and the (i+1)-th offset
+		std::vector<ClauseIndex> literalOccurrences;
+		std::vector<std::size_t> literalOccurrenceOffsets;
+		bool areLiteralOccurrencesOutdated;
+
+		std::vector<char> assignment;
+		std::vector<ClauseState> clauseStates;
+		std::vector<std::size_t> breakCounts;
+		std::vector<ClauseIndex> falsifiedClauses;
+		std::vector<std::size_t> positionsInFalsifiedClauses;
+		// Variables flipped since the assignment with the fewest falsified clauses was found, which is thus restored by flipping them again
+		std::vector<std::size_t> variablesFlippedSinceBestAssignment;
+		std::vector<double> candidateScores;
+		LocalSearchStatistics statistics;
+
+		void buildLiteralOccurrences(std::size_t& numTicks);
+		void initializeClauseStates(std::size_t& numTicks);
+		[[nodiscard]] std::size_t pickVariableOfFalsifiedClause(ClauseIndex falsifiedClause, std::size_t& numTicks);
+		[[nodiscard]] std::size_t pickVariableByProbSat(const long* clauseLiterals, std::size_t numLiterals);
+		[[nodiscard]] std::size_t pickVariableByWalkSat(const long* clauseLiterals, std::size_t numLiterals);
+		void flipVariable(std::size_t variable, std::size_t& numTicks);
+		void addFalsifiedClause(ClauseIndex clauseIndex);
+		void removeFalsifiedClause(ClauseIndex clauseIndex);
+
+		[[nodiscard]] bool isLiteralSatisfied(long literal) const noexcept
+		{
+			return assignment[literalToVariable(literal)] == static_cast<char>(literal > 0);
+		}
+
+		[[nodiscard]] static std::size_t literalToVariable(long literal) noexcept
+		{
+			return static_cast<std::size_t>(std::abs(literal));
+		}
+
+		[[nodiscard]] static std::size_t literalToIndex(long literal) noexcept
+		{
+			return (static_cast<std::size_t>(std::abs(literal)) << 1) | static_cast<std::size_t>(literal < 0);
+		}
+	};
+}
+#endif
@@ -0,0 +1,78 @@
+#ifndef LOOKAHEAD_CUBER_HPP
+#define LOOKAHEAD_CUBER_HPP
+
+#include "solver/sharedFormula.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace solver
+{
+	/*
+	 * Splits a formula into cubes (conjunctions of literals) whose disjunction covers the whole search space of the formula (https://doi.org/10.1007/978-3-642-34188-5_8). At every node of the split
+	 * the branching variable is selected by a lookahead: the most promising candidate variables are assigned with both polarities and the variable whose assignments imply the most other assignments
+	 * via unit propagation is chosen. Failed literals found during the lookahead are added to the cube while cubes refuted by unit propagation are dropped.
+	 *
+	 * The cuber uses its own counter-based unit propagation on the clauses of the shared formula, thus every thread requires its own instance.
+	 */
+	class LookaheadCuber
+	{
+	public:
+		using ptr = std::unique_ptr<LookaheadCuber>;
+
+		static constexpr std::size_t DEFAULT_MAXIMUM_NUM_LOOKAHEAD_CANDIDATES = 32;
+
+		struct CuberStatistics
+		{
+			std::size_t numLookaheads;
+			std::size_t numFailedLiterals;
+			std::size_t numRefutedCubes;
+		};
+
+		LookaheadCuber() = delete;
+		explicit LookaheadCuber(SharedFormula::ptr sharedFormula, std::size_t maximumNumLookaheadCandidates = DEFAULT_MAXIMUM_NUM_LOOKAHEAD_CANDIDATES);
+
+		/*
+		 * Splits the given cube into at most 2^depth cubes that extend the given cube, cubes whose unit propagation already satisfies every clause are not split any further.
+		 * No cube is returned if the formula is unsatisfiable under the given cube.
+		 */
+		[[nodiscard]] std::vector<std::vector<long>> splitCube(const std::vector<long>& cube, std::size_t depth);
+		[[nodiscard]] const CuberStatistics& getStatistics() const noexcept;
+
+	protected:
+		SharedFormula::ptr sharedFormula;
+		std::size_t maximumNumLookaheadCandidates;
+		bool isFormulaKnownToBeUnsat;
+		std::vector<std::vector<std::size_t>> literalOccurrences;
+		std::vector<std::uint32_t> numFalsifiedLiteralsPerClause;
+		// The value of every variable stored as 1 (positive), -1 (negative) or 0 (unassigned)
+		std::vector<signed char> variableValues;
+		std::vector<long> trail;
+		std::size_t propagationQueueHead;
+		std::vector<double> candidateScores;
+		CuberStatistics statistics;
+
+		void splitCubeRecursively(std::vector<long> cube, std::size_t remainingDepth, std::vector<std::vector<long>>& generatedCubes);
+		[[nodiscard]] std::optional<long> determineBranchingLiteral(std::vector<long>& cube, bool& isCubeRefuted);
+		[[nodiscard]] std::vector<std::size_t> preselectCandidateVariables();
+		[[nodiscard]] std::optional<std::size_t> lookahead(long literal);
+		[[nodiscard]] bool assignAndPropagate(long literal);
+		[[nodiscard]] bool propagate();
+		void undoAssignments(std::size_t trailSize);
+
+		[[nodiscard]] signed char getLiteralValue(long literal) const noexcept
+		{
+			const signed char variableValue = variableValues[static_cast<std::size_t>(std::abs(literal))];
+			return literal < 0 ? static_cast<signed char>(-variableValue) : variableValue;
+		}
+
+		[[nodiscard]] static std::size_t literalToIndex(long literal) noexcept
+		{
+			return (static_cast<std::size_t>(std::abs(literal)) << 1) | static_cast<std::size_t>(literal < 0);
+		}
+	};
+}
+#endif
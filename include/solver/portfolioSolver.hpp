@@ -0,0 +1,61 @@
+#ifndef PORTFOLIO_SOLVER_HPP
+#define PORTFOLIO_SOLVER_HPP
+
+#include <dimacs/problemDefinition.hpp>
+#include "solver/clauseExchange.hpp"
+#include "solver/sharedFormula.hpp"
+#include "solver/solver.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace solver
+{
+	/*
+	 * Runs multiple solver instances (workers) with diversified configurations in parallel on the same formula, whose original clauses are shared by all workers.
+	 * The first worker to determine the satisfiability of the formula wins and cancels the search of all other workers cooperatively. If clause sharing is enabled, the workers
+	 * exchange their short learned clauses (with a small LBD) via a lock-free clause exchange.
+	 */
+	class PortfolioSolver
+	{
+	public:
+		using ptr = std::unique_ptr<PortfolioSolver>;
+
+		PortfolioSolver() = delete;
+		PortfolioSolver(const dimacs::ProblemDefinition& problemDefinition, std::size_t numWorkers, Solver::SolverConfiguration baseConfiguration, bool isClauseSharingEnabled = true)
+			: PortfolioSolver(SharedFormula::fromProblemDefinition(problemDefinition), numWorkers, std::move(baseConfiguration), isClauseSharingEnabled) {}
+
+		PortfolioSolver(SharedFormula::ptr sharedFormula, std::size_t numWorkers, Solver::SolverConfiguration baseConfiguration, bool isClauseSharingEnabled = true);
+
+		[[nodiscard]] Solver::SolverResult solve();
+		[[nodiscard]] std::vector<long> getModel() const;
+		[[nodiscard]] std::size_t getNumWorkers() const noexcept;
+		[[nodiscard]] std::optional<std::size_t> getIndexOfWinningWorker() const noexcept;
+		[[nodiscard]] const Solver::SolverConfiguration& getConfigurationOfWorker(std::size_t workerIndex) const;
+		[[nodiscard]] const Solver::SolverStatistics& getStatisticsOfWorker(std::size_t workerIndex) const;
+
+		// The budget is shared by all workers, thus its conflict and tick limits bound the total work of the portfolio. The budget needs to outlive the solver
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept;
+
+		/*
+		 * The first worker uses the base configuration while the configuration of every other worker differs in its random seed, decision heuristic, restart policy, search mode switching
+		 * and phase selection.
+		 */
+		[[nodiscard]] static Solver::SolverConfiguration diversifyConfiguration(const Solver::SolverConfiguration& baseConfiguration, std::size_t workerIndex);
+
+	protected:
+		SharedFormula::ptr sharedFormula;
+		std::vector<Solver::SolverConfiguration> configurationsOfWorkers;
+		std::vector<Solver::ptr> workers;
+		ClauseExchange::ptr clauseExchange;
+		std::atomic_bool isSearchCancelled;
+		budget::ResourceBudget* resourceBudget;
+		std::optional<std::size_t> indexOfWinningWorker;
+		Solver::SolverResult result;
+
+		void runWorker(std::size_t workerIndex);
+	};
+}
+#endif
@@ -0,0 +1,41 @@
+#ifndef BASE_RESTART_POLICY_HPP
+#define BASE_RESTART_POLICY_HPP
+
+#include <cstddef>
+#include <memory>
+
+namespace restartPolicies
+{
+	/*
+	 * Interface between the CDCL search and the strategy deciding when the search should be restarted. The policy is notified about every conflict (with the literal block distance (LBD) of the
+	 * learned clause and the size of the trail at the time of the conflict) as well as about every performed restart.
+	 */
+	class BaseRestartPolicy {
+	public:
+		using ptr = std::unique_ptr<BaseRestartPolicy>;
+
+		BaseRestartPolicy()
+			: numConflictsSinceLastRestart(0), numBlockedRestarts(0) {}
+
+		virtual ~BaseRestartPolicy() = default;
+
+		virtual void onConflict(std::size_t literalBlockDistanceOfLearnedClause, std::size_t trailSize) = 0;
+		[[nodiscard]] virtual bool shouldRestart() const = 0;
+
+		virtual void onRestart()
+		{
+			numConflictsSinceLastRestart = 0;
+		}
+
+		[[nodiscard]] std::size_t getNumBlockedRestarts() const noexcept
+		{
+			return numBlockedRestarts;
+		}
+
+	protected:
+		std::size_t numConflictsSinceLastRestart;
+		std::size_t numBlockedRestarts;
+	};
+}
+
+#endif
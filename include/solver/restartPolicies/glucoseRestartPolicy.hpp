@@ -0,0 +1,80 @@
+#ifndef GLUCOSE_RESTART_POLICY_HPP
+#define GLUCOSE_RESTART_POLICY_HPP
+
+#include "solver/restartPolicies/baseRestartPolicy.hpp"
+
+// https://www.ijcai.org/Proceedings/09/Papers/074.pdf
+// https://www.cril.univ-artois.fr/~audemard/slidesPOS2012.pdf
+// https://fmv.jku.at/papers/BiereFroehlich-POS15.pdf
+namespace restartPolicies
+{
+	/*
+	 * Glucose-style dynamic restarts: A restart is triggered once the fast moving average of the literal block distances (LBD) of the recently learned clauses exceeds the slow (long-term)
+	 * average by a given margin, which indicates that the learned clauses of the current part of the search space are worse than on average.
+	 *
+	 * A restart is blocked (postponed) if the current trail is significantly larger than the moving average of the trail sizes at recent conflicts, since the solver might be close to a
+	 * satisfying assignment.
+	 */
+	class GlucoseRestartPolicy : public BaseRestartPolicy {
+	public:
+		struct Configuration
+		{
+			double fastMovingAverageSmoothingFactor = 0.03;
+			double slowMovingAverageSmoothingFactor = 1e-5;
+			double restartMargin = 1.1;
+			std::size_t minimumConflictsBetweenRestarts = 2;
+			double trailSizeMovingAverageSmoothingFactor = 2e-4;
+			double blockingMargin = 1.4;
+			std::size_t minimumConflictsBeforeBlocking = 10000;
+			std::size_t minimumConflictsAfterBlockedRestart = 50;
+		};
+
+		/*
+		 * Exponential moving average with bias correction, preventing the average from being dominated by its initial value during the first updates.
+		 */
+		class ExponentialMovingAverage
+		{
+		public:
+			explicit ExponentialMovingAverage(double smoothingFactor)
+				: smoothingFactor(smoothingFactor), biasedAverage(0), biasCorrectionFactor(1) {}
+
+			void update(double value) noexcept
+			{
+				biasedAverage += smoothingFactor * (value - biasedAverage);
+				biasCorrectionFactor *= 1 - smoothingFactor;
+			}
+
+			[[nodiscard]] double getValue() const noexcept
+			{
+				return biasCorrectionFactor < 1 ? biasedAverage / (1 - biasCorrectionFactor) : 0;
+			}
+
+		protected:
+			double smoothingFactor;
+			double biasedAverage;
+			double biasCorrectionFactor;
+		};
+
+		GlucoseRestartPolicy()
+			: GlucoseRestartPolicy(Configuration()) {}
+
+		explicit GlucoseRestartPolicy(Configuration configuration);
+
+		void onConflict(std::size_t literalBlockDistanceOfLearnedClause, std::size_t trailSize) override;
+		[[nodiscard]] bool shouldRestart() const override;
+		void onRestart() override;
+
+		[[nodiscard]] double getFastMovingAverageOfLiteralBlockDistance() const noexcept;
+		[[nodiscard]] double getSlowMovingAverageOfLiteralBlockDistance() const noexcept;
+
+	protected:
+		Configuration configuration;
+		std::size_t numConflicts;
+		std::size_t numRequiredConflictsBeforeRestart;
+		ExponentialMovingAverage fastMovingAverageOfLiteralBlockDistance;
+		ExponentialMovingAverage slowMovingAverageOfLiteralBlockDistance;
+		ExponentialMovingAverage movingAverageOfTrailSize;
+	};
+}
+
+#endif
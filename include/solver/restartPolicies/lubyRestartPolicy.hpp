@@ -0,0 +1,44 @@
+#ifndef LUBY_RESTART_POLICY_HPP
+#define LUBY_RESTART_POLICY_HPP
+
+#include "solver/restartPolicies/baseRestartPolicy.hpp"
+
+#include <cstdint>
+#include <optional>
+
+// https://www.cs.utexas.edu/~diz/Sub%20Websites/Research/luby.pdf
+// https://fmv.jku.at/papers/BiereFroehlich-POS15.pdf
+namespace restartPolicies
+{
+	/*
+	 * Restarts the search after a number of conflicts following the Luby sequence (1, 1, 2, 1, 1, 2, 4, 1, ...) scaled by a unit interval. The elements of the sequence are generated with the
+	 * reluctant doubling scheme of Knuth, i.e. by the pairs (u, v) with (u, v) = (u + 1, 1) if u & -u = v and (u, v) = (u, 2 * v) otherwise.
+	 *
+	 * With a maximum interval defined, the sequence starts from the beginning once the next interval would exceed the maximum, which is the variant used in the stable search mode.
+	 */
+	class LubyRestartPolicy : public BaseRestartPolicy {
+	public:
+		constexpr static std::size_t DEFAULT_UNIT_INTERVAL = 100;
+		constexpr static std::size_t DEFAULT_RELUCTANT_DOUBLING_UNIT_INTERVAL = 1024;
+		constexpr static std::size_t DEFAULT_RELUCTANT_DOUBLING_MAXIMUM_INTERVAL = 1 << 20;
+
+		LubyRestartPolicy()
+			: LubyRestartPolicy(DEFAULT_UNIT_INTERVAL, std::nullopt) {}
+
+		LubyRestartPolicy(std::size_t unitConflictInterval, std::optional<std::size_t> optionalMaximumConflictInterval);
+
+		void onConflict(std::size_t literalBlockDistanceOfLearnedClause, std::size_t trailSize) override;
+		[[nodiscard]] bool shouldRestart() const override;
+		void onRestart() override;
+
+		[[nodiscard]] std::size_t getCurrentConflictInterval() const noexcept;
+
+	protected:
+		std::size_t unitConflictInterval;
+		std::optional<std::size_t> optionalMaximumConflictInterval;
+		std::uint64_t reluctantDoublingU;
+		std::uint64_t reluctantDoublingV;
+	};
+}
+
+#endif
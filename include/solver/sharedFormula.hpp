@@ -0,0 +1,67 @@
+#ifndef SHARED_FORMULA_HPP
+#define SHARED_FORMULA_HPP
+
+#include <dimacs/problemDefinition.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace solver
+{
+	/*
+	 * An immutable copy of the clauses of a parsed formula that can be shared by multiple solver instances (i.e. the workers of a portfolio) without copying the literals of the original clauses
+	 * for every instance. The literals of every clause are sorted and deduplicated while tautologies are dropped, the assignments determined during the parsing of the formula are stored as units.
+	 */
+	class SharedFormula
+	{
+	public:
+		using ptr = std::shared_ptr<const SharedFormula>;
+
+		SharedFormula() = delete;
+		explicit SharedFormula(const dimacs::ProblemDefinition& problemDefinition);
+
+		[[nodiscard]] static ptr fromProblemDefinition(const dimacs::ProblemDefinition& problemDefinition)
+		{
+			return std::make_shared<const SharedFormula>(problemDefinition);
+		}
+
+		[[nodiscard]] std::size_t getNumVariables() const noexcept
+		{
+			return numVariables;
+		}
+
+		[[nodiscard]] std::size_t getNumClauses() const noexcept
+		{
+			return clauseOffsets.size() - 1;
+		}
+
+		[[nodiscard]] const std::vector<long>& getUnitLiterals() const noexcept
+		{
+			return unitLiterals;
+		}
+
+		[[nodiscard]] std::size_t getOffsetOfClause(std::size_t clauseIndex) const noexcept
+		{
+			return clauseOffsets[clauseIndex];
+		}
+
+		[[nodiscard]] std::uint32_t getNumLiteralsOfClause(std::size_t clauseIndex) const noexcept
+		{
+			return static_cast<std::uint32_t>(clauseOffsets[clauseIndex + 1] - clauseOffsets[clauseIndex]);
+		}
+
+		// The returned pointer remains valid for the lifetime of the shared formula since the arena is never modified after its construction
+		[[nodiscard]] const long* getClauseLiteralArena() const noexcept
+		{
+			return clauseLiteralArena.data();
+		}
+
+	protected:
+		std::size_t numVariables;
+		std::vector<long> clauseLiteralArena;
+		std::vector<std::size_t> clauseOffsets;
+		std::vector<long> unitLiterals;
+	};
+}
+#endif
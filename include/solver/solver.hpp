@@ -1,4 +1,678 @@
 #ifndef SOLVER_HPP
 #define SOLVER_HPP
 
-#endif
\ No newline at end of file
+#include <budget/resourceBudget.hpp>
+#include <dimacs/problemDefinition.hpp>
+#include <optimizations/modelReconstruction/modelReconstructionStack.hpp>
+#include <proof/proofWriter.hpp>
+#include "solver/clauseExchange.hpp"
+#include "solver/localSearch.hpp"
+#include "solver/sharedFormula.hpp"
+#include "solver/decisionHeuristics/baseDecisionHeuristic.hpp"
+#include "solver/restartPolicies/baseRestartPolicy.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// https://www.cs.princeton.edu/~zkincaid/courses/fall18/readings/SATHandbook-CDCL.pdf
+// http://minisat.se/downloads/MiniSat.pdf
+namespace solver
+{
+	class Solver
+	{
+	public:
+		using ptr = std::unique_ptr<Solver>;
+
+		enum SolverResult : char
+		{
+			Sat,
+			Unsat,
+			Unknown
+		};
+
+		enum DecisionHeuristic : char
+		{
+			Evsids,
+			Sequential,
+			LearningRateBranching,
+			UserDefined
+		};
+
+		/*
+		 * Learned clauses with a small LBD (core) are kept indefinitely, tier-2 clauses are kept as long as they are used during conflict analysis and clauses of the local tier
+		 * are subject to the periodic reduction of the clause database.
+		 */
+		enum ClauseTier : char
+		{
+			Core,
+			TierTwo,
+			Local
+		};
+
+		enum RestartPolicy : char
+		{
+			NoRestarts,
+			Luby,
+			Glucose,
+			ReluctantDoubling
+		};
+
+		/*
+		 * The search alternates between a focused mode (aggressive, frequent restarts) and a stable mode (few restarts) if a decision heuristic for the stable mode is defined.
+		 * The number of conflicts between two switches of the search mode starts at the initial switch interval and is doubled after every stable mode phase.
+		 */
+		enum SearchMode : char
+		{
+			Focused,
+			Stable
+		};
+
+		/*
+		 * Determines in which search modes the decisions follow the target phases (the assignment of the longest conflict-free trail since the last restart) instead of the saved phases
+		 * (https://doi.org/10.1007/978-3-030-51825-7_27).
+		 */
+		enum TargetPhaseUsage : char
+		{
+			Never,
+			StableModeOnly,
+			Always
+		};
+
+		/*
+		 * The saved phases of all variables are periodically overwritten with the phases of one of the following strategies (cycled in the given order) to escape regions of the search space
+		 * in which the search got stuck. The walk strategy improves the best phases by a local search on the irredundant clauses and is skipped if the effort of the local search is zero.
+		 */
+		enum RephasingStrategy : char
+		{
+			Original,
+			Inverted,
+			Best,
+			Walk,
+			Random
+		};
+
+		/*
+		 * Simplification passes run on the clauses of the solver during inprocessing (https://doi.org/10.1007/978-3-642-31365-3_28), the passes are executed in the given order. The removal of (set) blocked
+		 * clauses is recorded on the model reconstruction stack of the solver.
+		 */
+		enum InprocessingPass : char
+		{
+			Probing,
+			Subsumption,
+			Vivification,
+			BlockedClauseElimination,
+			SetBlockedClauseElimination
+		};
+
+		struct SolverConfiguration
+		{
+			std::optional<std::size_t> optionalConflictLimit;
+			// Used in the focused search mode and throughout the whole search if no decision heuristic for the stable search mode is defined
+			DecisionHeuristic decisionHeuristic = DecisionHeuristic::Evsids;
+			std::optional<DecisionHeuristic> optionalStableModeDecisionHeuristic;
+			std::size_t initialSearchModeSwitchConflictInterval = 1000;
+			// Used in the focused search mode and throughout the whole search if no decision heuristic for the stable search mode is defined
+			RestartPolicy restartPolicy = RestartPolicy::Glucose;
+			// Only used if a decision heuristic for the stable search mode is defined since the search otherwise stays in the focused search mode
+			RestartPolicy stableModeRestartPolicy = RestartPolicy::ReluctantDoubling;
+			// Only backtrack to the decision level at which the decision heuristic would pick a different branching variable than in the current trail during a restart
+			bool isTrailReuseEnabled = true;
+			// Learned clauses with a literal block distance (LBD) up to the given limits are assigned to the core and tier-2 tier respectively, all other learned clauses to the local tier
+			std::size_t maximumLiteralBlockDistanceOfCoreClauses = 2;
+			std::size_t maximumLiteralBlockDistanceOfTierTwoClauses = 6;
+			std::size_t initialClauseDatabaseReductionInterval = 2000;
+			std::size_t clauseDatabaseReductionIntervalIncrement = 300;
+			bool isLearnedClauseMinimizationEnabled = true;
+			bool isLearnedClauseShrinkingEnabled = true;
+			// Branch on the polarity a variable had when it was last unassigned instead of the initial polarity
+			bool isPhaseSavingEnabled = true;
+			TargetPhaseUsage targetPhaseUsage = TargetPhaseUsage::StableModeOnly;
+			// The n-th rephasing is performed n * rephasing interval conflicts after the previous one, no rephasing is performed if no interval is defined
+			std::optional<std::size_t> optionalRephasingInterval = 1000;
+			std::uint32_t randomSeed = 0;
+			// The polarity used for variables without a saved phase as well as by the original (and inverted) rephasing
+			bool isInitialPhasePositive = false;
+			/*
+			 * Backtrack only to the decision level prior to the conflict (https://doi.org/10.1007/978-3-319-94144-8_7) if a backjump would skip more decision levels than the given threshold,
+			 * the asserting literal is then assigned out-of-order on its backjump level. Chronological backtracking is disabled if no threshold is defined.
+			 */
+			std::optional<std::size_t> optionalChronologicalBacktrackingThreshold = 100;
+			// Learned clauses are only exported to the other workers of a portfolio if neither their LBD nor their size exceed the given limits
+			std::size_t maximumLiteralBlockDistanceOfExportedClauses = 3;
+			std::size_t maximumSizeOfExportedClauses = 8;
+			/*
+			 * The n-th inprocessing round is performed at the first restart at least n * inprocessing interval conflicts (or n * inprocessing tick interval propagation ticks of the search) after the previous one,
+			 * whichever is reached first. Since both intervals are deterministic, the schedule does not depend on the speed of the machine. No inprocessing is performed if neither interval is defined.
+			 * Every pass may spend the given fraction (in per mille) of the propagation ticks of the search since the previous round but at least the minimum effort, a pass with an effort of zero is disabled.
+			 */
+			std::optional<std::size_t> optionalInprocessingInterval;
+			std::optional<std::size_t> optionalInprocessingTickInterval;
+			std::array<std::size_t, 5> perInprocessingPassEffortsInPerMille = { 100, 50, 100, 50, 20 };
+			std::size_t minimumInprocessingPassEffort = 10000;
+			std::size_t maximumSizeOfInprocessingBlockingSets = 2;
+			// The learned clauses of the flagged tiers (only tier-2 by default) and optionally the irredundant clauses are candidates of the vivification
+			std::array<bool, 3> isVivificationEnabledPerLearnedClauseTier = { false, true, false };
+			bool isVivificationOfIrredundantClausesEnabled = false;
+			// Successful probes add hyper-binary resolvents of the literals implied by non-binary clauses (at most the given number per probing pass) and assign the literals implied by both polarities of the
+			// probed variable (lifting) on the root decision level
+			bool isHyperBinaryResolutionDuringProbingEnabled = true;
+			std::size_t maximumNumHyperBinaryResolventsPerProbingPass = 1000;
+			bool isLiftingDuringProbingEnabled = true;
+			/*
+			 * The local search of the walk rephasing may spend the given fraction (in per mille) of the propagation ticks of the search since the previous local search but at least the minimum effort.
+			 * A local search with the given effort (in ticks) is performed prior to the search of the first call of solve() if defined, whose phases are used for the first decisions. If the local search finds
+			 * a model of the formula, the search thus assigns it without any conflict (as long as phase saving is enabled).
+			 */
+			LocalSearch::Algorithm localSearchAlgorithm = LocalSearch::Algorithm::ProbSat;
+			std::size_t localSearchEffortInPerMille = 50;
+			std::size_t minimumLocalSearchEffort = 10000;
+			std::optional<std::size_t> optionalInitialLocalSearchEffort;
+		};
+
+		struct DecisionHeuristicStatistics
+		{
+			DecisionHeuristic decisionHeuristic;
+			std::size_t numDecisions;
+			std::size_t numConflicts;
+			std::size_t numActivations;
+			std::chrono::nanoseconds durationOfActivePhases;
+		};
+
+		struct InprocessingPassStatistics
+		{
+			std::size_t numTicks;
+			std::size_t numRemovedClauses;
+			// Literals removed from clauses that were strengthened but not removed
+			std::size_t numRemovedLiterals;
+			std::size_t numDerivedUnitClauses;
+			// Clauses added by the pass, i.e. the hyper-binary resolvents of the probing
+			std::size_t numAddedClauses;
+		};
+
+		struct SolverStatistics
+		{
+			std::size_t numDecisions;
+			std::size_t numPropagations;
+			/*
+			 * Cache lines (see budget/effortTicks.hpp) touched during propagation: The cache lines spanned by every visited watch list as well as the metadata and the scanned literals of every accessed clause
+			 * of a non-binary watcher.
+			 */
+			std::size_t numPropagationTicks;
+			std::size_t numConflicts;
+			std::size_t numLearnedClauses;
+			std::size_t numLearnedUnitClauses;
+			std::size_t numLearnedLiterals;
+			std::size_t numMinimizedLiterals;
+			std::size_t numShrunkLiterals;
+			std::size_t numBackjumps;
+			std::size_t numSkippedDecisionLevelsDuringBackjumps;
+			std::size_t numChronologicalBacktracks;
+			// Assignments of the decision levels between the backjump level and the conflict level that were kept by chronological backtracking
+			std::size_t numAssignmentsRetainedByChronologicalBacktracking;
+			// Out-of-order assignments of lower decision levels that were kept on the trail while backtracking
+			std::size_t numRetainedOutOfOrderAssignments;
+			std::size_t numMissedImplications;
+			std::size_t numExportedClauses;
+			std::size_t numImportedClauses;
+			// Imported clauses that were used at least once during conflict analysis
+			std::size_t numUsefulImportedClauses;
+			// Clauses of other workers that were overwritten in their export ring before they could be imported
+			std::size_t numMissedImportedClauses;
+			std::size_t maxDecisionLevel;
+			std::size_t numRestarts;
+			std::size_t numBlockedRestarts;
+			std::size_t numRestartsWithReusedTrail;
+			std::size_t numReusedDecisionLevels;
+			std::size_t numClauseDatabaseReductions;
+			std::size_t numDeletedLearnedClauses;
+			std::size_t numGarbageCollections;
+			std::array<std::size_t, 5> numRephasesPerStrategy;
+			LocalSearch::LocalSearchStatistics localSearchStatistics;
+			std::size_t numInprocessingRounds;
+			// Clauses eliminated during inprocessing that were added back to the formula due to an incremental addition of clauses or the usage of assumptions
+			std::size_t numRestoredEliminatedClauses;
+			std::array<InprocessingPassStatistics, 5> perInprocessingPassStatistics;
+			std::array<std::size_t, 3> numLearnedClausesPerTier;
+			std::array<DecisionHeuristicStatistics, 2> perSearchModeDecisionHeuristicStatistics;
+		};
+
+		Solver() = delete;
+		explicit Solver(const dimacs::ProblemDefinition& problemDefinition)
+			: Solver(problemDefinition, SolverConfiguration()) {}
+
+		Solver(const dimacs::ProblemDefinition& problemDefinition, SolverConfiguration configuration)
+			: Solver(SharedFormula::fromProblemDefinition(problemDefinition), std::move(configuration)) {}
+
+		// The original clauses are not copied but referenced from the shared formula, which is kept alive by the solver
+		Solver(SharedFormula::ptr sharedFormula, SolverConfiguration configuration);
+
+		[[nodiscard]] SolverResult solve();
+
+		/*
+		 * Solves the formula under the given assumptions, which are assigned as the first decisions of the search (https://doi.org/10.1016/S1571-0661(05)82542-3). An unsatisfiable result thus only states
+		 * that the formula is unsatisfiable under the assumptions while the clauses learned during the search do not depend on the assumptions and are kept for later calls.
+		 */
+		[[nodiscard]] SolverResult solve(const std::vector<long>& assumptions);
+
+		/*
+		 * Adds a clause to the formula between two calls of solve(), variables that are not yet part of the formula are added to it. The learned clauses as well as the state of the heuristics
+		 * are kept, thus a sequence of related queries does not need to relearn the clauses of the previous queries. Clauses eliminated during inprocessing are added back to the formula beforehand.
+		 */
+		void addClause(const std::vector<long>& clauseLiterals);
+
+		/*
+		 * The subset of the assumptions of the last call of solve() that was sufficient to determine the unsatisfiability of the formula under the assumptions. The set is empty if the formula
+		 * is unsatisfiable regardless of the assumptions or if the last call did not determine the formula to be unsatisfiable.
+		 */
+		[[nodiscard]] const std::vector<long>& getFailedAssumptions() const noexcept;
+		[[nodiscard]] bool isAssumptionFailed(long assumption) const;
+		[[nodiscard]] std::optional<dimacs::ProblemDefinition::VariableValue> getValueOfVariable(std::size_t variable) const;
+		[[nodiscard]] std::vector<long> getModel() const;
+		[[nodiscard]] const SolverStatistics& getStatistics() const noexcept;
+		[[nodiscard]] std::size_t getNumVariables() const noexcept;
+
+		[[nodiscard]] SearchMode getActiveSearchMode() const noexcept;
+
+		[[nodiscard]] static std::string stringifyDecisionHeuristic(DecisionHeuristic decisionHeuristic)
+		{
+			switch (decisionHeuristic)
+			{
+				case DecisionHeuristic::Evsids:
+					return "evsids";
+				case DecisionHeuristic::Sequential:
+					return "sequential";
+				case DecisionHeuristic::LearningRateBranching:
+					return "lrb";
+				default:
+					return "user-defined";
+			}
+		}
+
+		[[nodiscard]] static std::string stringifyRestartPolicy(RestartPolicy restartPolicy)
+		{
+			switch (restartPolicy)
+			{
+				case RestartPolicy::Luby:
+					return "luby";
+				case RestartPolicy::Glucose:
+					return "glucose";
+				case RestartPolicy::ReluctantDoubling:
+					return "reluctantDoubling";
+				default:
+					return "none";
+			}
+		}
+
+		[[nodiscard]] static std::string stringifyInprocessingPass(InprocessingPass inprocessingPass)
+		{
+			switch (inprocessingPass)
+			{
+				case InprocessingPass::Probing:
+					return "probing";
+				case InprocessingPass::Subsumption:
+					return "subsumption";
+				case InprocessingPass::Vivification:
+					return "vivification";
+				case InprocessingPass::BlockedClauseElimination:
+					return "bce";
+				default:
+					return "sbce";
+			}
+		}
+
+		[[nodiscard]] static std::string stringifyRephasingStrategy(RephasingStrategy rephasingStrategy)
+		{
+			switch (rephasingStrategy)
+			{
+				case RephasingStrategy::Original:
+					return "original";
+				case RephasingStrategy::Inverted:
+					return "inverted";
+				case RephasingStrategy::Best:
+					return "best";
+				case RephasingStrategy::Walk:
+					return "walk";
+				default:
+					return "random";
+			}
+		}
+
+		/*
+		 * Replaces the decision heuristic of the given search mode selected in the configuration of the solver, allowing the benchmarking of user-defined heuristics.
+		 * Defining a heuristic for the stable search mode enables the switching between the search modes. The heuristic is initialized for the variables of the formula and
+		 * should only be replaced between two calls of solve().
+		 */
+		void setDecisionHeuristic(decisionHeuristics::BaseDecisionHeuristic::ptr decisionHeuristic, SearchMode searchMode = SearchMode::Focused);
+
+		/*
+		 * The search is cancelled cooperatively (with an unknown result) as soon as the given flag is set, the flag is polled at every decision and conflict and can thus be set by another thread.
+		 * The flag needs to outlive the solver.
+		 */
+		void setCancellationFlag(const std::atomic_bool* cancellationFlag) noexcept;
+
+		// Replaces the conflict limit of the configuration, the limit refers to the total number of conflicts over all calls of solve()
+		void setConflictLimit(std::optional<std::size_t> optionalConflictLimit) noexcept;
+
+		// The search is cancelled with an unknown result once the callback returns true, the callback is polled at the same points as the cancellation flag
+		void setTerminationCallback(std::function<bool()> terminationCallback);
+
+		/*
+		 * Charges the conflicts and propagation ticks of the search to the given budget, the search (as well as every inprocessing pass) is cancelled with an unknown result once the budget is exhausted.
+		 * The budget is polled at the same points as the cancellation flag, can be shared by several solvers and needs to outlive the solver.
+		 */
+		void setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept;
+
+		// Every learned clause with at most the given number of literals is passed to the callback, which can be used to export learned clauses to the user of an incremental solver
+		void setLearnedClauseCallback(std::size_t maximumSizeOfPassedClauses, std::function<void(const std::vector<long>&)> learnedClauseCallback);
+
+		/*
+		 * Enables the exchange of learned clauses with the other workers of the given clause exchange, learned clauses satisfying the export limits of the configuration are exported after every conflict
+		 * while the clauses of other workers are imported after every restart. The clause exchange needs to outlive the solver.
+		 */
+		void setClauseExchange(ClauseExchange* clauseExchange, std::size_t workerIndex);
+
+		/*
+		 * Records the learned and deleted clauses as well as the empty clause (once the formula was determined to be unsatisfiable without assumptions) in the DRAT proof of the given writer, the writer needs to outlive the solver.
+		 * LRAT proofs are not supported since the solver does not track the identifiers of its clauses while imported clauses of other workers could not be justified in the proof. Blocked and set-blocked
+		 * clauses are not eliminated during inprocessing while a proof is recorded since their restoration by later calls of addClause() or solve() with assumptions could not be justified in the proof either.
+		 */
+		void setProofWriter(proof::ProofWriter* proofWriter);
+
+	protected:
+		using ClauseIndex = std::size_t;
+		constexpr static ClauseIndex NO_CLAUSE = SIZE_MAX;
+
+		enum LiteralValue : signed char
+		{
+			Falsified = -1,
+			Unassigned = 0,
+			Satisfied = 1
+		};
+
+		/*
+		 * The literals of a clause are never reordered during propagation, instead the positions of the two watched literals are recorded in the metadata of the clause.
+		 * This allows the literal data of a clause to be treated as read-only once it was added to the arena.
+		 */
+		struct ClauseMetadata
+		{
+			std::size_t literalsOffset;
+			std::uint32_t numLiterals;
+			std::array<std::uint32_t, 2> watchedLiteralPositions;
+			std::uint32_t literalBlockDistance;
+			ClauseTier tier;
+			bool isLearned;
+			bool isStoredInSharedFormula;
+			// Set for clauses imported from other workers until they are used for the first time during conflict analysis
+			bool isUnusedImportedClause;
+			bool isDeleted;
+			bool wasUsedSinceLastReduction;
+			// Set once the clause was vivified, the flags are reset once every candidate of the vivification was vivified
+			bool wasVivified;
+		};
+
+		struct Watcher
+		{
+			ClauseIndex clauseIndex;
+			long blockingLiteral;
+			bool isBinaryClause;
+		};
+
+		/*
+		 * Markers of the variables during the conflict analysis and the minimization of the learned clause: Seen variables are part of the learned clause, removable variables are implied by the literals
+		 * of the learned clause while poisoned variables were determined to not be removable.
+		 */
+		enum VariableMarker : char
+		{
+			Unmarked,
+			Seen,
+			Removable,
+			Poisoned
+		};
+
+		struct RedundancyCheckStackEntry
+		{
+			std::uint32_t nextLiteralPosition;
+			long literal;
+		};
+
+		struct VariableAssignmentData
+		{
+			std::size_t decisionLevel;
+			ClauseIndex reason;
+			std::size_t trailPosition;
+		};
+
+		SolverConfiguration configuration;
+		std::size_t numVariables;
+		bool isFormulaKnownToBeUnsat;
+		bool wasEmptyClauseAddedToProof;
+		SharedFormula::ptr sharedFormula;
+		const long* sharedClauseLiteralArena;
+		const std::atomic_bool* cancellationFlag;
+		budget::ResourceBudget* resourceBudget;
+		ClauseExchange* clauseExchange;
+		proof::ProofWriter* proofWriter;
+		std::size_t workerIndexInClauseExchange;
+		std::vector<ClauseExchange::ExchangedClause> importedClauses;
+		// The assumptions of the active call of solve(), the i-th assumption is the decision of the (i + 1)-th decision level
+		std::vector<long> assumptions;
+		std::vector<long> failedAssumptions;
+		std::function<bool()> terminationCallback;
+		std::function<void(const std::vector<long>&)> learnedClauseCallback;
+		std::size_t maximumSizeOfClausesPassedToLearnedClauseCallback;
+
+		std::vector<long> clauseLiteralArena;
+		std::vector<ClauseMetadata> clauses;
+		std::vector<std::vector<Watcher>> watchers;
+
+		std::vector<LiteralValue> literalValues;
+		std::vector<VariableAssignmentData> variableAssignmentData;
+		std::vector<long> trail;
+		std::vector<std::size_t> decisionLevelStartPositionsInTrail;
+		std::size_t propagationQueueHead;
+		std::array<decisionHeuristics::BaseDecisionHeuristic::ptr, 2> perSearchModeDecisionHeuristics;
+		decisionHeuristics::BaseDecisionHeuristic* decisionHeuristic;
+		std::array<restartPolicies::BaseRestartPolicy::ptr, 2> perSearchModeRestartPolicies;
+		restartPolicies::BaseRestartPolicy* restartPolicy;
+		SearchMode activeSearchMode;
+		std::size_t searchModeSwitchConflictInterval;
+		std::size_t numConflictsAtNextSearchModeSwitch;
+		std::chrono::time_point<std::chrono::steady_clock> activationTimeOfSearchMode;
+
+		std::size_t numConflictsAtNextClauseDatabaseReduction;
+		std::size_t numLiteralsOfDeletedClauses;
+
+		// The phases are stored as flags for the positive polarity of the variable
+		std::vector<char> savedPhases;
+		std::vector<char> targetPhases;
+		std::vector<char> bestPhases;
+		std::size_t numAssignmentsOfTargetPhases;
+		std::size_t numAssignmentsOfBestPhases;
+		std::size_t numRephases;
+		std::size_t numConflictsAtNextRephasing;
+		std::size_t numPropagationTicksAtLastLocalSearch;
+		bool isInitialLocalSearchPending;
+		std::mt19937 randomNumberGenerator;
+
+		std::size_t numConflictsAtNextInprocessing;
+		std::size_t numPropagationTicksAtLastInprocessing;
+		std::size_t nextProbedVariable;
+		// Literals implied by a successful probe are stamped with the stamp of the probe, the stamps of the probes of a probing pass are larger than the stamp at the start of the pass
+		std::vector<std::size_t> probingStamps;
+		std::size_t currentProbingStamp;
+		// A literal is only probed again once further literals were assigned on the root decision level since its last probe
+		std::vector<std::size_t> perLiteralNumRootAssignmentsAtLastProbe;
+		// Rotating start positions (among the irredundant clauses) of the candidate enumeration of the (set) blocked clause elimination
+		std::size_t nextBlockedClauseEliminationCandidate;
+		std::size_t nextSetBlockedClauseEliminationCandidate;
+		bool wereClausesDeletedDuringInprocessing;
+		modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+
+		std::vector<VariableMarker> variableMarkers;
+		std::vector<std::size_t> markedVariables;
+		std::vector<RedundancyCheckStackEntry> redundancyCheckStack;
+		std::vector<std::size_t> shrinkingStamps;
+		std::size_t currentShrinkingStamp;
+		std::vector<std::size_t> decisionLevelStamps;
+		std::size_t currentDecisionLevelStamp;
+		std::vector<dimacs::ProblemDefinition::VariableValue> model;
+		SolverStatistics statistics;
+
+		[[nodiscard]] SolverResult search();
+		[[nodiscard]] bool addOriginalClause(std::vector<long> clauseLiterals);
+		[[nodiscard]] bool addOriginalClauseOfSharedFormula(std::size_t clauseIndexInSharedFormula);
+		[[nodiscard]] ClauseIndex addClauseToArena(const std::vector<long>& clauseLiterals, bool isLearned, std::uint32_t secondWatchedLiteralPosition);
+		void attachClause(ClauseIndex clauseIndex);
+		void detachClause(ClauseIndex clauseIndex, std::size_t& numTicks);
+		[[nodiscard]] ClauseIndex propagate();
+		[[nodiscard]] std::vector<long> analyzeConflict(ClauseIndex conflictingClause);
+		void minimizeLearnedClause(std::vector<long>& learnedClauseLiterals);
+		void shrinkLearnedClause(std::vector<long>& learnedClauseLiterals, std::uint32_t abstractDecisionLevelsOfClause);
+		[[nodiscard]] std::optional<long> determineUniqueImplicationPointOfDecisionLevel(const std::vector<long>& literalsOfDecisionLevel, std::size_t decisionLevel, std::uint32_t abstractDecisionLevelsOfClause);
+		[[nodiscard]] bool isLiteralRedundant(long literal, std::uint32_t abstractDecisionLevelsOfClause);
+		void markVariable(std::size_t variable, VariableMarker marker);
+		[[nodiscard]] std::size_t computeLiteralBlockDistance(const long* clauseLiterals, std::size_t numLiterals);
+		void markClauseAsUsedDuringConflictAnalysis(ClauseIndex clauseIndex);
+		[[nodiscard]] ClauseTier determineTierOfLearnedClause(std::size_t literalBlockDistance) const noexcept;
+		void moveLearnedClauseToTier(ClauseMetadata& clause, ClauseTier tier);
+		[[nodiscard]] bool isClauseDatabaseReductionDue() const noexcept;
+		void reduceClauseDatabase();
+		void deleteClause(ClauseIndex clauseIndex);
+		void collectGarbage();
+		[[nodiscard]] std::size_t determineBackjumpLevel(const std::vector<long>& learnedClauseLiterals, std::uint32_t& positionOfLiteralOnBackjumpLevel) const;
+		void backtrack(std::size_t decisionLevel);
+		void assignLiteral(long literal, ClauseIndex reason, std::size_t decisionLevel);
+		[[nodiscard]] std::size_t determineConflictLevel(ClauseIndex conflictingClause, std::size_t& numLiteralsOnConflictLevel, long& literalOnConflictLevel);
+		void watchLiteralsOfHighestDecisionLevels(ClauseIndex clauseIndex);
+		[[nodiscard]] std::size_t determineMaximumDecisionLevelOfClause(const ClauseMetadata& clause, long excludedLiteral) const;
+		void replaceWatchedLiteral(ClauseIndex clauseIndex, std::size_t watchIndex, std::uint32_t literalPosition);
+		[[nodiscard]] std::optional<long> pickBranchingLiteral();
+		[[nodiscard]] std::optional<long> pickAssumptionLiteral(bool& isAssumptionFalsified);
+		void determineFailedAssumptions(long falsifiedAssumption);
+		void increaseNumVariables(std::size_t numVariables);
+		[[nodiscard]] bool areTargetPhasesUsedInActiveSearchMode() const noexcept;
+		void updateTargetAndBestPhases(std::size_t numConflictFreeAssignments);
+		[[nodiscard]] bool isRephasingDue() const noexcept;
+		void rephase();
+		void seedPhasesByLocalSearch(std::size_t effort);
+		void recordModel();
+		[[nodiscard]] bool isInprocessingDue() const noexcept;
+		[[nodiscard]] bool inprocess();
+		[[nodiscard]] bool probeLiterals(std::size_t effort);
+		void subsumeClauses(std::size_t effort);
+		[[nodiscard]] bool vivifyClauses(std::size_t effort);
+		[[nodiscard]] std::vector<long> vivifyClause(ClauseIndex clauseIndex, const long* orderedClauseLiterals, std::uint32_t numLiterals, bool& isClauseImplied);
+		void eliminateBlockedClauses(std::size_t effort);
+		void eliminateSetBlockedClauses(std::size_t effort);
+		[[nodiscard]] dimacs::ProblemDefinition::ptr createProblemDefinitionOfIrredundantClauses(std::vector<ClauseIndex>& clauseIndicesInProblemDefinition, std::size_t& numTicks) const;
+		[[nodiscard]] bool restoreEliminatedClauses();
+		[[nodiscard]] bool isSearchModeSwitchDue() const noexcept;
+		void switchSearchMode();
+		void recordDurationOfActiveSearchMode();
+		void restart();
+		void exportLearnedClause(const std::vector<long>& learnedClauseLiterals, std::size_t literalBlockDistance);
+		[[nodiscard]] bool importClausesOfOtherWorkers();
+		[[nodiscard]] bool addImportedClause(const ClauseExchange::ExchangedClause& importedClause);
+		[[nodiscard]] std::size_t determineNumReusableDecisionLevels();
+
+		[[nodiscard]] static decisionHeuristics::BaseDecisionHeuristic::ptr createDecisionHeuristic(DecisionHeuristic decisionHeuristic);
+		[[nodiscard]] static restartPolicies::BaseRestartPolicy::ptr createRestartPolicy(RestartPolicy restartPolicy);
+
+		[[nodiscard]] const long* getLiteralsOfClause(const ClauseMetadata& clause) const noexcept
+		{
+			return (clause.isStoredInSharedFormula ? sharedClauseLiteralArena : clauseLiteralArena.data()) + clause.literalsOffset;
+		}
+
+		[[nodiscard]] bool isCancellationRequested() const noexcept
+		{
+			return (cancellationFlag && cancellationFlag->load(std::memory_order_relaxed)) || (resourceBudget && resourceBudget->isExhausted()) || (terminationCallback && terminationCallback());
+		}
+
+		[[nodiscard]] LiteralValue getLiteralValue(long literal) const noexcept
+		{
+			return literalValues[literalToIndex(literal)];
+		}
+
+		[[nodiscard]] bool isVariableAssigned(std::size_t variable) const noexcept
+		{
+			return getLiteralValue(static_cast<long>(variable)) != LiteralValue::Unassigned;
+		}
+
+		[[nodiscard]] std::size_t getCurrentDecisionLevel() const noexcept
+		{
+			return decisionLevelStartPositionsInTrail.size();
+		}
+
+		[[nodiscard]] std::uint32_t computeAbstractDecisionLevel(std::size_t variable) const noexcept
+		{
+			return static_cast<std::uint32_t>(1) << (variableAssignmentData[variable].decisionLevel & 31);
+		}
+
+		[[nodiscard]] static std::size_t literalToVariable(long literal) noexcept
+		{
+			return static_cast<std::size_t>(std::abs(literal));
+		}
+
+		[[nodiscard]] static std::size_t literalToIndex(long literal) noexcept
+		{
+			return (literalToVariable(literal) << 1) | static_cast<std::size_t>(literal < 0);
+		}
+	};
+
+	inline std::ostream& operator<<(std::ostream& os, const Solver::SolverStatistics& statistics)
+	{
+		os << "c decisions: " + std::to_string(statistics.numDecisions) + "\n";
+		os << "c propagations: " + std::to_string(statistics.numPropagations) + "\n";
+		os << "c conflicts: " + std::to_string(statistics.numConflicts) + "\n";
+		os << "c learned clauses: " + std::to_string(statistics.numLearnedClauses) + " (units: " + std::to_string(statistics.numLearnedUnitClauses) + ", literals: " + std::to_string(statistics.numLearnedLiterals) + ", minimized literals: " + std::to_string(statistics.numMinimizedLiterals) + ", shrunk literals: " + std::to_string(statistics.numShrunkLiterals) + ")\n";
+		os << "c backjumps: " + std::to_string(statistics.numBackjumps) + " (skipped decision levels: " + std::to_string(statistics.numSkippedDecisionLevelsDuringBackjumps) + ")\n";
+		os << "c max decision level: " + std::to_string(statistics.maxDecisionLevel) + "\n";
+		os << "c clause database reductions: " + std::to_string(statistics.numClauseDatabaseReductions) + " (deleted learned clauses: " + std::to_string(statistics.numDeletedLearnedClauses) + ", garbage collections: " + std::to_string(statistics.numGarbageCollections) + ")\n";
+		os << "c learned clauses per tier: core: " + std::to_string(statistics.numLearnedClausesPerTier[Solver::ClauseTier::Core]) + ", tier-2: " + std::to_string(statistics.numLearnedClausesPerTier[Solver::ClauseTier::TierTwo]) + ", local: " + std::to_string(statistics.numLearnedClausesPerTier[Solver::ClauseTier::Local]) + "\n";
+		os << "c rephases: " + std::to_string(statistics.numRephasesPerStrategy[Solver::RephasingStrategy::Original] + statistics.numRephasesPerStrategy[Solver::RephasingStrategy::Inverted] + statistics.numRephasesPerStrategy[Solver::RephasingStrategy::Best] + statistics.numRephasesPerStrategy[Solver::RephasingStrategy::Walk] + statistics.numRephasesPerStrategy[Solver::RephasingStrategy::Random]);
+		for (const Solver::RephasingStrategy rephasingStrategy : { Solver::RephasingStrategy::Original, Solver::RephasingStrategy::Inverted, Solver::RephasingStrategy::Best, Solver::RephasingStrategy::Walk, Solver::RephasingStrategy::Random })
+			os << (rephasingStrategy == Solver::RephasingStrategy::Original ? " (" : ", ") + Solver::stringifyRephasingStrategy(rephasingStrategy) + ": " + std::to_string(statistics.numRephasesPerStrategy[rephasingStrategy]);
+		os << ")\n";
+		os << "c local searches: " + std::to_string(statistics.localSearchStatistics.numSearches) + " (flips: " + std::to_string(statistics.localSearchStatistics.numFlips) + ", ticks: " + std::to_string(statistics.localSearchStatistics.numTicks)
+			+ ", found models: " + std::to_string(statistics.localSearchStatistics.numFoundModels) + ")\n";
+		os << "c propagation ticks: " + std::to_string(statistics.numPropagationTicks) + "\n";
+		os << "c inprocessing rounds: " + std::to_string(statistics.numInprocessingRounds) + " (restored eliminated clauses: " + std::to_string(statistics.numRestoredEliminatedClauses) + ")\n";
+		for (const Solver::InprocessingPass inprocessingPass : { Solver::InprocessingPass::Probing, Solver::InprocessingPass::Subsumption, Solver::InprocessingPass::Vivification, Solver::InprocessingPass::BlockedClauseElimination, Solver::InprocessingPass::SetBlockedClauseElimination })
+		{
+			const Solver::InprocessingPassStatistics& inprocessingPassStatistics = statistics.perInprocessingPassStatistics[inprocessingPass];
+			os << "c inprocessing pass " + Solver::stringifyInprocessingPass(inprocessingPass) + ": ticks: " + std::to_string(inprocessingPassStatistics.numTicks) + ", removed clauses: " + std::to_string(inprocessingPassStatistics.numRemovedClauses)
+				+ ", removed literals: " + std::to_string(inprocessingPassStatistics.numRemovedLiterals) + ", derived units: " + std::to_string(inprocessingPassStatistics.numDerivedUnitClauses) + ", added clauses: " + std::to_string(inprocessingPassStatistics.numAddedClauses) + "\n";
+		}
+		os << "c chronological backtracks: " + std::to_string(statistics.numChronologicalBacktracks) + " (retained assignments: " + std::to_string(statistics.numAssignmentsRetainedByChronologicalBacktracking) + ", retained out-of-order assignments: " + std::to_string(statistics.numRetainedOutOfOrderAssignments) + ", missed implications: " + std::to_string(statistics.numMissedImplications) + ")\n";
+		os << "c exchanged clauses: exported: " + std::to_string(statistics.numExportedClauses) + ", imported: " + std::to_string(statistics.numImportedClauses) + " (useful: " + std::to_string(statistics.numUsefulImportedClauses) + ", missed: " + std::to_string(statistics.numMissedImportedClauses) + ")\n";
+		os << "c restarts: " + std::to_string(statistics.numRestarts) + " (blocked: " + std::to_string(statistics.numBlockedRestarts) + ", reusing trail: " + std::to_string(statistics.numRestartsWithReusedTrail) + ", reused decision levels: " + std::to_string(statistics.numReusedDecisionLevels) + ")\n";
+		for (std::size_t searchMode = 0; searchMode < statistics.perSearchModeDecisionHeuristicStatistics.size(); ++searchMode)
+		{
+			const Solver::DecisionHeuristicStatistics& decisionHeuristicStatistics = statistics.perSearchModeDecisionHeuristicStatistics[searchMode];
+			if (!decisionHeuristicStatistics.numActivations)
+				continue;
+
+			const auto durationOfActivePhasesInMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(decisionHeuristicStatistics.durationOfActivePhases).count();
+			const double conflictsPerDecision = decisionHeuristicStatistics.numDecisions ? static_cast<double>(decisionHeuristicStatistics.numConflicts) / static_cast<double>(decisionHeuristicStatistics.numDecisions) : 0;
+			const double conflictsPerSecond = durationOfActivePhasesInMilliseconds ? static_cast<double>(decisionHeuristicStatistics.numConflicts) * 1000 / static_cast<double>(durationOfActivePhasesInMilliseconds) : 0;
+			os << "c " + std::string(searchMode == Solver::SearchMode::Focused ? "focused" : "stable") + " mode heuristic " + Solver::stringifyDecisionHeuristic(decisionHeuristicStatistics.decisionHeuristic)
+				+ ": activations: " + std::to_string(decisionHeuristicStatistics.numActivations)
+				+ ", decisions: " + std::to_string(decisionHeuristicStatistics.numDecisions)
+				+ ", conflicts: " + std::to_string(decisionHeuristicStatistics.numConflicts)
+				+ " (" + std::to_string(conflictsPerDecision) + " per decision, " + std::to_string(conflictsPerSecond) + " per second)"
+				+ ", duration: " + std::to_string(durationOfActivePhasesInMilliseconds) + "ms\n";
+		}
+		return os;
+	}
+}
+#endif
@@ -0,0 +1,60 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace solver
+{
+	/*
+	 * The queue of work items of a single worker, the owning worker pushes and pops work items at the back (processing the most recently created items first) while idle workers steal the
+	 * oldest items from the front. The work items of the cube-and-conquer solver are coarse-grained (every item is the solution of a whole cube), thus a lock per queue is sufficient.
+	 */
+	template<typename T>
+	class WorkStealingDeque
+	{
+	public:
+		using ptr = std::unique_ptr<WorkStealingDeque>;
+
+		void push(T workItem)
+		{
+			const std::lock_guard<std::mutex> lock(mutex);
+			workItems.emplace_back(std::move(workItem));
+		}
+
+		[[nodiscard]] std::optional<T> pop()
+		{
+			const std::lock_guard<std::mutex> lock(mutex);
+			if (workItems.empty())
+				return std::nullopt;
+
+			std::optional<T> workItem = std::move(workItems.back());
+			workItems.pop_back();
+			return workItem;
+		}
+
+		[[nodiscard]] std::optional<T> steal()
+		{
+			const std::lock_guard<std::mutex> lock(mutex);
+			if (workItems.empty())
+				return std::nullopt;
+
+			std::optional<T> workItem = std::move(workItems.front());
+			workItems.pop_front();
+			return workItem;
+		}
+
+		[[nodiscard]] std::size_t size() const
+		{
+			const std::lock_guard<std::mutex> lock(mutex);
+			return workItems.size();
+		}
+
+	protected:
+		mutable std::mutex mutex;
+		std::deque<T> workItems;
+	};
+}
+#endif
@@ -1,15 +1,22 @@
 #include "benchmark/commandLineArgumentParser.hpp"
+#include "budget/resourceBudget.hpp"
 #include "dimacs/dimacsParser.hpp"
 #include "optimizations/setBlockedClauseElimination/baseSetBlockedClauseEliminator.hpp"
 #include "optimizations/setBlockedClauseElimination/literalOccurrenceBlockingSetCandidateGenerator.hpp"
 #include "optimizations/setBlockedClauseElimination/literalOccurrenceSetBlockedClauseEliminator.hpp"
 #include "optimizations/setBlockedClauseElimination/avlIntervalTreeSetBlockedClauseEliminator.hpp"
 #include "optimizations/utils/clauseCandidateSelector.hpp"
+#include "proof/dratChecker.hpp"
+#include "proof/proofWriter.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 const std::string clauseSelectionHeuristicCommandLineKey = "-clauseSelectionHeuristic";
 const std::string clauseSelectionRngSeedCommandLineKey = "-clauseSelectionRngSeed";
@@ -22,6 +29,9 @@ const std::string blockingSetEliminatorSelectorCommandLineKey = "-blockingSetEli
 const std::string nClausesToConsiderCommandLineKey = "-nCandidates";
 const std::string nClauseMatchesCommandLineKey = "-nMatches";
 const std::string cnfFileCommandLineKey = "-cnf";
+const std::string proofFileCommandLineKey = "-proof";
+const std::string timeLimitCommandLineKey = "-timeLimit";
+const std::string tickLimitCommandLineKey = "-tickLimit";
 const std::string helpCommandLineKey = "--help";
 
 /*
@@ -40,6 +50,30 @@ std::chrono::milliseconds getDurationBetweenTimestamps(const TimePoint endTimest
 }
 
 
+budget::ResourceBudget::Limits generateResourceBudgetLimitsFromCommandLine(const utils::CommandLineArgumentParser& commandLineArgumentParser)
+{
+	budget::ResourceBudget::Limits resourceBudgetLimits;
+	if (const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& timeLimitCommandLineArgument = commandLineArgumentParser.getValueOfArgument(timeLimitCommandLineKey); timeLimitCommandLineArgument.has_value()
+		&& timeLimitCommandLineArgument->wasFoundInCommandLineArgument)
+	{
+		// The time limit is defined in seconds
+		const std::optional<int> userDefinedTimeLimit = timeLimitCommandLineArgument->tryGetArgumentValueAsInteger();
+		if (!userDefinedTimeLimit.has_value() || *userDefinedTimeLimit <= 0)
+			throw std::invalid_argument("Expected positive integer value for command line argument " + timeLimitCommandLineKey + " but was actually " + timeLimitCommandLineArgument->optionalArgumentValue.value_or(""));
+		resourceBudgetLimits.optionalWallClockLimit = std::chrono::seconds(*userDefinedTimeLimit);
+	}
+	if (const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& tickLimitCommandLineArgument = commandLineArgumentParser.getValueOfArgument(tickLimitCommandLineKey); tickLimitCommandLineArgument.has_value()
+		&& tickLimitCommandLineArgument->wasFoundInCommandLineArgument)
+	{
+		// The tick limit is defined in millions of ticks, contrary to the time limit the eliminated clauses do not depend on the machine running the benchmark
+		const std::optional<int> userDefinedTickLimit = tickLimitCommandLineArgument->tryGetArgumentValueAsInteger();
+		if (!userDefinedTickLimit.has_value() || *userDefinedTickLimit <= 0)
+			throw std::invalid_argument("Expected positive integer value for command line argument " + tickLimitCommandLineKey + " but was actually " + tickLimitCommandLineArgument->optionalArgumentValue.value_or(""));
+		resourceBudgetLimits.optionalTickLimit = static_cast<std::size_t>(*userDefinedTickLimit) * 1000000;
+	}
+	return resourceBudgetLimits;
+}
+
 enum LiteralSelectionHeuristic
 {
 	Sequential,
@@ -289,6 +323,43 @@ BlockingSetEliminatorType determineTypeOfBlockingSetEliminatorFromCommandLine(co
 	throw std::invalid_argument("Required command line argument " + blockingSetEliminatorSelectorCommandLineKey + " was not found");
 }
 
+proof::DratChecker::ptr initializeDratCheckerForFormula(const dimacs::ProblemDefinition& cnfFormula)
+{
+	auto dratChecker = std::make_unique<proof::DratChecker>(cnfFormula.getNumDeclaredVariablesOfFormula());
+	for (const dimacs::ProblemDefinition::Clause* clause : cnfFormula.getClauses())
+		dratChecker->addOriginalClause(clause->literals);
+	return dratChecker;
+}
+
+/*
+ * A clause C blocked by the set L is propagation redundant with respect to the witness consisting of L and the negated literals of C \ L, every worker checks a disjoint range of the found clauses with its own checker
+ * since the unit propagation of the checker modifies its state.
+ */
+std::vector<std::size_t> determineFoundClausesNotRedundantWithRespectToBlockingSet(const dimacs::ProblemDefinition& cnfFormula, const std::vector<std::size_t>& identifiersOfSetBlockedClauses,
+	const std::vector<setBlockedClauseElimination::BaseSetBlockedClauseEliminator::FoundBlockingSet>& foundBlockingSets, std::size_t firstFoundClause, std::size_t lastFoundClause)
+{
+	const proof::DratChecker::ptr dratChecker = initializeDratCheckerForFormula(cnfFormula);
+
+	std::vector<std::size_t> identifiersOfNotRedundantClauses;
+	std::vector<long> witness;
+	for (std::size_t i = firstFoundClause; i < lastFoundClause; ++i)
+	{
+		const std::vector<long>& clauseLiterals = cnfFormula.getClauseByIndexInFormula(identifiersOfSetBlockedClauses[i])->literals;
+		const std::vector<long>& blockingSet = foundBlockingSets[i];
+
+		witness = blockingSet;
+		for (const long literal : clauseLiterals)
+		{
+			if (std::find(blockingSet.cbegin(), blockingSet.cend(), literal) == blockingSet.cend())
+				witness.emplace_back(-literal);
+		}
+
+		if (!dratChecker->isClauseRedundantWithRespectToWitness(clauseLiterals, witness))
+			identifiersOfNotRedundantClauses.emplace_back(identifiersOfSetBlockedClauses[i]);
+	}
+	return identifiersOfNotRedundantClauses;
+}
+
 int main(int argc, char* argv[])
 {
 	std::unique_ptr<dimacs::DimacsParser> dimacsParser = std::make_unique<dimacs::DimacsParser>(dimacs::DimacsParser::ParserConfiguration({ false, true }));
@@ -310,6 +381,9 @@ int main(int argc, char* argv[])
 	commandLineArgumentParser.registerCommandLineArgument(helpCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
 	commandLineArgumentParser.registerCommandLineArgument(blockingSetEliminatorSelectorCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument());
 	commandLineArgumentParser.registerCommandLineArgument(clauseSelectionMaxAllowedClauseSizeCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(proofFileCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(timeLimitCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(tickLimitCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
 
 	try
 	{
@@ -331,9 +405,39 @@ int main(int argc, char* argv[])
 	if (!cnfFileCommandRegistration.has_value() || !cnfFileCommandRegistration->wasFoundInCommandLineArgument || !cnfFileCommandRegistration->optionalArgumentValue.has_value())
 		std::cerr << "Required cnf file path was no defined" << "\n";
 
+	// The search for set blocked clauses stops once the time limit is reached or the benchmark is interrupted by SIGINT or SIGTERM, the clauses found so far are still verified
+	budget::ResourceBudget::ptr resourceBudget;
+	try
+	{
+		resourceBudget = std::make_unique<budget::ResourceBudget>(generateResourceBudgetLimitsFromCommandLine(commandLineArgumentParser));
+		budget::ResourceBudget::installInterruptSignalHandlers();
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << "Failed to initialize resource budget, reason: " << ex.what() << "\n";
+		return EXIT_FAILURE;
+	}
+	dimacsParser->setResourceBudget(resourceBudget.get());
+
 	//const std::string dimacsSatFormulaFile = argv[1];
 	const std::string dimacsSatFormulaFile = cnfFileCommandRegistration->optionalArgumentValue.value();
 
+	// The deletions of the found set blocked clauses are recorded in a DRAT proof if the user requested it
+	std::ofstream proofFileStream;
+	proof::ProofWriter::ptr proofWriter;
+	const std::optional<std::string> proofFile = commandLineArgumentParser.getValueOfArgument(proofFileCommandLineKey)->optionalArgumentValue;
+	if (proofFile.has_value())
+	{
+		proofFileStream.open(*proofFile, std::ofstream::binary | std::ofstream::trunc);
+		if (!proofFileStream.is_open())
+		{
+			std::cerr << "Could not open proof file " + *proofFile + "\n";
+			return EXIT_FAILURE;
+		}
+		proofWriter = std::make_unique<proof::ProofWriter>(proofFileStream, proof::ProofWriter::ProofFormat::Drat);
+		dimacsParser->setProofWriter(proofWriter.get());
+	}
+
 	std::cout << "=== START - PROCESSING CNF ===\n";
 	const TimePoint dimacsFormulaParsingStartTime = getCurrentTime();
 	const dimacs::DimacsParser::ParseResult parsingResult = dimacsParser->readProblemFromFile(dimacsSatFormulaFile);
@@ -420,6 +524,7 @@ int main(int argc, char* argv[])
 		}
 		blockingSetEliminator = std::move(avlTreeBlockingSetEliminator);
 	}
+	blockingSetEliminator->setResourceBudget(resourceBudget.get());
 	const TimePoint blockingSetEliminatorInitEndTime = getCurrentTime();
 	const std::chrono::milliseconds blockingSetEliminatorInitDuration = getDurationBetweenTimestamps(blockingSetEliminatorInitEndTime, blockingSetEliminatorInitStartTime);
 	std::cout << "Duration for initialization of the blocking set eliminator " + std::to_string(blockingSetEliminatorInitDuration.count()) + "ms\n";
@@ -443,6 +548,7 @@ int main(int argc, char* argv[])
 	std::size_t remainingNumClausesForPercentageThreshold = numClausesToProcessUntilPercentageThresholdIsReached;
 
 	std::vector<std::size_t> identifiersOfSetBlockedClauses;
+	std::vector<setBlockedClauseElimination::BaseSetBlockedClauseEliminator::FoundBlockingSet> foundBlockingSets;
 	std::size_t numCandidatesConsidered = 0;
 
 	std::chrono::milliseconds totalBenchmarkExecutionTime = dimacsFormulaParsingDuration + clauseCandidateGeneratorInitDuration + blockingSetCandidateGeneratorInitDuration + blockingSetEliminatorInitDuration;
@@ -461,11 +567,21 @@ int main(int argc, char* argv[])
 			std::cout << "Reached required number of clause candidates, will stop search...\n";
 			break;
 		}
+		if (resourceBudget->isExhausted())
+		{
+			std::cout << "Resource budget exhausted (" + budget::ResourceBudget::stringifyExhaustionReason(resourceBudget->getExhaustionReason()) + "), will stop search...\n";
+			break;
+		}
 		++numCandidatesConsidered;
 
 		const TimePoint blockingSetCheckStartTime = getCurrentTime();
 		if (const std::optional<setBlockedClauseElimination::BaseSetBlockedClauseEliminator::FoundBlockingSet>& foundBlockingSet = blockingSetEliminator->determineBlockingSet(clauseIdentifier, *blockingSetCandidateGenerator, blockingSetCandidateGeneratorConfiguration.optionalCandidateSizeRestriction); foundBlockingSet.has_value())
+		{
 			identifiersOfSetBlockedClauses.emplace_back(clauseIdentifier);
+			foundBlockingSets.emplace_back(*foundBlockingSet);
+			if (proofWriter)
+				proofWriter->deleteClause(cnfFormula->getClauseByIndexInFormula(clauseIdentifier)->literals);
+		}
 
 		const TimePoint blockingSetCheckEndTime = getCurrentTime();
 		totalBenchmarkExecutionTime += getDurationBetweenTimestamps(blockingSetCheckEndTime, blockingSetCheckStartTime);
@@ -481,10 +597,66 @@ int main(int argc, char* argv[])
 	}
 	std::cout << "=== END - BLOCKING SET SEARCH ===\n\n";
 
+	if (proofWriter)
+	{
+		if (!proofWriter->close())
+		{
+			std::cerr << "Failed to write proof\n";
+			return EXIT_FAILURE;
+		}
+		std::cout << "Recorded deletion of " + std::to_string(proofWriter->getNumDeletedClauses()) + " clauses in proof\n\n";
+	}
+
 	std::cout << "=== BEGIN - VERIFICATION OF RESULTS ===\n";
 	const TimePoint resultVerificationStartTime = getCurrentTime();
 
-	std::cout << "SKIPPED FOR NOW...\n";
+	// The found clauses are verified by concurrent workers while the recorded proof is verified by an additional worker
+	const std::size_t numVerificationWorkers = std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), identifiersOfSetBlockedClauses.size()));
+	const std::size_t numFoundClausesPerWorker = (identifiersOfSetBlockedClauses.size() + numVerificationWorkers - 1) / numVerificationWorkers;
+
+	std::future<proof::DratChecker::CheckResult> proofVerificationResult;
+	if (proofWriter)
+	{
+		proofVerificationResult = std::async(std::launch::async, [&cnfFormula, &proofFile]() {
+			std::ifstream proofFileStream(*proofFile, std::ifstream::binary);
+			if (!proofFileStream.is_open())
+				throw std::invalid_argument("Could not open proof file " + *proofFile);
+			return initializeDratCheckerForFormula(*cnfFormula)->verifyProof(proofFileStream, proof::DratChecker::CheckingMode::Backward);
+		});
+	}
+
+	std::vector<std::future<std::vector<std::size_t>>> foundClauseVerificationResults;
+	for (std::size_t firstFoundClause = 0; firstFoundClause < identifiersOfSetBlockedClauses.size(); firstFoundClause += numFoundClausesPerWorker)
+	{
+		const std::size_t lastFoundClause = std::min(firstFoundClause + numFoundClausesPerWorker, identifiersOfSetBlockedClauses.size());
+		foundClauseVerificationResults.emplace_back(std::async(std::launch::async, determineFoundClausesNotRedundantWithRespectToBlockingSet, std::cref(*cnfFormula), std::cref(identifiersOfSetBlockedClauses), std::cref(foundBlockingSets), firstFoundClause, lastFoundClause));
+	}
+
+	std::vector<std::size_t> identifiersOfFailedClauses;
+	for (std::future<std::vector<std::size_t>>& foundClauseVerificationResult : foundClauseVerificationResults)
+	{
+		const std::vector<std::size_t> identifiersOfFailedClausesOfWorker = foundClauseVerificationResult.get();
+		identifiersOfFailedClauses.insert(identifiersOfFailedClauses.end(), identifiersOfFailedClausesOfWorker.cbegin(), identifiersOfFailedClausesOfWorker.cend());
+	}
+	std::cout << "Verified " + std::to_string(identifiersOfSetBlockedClauses.size() - identifiersOfFailedClauses.size()) + " out of " + std::to_string(identifiersOfSetBlockedClauses.size()) + " set blocked clauses using " + std::to_string(foundClauseVerificationResults.size()) + " workers\n";
+	for (const std::size_t clauseIdentifier : identifiersOfFailedClauses)
+		std::cout << "Clause " + std::to_string(clauseIdentifier) + " is not redundant with respect to its blocking set!\n";
+
+	bool wasProofVerified = true;
+	if (proofVerificationResult.valid())
+	{
+		try
+		{
+			const proof::DratChecker::CheckResult proofCheckResult = proofVerificationResult.get();
+			wasProofVerified = proofCheckResult.isProofValid;
+			std::cout << "Proof with " + std::to_string(proofCheckResult.numLemmas) + " lemmas and " + std::to_string(proofCheckResult.numDeletions) + " deletions was " + (wasProofVerified ? "verified" : "rejected") + "\n";
+		}
+		catch (const std::exception& ex)
+		{
+			wasProofVerified = false;
+			std::cout << "Failed to verify proof, reason: " << ex.what() << "\n";
+		}
+	}
 
 	const TimePoint resultVerificationEndTime = getCurrentTime();
 	const std::chrono::milliseconds resultVerificationDuration = getDurationBetweenTimestamps(resultVerificationEndTime, resultVerificationStartTime);
@@ -499,5 +671,5 @@ int main(int argc, char* argv[])
 	std::cout << "SBCE check duration: " + std::to_string(setBlockedClauseCheckDuration.count()) + "ms\n";
 	std::cout << "SBCE result verification duration: " + std::to_string(resultVerificationDuration.count()) + "ms\n";
 	std::cout << "TOTAL: " + std::to_string(totalBenchmarkExecutionTime.count()) + "ms\n";
-	return EXIT_SUCCESS;
+	return identifiersOfFailedClauses.empty() && wasProofVerified ? EXIT_SUCCESS : EXIT_FAILURE;
 }
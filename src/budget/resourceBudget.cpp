@@ -0,0 +1,159 @@
+#include "budget/resourceBudget.hpp"
+
+#include <csignal>
+#include <cstdio>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+using namespace budget;
+
+namespace
+{
+	// Only lock-free atomics can be accessed by a signal handler
+	static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "The interrupt flag set by the signal handler must be lock-free");
+	std::atomic_bool wasInterruptSignalReceivedByProcess(false);
+
+	// The polls are counted per thread since a shared counter would be contended by every worker polling the same budget
+	thread_local std::size_t numPollsOfThread = 0;
+
+	void handleInterruptSignal(int signalNumber)
+	{
+		wasInterruptSignalReceivedByProcess.store(true, std::memory_order_relaxed);
+		std::signal(signalNumber, SIG_DFL);
+	}
+}
+
+ResourceBudget::ResourceBudget(const Limits& limits)
+	: limits(limits), startTimeInTicksOfClock(std::chrono::steady_clock::now().time_since_epoch().count()), numConsumedConflicts(0), numConsumedTicks(0), exhaustionReason(ExhaustionReason::None), isInterruptRequested(false)
+{
+	if (limits.optionalMemoryLimitInBytes.has_value() && !*limits.optionalMemoryLimitInBytes)
+		throw std::invalid_argument("Memory limit must be larger than zero");
+}
+
+void ResourceBudget::chargeConflicts(std::size_t numConflicts) noexcept
+{
+	numConsumedConflicts.fetch_add(numConflicts, std::memory_order_relaxed);
+}
+
+void ResourceBudget::chargeTicks(std::size_t numTicks) noexcept
+{
+	numConsumedTicks.fetch_add(numTicks, std::memory_order_relaxed);
+}
+
+void ResourceBudget::interrupt() noexcept
+{
+	isInterruptRequested.store(true, std::memory_order_relaxed);
+}
+
+void ResourceBudget::restart() noexcept
+{
+	startTimeInTicksOfClock.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+	numConsumedConflicts.store(0, std::memory_order_relaxed);
+	numConsumedTicks.store(0, std::memory_order_relaxed);
+	isInterruptRequested.store(false, std::memory_order_relaxed);
+	exhaustionReason.store(ExhaustionReason::None, std::memory_order_relaxed);
+}
+
+bool ResourceBudget::isExhausted() noexcept
+{
+	if (exhaustionReason.load(std::memory_order_relaxed) != ExhaustionReason::None)
+		return true;
+	if (isInterruptRequested.load(std::memory_order_relaxed) || wasInterruptSignalReceivedByProcess.load(std::memory_order_relaxed))
+		return markAsExhausted(ExhaustionReason::Interrupted);
+	if (limits.optionalConflictLimit.has_value() && numConsumedConflicts.load(std::memory_order_relaxed) >= *limits.optionalConflictLimit)
+		return markAsExhausted(ExhaustionReason::ConflictLimit);
+	if (limits.optionalTickLimit.has_value() && numConsumedTicks.load(std::memory_order_relaxed) >= *limits.optionalTickLimit)
+		return markAsExhausted(ExhaustionReason::TickLimit);
+	if (!limits.optionalWallClockLimit.has_value() && !limits.optionalMemoryLimitInBytes.has_value())
+		return false;
+	return isSampledLimitExceeded(++numPollsOfThread);
+}
+
+ResourceBudget::ExhaustionReason ResourceBudget::getExhaustionReason() const noexcept
+{
+	return static_cast<ExhaustionReason>(exhaustionReason.load(std::memory_order_relaxed));
+}
+
+std::size_t ResourceBudget::getNumConsumedConflicts() const noexcept
+{
+	return numConsumedConflicts.load(std::memory_order_relaxed);
+}
+
+std::size_t ResourceBudget::getNumConsumedTicks() const noexcept
+{
+	return numConsumedTicks.load(std::memory_order_relaxed);
+}
+
+std::chrono::milliseconds ResourceBudget::getElapsedTime() const noexcept
+{
+	const TimePoint startTime = TimePoint(TimePoint::duration(startTimeInTicksOfClock.load(std::memory_order_relaxed)));
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+}
+
+const ResourceBudget::Limits& ResourceBudget::getLimits() const noexcept
+{
+	return limits;
+}
+
+void ResourceBudget::installInterruptSignalHandlers()
+{
+	for (const int signalNumber : { SIGINT, SIGTERM })
+	{
+		if (std::signal(signalNumber, handleInterruptSignal) == SIG_ERR)
+			throw std::runtime_error("Failed to install handler for signal " + std::to_string(signalNumber));
+	}
+}
+
+bool ResourceBudget::wasInterruptSignalReceived() noexcept
+{
+	return wasInterruptSignalReceivedByProcess.load(std::memory_order_relaxed);
+}
+
+void ResourceBudget::resetInterruptSignal() noexcept
+{
+	wasInterruptSignalReceivedByProcess.store(false, std::memory_order_relaxed);
+}
+
+std::optional<std::size_t> ResourceBudget::determineResidentSetSizeInBytes()
+{
+#if defined(__linux__)
+	// The second field of /proc/self/statm is the number of resident pages
+	std::FILE* statmFile = std::fopen("/proc/self/statm", "r");
+	if (!statmFile)
+		return std::nullopt;
+
+	std::size_t numResidentPages = 0;
+	const int numParsedFields = std::fscanf(statmFile, "%*s %zu", &numResidentPages);
+	std::fclose(statmFile);
+	if (numParsedFields != 1)
+		return std::nullopt;
+	return numResidentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+	return std::nullopt;
+#endif
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+bool ResourceBudget::markAsExhausted(ExhaustionReason reason) noexcept
+{
+	// Only the first determined reason is recorded if several threads exhaust the budget concurrently
+	char expectedExhaustionReason = ExhaustionReason::None;
+	exhaustionReason.compare_exchange_strong(expectedExhaustionReason, reason, std::memory_order_relaxed);
+	return true;
+}
+
+bool ResourceBudget::isSampledLimitExceeded(std::size_t numPollsOfThread) noexcept
+{
+	if (limits.optionalWallClockLimit.has_value() && !(numPollsOfThread % NUM_POLLS_PER_CLOCK_SAMPLE) && getElapsedTime() >= *limits.optionalWallClockLimit)
+		return markAsExhausted(ExhaustionReason::WallClockLimit);
+
+	if (limits.optionalMemoryLimitInBytes.has_value() && !(numPollsOfThread % NUM_POLLS_PER_MEMORY_SAMPLE))
+	{
+		if (const std::optional<std::size_t> residentSetSizeInBytes = determineResidentSetSizeInBytes(); residentSetSizeInBytes.has_value() && *residentSetSizeInBytes >= *limits.optionalMemoryLimitInBytes)
+			return markAsExhausted(ExhaustionReason::MemoryLimit);
+	}
+	return false;
+}
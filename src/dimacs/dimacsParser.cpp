@@ -1,6 +1,8 @@
 #include "dimacs/dimacsParser.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <string>
 
@@ -34,6 +36,16 @@ DimacsParser::ParseResult DimacsParser::readProblemFromString(const std::string&
 	return parseResult;
 }
 
+void DimacsParser::setProofWriter(proof::ProofWriter* proofWriter) noexcept
+{
+	this->proofWriter = proofWriter;
+}
+
+void DimacsParser::setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+{
+	this->resourceBudget = resourceBudget;
+}
+
 std::optional<ProblemDefinition::ptr> DimacsParser::parseDimacsContent(std::basic_istream<char>& stream, bool& wasFormulaDeterminedToBeUnsat)
 {
 	resetInternals();
@@ -58,15 +70,35 @@ std::optional<ProblemDefinition::ptr> DimacsParser::parseDimacsContent(std::basi
 	std::size_t processedClauseCounter = 0;
 	ProcessingError clauseParsingError;
 	temporaryProcessingErrorContainer = configuration.recordParsingErrors ? &clauseParsingError : nullptr;
+	// The literals of a clause are only recorded prior to their simplification by the current variable assignment if the latter needs to be logged in the proof
+	std::vector<long> parsedClauseLiterals;
+	std::vector<long>* optionalParsedClauseLiterals = proofWriter ? &parsedClauseLiterals : nullptr;
 
 	bool continueProcessing;
 	do
 	{
+		if (resourceBudget && resourceBudget->isExhausted())
+		{
+			recordError(currProcessedLine, 0, "Parsing was aborted since the resource budget was exhausted (" + budget::ResourceBudget::stringifyExhaustionReason(resourceBudget->getExhaustionReason()) + ")");
+			return std::nullopt;
+		}
+
 		++currProcessedLine;
-		std::optional<ProblemDefinition::Clause> parsedClause = parseClauseDefinition(stream, problemDefinitionConfiguration->numVariables, *problemDefinition, temporaryProcessingErrorContainer, wasFormulaDeterminedToBeUnsat);
+		std::optional<ProblemDefinition::Clause> parsedClause = parseClauseDefinition(stream, problemDefinitionConfiguration->numVariables, *problemDefinition, temporaryProcessingErrorContainer, wasFormulaDeterminedToBeUnsat, optionalParsedClauseLiterals);
 		if (!clauseParsingError.text.empty())
 			recordError(currProcessedLine, 0, clauseParsingError.text);
 
+		if (proofWriter && !foundErrorsDuringCurrentParsingAttempt && !parsedClauseLiterals.empty())
+		{
+			if (!parsedClause.has_value())
+				proofWriter->deleteClause(parsedClauseLiterals);
+			else if (parsedClause->literals.size() != parsedClauseLiterals.size())
+			{
+				proofWriter->addClause(parsedClause->literals);
+				proofWriter->deleteClause(parsedClauseLiterals);
+			}
+		}
+
 		++processedClauseCounter;
 		continueProcessing = stream.peek() && !stream.eof();
 
@@ -96,6 +128,13 @@ std::optional<ProblemDefinition::ptr> DimacsParser::parseDimacsContent(std::basi
 				for (std::size_t i = 0; i < numPerformedVariableAssignments; ++i)
 				{
 					const long l = pastAssignments.at(numAssignmentsPrioToUnitPropagation + i).assignedLiteral;
+					if (proofWriter)
+					{
+						// The first assignment is the one of the parsed unit clause while all remaining ones were determined by unit propagation
+						if (i)
+							proofWriter->addClause(&l, 1);
+						logSimplificationOfClausesByAssignment(*problemDefinition, l);
+					}
 					if (!removeClausesSatisfiedByUnitPropagation(*problemDefinition, l))
 						recordError(currProcessedLine, 0, "Error during removal of clauses containing unit propagated literal " + std::to_string(l));
 					if (!problemDefinition->removeLiteralFromClausesOfFormula(-l))
@@ -116,6 +155,9 @@ std::optional<ProblemDefinition::ptr> DimacsParser::parseDimacsContent(std::basi
 	if (processedClauseCounter != problemDefinitionConfiguration->numClauses)
 		recordError(currProcessedLine, 0, "Expected formula to contain " + std::to_string(problemDefinitionConfiguration->numClauses) + " clauses but " + std::to_string(processedClauseCounter) + " were parsed");
 
+	if (proofWriter && wasFormulaDeterminedToBeUnsat)
+		proofWriter->addEmptyClause();
+
 	// TODO: Local variable elimination
 	if (!foundErrorsDuringCurrentParsingAttempt)
 		return std::move(problemDefinition);
@@ -139,6 +181,35 @@ bool DimacsParser::removeClausesSatisfiedByUnitPropagation(ProblemDefinition& pr
 	return true;
 }
 
+void DimacsParser::logSimplificationOfClausesByAssignment(const ProblemDefinition& problemDefinition, long assignedLiteral) const
+{
+	const LiteralOccurrenceLookup& literalOccurrenceLookup = problemDefinition.getLiteralOccurrenceLookup();
+	if (const std::optional<const LiteralOccurrenceLookup::LiteralOccurrenceLookupEntry*> lookupEntry = literalOccurrenceLookup[assignedLiteral]; lookupEntry.has_value() && *lookupEntry)
+	{
+		for (const std::size_t clauseIndex : **lookupEntry)
+		{
+			if (const ProblemDefinition::Clause* satisfiedClause = problemDefinition.getClauseByIndexInFormula(clauseIndex); satisfiedClause)
+				proofWriter->deleteClause(satisfiedClause->literals);
+		}
+	}
+
+	std::vector<long> shortenedClauseLiterals;
+	if (const std::optional<const LiteralOccurrenceLookup::LiteralOccurrenceLookupEntry*> lookupEntry = literalOccurrenceLookup[-assignedLiteral]; lookupEntry.has_value() && *lookupEntry)
+	{
+		for (const std::size_t clauseIndex : **lookupEntry)
+		{
+			const ProblemDefinition::Clause* shortenedClause = problemDefinition.getClauseByIndexInFormula(clauseIndex);
+			if (!shortenedClause)
+				continue;
+
+			shortenedClauseLiterals.clear();
+			std::copy_if(shortenedClause->literals.cbegin(), shortenedClause->literals.cend(), std::back_inserter(shortenedClauseLiterals), [assignedLiteral](const long literal) { return literal != -assignedLiteral; });
+			proofWriter->addClause(shortenedClauseLiterals);
+			proofWriter->deleteClause(shortenedClause->literals);
+		}
+	}
+}
+
 void DimacsParser::resetInternals()
 {
 	foundErrorsDuringCurrentParsingAttempt = false;
@@ -258,8 +329,11 @@ inline std::optional<DimacsParser::ProblemDefinitionConfiguration> DimacsParser:
 	return ProblemDefinitionConfiguration({ static_cast<std::size_t>(*userDefinedNumberOfVariables), static_cast<std::size_t>(*userDefinedNumberOfClauses) });
 }
 
-std::optional<ProblemDefinition::Clause> DimacsParser::parseClauseDefinition(std::basic_istream<char>& inputStream, std::size_t numDefinedVariablesInCnf, const ProblemDefinition& variableValueLookupGateway, ProcessingError* optionalFoundErrors, bool& wasClauseDeterminedToBeUnsat)
+std::optional<ProblemDefinition::Clause> DimacsParser::parseClauseDefinition(std::basic_istream<char>& inputStream, std::size_t numDefinedVariablesInCnf, const ProblemDefinition& variableValueLookupGateway, ProcessingError* optionalFoundErrors, bool& wasClauseDeterminedToBeUnsat, std::vector<long>* optionalParsedClauseLiterals)
 {
+	if (optionalParsedClauseLiterals)
+		optionalParsedClauseLiterals->clear();
+
 	std::string clauseDefinition;
 	if (!std::getline(inputStream, clauseDefinition))
 		return std::nullopt;
@@ -301,6 +375,9 @@ std::optional<ProblemDefinition::Clause> DimacsParser::parseClauseDefinition(std
 		}
 		else
 		{
+			if (optionalParsedClauseLiterals)
+				optionalParsedClauseLiterals->emplace_back(*clauseLiteral);
+
 			const ProblemDefinition::VariableValue currentValueOfVariable = variableValueLookupGateway.getValueOfVariable(std::abs(*clauseLiteral)).value_or(ProblemDefinition::VariableValue::Unknown);
 			doesCurrentVariableAssignmentSatisfyClause |= currentValueOfVariable == ProblemDefinition::determineSatisfyingAssignmentForLiteral(*clauseLiteral);
 
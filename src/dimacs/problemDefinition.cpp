@@ -1,5 +1,6 @@
 #include "dimacs/problemDefinition.hpp"
 #include "optimizations/utils/binarySearchUtils.hpp"
+#include <cmath>
 #include <sstream>
 
 using namespace dimacs;
@@ -0,0 +1,164 @@
+#include "ipasir/ipasir.h"
+#include "solver/solver.hpp"
+
+#include <cstdlib>
+#include <exception>
+#include <vector>
+
+namespace
+{
+	struct IpasirSolver
+	{
+		IpasirSolver()
+			: solver(solver::SharedFormula::fromProblemDefinition(dimacs::ProblemDefinition(0, 0)), solver::Solver::SolverConfiguration()) {}
+
+		solver::Solver solver;
+		std::vector<long> literalsOfAddedClause;
+		// Assumptions are only valid for the next call of ipasir_solve
+		std::vector<long> assumptions;
+		std::vector<int32_t> learnedClauseBuffer;
+		// Exceptions cannot be propagated to C callers, thus a failed operation puts the solver into an error state in which further clauses are ignored and every call of ipasir_solve reports an unknown result
+		bool isInErrorState = false;
+	};
+
+	IpasirSolver& toIpasirSolver(void* solver)
+	{
+		return *static_cast<IpasirSolver*>(solver);
+	}
+}
+
+const char* ipasir_signature(void)
+{
+	return "cdcl-solver";
+}
+
+void* ipasir_init(void)
+{
+	try
+	{
+		return new IpasirSolver();
+	}
+	catch (const std::exception&)
+	{
+		return nullptr;
+	}
+}
+
+void ipasir_release(void* solver)
+{
+	delete static_cast<IpasirSolver*>(solver);
+}
+
+void ipasir_add(void* solver, int32_t lit_or_zero)
+{
+	IpasirSolver& ipasirSolver = toIpasirSolver(solver);
+	if (ipasirSolver.isInErrorState)
+		return;
+
+	try
+	{
+		if (lit_or_zero)
+		{
+			ipasirSolver.literalsOfAddedClause.emplace_back(lit_or_zero);
+			return;
+		}
+		ipasirSolver.solver.addClause(ipasirSolver.literalsOfAddedClause);
+	}
+	catch (const std::exception&)
+	{
+		ipasirSolver.isInErrorState = true;
+	}
+	ipasirSolver.literalsOfAddedClause.clear();
+}
+
+void ipasir_assume(void* solver, int32_t lit)
+{
+	IpasirSolver& ipasirSolver = toIpasirSolver(solver);
+	if (ipasirSolver.isInErrorState)
+		return;
+
+	try
+	{
+		ipasirSolver.assumptions.emplace_back(lit);
+	}
+	catch (const std::exception&)
+	{
+		ipasirSolver.isInErrorState = true;
+	}
+}
+
+int ipasir_solve(void* solver)
+{
+	IpasirSolver& ipasirSolver = toIpasirSolver(solver);
+	solver::Solver::SolverResult result = solver::Solver::SolverResult::Unknown;
+	try
+	{
+		if (!ipasirSolver.isInErrorState)
+		{
+			// Assumptions on variables that do not occur in any clause yet still need to be known to the solver
+			for (const long assumption : ipasirSolver.assumptions)
+			{
+				if (static_cast<std::size_t>(std::abs(assumption)) > ipasirSolver.solver.getNumVariables())
+					ipasirSolver.solver.addClause({ assumption, -assumption });
+			}
+			result = ipasirSolver.solver.solve(ipasirSolver.assumptions);
+		}
+	}
+	catch (const std::exception&)
+	{
+		ipasirSolver.isInErrorState = true;
+		result = solver::Solver::SolverResult::Unknown;
+	}
+	ipasirSolver.assumptions.clear();
+
+	switch (result)
+	{
+		case solver::Solver::SolverResult::Sat:
+			return 10;
+		case solver::Solver::SolverResult::Unsat:
+			return 20;
+		default:
+			return 0;
+	}
+}
+
+int32_t ipasir_val(void* solver, int32_t lit)
+{
+	const int32_t variable = lit < 0 ? -lit : lit;
+	const std::optional<dimacs::ProblemDefinition::VariableValue> value = toIpasirSolver(solver).solver.getValueOfVariable(static_cast<std::size_t>(variable));
+	if (!value.has_value() || *value == dimacs::ProblemDefinition::VariableValue::Unknown)
+		return 0;
+	return *value == dimacs::ProblemDefinition::VariableValue::High ? variable : -variable;
+}
+
+int ipasir_failed(void* solver, int32_t lit)
+{
+	return toIpasirSolver(solver).solver.isAssumptionFailed(lit) ? 1 : 0;
+}
+
+void ipasir_set_terminate(void* solver, void* data, int (*terminate)(void* data))
+{
+	if (!terminate)
+	{
+		toIpasirSolver(solver).solver.setTerminationCallback(nullptr);
+		return;
+	}
+	toIpasirSolver(solver).solver.setTerminationCallback([data, terminate] { return terminate(data) != 0; });
+}
+
+void ipasir_set_learn(void* solver, void* data, int max_length, void (*learn)(void* data, int32_t* clause))
+{
+	IpasirSolver& ipasirSolver = toIpasirSolver(solver);
+	if (!learn || max_length < 0)
+	{
+		ipasirSolver.solver.setLearnedClauseCallback(0, nullptr);
+		return;
+	}
+
+	ipasirSolver.solver.setLearnedClauseCallback(static_cast<std::size_t>(max_length), [&ipasirSolver, data, learn](const std::vector<long>& learnedClauseLiterals)
+	{
+		ipasirSolver.learnedClauseBuffer.assign(learnedClauseLiterals.cbegin(), learnedClauseLiterals.cend());
+		ipasirSolver.learnedClauseBuffer.emplace_back(0);
+		learn(data, ipasirSolver.learnedClauseBuffer.data());
+	});
+}
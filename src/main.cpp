@@ -1,14 +1,419 @@
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
+#include "benchmark/commandLineArgumentParser.hpp"
+#include "budget/resourceBudget.hpp"
 #include "dimacs/dimacsParser.hpp"
+#include "optimizations/blockedClauseElimination/blockingLiteralGenerator.hpp"
+#include "optimizations/blockedClauseElimination/literalOccurrenceBlockedClauseEliminator.hpp"
+#include "optimizations/boundedVariableElimination/boundedVariableEliminator.hpp"
+#include "optimizations/equivalentLiteralSubstitution/equivalentLiteralSubstitutor.hpp"
+#include "optimizations/modelReconstruction/modelChecker.hpp"
+#include "optimizations/modelReconstruction/modelReconstructionStack.hpp"
+#include "optimizations/subsumption/backwardSubsumptionEliminator.hpp"
+#include "optimizations/unhiding/transitiveBinaryClauseEliminator.hpp"
+#include "proof/proofWriter.hpp"
+#include "solver/cubeAndConquerSolver.hpp"
+#include "solver/portfolioSolver.hpp"
+#include "solver/solver.hpp"
+
+const std::string cnfFileCommandLineKey = "-cnf";
+const std::string blockedClauseEliminationCommandLineKey = "-bce";
+const std::string boundedVariableEliminationCommandLineKey = "-bve";
+const std::string subsumptionCommandLineKey = "-subsumption";
+const std::string equivalentLiteralSubstitutionCommandLineKey = "-els";
+const std::string unhidingCommandLineKey = "-unhide";
+const std::string conflictLimitCommandLineKey = "-conflictLimit";
+const std::string decisionHeuristicCommandLineKey = "-decisionHeuristic";
+const std::string stableModeDecisionHeuristicCommandLineKey = "-stableModeDecisionHeuristic";
+const std::string searchModeSwitchIntervalCommandLineKey = "-searchModeSwitchInterval";
+const std::string restartPolicyCommandLineKey = "-restartPolicy";
+const std::string stableModeRestartPolicyCommandLineKey = "-stableModeRestartPolicy";
+const std::string disableTrailReuseCommandLineKey = "-disableTrailReuse";
+const std::string disableLearnedClauseMinimizationCommandLineKey = "-disableMinimization";
+const std::string disableLearnedClauseShrinkingCommandLineKey = "-disableShrinking";
+const std::string disablePhaseSavingCommandLineKey = "-disablePhaseSaving";
+const std::string targetPhasesCommandLineKey = "-targetPhases";
+const std::string rephasingIntervalCommandLineKey = "-rephaseInterval";
+const std::string randomSeedCommandLineKey = "-seed";
+const std::string chronologicalBacktrackingThresholdCommandLineKey = "-chronoThreshold";
+const std::string inprocessingIntervalCommandLineKey = "-inprocessInterval";
+const std::string inprocessingTickIntervalCommandLineKey = "-inprocessTickInterval";
+const std::string initialLocalSearchEffortCommandLineKey = "-localSearch";
+const std::string localSearchAlgorithmCommandLineKey = "-localSearchAlgorithm";
+const std::string walkEffortCommandLineKey = "-walkEffort";
+const std::string numThreadsCommandLineKey = "-threads";
+const std::string disableClauseSharingCommandLineKey = "-disableClauseSharing";
+const std::string cubeDepthCommandLineKey = "-cubeDepth";
+const std::string cubeStallConflictsCommandLineKey = "-cubeStallConflicts";
+const std::string proofFileCommandLineKey = "-proof";
+const std::string timeLimitCommandLineKey = "-timeLimit";
+const std::string memoryLimitCommandLineKey = "-memoryLimit";
+const std::string tickLimitCommandLineKey = "-tickLimit";
+const std::string helpCommandLineKey = "--help";
+
+/*
+ * Prefer the usage of std::chrono::steady_clock instead of std::chrono::sytem_clock since the former cannot decrease (due to time zone changes, etc.) and is most suitable for measuring intervals according to (https://en.cppreference.com/w/cpp/chrono/steady_clock)
+ */
+using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+TimePoint getCurrentTime()
+{
+	return std::chrono::steady_clock::now();
+}
+
+std::chrono::milliseconds getDurationBetweenTimestamps(const TimePoint endTimestamp, const TimePoint startTimestamp)
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(endTimestamp - startTimestamp);
+}
+
+std::optional<solver::Solver::DecisionHeuristic> parseDecisionHeuristicFromCommandLine(const utils::CommandLineArgumentParser& commandLineArgumentParser, const std::string& commandLineKey)
+{
+	const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& decisionHeuristicCommandLineArgument = commandLineArgumentParser.getValueOfArgument(commandLineKey);
+	if (!decisionHeuristicCommandLineArgument.has_value() || !decisionHeuristicCommandLineArgument->wasFoundInCommandLineArgument)
+		return std::nullopt;
+
+	const std::string& userDefinedDecisionHeuristic = decisionHeuristicCommandLineArgument->optionalArgumentValue.value_or("");
+	for (const solver::Solver::DecisionHeuristic decisionHeuristic : { solver::Solver::DecisionHeuristic::Evsids, solver::Solver::DecisionHeuristic::LearningRateBranching, solver::Solver::DecisionHeuristic::Sequential })
+	{
+		if (userDefinedDecisionHeuristic == solver::Solver::stringifyDecisionHeuristic(decisionHeuristic))
+			return decisionHeuristic;
+	}
+	throw std::invalid_argument("Expected one of [evsids, lrb, sequential] for command line argument " + commandLineKey + " but was actually " + userDefinedDecisionHeuristic);
+}
+
+std::optional<solver::Solver::RestartPolicy> parseRestartPolicyFromCommandLine(const utils::CommandLineArgumentParser& commandLineArgumentParser, const std::string& commandLineKey)
+{
+	const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& restartPolicyCommandLineArgument = commandLineArgumentParser.getValueOfArgument(commandLineKey);
+	if (!restartPolicyCommandLineArgument.has_value() || !restartPolicyCommandLineArgument->wasFoundInCommandLineArgument)
+		return std::nullopt;
+
+	const std::string& userDefinedRestartPolicy = restartPolicyCommandLineArgument->optionalArgumentValue.value_or("");
+	for (const solver::Solver::RestartPolicy restartPolicy : { solver::Solver::RestartPolicy::NoRestarts, solver::Solver::RestartPolicy::Luby, solver::Solver::RestartPolicy::Glucose, solver::Solver::RestartPolicy::ReluctantDoubling })
+	{
+		if (userDefinedRestartPolicy == solver::Solver::stringifyRestartPolicy(restartPolicy))
+			return restartPolicy;
+	}
+	throw std::invalid_argument("Expected one of [none, luby, glucose, reluctantDoubling] for command line argument " + commandLineKey + " but was actually " + userDefinedRestartPolicy);
+}
+
+std::optional<std::size_t> parseNonNegativeIntegerFromCommandLine(const utils::CommandLineArgumentParser& commandLineArgumentParser, const std::string& commandLineKey)
+{
+	const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& integerCommandLineArgument = commandLineArgumentParser.getValueOfArgument(commandLineKey);
+	if (!integerCommandLineArgument.has_value() || !integerCommandLineArgument->wasFoundInCommandLineArgument)
+		return std::nullopt;
+
+	const std::optional<int> userDefinedValue = integerCommandLineArgument->tryGetArgumentValueAsInteger();
+	if (!userDefinedValue.has_value() || *userDefinedValue < 0)
+		throw std::invalid_argument("Expected non-negative integer value for command line argument " + commandLineKey + " but was actually " + integerCommandLineArgument->optionalArgumentValue.value_or(""));
+	return static_cast<std::size_t>(*userDefinedValue);
+}
+
+std::optional<solver::Solver::TargetPhaseUsage> parseTargetPhaseUsageFromCommandLine(const utils::CommandLineArgumentParser& commandLineArgumentParser, const std::string& commandLineKey)
+{
+	const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& targetPhaseUsageCommandLineArgument = commandLineArgumentParser.getValueOfArgument(commandLineKey);
+	if (!targetPhaseUsageCommandLineArgument.has_value() || !targetPhaseUsageCommandLineArgument->wasFoundInCommandLineArgument)
+		return std::nullopt;
+
+	const std::string& userDefinedTargetPhaseUsage = targetPhaseUsageCommandLineArgument->optionalArgumentValue.value_or("");
+	if (userDefinedTargetPhaseUsage == "never")
+		return solver::Solver::TargetPhaseUsage::Never;
+	if (userDefinedTargetPhaseUsage == "stable")
+		return solver::Solver::TargetPhaseUsage::StableModeOnly;
+	if (userDefinedTargetPhaseUsage == "always")
+		return solver::Solver::TargetPhaseUsage::Always;
+	throw std::invalid_argument("Expected one of [never, stable, always] for command line argument " + commandLineKey + " but was actually " + userDefinedTargetPhaseUsage);
+}
+
+std::optional<solver::LocalSearch::Algorithm> parseLocalSearchAlgorithmFromCommandLine(const utils::CommandLineArgumentParser& commandLineArgumentParser, const std::string& commandLineKey)
+{
+	const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& localSearchAlgorithmCommandLineArgument = commandLineArgumentParser.getValueOfArgument(commandLineKey);
+	if (!localSearchAlgorithmCommandLineArgument.has_value() || !localSearchAlgorithmCommandLineArgument->wasFoundInCommandLineArgument)
+		return std::nullopt;
+
+	const std::string& userDefinedLocalSearchAlgorithm = localSearchAlgorithmCommandLineArgument->optionalArgumentValue.value_or("");
+	if (userDefinedLocalSearchAlgorithm == solver::LocalSearch::stringifyAlgorithm(solver::LocalSearch::Algorithm::ProbSat))
+		return solver::LocalSearch::Algorithm::ProbSat;
+	if (userDefinedLocalSearchAlgorithm == solver::LocalSearch::stringifyAlgorithm(solver::LocalSearch::Algorithm::WalkSat))
+		return solver::LocalSearch::Algorithm::WalkSat;
+	throw std::invalid_argument("Expected one of [probsat, walksat] for command line argument " + commandLineKey + " but was actually " + userDefinedLocalSearchAlgorithm);
+}
+
+solver::Solver::SolverConfiguration generateSolverConfigurationFromCommandLine(const utils::CommandLineArgumentParser& commandLineArgumentParser)
+{
+	std::optional<std::size_t> optionalConflictLimit;
+	if (const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& conflictLimitCommandLineArgument = commandLineArgumentParser.getValueOfArgument(conflictLimitCommandLineKey); conflictLimitCommandLineArgument.has_value()
+		&& conflictLimitCommandLineArgument->wasFoundInCommandLineArgument)
+	{
+		const std::optional<int> userDefinedConflictLimit = conflictLimitCommandLineArgument->tryGetArgumentValueAsInteger();
+		if (!userDefinedConflictLimit.has_value() || *userDefinedConflictLimit < 0)
+			throw std::invalid_argument("Expected positive integer value for command line argument " + conflictLimitCommandLineKey + " but was actually " + conflictLimitCommandLineArgument->optionalArgumentValue.value_or(""));
+		optionalConflictLimit = static_cast<std::size_t>(*userDefinedConflictLimit);
+	}
+
+	solver::Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalConflictLimit = optionalConflictLimit;
+	if (const std::optional<solver::Solver::DecisionHeuristic> userDefinedDecisionHeuristic = parseDecisionHeuristicFromCommandLine(commandLineArgumentParser, decisionHeuristicCommandLineKey); userDefinedDecisionHeuristic.has_value())
+		solverConfiguration.decisionHeuristic = *userDefinedDecisionHeuristic;
+	solverConfiguration.optionalStableModeDecisionHeuristic = parseDecisionHeuristicFromCommandLine(commandLineArgumentParser, stableModeDecisionHeuristicCommandLineKey);
+
+	if (const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& searchModeSwitchIntervalCommandLineArgument = commandLineArgumentParser.getValueOfArgument(searchModeSwitchIntervalCommandLineKey); searchModeSwitchIntervalCommandLineArgument.has_value()
+		&& searchModeSwitchIntervalCommandLineArgument->wasFoundInCommandLineArgument)
+	{
+		const std::optional<int> userDefinedSearchModeSwitchInterval = searchModeSwitchIntervalCommandLineArgument->tryGetArgumentValueAsInteger();
+		if (!userDefinedSearchModeSwitchInterval.has_value() || *userDefinedSearchModeSwitchInterval <= 0)
+			throw std::invalid_argument("Expected positive integer value for command line argument " + searchModeSwitchIntervalCommandLineKey + " but was actually " + searchModeSwitchIntervalCommandLineArgument->optionalArgumentValue.value_or(""));
+		solverConfiguration.initialSearchModeSwitchConflictInterval = static_cast<std::size_t>(*userDefinedSearchModeSwitchInterval);
+	}
+
+	if (const std::optional<solver::Solver::RestartPolicy> userDefinedRestartPolicy = parseRestartPolicyFromCommandLine(commandLineArgumentParser, restartPolicyCommandLineKey); userDefinedRestartPolicy.has_value())
+		solverConfiguration.restartPolicy = *userDefinedRestartPolicy;
+	// The stable search mode, and thus its restart policy, is only used if a decision heuristic for it is defined
+	if (const std::optional<solver::Solver::RestartPolicy> userDefinedRestartPolicy = parseRestartPolicyFromCommandLine(commandLineArgumentParser, stableModeRestartPolicyCommandLineKey); userDefinedRestartPolicy.has_value())
+	{
+		if (!solverConfiguration.optionalStableModeDecisionHeuristic.has_value())
+			throw std::invalid_argument("Command line argument " + stableModeRestartPolicyCommandLineKey + " requires a decision heuristic for the stable search mode (" + stableModeDecisionHeuristicCommandLineKey + ")");
+		solverConfiguration.stableModeRestartPolicy = *userDefinedRestartPolicy;
+	}
+	solverConfiguration.isTrailReuseEnabled = !commandLineArgumentParser.getValueOfArgument(disableTrailReuseCommandLineKey)->wasFoundInCommandLineArgument;
+	solverConfiguration.isLearnedClauseMinimizationEnabled = !commandLineArgumentParser.getValueOfArgument(disableLearnedClauseMinimizationCommandLineKey)->wasFoundInCommandLineArgument;
+	solverConfiguration.isLearnedClauseShrinkingEnabled = !commandLineArgumentParser.getValueOfArgument(disableLearnedClauseShrinkingCommandLineKey)->wasFoundInCommandLineArgument;
+	solverConfiguration.isPhaseSavingEnabled = !commandLineArgumentParser.getValueOfArgument(disablePhaseSavingCommandLineKey)->wasFoundInCommandLineArgument;
+	if (const std::optional<solver::Solver::TargetPhaseUsage> userDefinedTargetPhaseUsage = parseTargetPhaseUsageFromCommandLine(commandLineArgumentParser, targetPhasesCommandLineKey); userDefinedTargetPhaseUsage.has_value())
+		solverConfiguration.targetPhaseUsage = *userDefinedTargetPhaseUsage;
+	// A rephasing interval of zero disables the rephasing
+	if (const std::optional<std::size_t> userDefinedRephasingInterval = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, rephasingIntervalCommandLineKey); userDefinedRephasingInterval.has_value())
+		solverConfiguration.optionalRephasingInterval = *userDefinedRephasingInterval ? userDefinedRephasingInterval : std::nullopt;
+	if (const std::optional<std::size_t> userDefinedRandomSeed = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, randomSeedCommandLineKey); userDefinedRandomSeed.has_value())
+		solverConfiguration.randomSeed = static_cast<std::uint32_t>(*userDefinedRandomSeed);
+	// A threshold of zero disables the chronological backtracking
+	if (const std::optional<std::size_t> userDefinedChronologicalBacktrackingThreshold = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, chronologicalBacktrackingThresholdCommandLineKey); userDefinedChronologicalBacktrackingThreshold.has_value())
+		solverConfiguration.optionalChronologicalBacktrackingThreshold = *userDefinedChronologicalBacktrackingThreshold ? userDefinedChronologicalBacktrackingThreshold : std::nullopt;
+	// An inprocessing interval of zero disables the inprocessing
+	if (const std::optional<std::size_t> userDefinedInprocessingInterval = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, inprocessingIntervalCommandLineKey); userDefinedInprocessingInterval.has_value())
+		solverConfiguration.optionalInprocessingInterval = *userDefinedInprocessingInterval ? userDefinedInprocessingInterval : std::nullopt;
+	// The inprocessing tick interval is defined in millions of ticks, an interval of zero disables the tick based schedule
+	if (const std::optional<std::size_t> userDefinedInprocessingTickInterval = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, inprocessingTickIntervalCommandLineKey); userDefinedInprocessingTickInterval.has_value())
+		solverConfiguration.optionalInprocessingTickInterval = *userDefinedInprocessingTickInterval ? std::make_optional(*userDefinedInprocessingTickInterval * 1000000) : std::nullopt;
+	// The effort of the initial local search is defined in millions of ticks while the effort of the walk rephasing is defined in per mille of the propagation ticks, an effort of zero disables the local search
+	if (const std::optional<std::size_t> userDefinedInitialLocalSearchEffort = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, initialLocalSearchEffortCommandLineKey); userDefinedInitialLocalSearchEffort.has_value())
+		solverConfiguration.optionalInitialLocalSearchEffort = *userDefinedInitialLocalSearchEffort ? std::make_optional(*userDefinedInitialLocalSearchEffort * 1000000) : std::nullopt;
+	if (const std::optional<std::size_t> userDefinedWalkEffort = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, walkEffortCommandLineKey); userDefinedWalkEffort.has_value())
+		solverConfiguration.localSearchEffortInPerMille = *userDefinedWalkEffort;
+	if (const std::optional<solver::LocalSearch::Algorithm> userDefinedLocalSearchAlgorithm = parseLocalSearchAlgorithmFromCommandLine(commandLineArgumentParser, localSearchAlgorithmCommandLineKey); userDefinedLocalSearchAlgorithm.has_value())
+		solverConfiguration.localSearchAlgorithm = *userDefinedLocalSearchAlgorithm;
+	return solverConfiguration;
+}
+
+budget::ResourceBudget::Limits generateResourceBudgetLimitsFromCommandLine(const utils::CommandLineArgumentParser& commandLineArgumentParser)
+{
+	/*
+	 * The time limit is defined in seconds, the tick limit in millions of ticks and the memory limit in megabytes, a limit of zero disables the limit. Contrary to the time limit, the result of a run
+	 * bounded by the tick limit does not depend on the machine.
+	 */
+	budget::ResourceBudget::Limits resourceBudgetLimits;
+	if (const std::optional<std::size_t> userDefinedTimeLimit = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, timeLimitCommandLineKey); userDefinedTimeLimit.has_value() && *userDefinedTimeLimit)
+		resourceBudgetLimits.optionalWallClockLimit = std::chrono::seconds(*userDefinedTimeLimit);
+	if (const std::optional<std::size_t> userDefinedMemoryLimit = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, memoryLimitCommandLineKey); userDefinedMemoryLimit.has_value() && *userDefinedMemoryLimit)
+		resourceBudgetLimits.optionalMemoryLimitInBytes = *userDefinedMemoryLimit << 20;
+	if (const std::optional<std::size_t> userDefinedTickLimit = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, tickLimitCommandLineKey); userDefinedTickLimit.has_value() && *userDefinedTickLimit)
+		resourceBudgetLimits.optionalTickLimit = *userDefinedTickLimit * 1000000;
+	return resourceBudgetLimits;
+}
+
+/*
+ * Returns no statistics if a literal is equivalent to its negation, i.e. the formula is unsatisfiable.
+ */
+std::optional<equivalentLiteralSubstitution::EquivalentLiteralSubstitutor::SubstitutionStatistics> substituteEquivalentLiterals(const dimacs::ProblemDefinition::ptr& cnfFormula, modelReconstruction::ModelReconstructionStack& modelReconstructionStack, proof::ProofWriter* optionalProofWriter, budget::ResourceBudget* resourceBudget)
+{
+	equivalentLiteralSubstitution::EquivalentLiteralSubstitutor equivalentLiteralSubstitutor(cnfFormula);
+	equivalentLiteralSubstitutor.setResourceBudget(resourceBudget);
+	equivalentLiteralSubstitutor.setProofWriter(optionalProofWriter);
+	if (!equivalentLiteralSubstitutor.substituteEquivalentLiterals(modelReconstructionStack))
+		return std::nullopt;
+	return equivalentLiteralSubstitutor.getStatistics();
+}
+
+/*
+ * Returns no statistics if both literals of a variable failed, i.e. the formula is unsatisfiable.
+ */
+std::optional<unhiding::TransitiveBinaryClauseEliminator::UnhidingStatistics> eliminateTransitiveBinaryClausesAndFailedLiterals(const dimacs::ProblemDefinition::ptr& cnfFormula, std::size_t randomSeed, proof::ProofWriter* optionalProofWriter, budget::ResourceBudget* resourceBudget)
+{
+	unhiding::TransitiveBinaryClauseEliminator::UnhidingConfiguration unhidingConfiguration;
+	unhidingConfiguration.randomSeed = randomSeed;
+	unhiding::TransitiveBinaryClauseEliminator transitiveBinaryClauseEliminator(cnfFormula, unhidingConfiguration);
+	transitiveBinaryClauseEliminator.setResourceBudget(resourceBudget);
+	transitiveBinaryClauseEliminator.setProofWriter(optionalProofWriter);
+	if (!transitiveBinaryClauseEliminator.eliminateTransitiveBinaryClausesAndFailedLiterals())
+		return std::nullopt;
+	return transitiveBinaryClauseEliminator.getStatistics();
+}
+
+/*
+ * Returns no statistics if a clause was strengthened to the empty clause, i.e. the formula is unsatisfiable.
+ */
+std::optional<subsumption::BackwardSubsumptionEliminator::SubsumptionStatistics> subsumeAndStrengthenClauses(const dimacs::ProblemDefinition::ptr& cnfFormula, std::size_t numThreads, proof::ProofWriter* optionalProofWriter, budget::ResourceBudget* resourceBudget)
+{
+	subsumption::BackwardSubsumptionEliminator::SubsumptionConfiguration subsumptionConfiguration;
+	subsumptionConfiguration.numThreads = numThreads;
+	subsumption::BackwardSubsumptionEliminator backwardSubsumptionEliminator(cnfFormula, subsumptionConfiguration);
+	backwardSubsumptionEliminator.setResourceBudget(resourceBudget);
+	backwardSubsumptionEliminator.setProofWriter(optionalProofWriter);
+	if (!backwardSubsumptionEliminator.subsumeAndStrengthenClauses())
+		return std::nullopt;
+	return backwardSubsumptionEliminator.getStatistics();
+}
+
+std::size_t eliminateBlockedClauses(const dimacs::ProblemDefinition::ptr& cnfFormula, modelReconstruction::ModelReconstructionStack& modelReconstructionStack, proof::ProofWriter* optionalProofWriter, budget::ResourceBudget* resourceBudget)
+{
+	blockedClauseElimination::LiteralOccurrenceBlockedClauseEliminator blockedClauseEliminator(cnfFormula);
+	blockedClauseEliminator.setResourceBudget(resourceBudget);
+	const blockedClauseElimination::BlockingLiteralGenerator::ptr blockingLiteralGenerator = blockedClauseElimination::BlockingLiteralGenerator::usingSequentialLiteralSelectionHeuristic();
+
+	std::vector<std::size_t> identifiersOfClauses = cnfFormula->getIdentifiersOfClauses();
+	std::sort(identifiersOfClauses.begin(), identifiersOfClauses.end());
+
+	std::size_t numEliminatedClauses = 0;
+	for (const std::size_t clauseIdentifier : identifiersOfClauses)
+	{
+		if (resourceBudget && resourceBudget->isExhausted())
+			break;
+
+		const std::optional<long> blockingLiteral = blockedClauseEliminator.determineBlockingLiteralOfClause(clauseIdentifier, *blockingLiteralGenerator);
+		if (!blockingLiteral.has_value())
+			continue;
+
+		const std::vector<long>& clauseLiterals = cnfFormula->getClauseByIndexInFormula(clauseIdentifier)->literals;
+		modelReconstructionStack.addBlockedClause(*blockingLiteral, clauseLiterals);
+		// Deletions are not checked in a DRAT proof, thus the blocked clause can simply be deleted
+		if (optionalProofWriter)
+			optionalProofWriter->deleteClause(clauseLiterals);
+		if (cnfFormula->removeClause(clauseIdentifier))
+			++numEliminatedClauses;
+	}
+	return numEliminatedClauses;
+}
+
+/*
+ * Returns no statistics if the elimination derived the empty clause as a resolvent, i.e. the formula is unsatisfiable.
+ */
+std::optional<boundedVariableElimination::BoundedVariableEliminator::EliminationStatistics> eliminateVariables(const dimacs::ProblemDefinition::ptr& cnfFormula, modelReconstruction::ModelReconstructionStack& modelReconstructionStack, proof::ProofWriter* optionalProofWriter, budget::ResourceBudget* resourceBudget)
+{
+	boundedVariableElimination::BoundedVariableEliminator boundedVariableEliminator(cnfFormula, boundedVariableElimination::BoundedVariableEliminator::EliminationConfiguration());
+	boundedVariableEliminator.setResourceBudget(resourceBudget);
+	boundedVariableEliminator.setProofWriter(optionalProofWriter);
+	if (!boundedVariableEliminator.eliminateVariables(modelReconstructionStack))
+		return std::nullopt;
+	return boundedVariableEliminator.getStatistics();
+}
+
+/*
+ * Flushes the remaining clauses of the proof (if any is recorded) to the proof file, a failed write is reported on the error stream. Closing an already closed proof only reports the result of its first close.
+ */
+bool closeProofWriter(proof::ProofWriter* optionalProofWriter)
+{
+	if (optionalProofWriter && !optionalProofWriter->close())
+	{
+		std::cerr << "Failed to write proof\n";
+		return false;
+	}
+	return true;
+}
+
+// Closes the proof of the unsatisfiable formula and reports the result, returns the exit code of the executable
+int reportUnsatisfiableFormula(proof::ProofWriter* optionalProofWriter)
+{
+	if (!closeProofWriter(optionalProofWriter))
+		return EXIT_FAILURE;
+
+	std::cout << "s UNSATISFIABLE\n";
+	return 20;
+}
 
 int main(int argc, char* argv[])
 {
-	if (argc != 2)
+	auto commandLineArgumentParser = utils::CommandLineArgumentParser();
+	commandLineArgumentParser.registerCommandLineArgument(cnfFileCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(blockedClauseEliminationCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(subsumptionCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(boundedVariableEliminationCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(equivalentLiteralSubstitutionCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(unhidingCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(conflictLimitCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(decisionHeuristicCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(stableModeDecisionHeuristicCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(searchModeSwitchIntervalCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(restartPolicyCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(stableModeRestartPolicyCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(disableTrailReuseCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(disableLearnedClauseMinimizationCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(disableLearnedClauseShrinkingCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(disablePhaseSavingCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(targetPhasesCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(rephasingIntervalCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(randomSeedCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(chronologicalBacktrackingThresholdCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(inprocessingIntervalCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(inprocessingTickIntervalCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(initialLocalSearchEffortCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(localSearchAlgorithmCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(walkEffortCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(numThreadsCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(disableClauseSharingCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(cubeDepthCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(cubeStallConflictsCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(proofFileCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createStringArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(timeLimitCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(memoryLimitCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(tickLimitCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createIntegerArgument().asOptionalArgument());
+	commandLineArgumentParser.registerCommandLineArgument(helpCommandLineKey, utils::CommandLineArgumentParser::CommandLineArgumentRegistration::createValueLessArgument().asOptionalArgument());
+
+	try
+	{
+		commandLineArgumentParser.processCommandLineArguments(argc, argv);
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << "Failed to parse command line arguments, reason: " << ex.what() << "\n";
+		return EXIT_FAILURE;
+	}
+
+	if (const std::optional<utils::CommandLineArgumentParser::CommandLineArgumentRegistration>& helpCommandRegistation = commandLineArgumentParser.getValueOfArgument(helpCommandLineKey); helpCommandRegistation.has_value() && helpCommandRegistation->wasFoundInCommandLineArgument)
+	{
+		std::cout << commandLineArgumentParser << "\n";
+		return EXIT_SUCCESS;
+	}
+
+	solver::Solver::SolverConfiguration solverConfiguration;
+	std::size_t numThreads = 1;
+	// The cube-and-conquer mode is only used if the depth of the initial split of the formula into cubes is defined
+	std::optional<solver::CubeAndConquerSolver::CubeAndConquerConfiguration> cubeAndConquerConfiguration;
+	budget::ResourceBudget::Limits resourceBudgetLimits;
+	try
+	{
+		solverConfiguration = generateSolverConfigurationFromCommandLine(commandLineArgumentParser);
+		resourceBudgetLimits = generateResourceBudgetLimitsFromCommandLine(commandLineArgumentParser);
+		numThreads = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, numThreadsCommandLineKey).value_or(1);
+		if (!numThreads)
+			throw std::invalid_argument("Expected positive integer value for command line argument " + numThreadsCommandLineKey);
+
+		if (const std::optional<std::size_t> userDefinedCubeDepth = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, cubeDepthCommandLineKey); userDefinedCubeDepth.has_value())
+		{
+			cubeAndConquerConfiguration = solver::CubeAndConquerSolver::CubeAndConquerConfiguration();
+			cubeAndConquerConfiguration->initialCubeDepth = *userDefinedCubeDepth;
+			cubeAndConquerConfiguration->numConflictsUntilCubeIsStalled = parseNonNegativeIntegerFromCommandLine(commandLineArgumentParser, cubeStallConflictsCommandLineKey).value_or(cubeAndConquerConfiguration->numConflictsUntilCubeIsStalled);
+			cubeAndConquerConfiguration->isClauseSharingEnabled = !commandLineArgumentParser.getValueOfArgument(disableClauseSharingCommandLineKey)->wasFoundInCommandLineArgument;
+		}
+		if (commandLineArgumentParser.getValueOfArgument(proofFileCommandLineKey)->wasFoundInCommandLineArgument && (numThreads > 1 || cubeAndConquerConfiguration.has_value()))
+			throw std::invalid_argument("Proof can only be recorded by a single solver, thus command line argument " + proofFileCommandLineKey + " cannot be combined with " + numThreadsCommandLineKey + " > 1 or " + cubeDepthCommandLineKey);
+	}
+	catch (const std::invalid_argument& ex)
 	{
-		std::cerr << "Solver expected only one argument which defines the path to the SAT formula\n";
+		std::cerr << "Validation of command line arguments failed, reason: " << ex.what() << "\n";
 		return EXIT_FAILURE;
 	}
 
@@ -19,8 +424,59 @@ int main(int argc, char* argv[])
 		return EXIT_FAILURE;
 	}
 
-	const std::string dimacsSatFormulaFile = argv[1];
+	// The limits apply to the whole run (parsing, preprocessing and solving) while SIGINT and SIGTERM stop the run at the next poll of the budget with an unknown result
+	budget::ResourceBudget resourceBudget(resourceBudgetLimits);
+	try
+	{
+		budget::ResourceBudget::installInterruptSignalHandlers();
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << "Failed to install signal handlers, reason: " << ex.what() << "\n";
+		return EXIT_FAILURE;
+	}
+	dimacsParser->setResourceBudget(&resourceBudget);
+
+	// The proof file stream is declared before the writer to guarantee that the writer is closed (and thus flushes its buffers) before the stream is destroyed
+	std::ofstream proofFileStream;
+	proof::ProofWriter::ptr proofWriter;
+	if (const std::optional<std::string> proofFile = commandLineArgumentParser.getValueOfArgument(proofFileCommandLineKey)->optionalArgumentValue; proofFile.has_value())
+	{
+		proofFileStream.open(*proofFile, std::ofstream::binary | std::ofstream::trunc);
+		if (!proofFileStream.is_open())
+		{
+			std::cerr << "Could not open proof file " + *proofFile + "\n";
+			return EXIT_FAILURE;
+		}
+		proofWriter = std::make_unique<proof::ProofWriter>(proofFileStream, proof::ProofWriter::ProofFormat::Drat);
+		dimacsParser->setProofWriter(proofWriter.get());
+	}
+
+	// The formula can also be passed as the first positional argument (i.e. SolverExecutable <file> [options]) as in previous versions of the executable
+	std::optional<std::string> optionalDimacsSatFormulaFile = commandLineArgumentParser.getValueOfArgument(cnfFileCommandLineKey)->optionalArgumentValue;
+	if (!optionalDimacsSatFormulaFile.has_value() && argc > 1 && argv[1][0] != '-')
+		optionalDimacsSatFormulaFile = argv[1];
+	if (!optionalDimacsSatFormulaFile.has_value())
+	{
+		std::cerr << "No CNF file was specified, use " + cnfFileCommandLineKey + " <file> or pass the file as the first argument\n";
+		return EXIT_FAILURE;
+	}
+	const std::string dimacsSatFormulaFile = *optionalDimacsSatFormulaFile;
+	std::cout << "c === START - PROCESSING CNF ===\n";
+	const TimePoint dimacsFormulaParsingStartTime = getCurrentTime();
 	const dimacs::DimacsParser::ParseResult parsingResult = dimacsParser->readProblemFromFile(dimacsSatFormulaFile);
+	const TimePoint dimacsFormulaParsingEndTime = getCurrentTime();
+	const std::chrono::milliseconds dimacsFormulaParsingDuration = getDurationBetweenTimestamps(dimacsFormulaParsingEndTime, dimacsFormulaParsingStartTime);
+	std::cout << "c Duration for processing of cnf formula: " + std::to_string(dimacsFormulaParsingDuration.count()) + "ms\n";
+	std::cout << "c === END - PROCESSING CNF ===\n";
+
+	if (resourceBudget.getExhaustionReason() != budget::ResourceBudget::ExhaustionReason::None)
+	{
+		std::cout << "c Resource budget exhausted during parsing (" + budget::ResourceBudget::stringifyExhaustionReason(resourceBudget.getExhaustionReason()) + ")\n";
+		std::cout << "s UNKNOWN\n";
+		return EXIT_SUCCESS;
+	}
+
 	if (parsingResult.determinedAnyErrors)
 	{
 		std::ostringstream out;
@@ -33,6 +489,203 @@ int main(int argc, char* argv[])
 		std::cerr << out.str() << "\n";
 		return EXIT_FAILURE;
 	}
-	std::cout << "Parsing of SAT formula @ " + dimacsSatFormulaFile + " OK\n";
-	return EXIT_SUCCESS;
+	if (!parsingResult.formula.has_value())
+		return EXIT_FAILURE;
+
+	std::cout << "c Parsing of SAT formula @ " + dimacsSatFormulaFile + " OK\n";
+	if (parsingResult.wasFormulaDeterminedToBeUnsat)
+	{
+		std::cout << "c Unit propagation during parsing determined formula to be unsatisfiable\n";
+		return reportUnsatisfiableFormula(proofWriter.get());
+	}
+	const dimacs::ProblemDefinition::ptr& cnfFormula = parsingResult.formula.value();
+
+	// The model reported for the formula is validated against the clauses and the assignments determined during parsing
+	modelReconstruction::ModelChecker modelChecker;
+	for (const dimacs::ProblemDefinition::Clause* clause : cnfFormula->getClauses())
+		modelChecker.addClause(clause->literals);
+	for (const dimacs::ProblemDefinition::PastAssignment& pastAssignment : cnfFormula->getPastAssignments())
+		modelChecker.addClause({ pastAssignment.assignedLiteral });
+
+	std::cout << "c === START - PREPROCESSING ===\n";
+	const TimePoint preprocessingStartTime = getCurrentTime();
+	const bool shouldBlockedClausesBeEliminated = commandLineArgumentParser.getValueOfArgument(blockedClauseEliminationCommandLineKey)->wasFoundInCommandLineArgument;
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	if (commandLineArgumentParser.getValueOfArgument(equivalentLiteralSubstitutionCommandLineKey)->wasFoundInCommandLineArgument)
+	{
+		// Equivalent literals are substituted first since the substitution reduces the number of variables and the rewritten clauses can be subsumed by other clauses
+		const std::optional<equivalentLiteralSubstitution::EquivalentLiteralSubstitutor::SubstitutionStatistics> substitutionStatistics = substituteEquivalentLiterals(cnfFormula, modelReconstructionStack, proofWriter.get(), &resourceBudget);
+		if (!substitutionStatistics.has_value())
+		{
+			std::cout << "c Equivalent literal substitution determined formula to be unsatisfiable\n";
+			return reportUnsatisfiableFormula(proofWriter.get());
+		}
+		std::cout << "c Substituted " + std::to_string(substitutionStatistics->numSubstitutedVariables) + " variables of " + std::to_string(substitutionStatistics->numEquivalenceClasses) + " equivalence classes, rewrote " + std::to_string(substitutionStatistics->numRewrittenClauses) + " clauses and removed " + std::to_string(substitutionStatistics->numRemovedClauses) + " tautologies\n";
+	}
+	if (commandLineArgumentParser.getValueOfArgument(unhidingCommandLineKey)->wasFoundInCommandLineArgument)
+	{
+		// The binary implication graph is acyclic after the substitution of equivalent literals, thus the search trees of the unhiding cover more implications
+		const std::optional<unhiding::TransitiveBinaryClauseEliminator::UnhidingStatistics> unhidingStatistics = eliminateTransitiveBinaryClausesAndFailedLiterals(cnfFormula, solverConfiguration.randomSeed, proofWriter.get(), &resourceBudget);
+		if (!unhidingStatistics.has_value())
+		{
+			std::cout << "c Failed literal detection during unhiding determined formula to be unsatisfiable\n";
+			return reportUnsatisfiableFormula(proofWriter.get());
+		}
+		std::cout << "c Removed " + std::to_string(unhidingStatistics->numRemovedTransitiveClauses) + " transitive binary clauses and derived " + std::to_string(unhidingStatistics->numFailedLiterals) + " failed literals in " + std::to_string(unhidingStatistics->numRounds) + " rounds\n";
+	}
+	if (commandLineArgumentParser.getValueOfArgument(subsumptionCommandLineKey)->wasFoundInCommandLineArgument)
+	{
+		// Subsumed clauses are removed first since they would otherwise be visited during the checks of the blocked clause elimination
+		const std::optional<subsumption::BackwardSubsumptionEliminator::SubsumptionStatistics> subsumptionStatistics = subsumeAndStrengthenClauses(cnfFormula, numThreads, proofWriter.get(), &resourceBudget);
+		if (!subsumptionStatistics.has_value())
+		{
+			std::cout << "c Strengthening of clauses determined formula to be unsatisfiable\n";
+			return reportUnsatisfiableFormula(proofWriter.get());
+		}
+		std::cout << "c Removed " + std::to_string(subsumptionStatistics->numSubsumedClauses) + " subsumed clauses and strengthened " + std::to_string(subsumptionStatistics->numStrengthenedClauses) + " clauses in " + std::to_string(subsumptionStatistics->numRounds) + " rounds\n";
+	}
+	const std::size_t numEliminatedClauses = shouldBlockedClausesBeEliminated ? eliminateBlockedClauses(cnfFormula, modelReconstructionStack, proofWriter.get(), &resourceBudget) : 0;
+	std::cout << "c Eliminated " + std::to_string(numEliminatedClauses) + " blocked clauses\n";
+	if (commandLineArgumentParser.getValueOfArgument(boundedVariableEliminationCommandLineKey)->wasFoundInCommandLineArgument)
+	{
+		const std::optional<boundedVariableElimination::BoundedVariableEliminator::EliminationStatistics> eliminationStatistics = eliminateVariables(cnfFormula, modelReconstructionStack, proofWriter.get(), &resourceBudget);
+		if (!eliminationStatistics.has_value())
+		{
+			std::cout << "c Bounded variable elimination determined formula to be unsatisfiable\n";
+			return reportUnsatisfiableFormula(proofWriter.get());
+		}
+		std::cout << "c Eliminated " + std::to_string(eliminationStatistics->numEliminatedVariables) + " variables by replacing " + std::to_string(eliminationStatistics->numRemovedClauses) + " clauses with " + std::to_string(eliminationStatistics->numAddedResolvents) + " resolvents, " + std::to_string(eliminationStatistics->numSubsumedClauses) + " clauses were subsumed by resolvents\n";
+	}
+	const TimePoint preprocessingEndTime = getCurrentTime();
+	const std::chrono::milliseconds preprocessingDuration = getDurationBetweenTimestamps(preprocessingEndTime, preprocessingStartTime);
+	std::cout << "c " + std::to_string(cnfFormula->getNumClausesAfterOptimizations()) + " clauses remain after preprocessing\n";
+	std::cout << "c Duration for preprocessing: " + std::to_string(preprocessingDuration.count()) + "ms\n";
+	std::cout << "c === END - PREPROCESSING ===\n";
+
+	std::cout << "c === START - SOLVING ===\n";
+	const TimePoint solvingStartTime = getCurrentTime();
+	solver::Solver::ptr cdclSolver;
+	solver::PortfolioSolver::ptr portfolioSolver;
+	solver::CubeAndConquerSolver::ptr cubeAndConquerSolver;
+	try
+	{
+		if (cubeAndConquerConfiguration.has_value())
+		{
+			cubeAndConquerSolver = std::make_unique<solver::CubeAndConquerSolver>(*cnfFormula, numThreads, solverConfiguration, *cubeAndConquerConfiguration);
+			cubeAndConquerSolver->setResourceBudget(&resourceBudget);
+		}
+		else if (numThreads > 1)
+		{
+			portfolioSolver = std::make_unique<solver::PortfolioSolver>(*cnfFormula, numThreads, solverConfiguration, !commandLineArgumentParser.getValueOfArgument(disableClauseSharingCommandLineKey)->wasFoundInCommandLineArgument);
+			portfolioSolver->setResourceBudget(&resourceBudget);
+		}
+		else
+		{
+			cdclSolver = std::make_unique<solver::Solver>(*cnfFormula, solverConfiguration);
+			cdclSolver->setProofWriter(proofWriter.get());
+			cdclSolver->setResourceBudget(&resourceBudget);
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << "Failed to initialize solver, reason: " << ex.what() << "\n";
+		return EXIT_FAILURE;
+	}
+
+	solver::Solver::SolverResult solverResult = solver::Solver::SolverResult::Unknown;
+	try
+	{
+		if (cubeAndConquerSolver)
+			solverResult = cubeAndConquerSolver->solve();
+		else
+			solverResult = portfolioSolver ? portfolioSolver->solve() : cdclSolver->solve();
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << "Solving failed, reason: " << ex.what() << "\n";
+		return EXIT_FAILURE;
+	}
+	const TimePoint solvingEndTime = getCurrentTime();
+	const std::chrono::milliseconds solvingDuration = getDurationBetweenTimestamps(solvingEndTime, solvingStartTime);
+	if (portfolioSolver)
+	{
+		// Only the statistics of the winning worker (or the first worker if no worker determined a result) are reported in detail
+		const std::size_t reportedWorkerIndex = portfolioSolver->getIndexOfWinningWorker().value_or(0);
+		std::cout << "c portfolio workers: " + std::to_string(portfolioSolver->getNumWorkers()) + ", reported worker: " + std::to_string(reportedWorkerIndex)
+			+ (portfolioSolver->getIndexOfWinningWorker().has_value() ? " (winner)" : "") + "\n";
+
+		std::size_t numExportedClauses = 0;
+		std::size_t numImportedClauses = 0;
+		std::size_t numUsefulImportedClauses = 0;
+		for (std::size_t workerIndex = 0; workerIndex < portfolioSolver->getNumWorkers(); ++workerIndex)
+		{
+			const solver::Solver::SolverStatistics& statisticsOfWorker = portfolioSolver->getStatisticsOfWorker(workerIndex);
+			numExportedClauses += statisticsOfWorker.numExportedClauses;
+			numImportedClauses += statisticsOfWorker.numImportedClauses;
+			numUsefulImportedClauses += statisticsOfWorker.numUsefulImportedClauses;
+		}
+		std::cout << "c portfolio exchanged clauses: exported: " + std::to_string(numExportedClauses) + ", imported: " + std::to_string(numImportedClauses) + " (useful: " + std::to_string(numUsefulImportedClauses) + ")\n";
+		std::cout << portfolioSolver->getStatisticsOfWorker(reportedWorkerIndex);
+	}
+	else if (cubeAndConquerSolver)
+	{
+		const solver::CubeAndConquerSolver::CubeAndConquerStatistics cubeAndConquerStatistics = cubeAndConquerSolver->getStatistics();
+		std::cout << "c cube-and-conquer workers: " + std::to_string(cubeAndConquerSolver->getNumWorkers())
+			+ ", initial cubes: " + std::to_string(cubeAndConquerStatistics.numInitialCubes)
+			+ ", refuted cubes: " + std::to_string(cubeAndConquerStatistics.numRefutedCubes)
+			+ ", stalled cubes: " + std::to_string(cubeAndConquerStatistics.numStalledCubes) + " (resplit into: " + std::to_string(cubeAndConquerStatistics.numResplitCubes) + ")"
+			+ ", stolen cubes: " + std::to_string(cubeAndConquerStatistics.numStolenCubes) + "\n";
+		if (cubeAndConquerSolver->getIndexOfWinningWorker().has_value())
+			std::cout << cubeAndConquerSolver->getStatisticsOfWorker(*cubeAndConquerSolver->getIndexOfWinningWorker());
+	}
+	else
+		std::cout << cdclSolver->getStatistics();
+	if (proofWriter)
+	{
+		if (!closeProofWriter(proofWriter.get()))
+			return EXIT_FAILURE;
+		std::cout << "c proof: added clauses: " + std::to_string(proofWriter->getNumAddedClauses()) + ", deleted clauses: " + std::to_string(proofWriter->getNumDeletedClauses()) + ", written bytes: " + std::to_string(proofWriter->getNumWrittenBytes()) + "\n";
+	}
+	std::cout << "c Duration for solving: " + std::to_string(solvingDuration.count()) + "ms\n";
+	std::cout << "c === END - SOLVING ===\n";
+	std::cout << "c TOTAL: " + std::to_string((dimacsFormulaParsingDuration + preprocessingDuration + solvingDuration).count()) + "ms\n";
+
+	switch (solverResult)
+	{
+		case solver::Solver::SolverResult::Sat:
+		{
+			std::vector<long> model;
+			if (cubeAndConquerSolver)
+				model = cubeAndConquerSolver->getModel();
+			else
+				model = portfolioSolver ? portfolioSolver->getModel() : cdclSolver->getModel();
+
+			// The model of the reduced formula can falsify some of the eliminated clauses, thus it is extended to a model of the original formula
+			model = modelReconstructionStack.reconstructModel(model);
+			if (const std::optional<std::size_t> falsifiedClause = modelChecker.determineFirstFalsifiedClause(model); falsifiedClause.has_value())
+			{
+				std::ostringstream out;
+				for (const long literal : modelChecker.getLiteralsOfClause(*falsifiedClause))
+					out << " " << std::to_string(literal);
+				std::cerr << "Model falsifies clause" << out.str() << " of the formula\n";
+				return EXIT_FAILURE;
+			}
+
+			std::cout << "s SATISFIABLE\n";
+			std::ostringstream out;
+			out << "v";
+			for (const long literal : model)
+				out << " " << std::to_string(literal);
+			out << " 0\n";
+			std::cout << out.str();
+			return 10;
+		}
+		case solver::Solver::SolverResult::Unsat:
+			return reportUnsatisfiableFormula(proofWriter.get());
+		default:
+			if (resourceBudget.getExhaustionReason() != budget::ResourceBudget::ExhaustionReason::None)
+				std::cout << "c Resource budget exhausted (" + budget::ResourceBudget::stringifyExhaustionReason(resourceBudget.getExhaustionReason()) + ")\n";
+			std::cout << "s UNKNOWN\n";
+			return EXIT_SUCCESS;
+	}
 }
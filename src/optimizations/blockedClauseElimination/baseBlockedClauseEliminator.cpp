@@ -8,19 +8,33 @@ std::optional<long> BaseBlockedClauseEliminator::determineBlockingLiteralOfClaus
 	if (!referencedClause)
 		return std::nullopt;
 
+	// The initialization of the generator looks up the occurrences of every literal of the clause
+	std::size_t numTicksAtLastCharge = numTicks;
+	numTicks += budget::determineNumTicksOfSequentialAccess<long>(referencedClause->literals.size()) + referencedClause->literals.size();
 	blockingLiteralGenerator.init(referencedClause->literals, problemDefinition->getLiteralOccurrenceLookup());
 	std::optional<long> potentiallyBlockingLiteral = blockingLiteralGenerator.getNextCandiate();
 
-	while (potentiallyBlockingLiteral.has_value())
+	while (potentiallyBlockingLiteral.has_value() && !(resourceBudget && resourceBudget->isExhausted()))
 	{
-		if (doesEveryClauseInResolutionEnvironmentFullfillLiteralBlockedCondition(*referencedClause, *potentiallyBlockingLiteral))
+		++numTicks;
+		const bool isClauseBlocked = doesEveryClauseInResolutionEnvironmentFullfillLiteralBlockedCondition(*referencedClause, *potentiallyBlockingLiteral);
+		chargeTicksToResourceBudget(numTicksAtLastCharge);
+		if (isClauseBlocked)
 			return *potentiallyBlockingLiteral;
 
 		potentiallyBlockingLiteral = blockingLiteralGenerator.getNextCandiate();
 	}
+	chargeTicksToResourceBudget(numTicksAtLastCharge);
 	return std::nullopt;
 }
 
+void BaseBlockedClauseEliminator::chargeTicksToResourceBudget(std::size_t& numTicksAtLastCharge) const noexcept
+{
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicks - numTicksAtLastCharge);
+	numTicksAtLastCharge = numTicks;
+}
+
 bool BaseBlockedClauseEliminator::checkLiteralBlockedCondition(const dimacs::ProblemDefinition::Clause& clauseToCheck, long potentiallyBlockingLiteral, const std::vector<long>& literalOfClauseInResolutionEnvironment)
 {
 	// A clause C is blocked by a literal l iff for every C' with -l \in C': C \union C' \{-l} is a tautology
@@ -1,5 +1,6 @@
 #include "optimizations/blockedClauseElimination/blockingLiteralGenerator.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 using namespace blockedClauseElimination;
@@ -0,0 +1,342 @@
+#include "optimizations/boundedVariableElimination/boundedVariableEliminator.hpp"
+#include "budget/effortTicks.hpp"
+
+#include <algorithm>
+
+using namespace boundedVariableElimination;
+
+BoundedVariableEliminator::BoundedVariableEliminator(dimacs::ProblemDefinition::ptr problemDefinition, const EliminationConfiguration& configuration)
+	: problemDefinition(std::move(problemDefinition)), configuration(configuration), resourceBudget(nullptr), proofWriter(nullptr), numVariables(0), nextClauseIdentifier(0), statistics({})
+{
+	if (!this->problemDefinition)
+		throw std::invalid_argument("Problem definition cannot be null");
+	if (!configuration.maximumResolventSize)
+		throw std::invalid_argument("Maximum size of resolvents must be larger than zero");
+
+	numVariables = this->problemDefinition->getNumDeclaredVariablesOfFormula();
+	positionsInCandidateQueue.resize(numVariables + 1, NOT_IN_CANDIDATE_QUEUE);
+	isVariableEliminated.resize(numVariables + 1, 0);
+	isLiteralMarked.resize((numVariables + 1) * 2, 0);
+}
+
+void BoundedVariableEliminator::setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+{
+	this->resourceBudget = resourceBudget;
+}
+
+void BoundedVariableEliminator::setProofWriter(proof::ProofWriter* proofWriter) noexcept
+{
+	this->proofWriter = proofWriter;
+}
+
+bool BoundedVariableEliminator::eliminateVariables(modelReconstruction::ModelReconstructionStack& modelReconstructionStack)
+{
+	const std::vector<std::size_t> identifiersOfClauses = problemDefinition->getIdentifiersOfClauses();
+	nextClauseIdentifier = identifiersOfClauses.empty() ? 0 : *std::max_element(identifiersOfClauses.cbegin(), identifiersOfClauses.cend()) + 1;
+	for (std::size_t variable = 1; variable <= numVariables; ++variable)
+	{
+		if (!isVariableEliminated[variable] && positionsInCandidateQueue[variable] == NOT_IN_CANDIDATE_QUEUE && problemDefinition->getValueOfVariable(variable) == dimacs::ProblemDefinition::VariableValue::Unknown)
+			pushCandidate(variable);
+	}
+
+	bool wasEmptyResolventDerived = false;
+	std::size_t numTicksAtLastCharge = statistics.numTicks;
+	while (!candidateQueue.empty() && !wasEmptyResolventDerived)
+	{
+		if (resourceBudget && resourceBudget->isExhausted())
+			break;
+
+		const std::size_t variable = popCandidate();
+		if (tryToEliminateVariable(variable, modelReconstructionStack, wasEmptyResolventDerived))
+		{
+			++statistics.numEliminatedVariables;
+			eliminatedVariables.emplace_back(variable);
+		}
+
+		if (resourceBudget)
+			resourceBudget->chargeTicks(statistics.numTicks - numTicksAtLastCharge);
+		numTicksAtLastCharge = statistics.numTicks;
+	}
+
+	if (wasEmptyResolventDerived && proofWriter)
+		proofWriter->addEmptyClause();
+	return !wasEmptyResolventDerived;
+}
+
+const std::vector<std::size_t>& BoundedVariableEliminator::getEliminatedVariables() const noexcept
+{
+	return eliminatedVariables;
+}
+
+const BoundedVariableEliminator::EliminationStatistics& BoundedVariableEliminator::getStatistics() const noexcept
+{
+	return statistics;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+
+/*
+ * The resolvents are only determined after the number of occurrences of both literals was checked against the occurrence limit, their computation is aborted as soon as the number of non-tautological
+ * resolvents exceeds the number of replaced clauses (plus the configured bound) or a resolvent exceeds the size limit. Thus the effort per candidate is bounded by the squared occurrence limit.
+ */
+bool BoundedVariableEliminator::tryToEliminateVariable(std::size_t variable, modelReconstruction::ModelReconstructionStack& modelReconstructionStack, bool& wasEmptyResolventDerived)
+{
+	const auto positiveLiteral = static_cast<long>(variable);
+	const std::vector<std::size_t> positiveOccurrences = determineSortedOccurrencesOfLiteral(positiveLiteral);
+	const std::vector<std::size_t> negativeOccurrences = determineSortedOccurrencesOfLiteral(-positiveLiteral);
+	if ((positiveOccurrences.empty() && negativeOccurrences.empty()) || positiveOccurrences.size() > configuration.maximumNumOccurrencesPerLiteral || negativeOccurrences.size() > configuration.maximumNumOccurrencesPerLiteral)
+		return false;
+
+	std::vector<std::vector<long>> positiveClauses;
+	std::vector<std::vector<long>> negativeClauses;
+	for (const auto& [occurrences, clausesOfLiteral] : { std::make_pair(&positiveOccurrences, &positiveClauses), std::make_pair(&negativeOccurrences, &negativeClauses) })
+	{
+		clausesOfLiteral->reserve(occurrences->size());
+		for (const std::size_t clauseIdentifier : *occurrences)
+		{
+			// The clause is stored in a separate allocation of the unordered container of the formula
+			const dimacs::ProblemDefinition::Clause* clause = problemDefinition->getClauseByIndexInFormula(clauseIdentifier);
+			statistics.numTicks += 1 + budget::determineNumTicksOfSequentialAccess<long>(clause ? clause->literals.size() : 0);
+			if (!clause)
+				return false;
+			clausesOfLiteral->emplace_back(clause->literals);
+		}
+	}
+
+	const std::size_t maximumNumResolvents = positiveClauses.size() + negativeClauses.size() + configuration.maximumNumAdditionalClauses;
+	std::vector<std::vector<long>> resolvents;
+	std::vector<long> resolventLiterals;
+	for (const std::vector<long>& positiveClauseLiterals : positiveClauses)
+	{
+		for (const std::vector<long>& negativeClauseLiterals : negativeClauses)
+		{
+			statistics.numTicks += budget::determineNumTicksOfSequentialAccess<long>(positiveClauseLiterals.size() + negativeClauseLiterals.size());
+			if (!resolve(positiveClauseLiterals, negativeClauseLiterals, variable, resolventLiterals))
+				continue;
+
+			if (resolventLiterals.empty())
+			{
+				wasEmptyResolventDerived = true;
+				return false;
+			}
+			if (resolventLiterals.size() > configuration.maximumResolventSize || resolvents.size() == maximumNumResolvents)
+				return false;
+			resolvents.emplace_back(resolventLiterals);
+		}
+	}
+
+	std::vector<std::size_t> touchedVariables;
+	std::vector<std::size_t> resolventIdentifiers;
+	resolventIdentifiers.reserve(resolvents.size());
+	for (const std::vector<long>& resolvent : resolvents)
+	{
+		if (proofWriter)
+			proofWriter->addClause(resolvent);
+		if (!problemDefinition->addClause(nextClauseIdentifier, dimacs::ProblemDefinition::Clause(resolvent)))
+			throw std::runtime_error("Failed to add resolvent with identifier " + std::to_string(nextClauseIdentifier) + " to formula");
+
+		resolventIdentifiers.emplace_back(nextClauseIdentifier++);
+		++statistics.numAddedResolvents;
+		for (const long literal : resolvent)
+			touchedVariables.emplace_back(literalToVariable(literal));
+	}
+
+	// The replaced clauses are satisfied during the model reconstruction by assigning the literal of the eliminated variable contained in the falsified clause
+	for (const auto& [occurrences, clausesOfLiteral, witnessLiteral] : { std::make_tuple(&positiveOccurrences, &positiveClauses, positiveLiteral), std::make_tuple(&negativeOccurrences, &negativeClauses, -positiveLiteral) })
+	{
+		for (std::size_t i = 0; i < occurrences->size(); ++i)
+		{
+			const std::vector<long>& clauseLiterals = (*clausesOfLiteral)[i];
+			modelReconstructionStack.addEliminatedClause({ witnessLiteral }, clauseLiterals);
+			if (proofWriter)
+				proofWriter->deleteClause(clauseLiterals);
+			static_cast<void>(problemDefinition->removeClause((*occurrences)[i]));
+			++statistics.numRemovedClauses;
+			for (const long literal : clauseLiterals)
+				touchedVariables.emplace_back(literalToVariable(literal));
+		}
+	}
+	isVariableEliminated[variable] = 1;
+
+	for (std::size_t i = 0; i < resolvents.size(); ++i)
+	{
+		// The resolvent might have been subsumed by a previously added resolvent
+		if (problemDefinition->getClauseByIndexInFormula(resolventIdentifiers[i]))
+			removeClausesSubsumedByResolvent(resolventIdentifiers[i], resolvents[i], touchedVariables);
+	}
+	rescheduleVariables(touchedVariables);
+	return true;
+}
+
+std::vector<std::size_t> BoundedVariableEliminator::determineSortedOccurrencesOfLiteral(long literal)
+{
+	const std::optional<const dimacs::LiteralOccurrenceLookup::LiteralOccurrenceLookupEntry*> occurrencesOfLiteral = problemDefinition->getLiteralOccurrenceLookup()[literal];
+	if (!occurrencesOfLiteral.has_value() || !*occurrencesOfLiteral)
+		return {};
+
+	// The occurrences are sorted to make the order of the resolvents independent of the iteration order of the unordered container
+	std::vector<std::size_t> sortedOccurrences((*occurrencesOfLiteral)->cbegin(), (*occurrencesOfLiteral)->cend());
+	std::sort(sortedOccurrences.begin(), sortedOccurrences.end());
+	statistics.numTicks += budget::determineNumTicksOfNodeBasedAccess(sortedOccurrences.size());
+	return sortedOccurrences;
+}
+
+/*
+ * Determines the resolvent of the two clauses on the given variable, returns false if the resolvent is a tautology.
+ */
+bool BoundedVariableEliminator::resolve(const std::vector<long>& positiveClauseLiterals, const std::vector<long>& negativeClauseLiterals, std::size_t variable, std::vector<long>& resolventLiterals)
+{
+	resolventLiterals.clear();
+	for (const long literal : positiveClauseLiterals)
+	{
+		if (literalToVariable(literal) == variable || isLiteralMarked[literalToIndex(literal)])
+			continue;
+
+		isLiteralMarked[literalToIndex(literal)] = 1;
+		resolventLiterals.emplace_back(literal);
+	}
+	const std::size_t numLiteralsOfPositiveClause = resolventLiterals.size();
+
+	bool isTautology = false;
+	for (auto literalIterator = negativeClauseLiterals.cbegin(); literalIterator != negativeClauseLiterals.cend() && !isTautology; ++literalIterator)
+	{
+		const long literal = *literalIterator;
+		if (literalToVariable(literal) == variable || isLiteralMarked[literalToIndex(literal)])
+			continue;
+
+		isTautology = isLiteralMarked[literalToIndex(-literal)];
+		resolventLiterals.emplace_back(literal);
+	}
+
+	for (std::size_t i = 0; i < numLiteralsOfPositiveClause; ++i)
+		isLiteralMarked[literalToIndex(resolventLiterals[i])] = 0;
+	return !isTautology;
+}
+
+/*
+ * Backward subsumption: The clauses subsumed by the resolvent are a subset of the clauses containing the literal of the resolvent with the fewest occurrences.
+ */
+void BoundedVariableEliminator::removeClausesSubsumedByResolvent(std::size_t resolventIdentifier, const std::vector<long>& resolventLiterals, std::vector<std::size_t>& touchedVariables)
+{
+	const long literalWithFewestOccurrences = *std::min_element(resolventLiterals.cbegin(), resolventLiterals.cend(), [this](const long lLiteral, const long rLiteral)
+	{
+		return determineNumOccurrencesOfLiteral(lLiteral) < determineNumOccurrencesOfLiteral(rLiteral);
+	});
+	const std::vector<std::size_t> subsumedClauseCandidates = determineSortedOccurrencesOfLiteral(literalWithFewestOccurrences);
+
+	for (const long literal : resolventLiterals)
+		isLiteralMarked[literalToIndex(literal)] = 1;
+
+	for (const std::size_t candidateIdentifier : subsumedClauseCandidates)
+	{
+		const dimacs::ProblemDefinition::Clause* candidateClause = problemDefinition->getClauseByIndexInFormula(candidateIdentifier);
+		++statistics.numTicks;
+		if (candidateIdentifier == resolventIdentifier || !candidateClause || candidateClause->literals.size() < resolventLiterals.size())
+			continue;
+
+		statistics.numTicks += budget::determineNumTicksOfSequentialAccess<long>(candidateClause->literals.size());
+		const auto numMarkedLiterals = static_cast<std::size_t>(std::count_if(candidateClause->literals.cbegin(), candidateClause->literals.cend(), [this](const long literal) { return isLiteralMarked[literalToIndex(literal)]; }));
+		if (numMarkedLiterals != resolventLiterals.size())
+			continue;
+
+		// Subsumed clauses are implied by the resolvent, thus their removal does not need to be recorded on the model reconstruction stack
+		if (proofWriter)
+			proofWriter->deleteClause(candidateClause->literals);
+		for (const long literal : candidateClause->literals)
+			touchedVariables.emplace_back(literalToVariable(literal));
+		static_cast<void>(problemDefinition->removeClause(candidateIdentifier));
+		++statistics.numSubsumedClauses;
+	}
+
+	for (const long literal : resolventLiterals)
+		isLiteralMarked[literalToIndex(literal)] = 0;
+}
+
+void BoundedVariableEliminator::rescheduleVariables(const std::vector<std::size_t>& touchedVariables)
+{
+	for (const std::size_t variable : touchedVariables)
+	{
+		if (isVariableEliminated[variable])
+			continue;
+
+		if (const std::size_t positionInCandidateQueue = positionsInCandidateQueue[variable]; positionInCandidateQueue != NOT_IN_CANDIDATE_QUEUE)
+		{
+			moveCandidateUp(positionInCandidateQueue);
+			moveCandidateDown(positionsInCandidateQueue[variable]);
+		}
+		else
+			pushCandidate(variable);
+	}
+}
+
+std::size_t BoundedVariableEliminator::determineNumOccurrencesOfLiteral(long literal) const
+{
+	return problemDefinition->getLiteralOccurrenceLookup().getNumberOfOccurrencesOfLiteral(literal).value_or(0);
+}
+
+std::size_t BoundedVariableEliminator::determineOccurrenceProduct(std::size_t variable) const
+{
+	return determineNumOccurrencesOfLiteral(static_cast<long>(variable)) * determineNumOccurrencesOfLiteral(-static_cast<long>(variable));
+}
+
+void BoundedVariableEliminator::pushCandidate(std::size_t variable)
+{
+	positionsInCandidateQueue[variable] = candidateQueue.size();
+	candidateQueue.emplace_back(variable);
+	moveCandidateUp(candidateQueue.size() - 1);
+}
+
+std::size_t BoundedVariableEliminator::popCandidate()
+{
+	const std::size_t variable = candidateQueue.front();
+	swapCandidates(0, candidateQueue.size() - 1);
+	candidateQueue.pop_back();
+	positionsInCandidateQueue[variable] = NOT_IN_CANDIDATE_QUEUE;
+	if (!candidateQueue.empty())
+		moveCandidateDown(0);
+	return variable;
+}
+
+void BoundedVariableEliminator::moveCandidateUp(std::size_t position)
+{
+	while (position)
+	{
+		const std::size_t parentPosition = (position - 1) / 2;
+		const std::size_t product = determineOccurrenceProduct(candidateQueue[position]);
+		const std::size_t productOfParent = determineOccurrenceProduct(candidateQueue[parentPosition]);
+		if (productOfParent < product || (productOfParent == product && candidateQueue[parentPosition] < candidateQueue[position]))
+			break;
+
+		swapCandidates(position, parentPosition);
+		position = parentPosition;
+	}
+}
+
+void BoundedVariableEliminator::moveCandidateDown(std::size_t position)
+{
+	const auto isOrderedBefore = [this](const std::size_t lVariable, const std::size_t rVariable)
+	{
+		const std::size_t lProduct = determineOccurrenceProduct(lVariable);
+		const std::size_t rProduct = determineOccurrenceProduct(rVariable);
+		return lProduct != rProduct ? lProduct < rProduct : lVariable < rVariable;
+	};
+
+	while (2 * position + 1 < candidateQueue.size())
+	{
+		std::size_t childPosition = 2 * position + 1;
+		if (childPosition + 1 < candidateQueue.size() && isOrderedBefore(candidateQueue[childPosition + 1], candidateQueue[childPosition]))
+			++childPosition;
+		if (!isOrderedBefore(candidateQueue[childPosition], candidateQueue[position]))
+			break;
+
+		swapCandidates(position, childPosition);
+		position = childPosition;
+	}
+}
+
+void BoundedVariableEliminator::swapCandidates(std::size_t lPosition, std::size_t rPosition)
+{
+	std::swap(candidateQueue[lPosition], candidateQueue[rPosition]);
+	positionsInCandidateQueue[candidateQueue[lPosition]] = lPosition;
+	positionsInCandidateQueue[candidateQueue[rPosition]] = rPosition;
+}
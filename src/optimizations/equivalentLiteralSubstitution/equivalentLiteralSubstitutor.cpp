@@ -0,0 +1,313 @@
+#include "optimizations/equivalentLiteralSubstitution/equivalentLiteralSubstitutor.hpp"
+#include "budget/effortTicks.hpp"
+
+#include <algorithm>
+
+using namespace equivalentLiteralSubstitution;
+
+EquivalentLiteralSubstitutor::EquivalentLiteralSubstitutor(dimacs::ProblemDefinition::ptr problemDefinition)
+	: problemDefinition(std::move(problemDefinition)), resourceBudget(nullptr), proofWriter(nullptr), numVariables(0), statistics({})
+{
+	if (!this->problemDefinition)
+		throw std::invalid_argument("Problem definition cannot be null");
+
+	numVariables = this->problemDefinition->getNumDeclaredVariablesOfFormula();
+	representativeLiterals.resize((numVariables + 1) * 2, 0);
+	for (std::size_t literalIndex = 2; literalIndex < representativeLiterals.size(); ++literalIndex)
+		representativeLiterals[literalIndex] = indexToLiteral(literalIndex);
+	isLiteralMarked.resize((numVariables + 1) * 2, 0);
+}
+
+void EquivalentLiteralSubstitutor::setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+{
+	this->resourceBudget = resourceBudget;
+}
+
+void EquivalentLiteralSubstitutor::setProofWriter(proof::ProofWriter* proofWriter) noexcept
+{
+	this->proofWriter = proofWriter;
+}
+
+bool EquivalentLiteralSubstitutor::substituteEquivalentLiterals(modelReconstruction::ModelReconstructionStack& modelReconstructionStack)
+{
+	const std::size_t numTicksAtStart = statistics.numTicks;
+	buildBinaryImplicationGraph();
+
+	long literalEquivalentToItsNegation = 0;
+	if (!determineStronglyConnectedComponents(literalEquivalentToItsNegation))
+	{
+		// The literal implies its negation (and vice versa) via binary clauses, thus both its negation and the empty clause are derived by unit propagation
+		if (proofWriter)
+		{
+			proofWriter->addClause({ -literalEquivalentToItsNegation });
+			proofWriter->addEmptyClause();
+		}
+		if (resourceBudget)
+			resourceBudget->chargeTicks(statistics.numTicks - numTicksAtStart);
+		return false;
+	}
+
+	// The equivalences are implied by unit propagation over the binary clauses of the SCC and allow to derive the rewritten clauses by unit propagation
+	for (const std::size_t variable : substitutedVariables)
+	{
+		const auto positiveLiteral = static_cast<long>(variable);
+		const long representativeLiteral = representativeLiterals[literalToIndex(positiveLiteral)];
+		if (proofWriter)
+		{
+			proofWriter->addClause({ -positiveLiteral, representativeLiteral });
+			proofWriter->addClause({ positiveLiteral, -representativeLiteral });
+		}
+		modelReconstructionStack.addEliminatedClause({ positiveLiteral }, { positiveLiteral, -representativeLiteral });
+		modelReconstructionStack.addEliminatedClause({ -positiveLiteral }, { -positiveLiteral, representativeLiteral });
+	}
+	statistics.numSubstitutedVariables = substitutedVariables.size();
+
+	rewriteClauses();
+	if (proofWriter)
+	{
+		for (const std::size_t variable : substitutedVariables)
+		{
+			const auto positiveLiteral = static_cast<long>(variable);
+			const long representativeLiteral = representativeLiterals[literalToIndex(positiveLiteral)];
+			proofWriter->deleteClause({ -positiveLiteral, representativeLiteral });
+			proofWriter->deleteClause({ positiveLiteral, -representativeLiteral });
+		}
+	}
+
+	if (resourceBudget)
+		resourceBudget->chargeTicks(statistics.numTicks - numTicksAtStart);
+	return true;
+}
+
+const std::vector<long>& EquivalentLiteralSubstitutor::getRepresentativeLiterals() const noexcept
+{
+	return representativeLiterals;
+}
+
+const EquivalentLiteralSubstitutor::SubstitutionStatistics& EquivalentLiteralSubstitutor::getStatistics() const noexcept
+{
+	return statistics;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+
+/*
+ * The binary clauses are visited in the order of their identifiers to make the order of the successors (and thus the depth-first search) independent of the iteration order of the unordered container.
+ * Binary clauses referencing an assigned variable are skipped.
+ */
+void EquivalentLiteralSubstitutor::buildBinaryImplicationGraph()
+{
+	std::vector<std::size_t> identifiersOfClauses = problemDefinition->getIdentifiersOfClauses();
+	std::sort(identifiersOfClauses.begin(), identifiersOfClauses.end());
+
+	std::vector<std::pair<long, long>> implications;
+	for (const std::size_t clauseIdentifier : identifiersOfClauses)
+	{
+		const dimacs::ProblemDefinition::Clause* clause = problemDefinition->getClauseByIndexInFormula(clauseIdentifier);
+		++statistics.numTicks;
+		if (!clause || clause->literals.size() != 2 || clause->literals[0] == -clause->literals[1])
+			continue;
+
+		const bool isAnyVariableAssigned = std::any_of(clause->literals.cbegin(), clause->literals.cend(), [this](const long literal)
+		{
+			return problemDefinition->getValueOfVariable(literalToVariable(literal)).value_or(dimacs::ProblemDefinition::VariableValue::Unknown) != dimacs::ProblemDefinition::VariableValue::Unknown;
+		});
+		if (isAnyVariableAssigned)
+			continue;
+
+		implications.emplace_back(-clause->literals[0], clause->literals[1]);
+		implications.emplace_back(-clause->literals[1], clause->literals[0]);
+	}
+
+	implicationGraphOffsets.assign((numVariables + 1) * 2 + 1, 0);
+	for (const auto& [antecedentLiteral, consequentLiteral] : implications)
+		++implicationGraphOffsets[literalToIndex(antecedentLiteral) + 1];
+	for (std::size_t literalIndex = 1; literalIndex < implicationGraphOffsets.size(); ++literalIndex)
+		implicationGraphOffsets[literalIndex] += implicationGraphOffsets[literalIndex - 1];
+
+	std::vector<std::size_t> insertionPositions(implicationGraphOffsets.cbegin(), std::prev(implicationGraphOffsets.cend()));
+	implicationGraphSuccessors.resize(implications.size());
+	for (const auto& [antecedentLiteral, consequentLiteral] : implications)
+		implicationGraphSuccessors[insertionPositions[literalToIndex(antecedentLiteral)]++] = consequentLiteral;
+	statistics.numTicks += budget::determineNumTicksOfSequentialAccess<long>(implicationGraphSuccessors.size());
+}
+
+/*
+ * Iterative variant of Tarjan's algorithm, every frame of the explicit call stack stores the position of the next successor of its literal that needs to be visited.
+ * Returns false if an SCC contains both literals of a variable.
+ */
+bool EquivalentLiteralSubstitutor::determineStronglyConnectedComponents(long& literalEquivalentToItsNegation)
+{
+	struct DepthFirstSearchFrame
+	{
+		std::size_t literalIndex;
+		std::size_t nextSuccessorPosition;
+	};
+
+	const std::size_t numLiteralIndices = (numVariables + 1) * 2;
+	std::vector<std::size_t> discoveryIndices(numLiteralIndices, UNVISITED);
+	std::vector<std::size_t> lowLinks(numLiteralIndices, UNVISITED);
+	std::vector<char> isOnComponentStack(numLiteralIndices, 0);
+	std::vector<std::size_t> componentStack;
+	std::vector<DepthFirstSearchFrame> callStack;
+	std::vector<long> literalsOfComponent;
+	std::size_t nextDiscoveryIndex = 0;
+
+	const auto discoverLiteral = [&](const std::size_t literalIndex)
+	{
+		discoveryIndices[literalIndex] = nextDiscoveryIndex;
+		lowLinks[literalIndex] = nextDiscoveryIndex++;
+		isOnComponentStack[literalIndex] = 1;
+		componentStack.emplace_back(literalIndex);
+		callStack.emplace_back(DepthFirstSearchFrame({ literalIndex, implicationGraphOffsets[literalIndex] }));
+	};
+
+	for (std::size_t rootIndex = 2; rootIndex < numLiteralIndices; ++rootIndex)
+	{
+		// Literals without successors form trivial SCCs
+		if (discoveryIndices[rootIndex] != UNVISITED || implicationGraphOffsets[rootIndex] == implicationGraphOffsets[rootIndex + 1])
+			continue;
+		if (resourceBudget && resourceBudget->isExhausted())
+			break;
+
+		discoverLiteral(rootIndex);
+		while (!callStack.empty())
+		{
+			const std::size_t literalIndex = callStack.back().literalIndex;
+			if (callStack.back().nextSuccessorPosition < implicationGraphOffsets[literalIndex + 1])
+			{
+				const std::size_t successorIndex = literalToIndex(implicationGraphSuccessors[callStack.back().nextSuccessorPosition++]);
+				++statistics.numTicks;
+				if (discoveryIndices[successorIndex] == UNVISITED)
+					discoverLiteral(successorIndex);
+				else if (isOnComponentStack[successorIndex])
+					lowLinks[literalIndex] = std::min(lowLinks[literalIndex], discoveryIndices[successorIndex]);
+				continue;
+			}
+
+			callStack.pop_back();
+			if (!callStack.empty())
+				lowLinks[callStack.back().literalIndex] = std::min(lowLinks[callStack.back().literalIndex], lowLinks[literalIndex]);
+			if (lowLinks[literalIndex] != discoveryIndices[literalIndex])
+				continue;
+
+			literalsOfComponent.clear();
+			std::size_t componentLiteralIndex;
+			do
+			{
+				componentLiteralIndex = componentStack.back();
+				componentStack.pop_back();
+				isOnComponentStack[componentLiteralIndex] = 0;
+				literalsOfComponent.emplace_back(indexToLiteral(componentLiteralIndex));
+			} while (componentLiteralIndex != literalIndex);
+
+			if (literalsOfComponent.size() > 1 && !assignRepresentativeOfComponent(literalsOfComponent, literalEquivalentToItsNegation))
+				return false;
+		}
+	}
+
+	std::sort(substitutedVariables.begin(), substitutedVariables.end());
+	return true;
+}
+
+/*
+ * The SCC of the negated literals is found separately, the representatives of both SCCs are assigned once the first of them is found. Returns false if the SCC contains both literals of a variable.
+ */
+bool EquivalentLiteralSubstitutor::assignRepresentativeOfComponent(const std::vector<long>& literalsOfComponent, long& literalEquivalentToItsNegation)
+{
+	for (const long literal : literalsOfComponent)
+		isLiteralMarked[literalToIndex(literal)] = 1;
+	const auto literalOfContradictingVariable = std::find_if(literalsOfComponent.cbegin(), literalsOfComponent.cend(), [this](const long literal) { return isLiteralMarked[literalToIndex(-literal)]; });
+	for (const long literal : literalsOfComponent)
+		isLiteralMarked[literalToIndex(literal)] = 0;
+
+	if (literalOfContradictingVariable != literalsOfComponent.cend())
+	{
+		literalEquivalentToItsNegation = *literalOfContradictingVariable;
+		return false;
+	}
+
+	// At least one literal of an SCC whose negated SCC was already processed is mapped to a different representative
+	if (std::any_of(literalsOfComponent.cbegin(), literalsOfComponent.cend(), [this](const long literal) { return representativeLiterals[literalToIndex(literal)] != literal; }))
+		return true;
+
+	const long representativeLiteral = *std::min_element(literalsOfComponent.cbegin(), literalsOfComponent.cend(), [](const long lLiteral, const long rLiteral) { return literalToVariable(lLiteral) < literalToVariable(rLiteral); });
+	for (const long literal : literalsOfComponent)
+	{
+		if (literal == representativeLiteral)
+			continue;
+
+		representativeLiterals[literalToIndex(literal)] = representativeLiteral;
+		representativeLiterals[literalToIndex(-literal)] = -representativeLiteral;
+		substitutedVariables.emplace_back(literalToVariable(literal));
+	}
+	++statistics.numEquivalenceClasses;
+	return true;
+}
+
+/*
+ * Every clause containing a substituted variable is replaced by the clause in which every literal is replaced by its representative, duplicate literals are removed and clauses that became tautologies are deleted.
+ * Clauses only consisting of equivalent literals are thus either deleted or reduced to a unit clause.
+ */
+void EquivalentLiteralSubstitutor::rewriteClauses()
+{
+	const dimacs::LiteralOccurrenceLookup& literalOccurrenceLookup = problemDefinition->getLiteralOccurrenceLookup();
+	std::vector<std::size_t> identifiersOfAffectedClauses;
+	for (const std::size_t variable : substitutedVariables)
+	{
+		for (const long literal : { static_cast<long>(variable), -static_cast<long>(variable) })
+		{
+			const std::optional<const dimacs::LiteralOccurrenceLookup::LiteralOccurrenceLookupEntry*> occurrencesOfLiteral = literalOccurrenceLookup[literal];
+			if (!occurrencesOfLiteral.has_value() || !*occurrencesOfLiteral)
+				continue;
+
+			identifiersOfAffectedClauses.insert(identifiersOfAffectedClauses.end(), (*occurrencesOfLiteral)->cbegin(), (*occurrencesOfLiteral)->cend());
+			statistics.numTicks += budget::determineNumTicksOfNodeBasedAccess((*occurrencesOfLiteral)->size());
+		}
+	}
+	std::sort(identifiersOfAffectedClauses.begin(), identifiersOfAffectedClauses.end());
+	identifiersOfAffectedClauses.erase(std::unique(identifiersOfAffectedClauses.begin(), identifiersOfAffectedClauses.end()), identifiersOfAffectedClauses.end());
+
+	std::vector<long> rewrittenLiterals;
+	for (const std::size_t clauseIdentifier : identifiersOfAffectedClauses)
+	{
+		const dimacs::ProblemDefinition::Clause* clause = problemDefinition->getClauseByIndexInFormula(clauseIdentifier);
+		++statistics.numTicks;
+		if (!clause)
+			continue;
+
+		statistics.numTicks += budget::determineNumTicksOfSequentialAccess<long>(clause->literals.size());
+		const std::vector<long> originalLiterals = clause->literals;
+		rewrittenLiterals.clear();
+		bool isTautology = false;
+		for (auto literalIterator = originalLiterals.cbegin(); literalIterator != originalLiterals.cend() && !isTautology; ++literalIterator)
+		{
+			const long representativeLiteral = representativeLiterals[literalToIndex(*literalIterator)];
+			if (isLiteralMarked[literalToIndex(representativeLiteral)])
+				continue;
+
+			isTautology = isLiteralMarked[literalToIndex(-representativeLiteral)];
+			isLiteralMarked[literalToIndex(representativeLiteral)] = 1;
+			rewrittenLiterals.emplace_back(representativeLiteral);
+		}
+		for (const long literal : rewrittenLiterals)
+			isLiteralMarked[literalToIndex(literal)] = 0;
+
+		if (proofWriter)
+		{
+			if (!isTautology)
+				proofWriter->addClause(rewrittenLiterals);
+			proofWriter->deleteClause(originalLiterals);
+		}
+		static_cast<void>(problemDefinition->removeClause(clauseIdentifier));
+		if (isTautology)
+		{
+			++statistics.numRemovedClauses;
+			continue;
+		}
+
+		if (!problemDefinition->addClause(clauseIdentifier, dimacs::ProblemDefinition::Clause(rewrittenLiterals)))
+			throw std::runtime_error("Failed to replace clause with identifier " + std::to_string(clauseIdentifier) + " by its rewritten clause");
+		++statistics.numRewrittenClauses;
+	}
+}
@@ -0,0 +1,68 @@
+#include "optimizations/modelReconstruction/modelChecker.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+using namespace modelReconstruction;
+
+void ModelChecker::addClause(const std::vector<long>& clauseLiterals)
+{
+	if (std::find(clauseLiterals.cbegin(), clauseLiterals.cend(), 0) != clauseLiterals.cend())
+		throw std::invalid_argument("Literal 0 cannot be part of a clause");
+
+	clauseOffsets.emplace_back(flatClauseLiterals.size());
+	flatClauseLiterals.insert(flatClauseLiterals.end(), clauseLiterals.cbegin(), clauseLiterals.cend());
+	flatClauseLiterals.emplace_back(0);
+	for (const long literal : clauseLiterals)
+		largestReferencedVariable = std::max(largestReferencedVariable, static_cast<std::size_t>(std::labs(literal)));
+}
+
+std::optional<std::size_t> ModelChecker::determineFirstFalsifiedClause(const std::vector<long>& model) const
+{
+	// Every literal is mapped to 2 * variable + (literal < 0), thus a literal is satisfied iff. its entry in the lookup is set
+	std::vector<char> isLiteralSatisfied((largestReferencedVariable + 1) * 2, 0);
+	for (const long literal : model)
+	{
+		const auto variable = static_cast<std::size_t>(std::labs(literal));
+		if (variable <= largestReferencedVariable)
+			isLiteralSatisfied[(variable << 1) | (literal < 0)] = 1;
+	}
+
+	std::size_t clauseIndex = 0;
+	bool isCurrentClauseSatisfied = false;
+	for (const long literal : flatClauseLiterals)
+	{
+		if (!literal)
+		{
+			if (!isCurrentClauseSatisfied)
+				return clauseIndex;
+
+			++clauseIndex;
+			isCurrentClauseSatisfied = false;
+			continue;
+		}
+		isCurrentClauseSatisfied |= static_cast<bool>(isLiteralSatisfied[(static_cast<std::size_t>(std::labs(literal)) << 1) | (literal < 0)]);
+	}
+	return std::nullopt;
+}
+
+bool ModelChecker::isModelOfFormula(const std::vector<long>& model) const
+{
+	return !determineFirstFalsifiedClause(model).has_value();
+}
+
+std::vector<long> ModelChecker::getLiteralsOfClause(std::size_t clauseIndex) const
+{
+	if (clauseIndex >= clauseOffsets.size())
+		throw std::out_of_range("Clause index " + std::to_string(clauseIndex) + " is out of range");
+
+	const auto clauseBegin = flatClauseLiterals.cbegin() + static_cast<std::ptrdiff_t>(clauseOffsets[clauseIndex]);
+	return std::vector<long>(clauseBegin, std::find(clauseBegin, flatClauseLiterals.cend(), 0));
+}
+
+std::size_t ModelChecker::getNumClauses() const noexcept
+{
+	return clauseOffsets.size();
+}
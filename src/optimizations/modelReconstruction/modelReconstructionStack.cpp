@@ -0,0 +1,107 @@
+#include "optimizations/modelReconstruction/modelReconstructionStack.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+using namespace modelReconstruction;
+
+void ModelReconstructionStack::addBlockedClause(long blockingLiteral, const std::vector<long>& clauseLiterals)
+{
+	if (std::find(clauseLiterals.cbegin(), clauseLiterals.cend(), blockingLiteral) == clauseLiterals.cend())
+		throw std::invalid_argument("Blocking literal " + std::to_string(blockingLiteral) + " must be part of the blocked clause");
+
+	addEliminatedClause({ blockingLiteral }, clauseLiterals);
+}
+
+void ModelReconstructionStack::addSetBlockedClause(const std::vector<long>& blockingSet, const std::vector<long>& clauseLiterals)
+{
+	if (blockingSet.empty())
+		throw std::invalid_argument("Blocking set cannot be empty");
+	for (const long literal : blockingSet)
+	{
+		if (std::find(clauseLiterals.cbegin(), clauseLiterals.cend(), literal) == clauseLiterals.cend())
+			throw std::invalid_argument("Literal " + std::to_string(literal) + " of the blocking set must be part of the set blocked clause");
+	}
+
+	addEliminatedClause(blockingSet, clauseLiterals);
+}
+
+void ModelReconstructionStack::addEliminatedClause(const std::vector<long>& witness, const std::vector<long>& clauseLiterals)
+{
+	if (std::find(witness.cbegin(), witness.cend(), 0) != witness.cend() || std::find(clauseLiterals.cbegin(), clauseLiterals.cend(), 0) != clauseLiterals.cend())
+		throw std::invalid_argument("Literal 0 cannot be part of a witness or clause");
+
+	entries.emplace_back(ReconstructionEntry({ entryLiterals.size(), static_cast<std::uint32_t>(witness.size()), static_cast<std::uint32_t>(clauseLiterals.size()) }));
+	entryLiterals.insert(entryLiterals.end(), witness.cbegin(), witness.cend());
+	entryLiterals.insert(entryLiterals.end(), clauseLiterals.cbegin(), clauseLiterals.cend());
+	for (const long literal : witness)
+		largestReferencedVariable = std::max(largestReferencedVariable, static_cast<std::size_t>(std::labs(literal)));
+	for (const long literal : clauseLiterals)
+		largestReferencedVariable = std::max(largestReferencedVariable, static_cast<std::size_t>(std::labs(literal)));
+}
+
+std::vector<long> ModelReconstructionStack::reconstructModel(const std::vector<long>& modelOfReducedFormula) const
+{
+	std::size_t numVariables = largestReferencedVariable;
+	for (const long literal : modelOfReducedFormula)
+		numVariables = std::max(numVariables, static_cast<std::size_t>(std::labs(literal)));
+
+	std::vector<char> isVariableTrue(numVariables + 1, 0);
+	for (const long literal : modelOfReducedFormula)
+		isVariableTrue[static_cast<std::size_t>(std::labs(literal))] = literal > 0;
+
+	const auto isLiteralSatisfied = [&isVariableTrue](const long literal) { return static_cast<bool>(isVariableTrue[static_cast<std::size_t>(std::labs(literal))]) == (literal > 0); };
+	for (auto entryIterator = entries.crbegin(); entryIterator != entries.crend(); ++entryIterator)
+	{
+		const long* witnessLiterals = entryLiterals.data() + entryIterator->literalsOffset;
+		const long* clauseLiterals = witnessLiterals + entryIterator->numWitnessLiterals;
+		if (std::any_of(clauseLiterals, clauseLiterals + entryIterator->numClauseLiterals, isLiteralSatisfied))
+			continue;
+
+		for (const long* witnessLiteral = witnessLiterals; witnessLiteral != clauseLiterals; ++witnessLiteral)
+			isVariableTrue[static_cast<std::size_t>(std::labs(*witnessLiteral))] = *witnessLiteral > 0;
+	}
+
+	std::vector<long> reconstructedModel;
+	reconstructedModel.reserve(numVariables);
+	for (std::size_t variable = 1; variable <= numVariables; ++variable)
+		reconstructedModel.emplace_back(isVariableTrue[variable] ? static_cast<long>(variable) : -static_cast<long>(variable));
+	return reconstructedModel;
+}
+
+std::vector<long> ModelReconstructionStack::getWitnessOfEntry(std::size_t entryIndex) const
+{
+	if (entryIndex >= entries.size())
+		throw std::out_of_range("Entry index " + std::to_string(entryIndex) + " is out of range");
+
+	const auto witnessBegin = entryLiterals.cbegin() + static_cast<std::ptrdiff_t>(entries[entryIndex].literalsOffset);
+	return std::vector<long>(witnessBegin, witnessBegin + entries[entryIndex].numWitnessLiterals);
+}
+
+std::vector<long> ModelReconstructionStack::getClauseOfEntry(std::size_t entryIndex) const
+{
+	if (entryIndex >= entries.size())
+		throw std::out_of_range("Entry index " + std::to_string(entryIndex) + " is out of range");
+
+	const auto clauseBegin = entryLiterals.cbegin() + static_cast<std::ptrdiff_t>(entries[entryIndex].literalsOffset + entries[entryIndex].numWitnessLiterals);
+	return std::vector<long>(clauseBegin, clauseBegin + entries[entryIndex].numClauseLiterals);
+}
+
+std::size_t ModelReconstructionStack::getNumEntries() const noexcept
+{
+	return entries.size();
+}
+
+bool ModelReconstructionStack::isEmpty() const noexcept
+{
+	return entries.empty();
+}
+
+void ModelReconstructionStack::clear() noexcept
+{
+	entries.clear();
+	entryLiterals.clear();
+	largestReferencedVariable = 0;
+}
@@ -0,0 +1,282 @@
+#include "optimizations/subsumption/backwardSubsumptionEliminator.hpp"
+#include "budget/effortTicks.hpp"
+
+#include <algorithm>
+#include <thread>
+
+using namespace subsumption;
+
+BackwardSubsumptionEliminator::BackwardSubsumptionEliminator(dimacs::ProblemDefinition::ptr problemDefinition, const SubsumptionConfiguration& configuration)
+	: problemDefinition(std::move(problemDefinition)), configuration(configuration), resourceBudget(nullptr), proofWriter(nullptr), numVariables(0), statistics({})
+{
+	if (!this->problemDefinition)
+		throw std::invalid_argument("Problem definition cannot be null");
+	if (!configuration.numThreads)
+		throw std::invalid_argument("Number of threads must be larger than zero");
+
+	numVariables = this->problemDefinition->getNumDeclaredVariablesOfFormula();
+}
+
+void BackwardSubsumptionEliminator::setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+{
+	this->resourceBudget = resourceBudget;
+}
+
+void BackwardSubsumptionEliminator::setProofWriter(proof::ProofWriter* proofWriter) noexcept
+{
+	this->proofWriter = proofWriter;
+}
+
+bool BackwardSubsumptionEliminator::subsumeAndStrengthenClauses()
+{
+	bool wasAnyClauseStrengthened = true;
+	for (std::size_t round = 0; round < configuration.maximumNumRounds && wasAnyClauseStrengthened; ++round)
+	{
+		if (resourceBudget && resourceBudget->isExhausted())
+			break;
+
+		++statistics.numRounds;
+		if (!performRound(wasAnyClauseStrengthened))
+			return false;
+	}
+	return true;
+}
+
+const BackwardSubsumptionEliminator::SubsumptionStatistics& BackwardSubsumptionEliminator::getStatistics() const noexcept
+{
+	return statistics;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+
+bool BackwardSubsumptionEliminator::performRound(bool& wasAnyClauseStrengthened)
+{
+	wasAnyClauseStrengthened = false;
+	initializeCandidates();
+
+	const auto numCandidates = static_cast<CandidateIndex>(candidateIdentifiers.size());
+	if (!numCandidates)
+		return true;
+
+	// Every worker uses its own literal marks, the outcome of a candidate is only written by the worker checking the range containing the candidate
+	const std::size_t numWorkers = std::min<std::size_t>(configuration.numThreads, numCandidates);
+	std::vector<CandidateOutcome> candidateOutcomes(numCandidates, CandidateOutcome({ false, 0 }));
+	std::vector<std::vector<char>> perWorkerLiteralMarks(numWorkers, std::vector<char>((numVariables + 1) * 2, 0));
+	std::vector<std::size_t> perWorkerNumSignatureRejections(numWorkers, 0);
+	std::vector<std::size_t> perWorkerNumTicks(numWorkers, 0);
+
+	const auto determineFirstCandidateOfWorker = [numCandidates, numWorkers](const std::size_t workerIndex)
+	{
+		return static_cast<CandidateIndex>(numCandidates * workerIndex / numWorkers);
+	};
+	if (numWorkers == 1)
+		checkCandidatesInRange(0, numCandidates, perWorkerLiteralMarks.front(), candidateOutcomes, perWorkerNumSignatureRejections.front(), perWorkerNumTicks.front());
+	else
+	{
+		std::vector<std::thread> workerThreads;
+		workerThreads.reserve(numWorkers);
+		for (std::size_t workerIndex = 0; workerIndex < numWorkers; ++workerIndex)
+		{
+			workerThreads.emplace_back([&, workerIndex]
+			{
+				checkCandidatesInRange(determineFirstCandidateOfWorker(workerIndex), determineFirstCandidateOfWorker(workerIndex + 1), perWorkerLiteralMarks[workerIndex], candidateOutcomes, perWorkerNumSignatureRejections[workerIndex], perWorkerNumTicks[workerIndex]);
+			});
+		}
+		for (std::thread& workerThread : workerThreads)
+			workerThread.join();
+	}
+
+	std::size_t numTicksOfRound = 0;
+	for (std::size_t workerIndex = 0; workerIndex < numWorkers; ++workerIndex)
+	{
+		statistics.numSignatureRejections += perWorkerNumSignatureRejections[workerIndex];
+		numTicksOfRound += perWorkerNumTicks[workerIndex];
+	}
+	statistics.numTicks += numTicksOfRound;
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicksOfRound);
+
+	/*
+	 * The outcomes are merged in the order of the candidates. Every strengthened clause is derived from clauses of the formula at the start of the round and thus needs to be added to the proof prior to the deletion
+	 * of any clause of the round.
+	 */
+	std::vector<std::vector<long>> strengthenedClauses(numCandidates);
+	for (CandidateIndex candidate = 0; candidate < numCandidates; ++candidate)
+	{
+		const CandidateOutcome& candidateOutcome = candidateOutcomes[candidate];
+		if (candidateOutcome.isSubsumed || !candidateOutcome.removedLiteral)
+			continue;
+
+		std::vector<long>& strengthenedClauseLiterals = strengthenedClauses[candidate];
+		std::copy_if(candidateLiteralArena.cbegin() + static_cast<std::ptrdiff_t>(candidateOffsets[candidate]), candidateLiteralArena.cbegin() + static_cast<std::ptrdiff_t>(candidateOffsets[candidate + 1]), std::back_inserter(strengthenedClauseLiterals), [&candidateOutcome](const long literal)
+		{
+			return literal != candidateOutcome.removedLiteral;
+		});
+		if (proofWriter)
+		{
+			if (strengthenedClauseLiterals.empty())
+				proofWriter->addEmptyClause();
+			else
+				proofWriter->addClause(strengthenedClauseLiterals);
+		}
+		if (strengthenedClauseLiterals.empty())
+			return false;
+	}
+
+	for (CandidateIndex candidate = 0; candidate < numCandidates; ++candidate)
+	{
+		const CandidateOutcome& candidateOutcome = candidateOutcomes[candidate];
+		if (!candidateOutcome.isSubsumed && !candidateOutcome.removedLiteral)
+			continue;
+
+		const std::size_t clauseIdentifier = candidateIdentifiers[candidate];
+		if (proofWriter)
+			proofWriter->deleteClause(problemDefinition->getClauseByIndexInFormula(clauseIdentifier)->literals);
+		static_cast<void>(problemDefinition->removeClause(clauseIdentifier));
+
+		if (candidateOutcome.isSubsumed)
+		{
+			++statistics.numSubsumedClauses;
+			continue;
+		}
+		if (!problemDefinition->addClause(clauseIdentifier, dimacs::ProblemDefinition::Clause(std::move(strengthenedClauses[candidate]))))
+			throw std::runtime_error("Failed to replace clause with identifier " + std::to_string(clauseIdentifier) + " by its strengthened clause");
+
+		++statistics.numStrengthenedClauses;
+		wasAnyClauseStrengthened = true;
+	}
+	return true;
+}
+
+/*
+ * The candidates are ordered by their size (and identifier), tautologies are skipped since they are neither subsumed by nor subsume any non-tautological clause. Every candidate is connected to the one-watch list
+ * of its literal whose variable has the fewest occurrences, counting both polarities since the candidate is visited from clauses containing either the literal (subsumption) or its negation (strengthening).
+ */
+void BackwardSubsumptionEliminator::initializeCandidates()
+{
+	candidateIdentifiers.clear();
+	candidateLiteralArena.clear();
+	candidateOffsets.assign(1, 0);
+	candidateSignatures.clear();
+	oneWatchLists.assign((numVariables + 1) * 2, std::vector<CandidateIndex>());
+
+	std::vector<std::pair<std::size_t, std::size_t>> sizesAndIdentifiersOfClauses;
+	for (const std::size_t clauseIdentifier : problemDefinition->getIdentifiersOfClauses())
+		sizesAndIdentifiersOfClauses.emplace_back(problemDefinition->getClauseByIndexInFormula(clauseIdentifier)->literals.size(), clauseIdentifier);
+	std::sort(sizesAndIdentifiersOfClauses.begin(), sizesAndIdentifiersOfClauses.end());
+	statistics.numTicks += budget::determineNumTicksOfNodeBasedAccess(sizesAndIdentifiersOfClauses.size());
+
+	const dimacs::LiteralOccurrenceLookup& literalOccurrenceLookup = problemDefinition->getLiteralOccurrenceLookup();
+	const auto determineNumOccurrencesOfVariable = [&literalOccurrenceLookup](const long literal)
+	{
+		return literalOccurrenceLookup.getNumberOfOccurrencesOfLiteral(literal).value_or(0) + literalOccurrenceLookup.getNumberOfOccurrencesOfLiteral(-literal).value_or(0);
+	};
+
+	std::vector<long> clauseLiterals;
+	for (const auto& [clauseSize, clauseIdentifier] : sizesAndIdentifiersOfClauses)
+	{
+		clauseLiterals = problemDefinition->getClauseByIndexInFormula(clauseIdentifier)->literals;
+		std::sort(clauseLiterals.begin(), clauseLiterals.end());
+		clauseLiterals.erase(std::unique(clauseLiterals.begin(), clauseLiterals.end()), clauseLiterals.end());
+		statistics.numTicks += budget::determineNumTicksOfSequentialAccess<long>(clauseSize);
+		if (clauseLiterals.empty() || std::any_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [&clauseLiterals](const long literal) { return std::binary_search(clauseLiterals.cbegin(), clauseLiterals.cend(), -literal); }))
+			continue;
+
+		std::uint64_t signature = 0;
+		long watchedLiteral = clauseLiterals.front();
+		std::size_t numOccurrencesOfWatchedVariable = SIZE_MAX;
+		for (const long literal : clauseLiterals)
+		{
+			signature |= determineSignatureOfVariable(literalToVariable(literal));
+			if (const std::size_t numOccurrencesOfVariable = determineNumOccurrencesOfVariable(literal); numOccurrencesOfVariable < numOccurrencesOfWatchedVariable)
+			{
+				watchedLiteral = literal;
+				numOccurrencesOfWatchedVariable = numOccurrencesOfVariable;
+			}
+		}
+
+		oneWatchLists[literalToIndex(watchedLiteral)].emplace_back(static_cast<CandidateIndex>(candidateIdentifiers.size()));
+		candidateIdentifiers.emplace_back(clauseIdentifier);
+		candidateSignatures.emplace_back(signature);
+		candidateLiteralArena.insert(candidateLiteralArena.end(), clauseLiterals.cbegin(), clauseLiterals.cend());
+		candidateOffsets.emplace_back(candidateLiteralArena.size());
+	}
+}
+
+void BackwardSubsumptionEliminator::checkCandidatesInRange(CandidateIndex firstCandidate, CandidateIndex lastCandidate, std::vector<char>& isLiteralMarked, std::vector<CandidateOutcome>& candidateOutcomes, std::size_t& numSignatureRejections, std::size_t& numTicks) const
+{
+	for (CandidateIndex candidate = firstCandidate; candidate < lastCandidate; ++candidate)
+	{
+		if (resourceBudget && resourceBudget->isExhausted())
+			break;
+
+		candidateOutcomes[candidate] = checkCandidate(candidate, isLiteralMarked, numSignatureRejections, numTicks);
+	}
+}
+
+/*
+ * A clause C subsumes the candidate D if every literal of C is contained in D, the candidate is strengthened by C if exactly one literal of C is negated in D while all other literals are contained in D.
+ * Subsumption takes precedence over strengthening while only the first determined literal removable by self-subsuming resolution is removed from the candidate since the removal of a second literal
+ * might rely on the first one.
+ */
+BackwardSubsumptionEliminator::CandidateOutcome BackwardSubsumptionEliminator::checkCandidate(CandidateIndex candidate, std::vector<char>& isLiteralMarked, std::size_t& numSignatureRejections, std::size_t& numTicks) const
+{
+	const long* candidateLiterals = &candidateLiteralArena[candidateOffsets[candidate]];
+	const std::size_t numCandidateLiterals = getNumLiteralsOfCandidate(candidate);
+	const std::uint64_t candidateSignature = candidateSignatures[candidate];
+	for (std::size_t i = 0; i < numCandidateLiterals; ++i)
+		isLiteralMarked[literalToIndex(candidateLiterals[i])] = 1;
+
+	CandidateOutcome candidateOutcome({ false, 0 });
+	for (std::size_t i = 0; i < numCandidateLiterals && !candidateOutcome.isSubsumed; ++i)
+	{
+		for (const long watchedLiteral : { candidateLiterals[i], -candidateLiterals[i] })
+		{
+			const std::vector<CandidateIndex>& oneWatchList = oneWatchLists[literalToIndex(watchedLiteral)];
+			numTicks += budget::determineNumTicksOfSequentialAccess<CandidateIndex>(oneWatchList.size());
+			for (const CandidateIndex otherCandidate : oneWatchList)
+			{
+				if (otherCandidate == candidate || getNumLiteralsOfCandidate(otherCandidate) > numCandidateLiterals)
+					continue;
+				if (candidateSignatures[otherCandidate] & ~candidateSignature)
+				{
+					++numSignatureRejections;
+					continue;
+				}
+
+				const long* otherCandidateLiterals = &candidateLiteralArena[candidateOffsets[otherCandidate]];
+				const std::size_t numOtherCandidateLiterals = getNumLiteralsOfCandidate(otherCandidate);
+				numTicks += 1 + budget::determineNumTicksOfSequentialAccess<long>(numOtherCandidateLiterals);
+
+				long negatedLiteral = 0;
+				bool isSubsetModuloNegatedLiteral = true;
+				for (std::size_t j = 0; j < numOtherCandidateLiterals && isSubsetModuloNegatedLiteral; ++j)
+				{
+					const long literal = otherCandidateLiterals[j];
+					if (isLiteralMarked[literalToIndex(literal)])
+						continue;
+
+					isSubsetModuloNegatedLiteral = !negatedLiteral && isLiteralMarked[literalToIndex(-literal)];
+					negatedLiteral = literal;
+				}
+
+				if (!isSubsetModuloNegatedLiteral)
+					continue;
+				// Clauses ordered after the candidate that subsume it are equal to the candidate, thus only the later one of them is removed
+				if (!negatedLiteral && otherCandidate < candidate)
+				{
+					candidateOutcome.isSubsumed = true;
+					break;
+				}
+				if (negatedLiteral && !candidateOutcome.removedLiteral)
+					candidateOutcome.removedLiteral = -negatedLiteral;
+			}
+			if (candidateOutcome.isSubsumed)
+				break;
+		}
+	}
+
+	for (std::size_t i = 0; i < numCandidateLiterals; ++i)
+		isLiteralMarked[literalToIndex(candidateLiterals[i])] = 0;
+	return candidateOutcome;
+}
@@ -0,0 +1,283 @@
+#include "optimizations/unhiding/transitiveBinaryClauseEliminator.hpp"
+#include "budget/effortTicks.hpp"
+
+#include <algorithm>
+
+using namespace unhiding;
+
+TransitiveBinaryClauseEliminator::TransitiveBinaryClauseEliminator(dimacs::ProblemDefinition::ptr problemDefinition, const UnhidingConfiguration& configuration)
+	: problemDefinition(std::move(problemDefinition)), configuration(configuration), resourceBudget(nullptr), proofWriter(nullptr), numVariables(0), nextClauseIdentifier(0), randomNumberGenerator(static_cast<std::mt19937::result_type>(configuration.randomSeed)), statistics({})
+{
+	if (!this->problemDefinition)
+		throw std::invalid_argument("Problem definition cannot be null");
+	if (!configuration.maximumNumRounds)
+		throw std::invalid_argument("Maximum number of rounds must be larger than zero");
+
+	numVariables = this->problemDefinition->getNumDeclaredVariablesOfFormula();
+	isLiteralFailed.resize((numVariables + 1) * 2, 0);
+}
+
+void TransitiveBinaryClauseEliminator::setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+{
+	this->resourceBudget = resourceBudget;
+}
+
+void TransitiveBinaryClauseEliminator::setProofWriter(proof::ProofWriter* proofWriter) noexcept
+{
+	this->proofWriter = proofWriter;
+}
+
+bool TransitiveBinaryClauseEliminator::eliminateTransitiveBinaryClausesAndFailedLiterals()
+{
+	const std::vector<std::size_t> identifiersOfClauses = problemDefinition->getIdentifiersOfClauses();
+	nextClauseIdentifier = identifiersOfClauses.empty() ? 0 : *std::max_element(identifiersOfClauses.cbegin(), identifiersOfClauses.cend()) + 1;
+
+	std::size_t numTicksAtLastCharge = statistics.numTicks;
+	std::vector<long> failedLiteralsOfRound;
+	for (std::size_t round = 0; round < configuration.maximumNumRounds; ++round)
+	{
+		if (resourceBudget && resourceBudget->isExhausted())
+			break;
+
+		++statistics.numRounds;
+		buildBinaryImplicationGraph();
+		failedLiteralsOfRound.clear();
+		const bool wasSearchCompleted = stampLiterals(failedLiteralsOfRound);
+
+		// The failed literal implies both literals of a variable via binary clauses, thus its negation is derived by unit propagation
+		for (const long failedLiteral : failedLiteralsOfRound)
+		{
+			if (proofWriter)
+				proofWriter->addClause({ -failedLiteral });
+			if (!problemDefinition->addClause(nextClauseIdentifier, dimacs::ProblemDefinition::Clause({ -failedLiteral })))
+				throw std::runtime_error("Failed to add unit clause with identifier " + std::to_string(nextClauseIdentifier) + " to formula");
+
+			++nextClauseIdentifier;
+			failedLiterals.emplace_back(failedLiteral);
+			++statistics.numFailedLiterals;
+			if (isLiteralFailed[literalToIndex(-failedLiteral)])
+			{
+				if (proofWriter)
+					proofWriter->addEmptyClause();
+				if (resourceBudget)
+					resourceBudget->chargeTicks(statistics.numTicks - numTicksAtLastCharge);
+				return false;
+			}
+		}
+
+		const std::size_t numRemovedTransitiveClauses = wasSearchCompleted ? removeTransitiveClauses() : 0;
+		statistics.numRemovedTransitiveClauses += numRemovedTransitiveClauses;
+		if (resourceBudget)
+			resourceBudget->chargeTicks(statistics.numTicks - numTicksAtLastCharge);
+		numTicksAtLastCharge = statistics.numTicks;
+
+		if (!wasSearchCompleted || (!numRemovedTransitiveClauses && failedLiteralsOfRound.empty()))
+			break;
+	}
+	return true;
+}
+
+const std::vector<long>& TransitiveBinaryClauseEliminator::getFailedLiterals() const noexcept
+{
+	return failedLiterals;
+}
+
+const TransitiveBinaryClauseEliminator::UnhidingStatistics& TransitiveBinaryClauseEliminator::getStatistics() const noexcept
+{
+	return statistics;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+
+/*
+ * Every binary clause (a b) contributes the implications -a -> b and -b -> a, binary clauses referencing an assigned variable are skipped.
+ * The binary clauses are visited in the order of their identifiers prior to the shuffling of the implications, thus the search only depends on the configured seed.
+ */
+void TransitiveBinaryClauseEliminator::buildBinaryImplicationGraph()
+{
+	std::vector<std::size_t> identifiersOfClauses = problemDefinition->getIdentifiersOfClauses();
+	std::sort(identifiersOfClauses.begin(), identifiersOfClauses.end());
+
+	std::vector<std::pair<long, Implication>> implicationsOfClauses;
+	for (const std::size_t clauseIdentifier : identifiersOfClauses)
+	{
+		const dimacs::ProblemDefinition::Clause* clause = problemDefinition->getClauseByIndexInFormula(clauseIdentifier);
+		++statistics.numTicks;
+		if (!clause || clause->literals.size() != 2 || literalToVariable(clause->literals[0]) == literalToVariable(clause->literals[1]))
+			continue;
+
+		const bool isAnyVariableAssigned = std::any_of(clause->literals.cbegin(), clause->literals.cend(), [this](const long literal)
+		{
+			return problemDefinition->getValueOfVariable(literalToVariable(literal)).value_or(dimacs::ProblemDefinition::VariableValue::Unknown) != dimacs::ProblemDefinition::VariableValue::Unknown;
+		});
+		if (isAnyVariableAssigned)
+			continue;
+
+		implicationsOfClauses.emplace_back(-clause->literals[0], Implication({ clause->literals[1], clauseIdentifier }));
+		implicationsOfClauses.emplace_back(-clause->literals[1], Implication({ clause->literals[0], clauseIdentifier }));
+	}
+
+	implicationGraphOffsets.assign((numVariables + 1) * 2 + 1, 0);
+	for (const auto& [antecedentLiteral, implication] : implicationsOfClauses)
+		++implicationGraphOffsets[literalToIndex(antecedentLiteral) + 1];
+	for (std::size_t literalIndex = 1; literalIndex < implicationGraphOffsets.size(); ++literalIndex)
+		implicationGraphOffsets[literalIndex] += implicationGraphOffsets[literalIndex - 1];
+
+	std::vector<std::size_t> insertionPositions(implicationGraphOffsets.cbegin(), std::prev(implicationGraphOffsets.cend()));
+	implications.resize(implicationsOfClauses.size());
+	for (const auto& [antecedentLiteral, implication] : implicationsOfClauses)
+		implications[insertionPositions[literalToIndex(antecedentLiteral)]++] = implication;
+
+	for (std::size_t literalIndex = 0; literalIndex + 1 < implicationGraphOffsets.size(); ++literalIndex)
+		std::shuffle(std::next(implications.begin(), static_cast<std::ptrdiff_t>(implicationGraphOffsets[literalIndex])), std::next(implications.begin(), static_cast<std::ptrdiff_t>(implicationGraphOffsets[literalIndex + 1])), randomNumberGenerator);
+	statistics.numTicks += 2 * budget::determineNumTicksOfSequentialAccess<Implication>(implications.size());
+}
+
+/*
+ * Iterative depth-first search, every frame of the explicit call stack stores the position of the next implication of its literal that needs to be visited. The discovery stamps of the literals on the call stack
+ * are ascending, thus the deepest literal on the stack discovered prior to a given stamp is found by a binary search. Returns false if the search was stopped due to an exhausted budget.
+ */
+bool TransitiveBinaryClauseEliminator::stampLiterals(std::vector<long>& failedLiteralsOfRound)
+{
+	struct DepthFirstSearchFrame
+	{
+		std::size_t literalIndex;
+		std::size_t nextImplicationPosition;
+	};
+
+	const std::size_t numLiteralIndices = (numVariables + 1) * 2;
+	discoveryStamps.assign(numLiteralIndices, UNSTAMPED);
+	finishStamps.assign(numLiteralIndices, UNSTAMPED);
+	parentLiteralIndices.assign(numLiteralIndices, UNSTAMPED);
+
+	std::vector<char> hasPredecessor(numLiteralIndices, 0);
+	for (const Implication& implication : implications)
+		hasPredecessor[literalToIndex(implication.consequentLiteral)] = 1;
+
+	// Literals without predecessors are used as roots first since their search trees cover the largest part of the graph
+	std::vector<std::size_t> rootIndices;
+	std::vector<std::size_t> remainingRootIndices;
+	for (std::size_t literalIndex = 2; literalIndex < numLiteralIndices; ++literalIndex)
+	{
+		if (implicationGraphOffsets[literalIndex] != implicationGraphOffsets[literalIndex + 1])
+			(hasPredecessor[literalIndex] ? remainingRootIndices : rootIndices).emplace_back(literalIndex);
+	}
+	std::shuffle(rootIndices.begin(), rootIndices.end(), randomNumberGenerator);
+	std::shuffle(remainingRootIndices.begin(), remainingRootIndices.end(), randomNumberGenerator);
+	rootIndices.insert(rootIndices.end(), remainingRootIndices.cbegin(), remainingRootIndices.cend());
+	statistics.numTicks += budget::determineNumTicksOfSequentialAccess<std::size_t>(numLiteralIndices);
+
+	std::size_t nextStamp = 0;
+	std::vector<DepthFirstSearchFrame> callStack;
+	const auto discoverLiteral = [&](const std::size_t literalIndex)
+	{
+		discoveryStamps[literalIndex] = nextStamp++;
+		callStack.emplace_back(DepthFirstSearchFrame({ literalIndex, implicationGraphOffsets[literalIndex] }));
+	};
+
+	for (const std::size_t rootIndex : rootIndices)
+	{
+		if (discoveryStamps[rootIndex] != UNSTAMPED)
+			continue;
+		if (resourceBudget && resourceBudget->isExhausted())
+			return false;
+
+		const std::size_t discoveryStampOfRoot = nextStamp;
+		discoverLiteral(rootIndex);
+		while (!callStack.empty())
+		{
+			const std::size_t literalIndex = callStack.back().literalIndex;
+			if (callStack.back().nextImplicationPosition == implicationGraphOffsets[literalIndex + 1])
+			{
+				finishStamps[literalIndex] = nextStamp++;
+				callStack.pop_back();
+				continue;
+			}
+
+			const long consequentLiteral = implications[callStack.back().nextImplicationPosition++].consequentLiteral;
+			const std::size_t consequentIndex = literalToIndex(consequentLiteral);
+			const std::size_t negatedConsequentIndex = literalToIndex(-consequentLiteral);
+			++statistics.numTicks;
+
+			// The negated consequent was discovered while the literals of the call stack discovered prior to it were open, thus each of them reaches both the consequent and its negation
+			if (discoveryStamps[negatedConsequentIndex] != UNSTAMPED && discoveryStamps[negatedConsequentIndex] >= discoveryStampOfRoot)
+			{
+				const auto firstFrameDiscoveredAfterNegatedConsequent = std::upper_bound(callStack.cbegin(), callStack.cend(), discoveryStamps[negatedConsequentIndex], [this](const std::size_t discoveryStamp, const DepthFirstSearchFrame& frame)
+				{
+					return discoveryStamp < discoveryStamps[frame.literalIndex];
+				});
+				const std::size_t failedLiteralIndex = std::prev(firstFrameDiscoveredAfterNegatedConsequent)->literalIndex;
+				if (!isLiteralFailed[failedLiteralIndex])
+				{
+					isLiteralFailed[failedLiteralIndex] = 1;
+					failedLiteralsOfRound.emplace_back(indexToLiteral(failedLiteralIndex));
+				}
+			}
+
+			if (discoveryStamps[consequentIndex] == UNSTAMPED)
+			{
+				parentLiteralIndices[consequentIndex] = literalIndex;
+				discoverLiteral(consequentIndex);
+			}
+		}
+	}
+	return true;
+}
+
+/*
+ * The implications of every literal u are visited in ascending order of the discovery stamps of their consequents, since the stamp intervals are either nested or disjoint, the consequents whose intervals contain
+ * the interval of the current consequent form a stack. The implication u -> v is transitive if the top of this stack (another consequent w of u whose clause was not removed) strictly contains the interval of v.
+ * Returns the number of removed clauses.
+ */
+std::size_t TransitiveBinaryClauseEliminator::removeTransitiveClauses()
+{
+	std::size_t numRemovedClauses = 0;
+	std::vector<Implication> sortedImplications;
+	std::vector<std::size_t> enclosingConsequentIndices;
+	for (std::size_t literalIndex = 2; literalIndex + 1 < implicationGraphOffsets.size(); ++literalIndex)
+	{
+		if (implicationGraphOffsets[literalIndex + 1] - implicationGraphOffsets[literalIndex] < 2)
+			continue;
+
+		sortedImplications.assign(std::next(implications.cbegin(), static_cast<std::ptrdiff_t>(implicationGraphOffsets[literalIndex])), std::next(implications.cbegin(), static_cast<std::ptrdiff_t>(implicationGraphOffsets[literalIndex + 1])));
+		std::sort(sortedImplications.begin(), sortedImplications.end(), [this](const Implication& lImplication, const Implication& rImplication)
+		{
+			return discoveryStamps[literalToIndex(lImplication.consequentLiteral)] < discoveryStamps[literalToIndex(rImplication.consequentLiteral)];
+		});
+		statistics.numTicks += budget::determineNumTicksOfSequentialAccess<Implication>(sortedImplications.size());
+
+		const long antecedentLiteral = indexToLiteral(literalIndex);
+		enclosingConsequentIndices.clear();
+		for (const Implication& implication : sortedImplications)
+		{
+			const std::size_t consequentIndex = literalToIndex(implication.consequentLiteral);
+			while (!enclosingConsequentIndices.empty() && finishStamps[enclosingConsequentIndices.back()] < discoveryStamps[consequentIndex])
+				enclosingConsequentIndices.pop_back();
+
+			// The clause might have been removed while the implications of its other literal were visited
+			const dimacs::ProblemDefinition::Clause* clause = problemDefinition->getClauseByIndexInFormula(implication.clauseIdentifier);
+			++statistics.numTicks;
+			if (!clause)
+				continue;
+
+			const bool isTransitive = !enclosingConsequentIndices.empty() && discoveryStamps[enclosingConsequentIndices.back()] < discoveryStamps[consequentIndex]
+				&& !isEdgeOfSearchTree(antecedentLiteral, implication.consequentLiteral) && !isEdgeOfSearchTree(-implication.consequentLiteral, -antecedentLiteral);
+			if (!isTransitive)
+			{
+				enclosingConsequentIndices.emplace_back(consequentIndex);
+				continue;
+			}
+
+			if (proofWriter)
+				proofWriter->deleteClause(clause->literals);
+			static_cast<void>(problemDefinition->removeClause(implication.clauseIdentifier));
+			++numRemovedClauses;
+		}
+	}
+	return numRemovedClauses;
+}
+
+bool TransitiveBinaryClauseEliminator::isEdgeOfSearchTree(long antecedentLiteral, long consequentLiteral) const
+{
+	return parentLiteralIndices[literalToIndex(consequentLiteral)] == literalToIndex(antecedentLiteral);
+}
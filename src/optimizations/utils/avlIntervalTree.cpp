@@ -1,5 +1,8 @@
 #include "optimizations/utils/avlIntervalTree.hpp"
 
+#include <climits>
+#include <cmath>
+
 using namespace avl;
 
 std::unordered_set<std::size_t> AvlIntervalTree::determineIndicesOfClausesContainingLiteral(long literal) const
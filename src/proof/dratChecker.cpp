@@ -0,0 +1,553 @@
+#include "proof/dratChecker.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+using namespace proof;
+
+DratChecker::DratChecker(std::size_t numVariables)
+	: numVariables(0), numActiveEmptyClauses(0), currentClauseVisitStamp(0)
+{
+	increaseNumVariables(numVariables);
+}
+
+void DratChecker::addOriginalClause(const std::vector<long>& clauseLiterals)
+{
+	if (std::find(clauseLiterals.cbegin(), clauseLiterals.cend(), 0) != clauseLiterals.cend())
+		throw std::invalid_argument("Literal 0 cannot be part of a clause");
+
+	static_cast<void>(addClause(clauseLiterals, false));
+}
+
+DratChecker::CheckResult DratChecker::verifyProof(std::istream& binaryProofStream, CheckingMode checkingMode)
+{
+	const std::vector<ProofLine> proofLines = readBinaryProof(binaryProofStream);
+	for (const ProofLine& proofLine : proofLines)
+	{
+		for (const long literal : proofLine.literals)
+			increaseNumVariables(literalToVariable(literal));
+	}
+
+	// Only the lemmas required to derive the empty clause can be determined in the backward mode, thus proofs without the empty clause are checked in the forward mode
+	const auto emptyClauseIterator = std::find_if(proofLines.cbegin(), proofLines.cend(), [](const ProofLine& proofLine) { return proofLine.isAddition && proofLine.literals.empty(); });
+	if (checkingMode == CheckingMode::Backward && emptyClauseIterator != proofLines.cend())
+		return verifyProofInBackwardMode(proofLines, static_cast<std::size_t>(std::distance(proofLines.cbegin(), emptyClauseIterator)));
+	return verifyProofInForwardMode(proofLines);
+}
+
+bool DratChecker::isClauseImpliedByUnitPropagation(const std::vector<long>& clauseLiterals)
+{
+	for (const long literal : clauseLiterals)
+		increaseNumVariables(literalToVariable(literal));
+
+	return isReverseUnitPropagation(clauseLiterals, false);
+}
+
+bool DratChecker::isClauseRedundantWithRespectToWitness(const std::vector<long>& clauseLiterals, const std::vector<long>& witness)
+{
+	for (const long literal : clauseLiterals)
+		increaseNumVariables(literalToVariable(literal));
+	for (const long literal : witness)
+		increaseNumVariables(literalToVariable(literal));
+
+	// The clause itself would trivially imply every checked clause, thus it is temporarily deactivated
+	const ClauseIndex checkedClause = findActiveClause(clauseLiterals);
+	if (checkedClause != NO_CLAUSE)
+		deactivateClause(checkedClause);
+
+	const bool isRedundant = isRedundantWithRespectToWitness(clauseLiterals, witness, false);
+	if (checkedClause != NO_CLAUSE)
+		activateClause(checkedClause);
+	return isRedundant;
+}
+
+std::size_t DratChecker::getNumActiveClauses() const noexcept
+{
+	return static_cast<std::size_t>(std::count_if(clauses.cbegin(), clauses.cend(), [](const CheckedClause& clause) { return clause.isActive; }));
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void DratChecker::increaseNumVariables(std::size_t numVariables)
+{
+	if (numVariables <= this->numVariables)
+		return;
+
+	this->numVariables = numVariables;
+	watchers.resize((numVariables + 1) * 2);
+	literalOccurrences.resize((numVariables + 1) * 2);
+	literalValues.resize((numVariables + 1) * 2, LiteralValue::Unassigned);
+	isLiteralOfCheckedClause.resize((numVariables + 1) * 2, 0);
+	isLiteralOfWitness.resize((numVariables + 1) * 2, 0);
+	reasons.resize(numVariables + 1, NO_CLAUSE);
+	isVariableSeen.resize(numVariables + 1, 0);
+}
+
+DratChecker::ClauseIndex DratChecker::addClause(std::vector<long> clauseLiterals, bool isLemma)
+{
+	for (const long literal : clauseLiterals)
+		increaseNumVariables(literalToVariable(literal));
+
+	// Duplicate literals are removed while the order of the remaining literals is kept since the first literal of a lemma is the pivot of the RAT check
+	std::vector<long> uniqueClauseLiterals;
+	uniqueClauseLiterals.reserve(clauseLiterals.size());
+	for (const long literal : clauseLiterals)
+	{
+		if (!isLiteralOfCheckedClause[literalToIndex(literal)])
+		{
+			isLiteralOfCheckedClause[literalToIndex(literal)] = 1;
+			uniqueClauseLiterals.emplace_back(literal);
+		}
+	}
+	for (const long literal : uniqueClauseLiterals)
+		isLiteralOfCheckedClause[literalToIndex(literal)] = 0;
+
+	std::vector<long> sortedClauseLiterals = uniqueClauseLiterals;
+	std::sort(sortedClauseLiterals.begin(), sortedClauseLiterals.end());
+
+	CheckedClause clause;
+	clause.literalsOffset = clauseLiteralArena.size();
+	clause.numLiterals = static_cast<std::uint32_t>(uniqueClauseLiterals.size());
+	clause.hash = computeHash(sortedClauseLiterals);
+	clause.isActive = false;
+	clause.isCore = false;
+	clause.isLemma = isLemma;
+	clauseLiteralArena.insert(clauseLiteralArena.end(), uniqueClauseLiterals.cbegin(), uniqueClauseLiterals.cend());
+	clauses.emplace_back(clause);
+	clauseVisitStamps.emplace_back(0);
+
+	const ClauseIndex clauseIndex = clauses.size() - 1;
+	for (const long literal : uniqueClauseLiterals)
+		literalOccurrences[literalToIndex(literal)].emplace_back(clauseIndex);
+	// The list of unit clauses is never shrunk, deactivated unit clauses are skipped during the unit propagation instead
+	if (clause.numLiterals == 1)
+		unitClauses.emplace_back(clauseIndex);
+
+	activateClause(clauseIndex);
+	return clauseIndex;
+}
+
+void DratChecker::activateClause(ClauseIndex clauseIndex)
+{
+	CheckedClause& clause = clauses[clauseIndex];
+	clause.isActive = true;
+	activeClausesPerHash[clause.hash].emplace_back(clauseIndex);
+	if (!clause.numLiterals)
+		++numActiveEmptyClauses;
+	else if (clause.numLiterals > 1)
+	{
+		const long* clauseLiterals = getLiteralsOfClause(clauseIndex);
+		watchers[literalToIndex(clauseLiterals[0])].emplace_back(clauseIndex);
+		watchers[literalToIndex(clauseLiterals[1])].emplace_back(clauseIndex);
+	}
+}
+
+void DratChecker::deactivateClause(ClauseIndex clauseIndex)
+{
+	CheckedClause& clause = clauses[clauseIndex];
+	clause.isActive = false;
+
+	std::vector<ClauseIndex>& activeClausesWithSameHash = activeClausesPerHash[clause.hash];
+	if (const auto clauseIterator = std::find(activeClausesWithSameHash.begin(), activeClausesWithSameHash.end(), clauseIndex); clauseIterator != activeClausesWithSameHash.end())
+	{
+		*clauseIterator = activeClausesWithSameHash.back();
+		activeClausesWithSameHash.pop_back();
+	}
+
+	if (!clause.numLiterals)
+		--numActiveEmptyClauses;
+	else if (clause.numLiterals > 1)
+	{
+		const long* clauseLiterals = getLiteralsOfClause(clauseIndex);
+		detachWatcher(clauseLiterals[0], clauseIndex);
+		detachWatcher(clauseLiterals[1], clauseIndex);
+	}
+}
+
+DratChecker::ClauseIndex DratChecker::findActiveClause(std::vector<long> clauseLiterals) const
+{
+	std::sort(clauseLiterals.begin(), clauseLiterals.end());
+	clauseLiterals.erase(std::unique(clauseLiterals.begin(), clauseLiterals.end()), clauseLiterals.end());
+
+	const auto activeClausesWithSameHash = activeClausesPerHash.find(computeHash(clauseLiterals));
+	if (activeClausesWithSameHash == activeClausesPerHash.cend())
+		return NO_CLAUSE;
+
+	std::vector<long> sortedLiteralsOfCandidate;
+	// Prefer the most recently added clause if the clause exists multiple times
+	for (auto candidateIterator = activeClausesWithSameHash->second.crbegin(); candidateIterator != activeClausesWithSameHash->second.crend(); ++candidateIterator)
+	{
+		const CheckedClause& candidate = clauses[*candidateIterator];
+		if (candidate.numLiterals != clauseLiterals.size())
+			continue;
+
+		sortedLiteralsOfCandidate.assign(getLiteralsOfClause(*candidateIterator), getLiteralsOfClause(*candidateIterator) + candidate.numLiterals);
+		std::sort(sortedLiteralsOfCandidate.begin(), sortedLiteralsOfCandidate.end());
+		if (sortedLiteralsOfCandidate == clauseLiterals)
+			return *candidateIterator;
+	}
+	return NO_CLAUSE;
+}
+
+void DratChecker::detachWatcher(long watchedLiteral, ClauseIndex clauseIndex)
+{
+	std::vector<ClauseIndex>& watchersOfLiteral = watchers[literalToIndex(watchedLiteral)];
+	if (const auto watcherIterator = std::find(watchersOfLiteral.begin(), watchersOfLiteral.end(), clauseIndex); watcherIterator != watchersOfLiteral.end())
+	{
+		*watcherIterator = watchersOfLiteral.back();
+		watchersOfLiteral.pop_back();
+	}
+}
+
+bool DratChecker::isResolutionAsymmetricTautology(const std::vector<long>& clauseLiterals, bool shouldAntecedentsBeMarked)
+{
+	if (clauseLiterals.empty())
+		return false;
+
+	// A RAT on the pivot literal p is propagation redundant with respect to the witness that only differs in p from the assignment falsifying the clause
+	const long pivotLiteral = clauseLiterals.front();
+	std::vector<long> witness = { pivotLiteral };
+	for (const long literal : clauseLiterals)
+	{
+		if (literal != pivotLiteral)
+			witness.emplace_back(-literal);
+	}
+	return isRedundantWithRespectToWitness(clauseLiterals, witness, shouldAntecedentsBeMarked);
+}
+
+/*
+ * A clause D that does not contain the negation of a witness literal differing from the assignment falsifying C is trivially implied since every literal of D falsified by the witness is also falsified by said assignment,
+ * thus only the clauses containing the negation of a witness literal that is not the negation of a literal of C need to be checked.
+ */
+bool DratChecker::isRedundantWithRespectToWitness(const std::vector<long>& clauseLiterals, const std::vector<long>& witness, bool shouldAntecedentsBeMarked)
+{
+	for (const long literal : clauseLiterals)
+		isLiteralOfCheckedClause[literalToIndex(literal)] = 1;
+	for (const long literal : witness)
+		isLiteralOfWitness[literalToIndex(literal)] = 1;
+
+	bool isRedundant = std::any_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [this](const long literal) { return isLiteralOfWitness[literalToIndex(literal)]; });
+	++currentClauseVisitStamp;
+
+	std::vector<long> resolventLiterals;
+	for (auto witnessLiteralIterator = witness.cbegin(); witnessLiteralIterator != witness.cend() && isRedundant; ++witnessLiteralIterator)
+	{
+		if (isLiteralOfCheckedClause[literalToIndex(-*witnessLiteralIterator)])
+			continue;
+
+		const std::vector<ClauseIndex>& clausesContainingNegatedWitnessLiteral = literalOccurrences[literalToIndex(-*witnessLiteralIterator)];
+		for (std::size_t i = 0; i < clausesContainingNegatedWitnessLiteral.size() && isRedundant; ++i)
+		{
+			const ClauseIndex clauseIndex = clausesContainingNegatedWitnessLiteral[i];
+			if (!clauses[clauseIndex].isActive || clauseVisitStamps[clauseIndex] == currentClauseVisitStamp)
+				continue;
+			clauseVisitStamps[clauseIndex] = currentClauseVisitStamp;
+
+			const long* touchedClauseLiterals = getLiteralsOfClause(clauseIndex);
+			const long* touchedClauseLiteralsEnd = touchedClauseLiterals + clauses[clauseIndex].numLiterals;
+			if (std::any_of(touchedClauseLiterals, touchedClauseLiteralsEnd, [this](const long literal) { return isLiteralOfWitness[literalToIndex(literal)]; }))
+				continue;
+
+			resolventLiterals = clauseLiterals;
+			std::copy_if(touchedClauseLiterals, touchedClauseLiteralsEnd, std::back_inserter(resolventLiterals), [this](const long literal) { return !isLiteralOfWitness[literalToIndex(-literal)]; });
+			isRedundant = isReverseUnitPropagation(resolventLiterals, shouldAntecedentsBeMarked);
+			if (isRedundant && shouldAntecedentsBeMarked)
+				clauses[clauseIndex].isCore = true;
+		}
+	}
+
+	for (const long literal : clauseLiterals)
+		isLiteralOfCheckedClause[literalToIndex(literal)] = 0;
+	for (const long literal : witness)
+		isLiteralOfWitness[literalToIndex(literal)] = 0;
+	return isRedundant;
+}
+
+bool DratChecker::isReverseUnitPropagation(const std::vector<long>& clauseLiterals, bool shouldAntecedentsBeMarked)
+{
+	if (numActiveEmptyClauses)
+		return true;
+
+	for (const long literal : clauseLiterals)
+	{
+		const LiteralValue literalValue = getLiteralValue(literal);
+		// The clause is a tautology if the negation of the literal was already assigned
+		if (literalValue == LiteralValue::Satisfied)
+		{
+			resetAssignment();
+			return true;
+		}
+		if (literalValue == LiteralValue::Unassigned)
+			assignLiteral(-literal, NO_CLAUSE);
+	}
+
+	ClauseIndex conflictingClause = NO_CLAUSE;
+	for (auto unitClauseIterator = unitClauses.cbegin(); unitClauseIterator != unitClauses.cend() && conflictingClause == NO_CLAUSE; ++unitClauseIterator)
+	{
+		if (!clauses[*unitClauseIterator].isActive)
+			continue;
+
+		const long unitLiteral = *getLiteralsOfClause(*unitClauseIterator);
+		if (getLiteralValue(unitLiteral) == LiteralValue::Falsified)
+			conflictingClause = *unitClauseIterator;
+		else if (getLiteralValue(unitLiteral) == LiteralValue::Unassigned)
+			assignLiteral(unitLiteral, *unitClauseIterator);
+	}
+
+	std::size_t propagationQueueHead = 0;
+	if (conflictingClause == NO_CLAUSE)
+		conflictingClause = propagate(propagationQueueHead);
+	if (conflictingClause != NO_CLAUSE && shouldAntecedentsBeMarked)
+		markAntecedentsOfConflict(conflictingClause);
+
+	resetAssignment();
+	return conflictingClause != NO_CLAUSE;
+}
+
+DratChecker::ClauseIndex DratChecker::propagate(std::size_t& propagationQueueHead)
+{
+	while (propagationQueueHead < trail.size())
+	{
+		const long falsifiedLiteral = -trail[propagationQueueHead++];
+		std::vector<ClauseIndex>& watchersOfFalsifiedLiteral = watchers[literalToIndex(falsifiedLiteral)];
+
+		std::size_t numRemainingWatchers = 0;
+		for (std::size_t i = 0; i < watchersOfFalsifiedLiteral.size(); ++i)
+		{
+			const ClauseIndex clauseIndex = watchersOfFalsifiedLiteral[i];
+			long* clauseLiterals = getLiteralsOfClause(clauseIndex);
+			if (clauseLiterals[0] == falsifiedLiteral)
+				std::swap(clauseLiterals[0], clauseLiterals[1]);
+
+			if (getLiteralValue(clauseLiterals[0]) == LiteralValue::Satisfied)
+			{
+				watchersOfFalsifiedLiteral[numRemainingWatchers++] = clauseIndex;
+				continue;
+			}
+
+			bool foundReplacementWatch = false;
+			for (std::uint32_t literalPosition = 2; literalPosition < clauses[clauseIndex].numLiterals && !foundReplacementWatch; ++literalPosition)
+			{
+				if (getLiteralValue(clauseLiterals[literalPosition]) != LiteralValue::Falsified)
+				{
+					std::swap(clauseLiterals[1], clauseLiterals[literalPosition]);
+					watchers[literalToIndex(clauseLiterals[1])].emplace_back(clauseIndex);
+					foundReplacementWatch = true;
+				}
+			}
+			if (foundReplacementWatch)
+				continue;
+
+			watchersOfFalsifiedLiteral[numRemainingWatchers++] = clauseIndex;
+			if (getLiteralValue(clauseLiterals[0]) == LiteralValue::Falsified)
+			{
+				while (++i < watchersOfFalsifiedLiteral.size())
+					watchersOfFalsifiedLiteral[numRemainingWatchers++] = watchersOfFalsifiedLiteral[i];
+				watchersOfFalsifiedLiteral.resize(numRemainingWatchers);
+				return clauseIndex;
+			}
+			assignLiteral(clauseLiterals[0], clauseIndex);
+		}
+		watchersOfFalsifiedLiteral.resize(numRemainingWatchers);
+	}
+	return NO_CLAUSE;
+}
+
+void DratChecker::assignLiteral(long literal, ClauseIndex reason)
+{
+	literalValues[literalToIndex(literal)] = LiteralValue::Satisfied;
+	literalValues[literalToIndex(-literal)] = LiteralValue::Falsified;
+	reasons[literalToVariable(literal)] = reason;
+	trail.emplace_back(literal);
+}
+
+void DratChecker::markAntecedentsOfConflict(ClauseIndex conflictingClause)
+{
+	clauses[conflictingClause].isCore = true;
+	const long* conflictingClauseLiterals = getLiteralsOfClause(conflictingClause);
+	for (std::uint32_t i = 0; i < clauses[conflictingClause].numLiterals; ++i)
+		isVariableSeen[literalToVariable(conflictingClauseLiterals[i])] = 1;
+
+	for (auto trailIterator = trail.crbegin(); trailIterator != trail.crend(); ++trailIterator)
+	{
+		const std::size_t variable = literalToVariable(*trailIterator);
+		if (!isVariableSeen[variable] || reasons[variable] == NO_CLAUSE)
+			continue;
+
+		const ClauseIndex reason = reasons[variable];
+		clauses[reason].isCore = true;
+		const long* reasonLiterals = getLiteralsOfClause(reason);
+		for (std::uint32_t i = 0; i < clauses[reason].numLiterals; ++i)
+			isVariableSeen[literalToVariable(reasonLiterals[i])] = 1;
+	}
+
+	for (const long literal : trail)
+		isVariableSeen[literalToVariable(literal)] = 0;
+}
+
+void DratChecker::resetAssignment()
+{
+	for (const long literal : trail)
+	{
+		literalValues[literalToIndex(literal)] = LiteralValue::Unassigned;
+		literalValues[literalToIndex(-literal)] = LiteralValue::Unassigned;
+	}
+	trail.clear();
+}
+
+DratChecker::CheckResult DratChecker::verifyProofInForwardMode(const std::vector<ProofLine>& proofLines)
+{
+	CheckResult checkResult = CheckResult({ true, false, 0, 0, 0, 0, 0, 0, std::nullopt });
+	for (std::size_t proofLineIndex = 0; proofLineIndex < proofLines.size(); ++proofLineIndex)
+	{
+		const ProofLine& proofLine = proofLines[proofLineIndex];
+		if (!proofLine.isAddition)
+		{
+			++checkResult.numDeletions;
+			// Deletions of unit clauses are ignored since they would invalidate the assignments implied by them
+			if (const ClauseIndex deletedClause = findActiveClause(proofLine.literals); deletedClause != NO_CLAUSE && clauses[deletedClause].numLiterals != 1)
+				deactivateClause(deletedClause);
+			else
+				++checkResult.numIgnoredDeletions;
+			continue;
+		}
+
+		++checkResult.numLemmas;
+		++checkResult.numCheckedLemmas;
+		bool isLemmaValid = isReverseUnitPropagation(proofLine.literals, false);
+		if (!isLemmaValid && isResolutionAsymmetricTautology(proofLine.literals, false))
+		{
+			isLemmaValid = true;
+			++checkResult.numResolutionAsymmetricTautologies;
+		}
+		if (!isLemmaValid)
+		{
+			checkResult.isProofValid = false;
+			checkResult.optionalIndexOfFirstInvalidProofLine = proofLineIndex;
+			return checkResult;
+		}
+
+		static_cast<void>(addClause(proofLine.literals, true));
+		if (proofLine.literals.empty())
+		{
+			checkResult.wasEmptyClauseDerived = true;
+			return checkResult;
+		}
+	}
+	return checkResult;
+}
+
+DratChecker::CheckResult DratChecker::verifyProofInBackwardMode(const std::vector<ProofLine>& proofLines, std::size_t indexOfEmptyClause)
+{
+	CheckResult checkResult = CheckResult({ true, false, 0, 0, 0, 0, 0, 0, std::nullopt });
+	std::vector<ClauseIndex> clausesOfProofLines(indexOfEmptyClause + 1, NO_CLAUSE);
+	for (std::size_t proofLineIndex = 0; proofLineIndex <= indexOfEmptyClause; ++proofLineIndex)
+	{
+		const ProofLine& proofLine = proofLines[proofLineIndex];
+		if (proofLine.isAddition)
+		{
+			++checkResult.numLemmas;
+			clausesOfProofLines[proofLineIndex] = addClause(proofLine.literals, true);
+			continue;
+		}
+
+		++checkResult.numDeletions;
+		if (const ClauseIndex deletedClause = findActiveClause(proofLine.literals); deletedClause != NO_CLAUSE && clauses[deletedClause].numLiterals != 1)
+		{
+			deactivateClause(deletedClause);
+			clausesOfProofLines[proofLineIndex] = deletedClause;
+		}
+		else
+			++checkResult.numIgnoredDeletions;
+	}
+
+	clauses[clausesOfProofLines[indexOfEmptyClause]].isCore = true;
+	for (std::size_t proofLineIndex = indexOfEmptyClause + 1; proofLineIndex-- > 0;)
+	{
+		const ClauseIndex clauseIndex = clausesOfProofLines[proofLineIndex];
+		if (clauseIndex == NO_CLAUSE)
+			continue;
+		if (!proofLines[proofLineIndex].isAddition)
+		{
+			activateClause(clauseIndex);
+			continue;
+		}
+
+		deactivateClause(clauseIndex);
+		if (!clauses[clauseIndex].isCore)
+			continue;
+
+		++checkResult.numCheckedLemmas;
+		bool isLemmaValid = isReverseUnitPropagation(proofLines[proofLineIndex].literals, true);
+		if (!isLemmaValid && isResolutionAsymmetricTautology(proofLines[proofLineIndex].literals, true))
+		{
+			isLemmaValid = true;
+			++checkResult.numResolutionAsymmetricTautologies;
+		}
+		if (!isLemmaValid)
+		{
+			checkResult.isProofValid = false;
+			checkResult.optionalIndexOfFirstInvalidProofLine = proofLineIndex;
+			return checkResult;
+		}
+	}
+
+	checkResult.wasEmptyClauseDerived = true;
+	checkResult.numCoreOriginalClauses = static_cast<std::size_t>(std::count_if(clauses.cbegin(), clauses.cend(), [](const CheckedClause& clause) { return !clause.isLemma && clause.isCore; }));
+	return checkResult;
+}
+
+std::vector<DratChecker::ProofLine> DratChecker::readBinaryProof(std::istream& binaryProofStream)
+{
+	const std::string proofContent((std::istreambuf_iterator<char>(binaryProofStream)), std::istreambuf_iterator<char>());
+
+	std::vector<ProofLine> proofLines;
+	std::size_t position = 0;
+	while (position < proofContent.size())
+	{
+		const char lineMarker = proofContent[position++];
+		if (lineMarker != 'a' && lineMarker != 'd')
+			throw std::invalid_argument("Expected line marker 'a' or 'd' at position " + std::to_string(position - 1) + " of the proof");
+
+		ProofLine proofLine;
+		proofLine.isAddition = lineMarker == 'a';
+		while (true)
+		{
+			std::uint64_t mappedLiteral = 0;
+			std::size_t shift = 0;
+			unsigned char byte;
+			do
+			{
+				if (position == proofContent.size() || shift > 56)
+					throw std::invalid_argument("Proof line ending at position " + std::to_string(position) + " is truncated");
+
+				byte = static_cast<unsigned char>(proofContent[position++]);
+				mappedLiteral |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+				shift += 7;
+			} while (byte & 0x80);
+
+			if (!mappedLiteral)
+				break;
+
+			const auto variable = static_cast<long>(mappedLiteral >> 1);
+			proofLine.literals.emplace_back(mappedLiteral & 1 ? -variable : variable);
+		}
+		proofLines.emplace_back(std::move(proofLine));
+	}
+	return proofLines;
+}
+
+// The hash is independent of the order of the literals to allow the lookup of deleted clauses whose literals are defined in a different order
+std::size_t DratChecker::computeHash(const std::vector<long>& sortedClauseLiterals) noexcept
+{
+	std::size_t sum = 0;
+	std::size_t product = 1;
+	for (const long literal : sortedClauseLiterals)
+	{
+		const auto mappedLiteral = static_cast<std::size_t>(literalToIndex(literal));
+		sum += mappedLiteral * 0x9E3779B97F4A7C15ULL;
+		product *= (mappedLiteral << 1) | 1;
+	}
+	return sum ^ product ^ sortedClauseLiterals.size();
+}
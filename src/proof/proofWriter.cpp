@@ -0,0 +1,185 @@
+#include "proof/proofWriter.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+
+using namespace proof;
+
+ProofWriter::ProofWriter(std::ostream& outputStream, ProofFormat proofFormat, std::size_t bufferSize)
+	: outputStream(outputStream), proofFormat(proofFormat), bufferSize(bufferSize), isFlushBufferPending(false), isClosed(false), hasWriteFailed(false), numAddedClauses(0), numDeletedClauses(0), numWrittenBytes(0)
+{
+	if (!bufferSize)
+		throw std::invalid_argument("Size of the proof buffer must be larger than zero");
+
+	fillBuffer.reserve(bufferSize);
+	flushBuffer.reserve(bufferSize);
+	writerThread = std::thread(&ProofWriter::writeHandedOverBuffers, this);
+}
+
+ProofWriter::~ProofWriter()
+{
+	// Errors during the writing of the proof can only be reported by an explicit call to close(..)
+	if (!isClosed)
+		static_cast<void>(close());
+}
+
+void ProofWriter::addClause(const long* clauseLiterals, std::size_t numLiterals)
+{
+	if (proofFormat == ProofFormat::Lrat)
+		throw std::invalid_argument("Clause additions of a LRAT proof require the identifier of the clause as well as its hints");
+
+	++numAddedClauses;
+	writeByte('a');
+	writeLiterals(clauseLiterals, numLiterals);
+}
+
+void ProofWriter::addClause(const std::vector<long>& clauseLiterals)
+{
+	addClause(clauseLiterals.data(), clauseLiterals.size());
+}
+
+void ProofWriter::addEmptyClause()
+{
+	addClause(nullptr, 0);
+}
+
+void ProofWriter::deleteClause(const long* clauseLiterals, std::size_t numLiterals)
+{
+	if (proofFormat == ProofFormat::Lrat)
+		throw std::invalid_argument("Clause deletions of a LRAT proof require the identifiers of the deleted clauses");
+
+	++numDeletedClauses;
+	writeByte('d');
+	writeLiterals(clauseLiterals, numLiterals);
+}
+
+void ProofWriter::deleteClause(const std::vector<long>& clauseLiterals)
+{
+	deleteClause(clauseLiterals.data(), clauseLiterals.size());
+}
+
+void ProofWriter::addClause(ClauseId clauseId, const std::vector<long>& clauseLiterals, const std::vector<long>& hints)
+{
+	if (proofFormat != ProofFormat::Lrat)
+		throw std::invalid_argument("Clause identifiers and hints can only be defined for clause additions of a LRAT proof");
+	if (!clauseId)
+		throw std::invalid_argument("Clause identifier must be larger than zero");
+
+	++numAddedClauses;
+	writeByte('a');
+	writeMappedNumber(clauseId << 1);
+	writeLiterals(clauseLiterals.data(), clauseLiterals.size());
+	for (const long hint : hints)
+		writeSignedNumber(hint);
+	writeByte(0);
+}
+
+void ProofWriter::deleteClauses(const std::vector<ClauseId>& clauseIds)
+{
+	if (proofFormat != ProofFormat::Lrat)
+		throw std::invalid_argument("Clause identifiers can only be used to delete clauses of a LRAT proof");
+
+	numDeletedClauses += clauseIds.size();
+	writeByte('d');
+	for (const ClauseId clauseId : clauseIds)
+		writeMappedNumber(clauseId << 1);
+	writeByte(0);
+}
+
+bool ProofWriter::close()
+{
+	if (isClosed)
+		return !hasWriteFailed;
+
+	if (!fillBuffer.empty())
+		handOverFillBuffer();
+
+	{
+		const std::lock_guard lock(bufferHandoverMutex);
+		isClosed = true;
+	}
+	bufferHandoverConditionVariable.notify_all();
+	writerThread.join();
+	outputStream.flush();
+	hasWriteFailed = hasWriteFailed || !outputStream;
+	return !hasWriteFailed;
+}
+
+ProofWriter::ProofFormat ProofWriter::getProofFormat() const noexcept
+{
+	return proofFormat;
+}
+
+std::size_t ProofWriter::getNumAddedClauses() const noexcept
+{
+	return numAddedClauses;
+}
+
+std::size_t ProofWriter::getNumDeletedClauses() const noexcept
+{
+	return numDeletedClauses;
+}
+
+std::size_t ProofWriter::getNumWrittenBytes() const noexcept
+{
+	return numWrittenBytes + fillBuffer.size();
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void ProofWriter::writeLiterals(const long* clauseLiterals, std::size_t numLiterals)
+{
+	for (std::size_t i = 0; i < numLiterals; ++i)
+		writeSignedNumber(clauseLiterals[i]);
+	writeByte(0);
+}
+
+void ProofWriter::writeMappedNumber(std::uint64_t mappedNumber)
+{
+	while (mappedNumber > 127)
+	{
+		writeByte(static_cast<char>(0x80 | (mappedNumber & 0x7F)));
+		mappedNumber >>= 7;
+	}
+	writeByte(static_cast<char>(mappedNumber));
+}
+
+void ProofWriter::writeSignedNumber(long number)
+{
+	writeMappedNumber((static_cast<std::uint64_t>(std::labs(number)) << 1) | (number < 0));
+}
+
+/*
+ * The filled buffer is swapped with the flush buffer once the writer thread finished writing the latter, thus only the producer accesses the fill buffer while the writer thread exclusively owns the flush buffer while it is pending.
+ */
+void ProofWriter::handOverFillBuffer()
+{
+	std::unique_lock lock(bufferHandoverMutex);
+	bufferHandoverConditionVariable.wait(lock, [this] { return !isFlushBufferPending; });
+	numWrittenBytes += fillBuffer.size();
+	fillBuffer.swap(flushBuffer);
+	isFlushBufferPending = true;
+	lock.unlock();
+
+	bufferHandoverConditionVariable.notify_all();
+	fillBuffer.clear();
+}
+
+void ProofWriter::writeHandedOverBuffers()
+{
+	std::unique_lock lock(bufferHandoverMutex);
+	while (true)
+	{
+		bufferHandoverConditionVariable.wait(lock, [this] { return isFlushBufferPending || isClosed; });
+		if (!isFlushBufferPending)
+			return;
+
+		lock.unlock();
+		if (!hasWriteFailed && !outputStream.write(flushBuffer.data(), static_cast<std::streamsize>(flushBuffer.size())))
+			hasWriteFailed = true;
+		flushBuffer.clear();
+		lock.lock();
+
+		isFlushBufferPending = false;
+		bufferHandoverConditionVariable.notify_all();
+	}
+}
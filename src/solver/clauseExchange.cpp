@@ -0,0 +1,135 @@
+#include "solver/clauseExchange.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace solver;
+
+ClauseExchange::ClauseExchange(std::size_t numWorkers, std::size_t ringCapacity)
+	: ringCapacity(ringCapacity), exportRings(numWorkers), workerLocalData(numWorkers)
+{
+	if (!numWorkers)
+		throw std::invalid_argument("Clause exchange requires at least one worker");
+	if (!ringCapacity)
+		throw std::invalid_argument("Capacity of export rings must be larger than zero");
+
+	for (ExportRing& exportRing : exportRings)
+	{
+		exportRing.slots = std::make_unique<Slot[]>(ringCapacity);
+		for (std::size_t slotIndex = 0; slotIndex < ringCapacity; ++slotIndex)
+			exportRing.slots[slotIndex].sequenceNumber.store(0, std::memory_order_relaxed);
+		exportRing.numPublishedClauses.store(0, std::memory_order_relaxed);
+	}
+	for (WorkerLocalData& dataOfWorker : workerLocalData)
+	{
+		dataOfWorker.numReadClausesPerRing.resize(numWorkers, 0);
+		dataOfWorker.knownClauseHashes.resize(NUM_CLAUSE_HASH_TABLE_ENTRIES, 0);
+	}
+}
+
+bool ClauseExchange::exportClause(std::size_t workerIndex, const long* clauseLiterals, std::size_t numLiterals, std::uint32_t literalBlockDistance)
+{
+	if (!numLiterals || numLiterals > MAXIMUM_CLAUSE_SIZE || !recordClauseHash(workerIndex, computeClauseHash(clauseLiterals, numLiterals)))
+		return false;
+
+	ExportRing& exportRing = exportRings[workerIndex];
+	const std::uint64_t ticket = exportRing.numPublishedClauses.load(std::memory_order_relaxed);
+	Slot& slot = exportRing.slots[ticket % ringCapacity];
+
+	slot.sequenceNumber.store(2 * ticket + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	slot.numLiterals.store(static_cast<std::uint32_t>(numLiterals), std::memory_order_relaxed);
+	slot.literalBlockDistance.store(literalBlockDistance, std::memory_order_relaxed);
+	for (std::size_t literalIndex = 0; literalIndex < numLiterals; ++literalIndex)
+		slot.literals[literalIndex].store(clauseLiterals[literalIndex], std::memory_order_relaxed);
+	slot.sequenceNumber.store(2 * (ticket + 1), std::memory_order_release);
+	exportRing.numPublishedClauses.store(ticket + 1, std::memory_order_release);
+	return true;
+}
+
+std::size_t ClauseExchange::importClauses(std::size_t workerIndex, std::vector<ExchangedClause>& importedClauses)
+{
+	std::size_t numSkippedClauses = 0;
+	std::vector<long> clauseLiterals;
+	for (std::size_t producerIndex = 0; producerIndex < exportRings.size(); ++producerIndex)
+	{
+		if (producerIndex == workerIndex)
+			continue;
+
+		const ExportRing& exportRing = exportRings[producerIndex];
+		std::uint64_t& numReadClauses = workerLocalData[workerIndex].numReadClausesPerRing[producerIndex];
+		const std::uint64_t numPublishedClauses = exportRing.numPublishedClauses.load(std::memory_order_acquire);
+		if (numPublishedClauses - numReadClauses > ringCapacity)
+		{
+			numSkippedClauses += numPublishedClauses - numReadClauses - ringCapacity;
+			numReadClauses = numPublishedClauses - ringCapacity;
+		}
+
+		for (; numReadClauses < numPublishedClauses; ++numReadClauses)
+		{
+			const Slot& slot = exportRing.slots[numReadClauses % ringCapacity];
+			const std::uint64_t expectedSequenceNumber = 2 * (numReadClauses + 1);
+			if (slot.sequenceNumber.load(std::memory_order_acquire) != expectedSequenceNumber)
+			{
+				++numSkippedClauses;
+				continue;
+			}
+
+			const std::uint32_t numLiterals = std::min(slot.numLiterals.load(std::memory_order_relaxed), static_cast<std::uint32_t>(MAXIMUM_CLAUSE_SIZE));
+			const std::uint32_t literalBlockDistance = slot.literalBlockDistance.load(std::memory_order_relaxed);
+			clauseLiterals.resize(numLiterals);
+			for (std::size_t literalIndex = 0; literalIndex < numLiterals; ++literalIndex)
+				clauseLiterals[literalIndex] = slot.literals[literalIndex].load(std::memory_order_relaxed);
+
+			// The slot was overwritten by the producer while it was read
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (slot.sequenceNumber.load(std::memory_order_relaxed) != expectedSequenceNumber)
+			{
+				++numSkippedClauses;
+				continue;
+			}
+
+			if (recordClauseHash(workerIndex, computeClauseHash(clauseLiterals.data(), clauseLiterals.size())))
+				importedClauses.emplace_back(ExchangedClause({ clauseLiterals, literalBlockDistance }));
+		}
+	}
+	return numSkippedClauses;
+}
+
+std::size_t ClauseExchange::getNumWorkers() const noexcept
+{
+	return exportRings.size();
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+/*
+ * The table of known clause hashes is direct-mapped, an entry is simply overwritten by a colliding clause hash thus a clause can be exchanged again once its entry was evicted.
+ */
+bool ClauseExchange::recordClauseHash(std::size_t workerIndex, std::uint64_t clauseHash)
+{
+	std::uint64_t& entry = workerLocalData[workerIndex].knownClauseHashes[clauseHash % NUM_CLAUSE_HASH_TABLE_ENTRIES];
+	if (entry == clauseHash)
+		return false;
+	entry = clauseHash;
+	return true;
+}
+
+/*
+ * The hash needs to be independent of the order of the literals since the literals of learned clauses are not sorted, it thus combines the sum and the xor of the mixed literals (using the finalizer of splitmix64).
+ */
+std::uint64_t ClauseExchange::computeClauseHash(const long* clauseLiterals, std::size_t numLiterals) noexcept
+{
+	std::uint64_t sumOfMixedLiterals = 0;
+	std::uint64_t xorOfMixedLiterals = 0;
+	for (std::size_t literalIndex = 0; literalIndex < numLiterals; ++literalIndex)
+	{
+		std::uint64_t mixedLiteral = static_cast<std::uint64_t>(clauseLiterals[literalIndex]) + 0x9E3779B97F4A7C15ULL;
+		mixedLiteral = (mixedLiteral ^ (mixedLiteral >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		mixedLiteral = (mixedLiteral ^ (mixedLiteral >> 27)) * 0x94D049BB133111EBULL;
+		mixedLiteral ^= mixedLiteral >> 31;
+		sumOfMixedLiterals += mixedLiteral;
+		xorOfMixedLiterals ^= mixedLiteral;
+	}
+	// A hash of zero marks an empty entry in the table of known clause hashes
+	return ((sumOfMixedLiterals ^ (xorOfMixedLiterals << 1) ^ numLiterals) | 1);
+}
@@ -0,0 +1,241 @@
+#include "solver/cubeAndConquerSolver.hpp"
+
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace solver;
+
+CubeAndConquerSolver::CubeAndConquerSolver(SharedFormula::ptr sharedFormula, std::size_t numWorkers, Solver::SolverConfiguration solverConfiguration, CubeAndConquerConfiguration cubeAndConquerConfiguration)
+	: sharedFormula(std::move(sharedFormula)), solverConfiguration(std::move(solverConfiguration)), cubeAndConquerConfiguration(cubeAndConquerConfiguration), numPendingCubes(0), isSearchCancelled(false), numWakeUpsOfIdleWorkers(0), resourceBudget(nullptr),
+	result(Solver::SolverResult::Unknown), numInitialCubes(0), numRefutedCubes(0), numStalledCubes(0), numResplitCubes(0), numStolenCubes(0)
+{
+	if (!this->sharedFormula)
+		throw std::invalid_argument("Shared formula cannot be null");
+	if (!numWorkers)
+		throw std::invalid_argument("Cube-and-conquer solver requires at least one worker");
+	if (!cubeAndConquerConfiguration.numConflictsUntilCubeIsStalled)
+		throw std::invalid_argument("Number of conflicts until a cube is stalled must be larger than zero");
+	if (!cubeAndConquerConfiguration.resplitCubeDepth)
+		throw std::invalid_argument("Depth of the split of stalled cubes must be larger than zero");
+	if (!cubeAndConquerConfiguration.maximumNumLookaheadCandidates)
+		throw std::invalid_argument("Maximum number of lookahead candidates must be larger than zero");
+
+	workers.resize(numWorkers);
+	// The cubers of the workers are only created once a worker needs to split a stalled cube
+	cubersOfWorkers.resize(numWorkers);
+	cubersOfWorkers.front() = std::make_unique<LookaheadCuber>(this->sharedFormula, cubeAndConquerConfiguration.maximumNumLookaheadCandidates);
+	if (cubeAndConquerConfiguration.isClauseSharingEnabled && numWorkers > 1)
+		clauseExchange = std::make_unique<ClauseExchange>(numWorkers);
+}
+
+Solver::SolverResult CubeAndConquerSolver::solve()
+{
+	isSearchCancelled = false;
+	indexOfWinningWorker.reset();
+	result = Solver::SolverResult::Unknown;
+	numPendingCubes = 0;
+	numRefutedCubes = 0;
+	numStalledCubes = 0;
+	numResplitCubes = 0;
+	numStolenCubes = 0;
+	cubeQueuesOfWorkers.clear();
+	for (std::size_t workerIndex = 0; workerIndex < workers.size(); ++workerIndex)
+		cubeQueuesOfWorkers.emplace_back(std::make_unique<WorkStealingDeque<Cube>>());
+
+	std::vector<Cube> initialCubes = cubersOfWorkers.front()->splitCube({}, cubeAndConquerConfiguration.initialCubeDepth);
+	numInitialCubes = initialCubes.size();
+	if (initialCubes.empty())
+	{
+		result = Solver::SolverResult::Unsat;
+		return result;
+	}
+	enqueueCubes(0, std::move(initialCubes), true);
+
+	std::mutex workerErrorMutex;
+	std::exception_ptr firstWorkerError;
+	std::vector<std::thread> workerThreads;
+	workerThreads.reserve(workers.size());
+	for (std::size_t workerIndex = 0; workerIndex < workers.size(); ++workerIndex)
+	{
+		workerThreads.emplace_back([this, workerIndex, &workerErrorMutex, &firstWorkerError]
+		{
+			try
+			{
+				runWorker(workerIndex);
+			}
+			catch (...)
+			{
+				const std::lock_guard<std::mutex> lock(workerErrorMutex);
+				if (!firstWorkerError)
+					firstWorkerError = std::current_exception();
+				isSearchCancelled = true;
+				wakeUpIdleWorkers();
+			}
+		});
+	}
+
+	for (std::thread& workerThread : workerThreads)
+		workerThread.join();
+
+	if (firstWorkerError)
+		std::rethrow_exception(firstWorkerError);
+	if (!indexOfWinningWorker.has_value() && !numPendingCubes)
+		result = Solver::SolverResult::Unsat;
+	return result;
+}
+
+std::vector<long> CubeAndConquerSolver::getModel() const
+{
+	if (!indexOfWinningWorker.has_value() || result != Solver::SolverResult::Sat)
+		return {};
+	return workers[*indexOfWinningWorker]->getModel();
+}
+
+std::size_t CubeAndConquerSolver::getNumWorkers() const noexcept
+{
+	return workers.size();
+}
+
+std::optional<std::size_t> CubeAndConquerSolver::getIndexOfWinningWorker() const noexcept
+{
+	return indexOfWinningWorker;
+}
+
+const Solver::SolverStatistics& CubeAndConquerSolver::getStatisticsOfWorker(std::size_t workerIndex) const
+{
+	if (workerIndex >= workers.size() || !workers[workerIndex])
+		throw std::out_of_range("No statistics of worker " + std::to_string(workerIndex) + " are available");
+	return workers[workerIndex]->getStatistics();
+}
+
+CubeAndConquerSolver::CubeAndConquerStatistics CubeAndConquerSolver::getStatistics() const noexcept
+{
+	return CubeAndConquerStatistics({ numInitialCubes, numRefutedCubes.load(), numStalledCubes.load(), numResplitCubes.load(), numStolenCubes.load() });
+}
+
+void CubeAndConquerSolver::setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+{
+	this->resourceBudget = resourceBudget;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void CubeAndConquerSolver::runWorker(std::size_t workerIndex)
+{
+	if (!workers[workerIndex])
+	{
+		workers[workerIndex] = std::make_unique<Solver>(sharedFormula, solverConfiguration);
+		workers[workerIndex]->setCancellationFlag(&isSearchCancelled);
+		if (clauseExchange)
+			workers[workerIndex]->setClauseExchange(clauseExchange.get(), workerIndex);
+	}
+	Solver& worker = *workers[workerIndex];
+	worker.setResourceBudget(resourceBudget);
+
+	while (!isSearchCancelled)
+	{
+		const std::size_t numWakeUpsBeforeAcquisition = numWakeUpsOfIdleWorkers;
+		std::optional<Cube> cube = acquireCube(workerIndex);
+		if (!cube.has_value())
+		{
+			// The remaining cubes are solved by other workers, which might still split them
+			if (!numPendingCubes)
+				return;
+			std::unique_lock<std::mutex> lock(idleWorkersMutex);
+			idleWorkersConditionVariable.wait(lock, [this, numWakeUpsBeforeAcquisition] { return numWakeUpsOfIdleWorkers != numWakeUpsBeforeAcquisition || isSearchCancelled || !numPendingCubes; });
+			continue;
+		}
+
+		// The conflict limit of the solver configuration limits the total number of conflicts of the worker over all of its cubes
+		std::size_t conflictLimitOfCube = worker.getStatistics().numConflicts + cubeAndConquerConfiguration.numConflictsUntilCubeIsStalled;
+		if (solverConfiguration.optionalConflictLimit.has_value())
+			conflictLimitOfCube = std::min(conflictLimitOfCube, *solverConfiguration.optionalConflictLimit);
+		worker.setConflictLimit(conflictLimitOfCube);
+
+		switch (worker.solve(*cube))
+		{
+			case Solver::SolverResult::Sat:
+				if (bool expectedCancellationState = false; isSearchCancelled.compare_exchange_strong(expectedCancellationState, true))
+				{
+					indexOfWinningWorker = workerIndex;
+					result = Solver::SolverResult::Sat;
+					wakeUpIdleWorkers();
+				}
+				return;
+			case Solver::SolverResult::Unsat:
+				++numRefutedCubes;
+				--numPendingCubes;
+				wakeUpIdleWorkers();
+				break;
+			default:
+			{
+				if (isSearchCancelled)
+					return;
+				// The pending cubes can never be solved once the budget is exhausted, thus the idle workers waiting for them are cancelled
+				if (resourceBudget && resourceBudget->isExhausted())
+				{
+					isSearchCancelled = true;
+					wakeUpIdleWorkers();
+					return;
+				}
+				// The cube remains pending so the other workers can continue to solve it within their own conflict limits
+				if (solverConfiguration.optionalConflictLimit.has_value() && worker.getStatistics().numConflicts >= *solverConfiguration.optionalConflictLimit)
+				{
+					cubeQueuesOfWorkers[workerIndex]->push(std::move(*cube));
+					wakeUpIdleWorkers();
+					return;
+				}
+
+				++numStalledCubes;
+				if (!cubersOfWorkers[workerIndex])
+					cubersOfWorkers[workerIndex] = std::make_unique<LookaheadCuber>(sharedFormula, cubeAndConquerConfiguration.maximumNumLookaheadCandidates);
+
+				std::vector<Cube> splitCubes = cubersOfWorkers[workerIndex]->splitCube(*cube, cubeAndConquerConfiguration.resplitCubeDepth);
+				numResplitCubes += splitCubes.size();
+				enqueueCubes(workerIndex, std::move(splitCubes), false);
+				--numPendingCubes;
+				wakeUpIdleWorkers();
+				break;
+			}
+		}
+	}
+}
+
+std::optional<CubeAndConquerSolver::Cube> CubeAndConquerSolver::acquireCube(std::size_t workerIndex)
+{
+	if (std::optional<Cube> cube = cubeQueuesOfWorkers[workerIndex]->pop(); cube.has_value())
+		return cube;
+
+	for (std::size_t offset = 1; offset < cubeQueuesOfWorkers.size(); ++offset)
+	{
+		if (std::optional<Cube> cube = cubeQueuesOfWorkers[(workerIndex + offset) % cubeQueuesOfWorkers.size()]->steal(); cube.has_value())
+		{
+			++numStolenCubes;
+			return cube;
+		}
+	}
+	return std::nullopt;
+}
+
+void CubeAndConquerSolver::enqueueCubes(std::size_t workerIndex, std::vector<Cube> cubes, bool areCubesDistributedOverAllWorkers)
+{
+	// The cubes are counted as pending before they are visible to other workers, thus the number of pending cubes cannot drop to zero while cubes are enqueued
+	numPendingCubes += cubes.size();
+	for (std::size_t cubeIndex = 0; cubeIndex < cubes.size(); ++cubeIndex)
+	{
+		const std::size_t indexOfReceivingWorker = areCubesDistributedOverAllWorkers ? (workerIndex + cubeIndex) % cubeQueuesOfWorkers.size() : workerIndex;
+		cubeQueuesOfWorkers[indexOfReceivingWorker]->push(std::move(cubes[cubeIndex]));
+	}
+	wakeUpIdleWorkers();
+}
+
+void CubeAndConquerSolver::wakeUpIdleWorkers()
+{
+	{
+		const std::lock_guard<std::mutex> lock(idleWorkersMutex);
+		++numWakeUpsOfIdleWorkers;
+	}
+	idleWorkersConditionVariable.notify_all();
+}
@@ -0,0 +1,99 @@
+#include "solver/decisionHeuristics/evsidsDecisionHeuristic.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using namespace decisionHeuristics;
+
+EvsidsDecisionHeuristic::EvsidsDecisionHeuristic(double activityDecayFactor)
+	: activityDecayFactor(activityDecayFactor), activityIncrement(1.0)
+{
+	if (activityDecayFactor <= 0 || activityDecayFactor >= 1)
+		throw std::invalid_argument("Activity decay factor " + std::to_string(activityDecayFactor) + " is not within the valid range (0, 1)");
+}
+
+void EvsidsDecisionHeuristic::init(std::size_t numVariables)
+{
+	activityIncrement = 1.0;
+	activities.assign(numVariables + 1, 0.0);
+	variableActivityHeap = VariableActivityHeap(numVariables);
+	for (std::size_t variable = 1; variable <= numVariables; ++variable)
+		variableActivityHeap.insert(variable, 0.0);
+}
+
+void EvsidsDecisionHeuristic::onNumVariablesIncreased(std::size_t numVariables)
+{
+	const std::size_t previousNumVariables = activities.size() - 1;
+	activities.resize(numVariables + 1, 0.0);
+	variableActivityHeap.increaseNumVariables(numVariables);
+	for (std::size_t variable = previousNumVariables + 1; variable <= numVariables; ++variable)
+		variableActivityHeap.insert(variable, 0.0);
+}
+
+void EvsidsDecisionHeuristic::onActivation()
+{
+	for (std::size_t variable = 1; variable < activities.size(); ++variable)
+		variableActivityHeap.insert(variable, activities[variable]);
+}
+
+void EvsidsDecisionHeuristic::onVariableBumpedDuringConflictAnalysis(std::size_t variable)
+{
+	activities[variable] += activityIncrement;
+	variableActivityHeap.increaseActivity(variable, activities[variable]);
+	if (activities[variable] > ACTIVITY_RESCALING_THRESHOLD)
+		rescaleActivities();
+}
+
+void EvsidsDecisionHeuristic::onConflict()
+{
+	activityIncrement /= activityDecayFactor;
+	if (activityIncrement > ACTIVITY_RESCALING_THRESHOLD)
+		rescaleActivities();
+}
+
+void EvsidsDecisionHeuristic::onVariableUnassigned(std::size_t variable)
+{
+	if (!variableActivityHeap.contains(variable))
+		variableActivityHeap.insert(variable, activities[variable]);
+}
+
+std::optional<std::size_t> EvsidsDecisionHeuristic::pickBranchingVariable(const VariableAssignmentCheck& isVariableAssigned)
+{
+	while (const std::optional<std::size_t> candidateVariable = variableActivityHeap.popVariableWithMaximumActivity())
+	{
+		if (!isVariableAssigned(*candidateVariable))
+			return candidateVariable;
+	}
+	return std::nullopt;
+}
+
+// Assigned variables are removed from the top of the heap, they are reinserted once they become unassigned
+std::optional<std::size_t> EvsidsDecisionHeuristic::peekBranchingVariable(const VariableAssignmentCheck& isVariableAssigned)
+{
+	while (const std::optional<std::size_t> candidateVariable = variableActivityHeap.getVariableWithMaximumActivity())
+	{
+		if (!isVariableAssigned(*candidateVariable))
+			return candidateVariable;
+		[[maybe_unused]] const std::optional<std::size_t> removedAssignedVariable = variableActivityHeap.popVariableWithMaximumActivity();
+	}
+	return std::nullopt;
+}
+
+bool EvsidsDecisionHeuristic::hasHigherPriority(std::size_t variable, std::size_t otherVariable) const
+{
+	return activities[variable] > activities[otherVariable] || (activities[variable] == activities[otherVariable] && variable < otherVariable);
+}
+
+double EvsidsDecisionHeuristic::getActivityOfVariable(std::size_t variable) const
+{
+	return variable < activities.size() ? activities[variable] : 0.0;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void EvsidsDecisionHeuristic::rescaleActivities()
+{
+	for (double& activity : activities)
+		activity *= ACTIVITY_RESCALING_FACTOR;
+	activityIncrement *= ACTIVITY_RESCALING_FACTOR;
+	variableActivityHeap.rescaleActivities(ACTIVITY_RESCALING_FACTOR);
+}
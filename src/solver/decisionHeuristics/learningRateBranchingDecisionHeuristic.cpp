@@ -0,0 +1,134 @@
+#include "solver/decisionHeuristics/learningRateBranchingDecisionHeuristic.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+using namespace decisionHeuristics;
+
+LearningRateBranchingDecisionHeuristic::LearningRateBranchingDecisionHeuristic(Configuration configuration)
+	: configuration(configuration), stepSize(configuration.initialStepSize), numConflicts(0)
+{
+	if (configuration.minimumStepSize <= 0 || configuration.minimumStepSize > configuration.initialStepSize || configuration.initialStepSize >= 1)
+		throw std::invalid_argument("Step size configuration [" + std::to_string(configuration.minimumStepSize) + ", " + std::to_string(configuration.initialStepSize) + "] must satisfy 0 < minimum step size <= initial step size < 1");
+	if (configuration.localityDecayFactor <= 0 || configuration.localityDecayFactor > 1)
+		throw std::invalid_argument("Locality decay factor " + std::to_string(configuration.localityDecayFactor) + " is not within the valid range (0, 1]");
+}
+
+void LearningRateBranchingDecisionHeuristic::init(std::size_t numVariables)
+{
+	stepSize = configuration.initialStepSize;
+	numConflicts = 0;
+	variableData.assign(numVariables + 1, VariableData({ 0.0, 0, 0, 0 }));
+	variableScoreHeap = VariableActivityHeap(numVariables);
+	for (std::size_t variable = 1; variable <= numVariables; ++variable)
+		variableScoreHeap.insert(variable, 0.0);
+}
+
+void LearningRateBranchingDecisionHeuristic::onNumVariablesIncreased(std::size_t numVariables)
+{
+	const std::size_t previousNumVariables = variableData.size() - 1;
+	variableData.resize(numVariables + 1, VariableData({ 0.0, numConflicts, numConflicts, 0 }));
+	variableScoreHeap.increaseNumVariables(numVariables);
+	for (std::size_t variable = previousNumVariables + 1; variable <= numVariables; ++variable)
+		variableScoreHeap.insert(variable, 0.0);
+}
+
+// Conflicts generated while the heuristic was inactive are not accounted for, thus the locality decay only considers the conflicts since the activation
+void LearningRateBranchingDecisionHeuristic::onActivation()
+{
+	for (std::size_t variable = 1; variable < variableData.size(); ++variable)
+	{
+		variableData[variable].conflictCountAtLastScoreUpdate = numConflicts;
+		variableScoreHeap.insert(variable, variableData[variable].score);
+	}
+}
+
+void LearningRateBranchingDecisionHeuristic::onVariableAssigned(std::size_t variable)
+{
+	variableData[variable].conflictCountAtAssignment = numConflicts;
+	variableData[variable].numParticipatedConflicts = 0;
+}
+
+void LearningRateBranchingDecisionHeuristic::onVariableBumpedDuringConflictAnalysis(std::size_t variable)
+{
+	++variableData[variable].numParticipatedConflicts;
+}
+
+void LearningRateBranchingDecisionHeuristic::onConflict()
+{
+	++numConflicts;
+	stepSize = std::max(configuration.minimumStepSize, stepSize - configuration.stepSizeDecrementPerConflict);
+}
+
+void LearningRateBranchingDecisionHeuristic::onVariableUnassigned(std::size_t variable)
+{
+	VariableData& dataOfVariable = variableData[variable];
+	if (const std::uint64_t numConflictsWhileAssigned = numConflicts - dataOfVariable.conflictCountAtAssignment; numConflictsWhileAssigned)
+	{
+		const double reward = static_cast<double>(dataOfVariable.numParticipatedConflicts) / static_cast<double>(numConflictsWhileAssigned);
+		dataOfVariable.score = (1.0 - stepSize) * dataOfVariable.score + stepSize * reward;
+		variableScoreHeap.updateActivity(variable, dataOfVariable.score);
+	}
+	dataOfVariable.conflictCountAtLastScoreUpdate = numConflicts;
+	variableScoreHeap.insert(variable, dataOfVariable.score);
+}
+
+std::optional<std::size_t> LearningRateBranchingDecisionHeuristic::pickBranchingVariable(const VariableAssignmentCheck& isVariableAssigned)
+{
+	applyLocalityDecayToVariablesWithHighestScore();
+	while (const std::optional<std::size_t> candidateVariable = variableScoreHeap.popVariableWithMaximumActivity())
+	{
+		if (!isVariableAssigned(*candidateVariable))
+			return candidateVariable;
+	}
+	return std::nullopt;
+}
+
+// Assigned variables are removed from the top of the heap, they are reinserted once they become unassigned
+std::optional<std::size_t> LearningRateBranchingDecisionHeuristic::peekBranchingVariable(const VariableAssignmentCheck& isVariableAssigned)
+{
+	applyLocalityDecayToVariablesWithHighestScore();
+	while (const std::optional<std::size_t> candidateVariable = variableScoreHeap.getVariableWithMaximumActivity())
+	{
+		if (!isVariableAssigned(*candidateVariable))
+			return candidateVariable;
+		[[maybe_unused]] const std::optional<std::size_t> removedAssignedVariable = variableScoreHeap.popVariableWithMaximumActivity();
+	}
+	return std::nullopt;
+}
+
+bool LearningRateBranchingDecisionHeuristic::hasHigherPriority(std::size_t variable, std::size_t otherVariable) const
+{
+	return variableData[variable].score > variableData[otherVariable].score || (variableData[variable].score == variableData[otherVariable].score && variable < otherVariable);
+}
+
+double LearningRateBranchingDecisionHeuristic::getScoreOfVariable(std::size_t variable) const
+{
+	return variable < variableData.size() ? variableData[variable].score : 0.0;
+}
+
+double LearningRateBranchingDecisionHeuristic::getStepSize() const noexcept
+{
+	return stepSize;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void LearningRateBranchingDecisionHeuristic::applyLocalityDecayToVariablesWithHighestScore()
+{
+	if (configuration.localityDecayFactor == 1)
+		return;
+
+	while (const std::optional<std::size_t> variableWithHighestScore = variableScoreHeap.getVariableWithMaximumActivity())
+	{
+		VariableData& dataOfVariable = variableData[*variableWithHighestScore];
+		const std::uint64_t numConflictsSinceLastScoreUpdate = numConflicts - dataOfVariable.conflictCountAtLastScoreUpdate;
+		if (!numConflictsSinceLastScoreUpdate)
+			return;
+
+		dataOfVariable.score *= std::pow(configuration.localityDecayFactor, static_cast<double>(numConflictsSinceLastScoreUpdate));
+		dataOfVariable.conflictCountAtLastScoreUpdate = numConflicts;
+		variableScoreHeap.updateActivity(*variableWithHighestScore, dataOfVariable.score);
+	}
+}
@@ -0,0 +1,145 @@
+#include "solver/decisionHeuristics/variableActivityHeap.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+using namespace decisionHeuristics;
+
+bool VariableActivityHeap::empty() const noexcept
+{
+	return heapEntries.empty();
+}
+
+std::size_t VariableActivityHeap::size() const noexcept
+{
+	return heapEntries.size();
+}
+
+bool VariableActivityHeap::contains(std::size_t variable) const noexcept
+{
+	return variable < positionsInHeap.size() && positionsInHeap[variable] != NOT_IN_HEAP;
+}
+
+std::optional<std::size_t> VariableActivityHeap::getVariableWithMaximumActivity() const noexcept
+{
+	if (heapEntries.empty())
+		return std::nullopt;
+	return heapEntries.front().variable;
+}
+
+void VariableActivityHeap::increaseNumVariables(std::size_t numVariables)
+{
+	if (numVariables + 1 > positionsInHeap.size())
+		positionsInHeap.resize(numVariables + 1, NOT_IN_HEAP);
+}
+
+void VariableActivityHeap::insert(std::size_t variable, double activity)
+{
+	if (!variable || variable >= positionsInHeap.size())
+		throw std::invalid_argument("Variable " + std::to_string(variable) + " is not within the valid range of variables [1, " + std::to_string(positionsInHeap.size() - 1) + "]");
+
+	if (contains(variable))
+		return;
+
+	positionsInHeap[variable] = heapEntries.size();
+	heapEntries.emplace_back(HeapEntry({ activity, variable }));
+	siftUp(heapEntries.size() - 1);
+}
+
+void VariableActivityHeap::increaseActivity(std::size_t variable, double activity)
+{
+	if (!contains(variable))
+		return;
+
+	const std::size_t heapPosition = positionsInHeap[variable];
+	heapEntries[heapPosition].activity = activity;
+	siftUp(heapPosition);
+}
+
+void VariableActivityHeap::updateActivity(std::size_t variable, double activity)
+{
+	if (!contains(variable))
+		return;
+
+	const std::size_t heapPosition = positionsInHeap[variable];
+	const bool wasActivityIncreased = activity > heapEntries[heapPosition].activity;
+	heapEntries[heapPosition].activity = activity;
+	if (wasActivityIncreased)
+		siftUp(heapPosition);
+	else
+		siftDown(heapPosition);
+}
+
+std::optional<std::size_t> VariableActivityHeap::popVariableWithMaximumActivity()
+{
+	if (heapEntries.empty())
+		return std::nullopt;
+
+	const std::size_t variable = heapEntries.front().variable;
+	positionsInHeap[variable] = NOT_IN_HEAP;
+	if (heapEntries.size() > 1)
+	{
+		heapEntries.front() = heapEntries.back();
+		positionsInHeap[heapEntries.front().variable] = 0;
+		heapEntries.pop_back();
+		siftDown(0);
+	}
+	else
+		heapEntries.pop_back();
+
+	return variable;
+}
+
+// Since all activities are scaled by the same positive factor, the order of the entries in the heap does not change
+void VariableActivityHeap::rescaleActivities(double scalingFactor)
+{
+	for (HeapEntry& heapEntry : heapEntries)
+		heapEntry.activity *= scalingFactor;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void VariableActivityHeap::siftUp(std::size_t heapPosition)
+{
+	const HeapEntry entryToSift = heapEntries[heapPosition];
+	while (heapPosition)
+	{
+		const std::size_t parentPosition = (heapPosition - 1) / ARITY;
+		if (!hasHigherPriority(entryToSift, heapEntries[parentPosition]))
+			break;
+
+		heapEntries[heapPosition] = heapEntries[parentPosition];
+		positionsInHeap[heapEntries[heapPosition].variable] = heapPosition;
+		heapPosition = parentPosition;
+	}
+	heapEntries[heapPosition] = entryToSift;
+	positionsInHeap[entryToSift.variable] = heapPosition;
+}
+
+void VariableActivityHeap::siftDown(std::size_t heapPosition)
+{
+	const HeapEntry entryToSift = heapEntries[heapPosition];
+	while (true)
+	{
+		const std::size_t firstChildPosition = heapPosition * ARITY + 1;
+		if (firstChildPosition >= heapEntries.size())
+			break;
+
+		const std::size_t lastChildPosition = std::min(firstChildPosition + ARITY, heapEntries.size());
+		std::size_t childPositionWithHighestPriority = firstChildPosition;
+		for (std::size_t childPosition = firstChildPosition + 1; childPosition < lastChildPosition; ++childPosition)
+		{
+			if (hasHigherPriority(heapEntries[childPosition], heapEntries[childPositionWithHighestPriority]))
+				childPositionWithHighestPriority = childPosition;
+		}
+
+		if (!hasHigherPriority(heapEntries[childPositionWithHighestPriority], entryToSift))
+			break;
+
+		heapEntries[heapPosition] = heapEntries[childPositionWithHighestPriority];
+		positionsInHeap[heapEntries[heapPosition].variable] = heapPosition;
+		heapPosition = childPositionWithHighestPriority;
+	}
+	heapEntries[heapPosition] = entryToSift;
+	positionsInHeap[entryToSift.variable] = heapPosition;
+}
@@ -0,0 +1,284 @@
+#include "solver/localSearch.hpp"
+#include "budget/effortTicks.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+using namespace solver;
+
+LocalSearch::LocalSearch(std::size_t numVariables, const LocalSearchConfiguration& configuration)
+	: numVariables(numVariables), configuration(configuration), resourceBudget(nullptr), randomNumberGenerator(configuration.randomSeed), clauseOffsets({ 0 }), areLiteralOccurrencesOutdated(true), statistics({})
+{
+	if (configuration.algorithm == Algorithm::ProbSat && configuration.probSatBreakExponent <= 0)
+		throw std::invalid_argument("Break exponent of ProbSAT must be larger than zero");
+	if (configuration.algorithm == Algorithm::WalkSat && (configuration.walkSatNoise < 0 || configuration.walkSatNoise > 1))
+		throw std::invalid_argument("Noise of WalkSAT must be a probability");
+
+	probSatScoresPerBreakCount.resize(MAXIMUM_DISTINGUISHED_BREAK_COUNT + 1);
+	for (std::size_t breakCount = 0; breakCount <= MAXIMUM_DISTINGUISHED_BREAK_COUNT; ++breakCount)
+		probSatScoresPerBreakCount[breakCount] = std::pow(1.0 + static_cast<double>(breakCount), -configuration.probSatBreakExponent);
+}
+
+void LocalSearch::addClause(const long* clauseLiterals, std::size_t numLiterals)
+{
+	if (!numLiterals)
+		throw std::invalid_argument("Local search cannot be performed on a formula containing the empty clause");
+
+	std::vector<long> normalizedClauseLiterals(clauseLiterals, clauseLiterals + numLiterals);
+	for (const long literal : normalizedClauseLiterals)
+	{
+		if (!literal || literalToVariable(literal) > numVariables)
+			throw std::invalid_argument("Literal " + std::to_string(literal) + " is not a literal of the formula");
+	}
+	std::sort(normalizedClauseLiterals.begin(), normalizedClauseLiterals.end());
+	normalizedClauseLiterals.erase(std::unique(normalizedClauseLiterals.begin(), normalizedClauseLiterals.end()), normalizedClauseLiterals.end());
+	for (const long literal : normalizedClauseLiterals)
+	{
+		if (std::binary_search(normalizedClauseLiterals.cbegin(), normalizedClauseLiterals.cend(), -literal))
+			return;
+	}
+	if (clauseOffsets.size() > std::numeric_limits<ClauseIndex>::max())
+		throw std::length_error("Maximum number of clauses of the local search exceeded");
+
+	clauseLiteralArena.insert(clauseLiteralArena.end(), normalizedClauseLiterals.cbegin(), normalizedClauseLiterals.cend());
+	clauseOffsets.emplace_back(clauseLiteralArena.size());
+	areLiteralOccurrencesOutdated = true;
+}
+
+void LocalSearch::addClause(const std::vector<long>& clauseLiterals)
+{
+	addClause(clauseLiterals.data(), clauseLiterals.size());
+}
+
+void LocalSearch::setResourceBudget(budget::ResourceBudget* resourceBudget)
+{
+	this->resourceBudget = resourceBudget;
+}
+
+std::size_t LocalSearch::search(std::vector<char>& phases, std::size_t maximumNumTicks)
+{
+	if (phases.size() <= numVariables)
+		throw std::invalid_argument("Expected a phase for every variable of the formula");
+
+	++statistics.numSearches;
+	std::size_t numTicks = 0;
+	std::size_t numTicksAtLastCharge = 0;
+	if (areLiteralOccurrencesOutdated)
+		buildLiteralOccurrences(numTicks);
+
+	assignment.assign(phases.cbegin(), phases.cbegin() + static_cast<std::ptrdiff_t>(numVariables + 1));
+	initializeClauseStates(numTicks);
+	variablesFlippedSinceBestAssignment.clear();
+	std::vector<char>& bestAssignment = phases;
+	std::size_t minimumNumFalsifiedClauses = falsifiedClauses.size();
+
+	bool isBestAssignmentOutdated = false;
+	for (std::size_t numFlips = 1; !falsifiedClauses.empty() && numTicks < maximumNumTicks; ++numFlips)
+	{
+		if (!(numFlips % NUM_FLIPS_PER_BUDGET_POLL) && resourceBudget)
+		{
+			resourceBudget->chargeTicks(numTicks - numTicksAtLastCharge);
+			numTicksAtLastCharge = numTicks;
+			if (resourceBudget->isExhausted())
+				break;
+		}
+
+		const ClauseIndex falsifiedClause = falsifiedClauses[randomNumberGenerator() % falsifiedClauses.size()];
+		const std::size_t flippedVariable = pickVariableOfFalsifiedClause(falsifiedClause, numTicks);
+		flipVariable(flippedVariable, numTicks);
+		++statistics.numFlips;
+
+		// Recording the flips is stopped once restoring the best assignment would be more expensive than copying the current one at the next improvement
+		if (!isBestAssignmentOutdated)
+		{
+			variablesFlippedSinceBestAssignment.emplace_back(flippedVariable);
+			isBestAssignmentOutdated = variablesFlippedSinceBestAssignment.size() > numVariables;
+		}
+		if (falsifiedClauses.size() < minimumNumFalsifiedClauses)
+		{
+			minimumNumFalsifiedClauses = falsifiedClauses.size();
+			if (isBestAssignmentOutdated)
+				std::copy(assignment.cbegin(), assignment.cend(), bestAssignment.begin());
+			else
+			{
+				for (const std::size_t variable : variablesFlippedSinceBestAssignment)
+					bestAssignment[variable] = static_cast<char>(!bestAssignment[variable]);
+			}
+			variablesFlippedSinceBestAssignment.clear();
+			isBestAssignmentOutdated = false;
+		}
+	}
+
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicks - numTicksAtLastCharge);
+	statistics.numTicks += numTicks;
+	statistics.numFoundModels += !minimumNumFalsifiedClauses;
+	return minimumNumFalsifiedClauses;
+}
+
+std::size_t LocalSearch::getNumClauses() const noexcept
+{
+	return clauseOffsets.size() - 1;
+}
+
+const LocalSearch::LocalSearchStatistics& LocalSearch::getStatistics() const noexcept
+{
+	return statistics;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void LocalSearch::buildLiteralOccurrences(std::size_t& numTicks)
+{
+	literalOccurrenceOffsets.assign((numVariables + 1) * 2 + 1, 0);
+	for (const long literal : clauseLiteralArena)
+		++literalOccurrenceOffsets[literalToIndex(literal) + 1];
+	std::partial_sum(literalOccurrenceOffsets.cbegin(), literalOccurrenceOffsets.cend(), literalOccurrenceOffsets.begin());
+
+	literalOccurrences.resize(clauseLiteralArena.size());
+	std::vector<std::size_t> nextOccurrencePositions(literalOccurrenceOffsets.cbegin(), literalOccurrenceOffsets.cend() - 1);
+	for (ClauseIndex clauseIndex = 0; clauseIndex < getNumClauses(); ++clauseIndex)
+	{
+		for (std::size_t literalPosition = clauseOffsets[clauseIndex]; literalPosition < clauseOffsets[clauseIndex + 1]; ++literalPosition)
+			literalOccurrences[nextOccurrencePositions[literalToIndex(clauseLiteralArena[literalPosition])]++] = clauseIndex;
+	}
+	// Every occurrence is written to a random position of the occurrence array
+	numTicks += budget::determineNumTicksOfSequentialAccess<long>(clauseLiteralArena.size()) * 2 + literalOccurrences.size();
+	areLiteralOccurrencesOutdated = false;
+}
+
+void LocalSearch::initializeClauseStates(std::size_t& numTicks)
+{
+	const std::size_t numClauses = getNumClauses();
+	clauseStates.assign(numClauses, ClauseState({ 0, 0 }));
+	breakCounts.assign(numVariables + 1, 0);
+	falsifiedClauses.clear();
+	positionsInFalsifiedClauses.assign(numClauses, 0);
+	numTicks += budget::determineNumTicksOfSequentialAccess<long>(clauseLiteralArena.size()) + budget::determineNumTicksOfSequentialAccess<ClauseState>(numClauses);
+
+	for (ClauseIndex clauseIndex = 0; clauseIndex < numClauses; ++clauseIndex)
+	{
+		ClauseState& clauseState = clauseStates[clauseIndex];
+		for (std::size_t literalPosition = clauseOffsets[clauseIndex]; literalPosition < clauseOffsets[clauseIndex + 1]; ++literalPosition)
+		{
+			const long literal = clauseLiteralArena[literalPosition];
+			if (!isLiteralSatisfied(literal))
+				continue;
+
+			++clauseState.numSatisfiedLiterals;
+			clauseState.satisfiedVariablesXor ^= literalToVariable(literal);
+		}
+
+		if (!clauseState.numSatisfiedLiterals)
+			addFalsifiedClause(clauseIndex);
+		else if (clauseState.numSatisfiedLiterals == 1)
+			++breakCounts[clauseState.satisfiedVariablesXor];
+	}
+}
+
+std::size_t LocalSearch::pickVariableOfFalsifiedClause(ClauseIndex falsifiedClause, std::size_t& numTicks)
+{
+	const long* clauseLiterals = clauseLiteralArena.data() + clauseOffsets[falsifiedClause];
+	const std::size_t numLiterals = clauseOffsets[falsifiedClause + 1] - clauseOffsets[falsifiedClause];
+	// The cached break counts of the variables are stored separately from the literals of the clause
+	numTicks += budget::determineNumTicksOfSequentialAccess<long>(numLiterals) + numLiterals;
+	if (numLiterals == 1)
+		return literalToVariable(*clauseLiterals);
+
+	return configuration.algorithm == Algorithm::ProbSat ? pickVariableByProbSat(clauseLiterals, numLiterals) : pickVariableByWalkSat(clauseLiterals, numLiterals);
+}
+
+std::size_t LocalSearch::pickVariableByProbSat(const long* clauseLiterals, std::size_t numLiterals)
+{
+	candidateScores.resize(numLiterals);
+	double sumOfScores = 0;
+	for (std::size_t literalPosition = 0; literalPosition < numLiterals; ++literalPosition)
+	{
+		const std::size_t breakCount = breakCounts[literalToVariable(clauseLiterals[literalPosition])];
+		candidateScores[literalPosition] = probSatScoresPerBreakCount[std::min(breakCount, MAXIMUM_DISTINGUISHED_BREAK_COUNT)];
+		sumOfScores += candidateScores[literalPosition];
+	}
+
+	double remainingScore = std::uniform_real_distribution<double>(0, sumOfScores)(randomNumberGenerator);
+	for (std::size_t literalPosition = 0; literalPosition + 1 < numLiterals; ++literalPosition)
+	{
+		remainingScore -= candidateScores[literalPosition];
+		if (remainingScore < 0)
+			return literalToVariable(clauseLiterals[literalPosition]);
+	}
+	return literalToVariable(clauseLiterals[numLiterals - 1]);
+}
+
+std::size_t LocalSearch::pickVariableByWalkSat(const long* clauseLiterals, std::size_t numLiterals)
+{
+	const long* literalWithFewestBreaks = std::min_element(clauseLiterals, clauseLiterals + numLiterals, [this](const long lLiteral, const long rLiteral)
+	{
+		return breakCounts[literalToVariable(lLiteral)] < breakCounts[literalToVariable(rLiteral)];
+	});
+	// A flip without breaks is never a random walk step
+	if (breakCounts[literalToVariable(*literalWithFewestBreaks)] && std::uniform_real_distribution<double>(0, 1)(randomNumberGenerator) < configuration.walkSatNoise)
+		return literalToVariable(clauseLiterals[randomNumberGenerator() % numLiterals]);
+	return literalToVariable(*literalWithFewestBreaks);
+}
+
+/*
+ * Only the clauses containing a literal of the flipped variable are updated: A clause becoming satisfied by the new literal makes the flipped variable critical while the previously only satisfied literal of a clause
+ * gaining a second satisfied literal is no longer critical. Conversely, a clause losing its only satisfied literal becomes falsified while the remaining satisfied literal of a clause becomes critical.
+ */
+void LocalSearch::flipVariable(std::size_t variable, std::size_t& numTicks)
+{
+	assignment[variable] = static_cast<char>(!assignment[variable]);
+	const long satisfiedLiteral = assignment[variable] ? static_cast<long>(variable) : -static_cast<long>(variable);
+
+	const std::size_t satisfiedLiteralIndex = literalToIndex(satisfiedLiteral);
+	const std::size_t numOccurrencesOfSatisfiedLiteral = literalOccurrenceOffsets[satisfiedLiteralIndex + 1] - literalOccurrenceOffsets[satisfiedLiteralIndex];
+	numTicks += budget::determineNumTicksOfSequentialAccess<ClauseIndex>(numOccurrencesOfSatisfiedLiteral) + numOccurrencesOfSatisfiedLiteral;
+	for (std::size_t occurrencePosition = literalOccurrenceOffsets[satisfiedLiteralIndex]; occurrencePosition < literalOccurrenceOffsets[satisfiedLiteralIndex + 1]; ++occurrencePosition)
+	{
+		const ClauseIndex clauseIndex = literalOccurrences[occurrencePosition];
+		ClauseState& clauseState = clauseStates[clauseIndex];
+		++clauseState.numSatisfiedLiterals;
+		clauseState.satisfiedVariablesXor ^= variable;
+		if (clauseState.numSatisfiedLiterals == 1)
+		{
+			removeFalsifiedClause(clauseIndex);
+			++breakCounts[variable];
+		}
+		else if (clauseState.numSatisfiedLiterals == 2)
+			--breakCounts[clauseState.satisfiedVariablesXor ^ variable];
+	}
+
+	const std::size_t falsifiedLiteralIndex = literalToIndex(-satisfiedLiteral);
+	const std::size_t numOccurrencesOfFalsifiedLiteral = literalOccurrenceOffsets[falsifiedLiteralIndex + 1] - literalOccurrenceOffsets[falsifiedLiteralIndex];
+	numTicks += budget::determineNumTicksOfSequentialAccess<ClauseIndex>(numOccurrencesOfFalsifiedLiteral) + numOccurrencesOfFalsifiedLiteral;
+	for (std::size_t occurrencePosition = literalOccurrenceOffsets[falsifiedLiteralIndex]; occurrencePosition < literalOccurrenceOffsets[falsifiedLiteralIndex + 1]; ++occurrencePosition)
+	{
+		const ClauseIndex clauseIndex = literalOccurrences[occurrencePosition];
+		ClauseState& clauseState = clauseStates[clauseIndex];
+		--clauseState.numSatisfiedLiterals;
+		clauseState.satisfiedVariablesXor ^= variable;
+		if (!clauseState.numSatisfiedLiterals)
+		{
+			addFalsifiedClause(clauseIndex);
+			--breakCounts[variable];
+		}
+		else if (clauseState.numSatisfiedLiterals == 1)
+			++breakCounts[clauseState.satisfiedVariablesXor];
+	}
+}
+
+void LocalSearch::addFalsifiedClause(ClauseIndex clauseIndex)
+{
+	positionsInFalsifiedClauses[clauseIndex] = falsifiedClauses.size();
+	falsifiedClauses.emplace_back(clauseIndex);
+}
+
+void LocalSearch::removeFalsifiedClause(ClauseIndex clauseIndex)
+{
+	const std::size_t positionOfClause = positionsInFalsifiedClauses[clauseIndex];
+	falsifiedClauses[positionOfClause] = falsifiedClauses.back();
+	positionsInFalsifiedClauses[falsifiedClauses[positionOfClause]] = positionOfClause;
+	falsifiedClauses.pop_back();
+}
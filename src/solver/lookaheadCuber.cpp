@@ -0,0 +1,284 @@
+#include "solver/lookaheadCuber.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+using namespace solver;
+
+LookaheadCuber::LookaheadCuber(SharedFormula::ptr sharedFormula, std::size_t maximumNumLookaheadCandidates)
+	: sharedFormula(std::move(sharedFormula)), maximumNumLookaheadCandidates(maximumNumLookaheadCandidates), isFormulaKnownToBeUnsat(false), propagationQueueHead(0), statistics({})
+{
+	if (!this->sharedFormula)
+		throw std::invalid_argument("Shared formula cannot be null");
+	if (!maximumNumLookaheadCandidates)
+		throw std::invalid_argument("Maximum number of lookahead candidates must be larger than zero");
+
+	const std::size_t numVariables = this->sharedFormula->getNumVariables();
+	literalOccurrences.resize((numVariables + 1) * 2);
+	numFalsifiedLiteralsPerClause.resize(this->sharedFormula->getNumClauses(), 0);
+	variableValues.resize(numVariables + 1, 0);
+	candidateScores.resize((numVariables + 1) * 2, 0);
+	trail.reserve(numVariables);
+
+	const long* clauseLiteralArena = this->sharedFormula->getClauseLiteralArena();
+	for (std::size_t clauseIndex = 0; clauseIndex < this->sharedFormula->getNumClauses(); ++clauseIndex)
+	{
+		const std::uint32_t numLiterals = this->sharedFormula->getNumLiteralsOfClause(clauseIndex);
+		isFormulaKnownToBeUnsat |= !numLiterals;
+		for (std::uint32_t literalPosition = 0; literalPosition < numLiterals; ++literalPosition)
+			literalOccurrences[literalToIndex(clauseLiteralArena[this->sharedFormula->getOffsetOfClause(clauseIndex) + literalPosition])].emplace_back(clauseIndex);
+	}
+
+	// The units of the formula remain assigned for the lifetime of the cuber
+	for (const long unitLiteral : this->sharedFormula->getUnitLiterals())
+	{
+		if (isFormulaKnownToBeUnsat)
+			break;
+		if (getLiteralValue(unitLiteral) < 0)
+			isFormulaKnownToBeUnsat = true;
+		else if (!getLiteralValue(unitLiteral))
+			isFormulaKnownToBeUnsat = !assignAndPropagate(unitLiteral);
+	}
+}
+
+std::vector<std::vector<long>> LookaheadCuber::splitCube(const std::vector<long>& cube, std::size_t depth)
+{
+	std::vector<std::vector<long>> generatedCubes;
+	if (isFormulaKnownToBeUnsat)
+		return generatedCubes;
+
+	for (const long literal : cube)
+	{
+		if (!literal || static_cast<std::size_t>(std::abs(literal)) > sharedFormula->getNumVariables())
+			throw std::invalid_argument("Literal " + std::to_string(literal) + " of cube is not a literal of the formula");
+	}
+
+	const std::size_t trailSizeOfUnits = trail.size();
+	bool isCubeRefuted = false;
+	for (auto literalIterator = cube.cbegin(); literalIterator != cube.cend() && !isCubeRefuted; ++literalIterator)
+	{
+		if (getLiteralValue(*literalIterator) < 0)
+			isCubeRefuted = true;
+		else if (!getLiteralValue(*literalIterator))
+			isCubeRefuted = !assignAndPropagate(*literalIterator);
+	}
+
+	if (isCubeRefuted)
+		++statistics.numRefutedCubes;
+	else
+		splitCubeRecursively(cube, depth, generatedCubes);
+	undoAssignments(trailSizeOfUnits);
+	return generatedCubes;
+}
+
+const LookaheadCuber::CuberStatistics& LookaheadCuber::getStatistics() const noexcept
+{
+	return statistics;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void LookaheadCuber::splitCubeRecursively(std::vector<long> cube, std::size_t remainingDepth, std::vector<std::vector<long>>& generatedCubes)
+{
+	if (!remainingDepth)
+	{
+		generatedCubes.emplace_back(std::move(cube));
+		return;
+	}
+
+	bool isCubeRefuted = false;
+	const std::optional<long> branchingLiteral = determineBranchingLiteral(cube, isCubeRefuted);
+	if (isCubeRefuted)
+	{
+		++statistics.numRefutedCubes;
+		return;
+	}
+	if (!branchingLiteral.has_value())
+	{
+		generatedCubes.emplace_back(std::move(cube));
+		return;
+	}
+
+	for (const long literal : { *branchingLiteral, -*branchingLiteral })
+	{
+		const std::size_t trailSizeOfCube = trail.size();
+		if (assignAndPropagate(literal))
+		{
+			cube.emplace_back(literal);
+			splitCubeRecursively(cube, remainingDepth - 1, generatedCubes);
+			cube.pop_back();
+		}
+		else
+			++statistics.numRefutedCubes;
+		undoAssignments(trailSizeOfCube);
+	}
+}
+
+/*
+ * Every preselected candidate is assigned with both polarities, a polarity leading to a conflict is a failed literal whose negation is implied by the cube and thus added to it.
+ * Among the remaining candidates the variable maximizing the product of the number of implied assignments of both polarities is selected, the polarity with more implied assignments is explored first.
+ */
+std::optional<long> LookaheadCuber::determineBranchingLiteral(std::vector<long>& cube, bool& isCubeRefuted)
+{
+	std::optional<long> branchingLiteral;
+	std::size_t scoreOfBranchingLiteral = 0;
+	for (const std::size_t candidateVariable : preselectCandidateVariables())
+	{
+		const long positiveLiteral = static_cast<long>(candidateVariable);
+		if (getLiteralValue(positiveLiteral))
+			continue;
+
+		const std::optional<std::size_t> numImpliedAssignmentsOfPositiveLiteral = lookahead(positiveLiteral);
+		const std::optional<std::size_t> numImpliedAssignmentsOfNegativeLiteral = lookahead(-positiveLiteral);
+		if (!numImpliedAssignmentsOfPositiveLiteral.has_value() || !numImpliedAssignmentsOfNegativeLiteral.has_value())
+		{
+			if (!numImpliedAssignmentsOfPositiveLiteral.has_value() && !numImpliedAssignmentsOfNegativeLiteral.has_value())
+			{
+				isCubeRefuted = true;
+				return std::nullopt;
+			}
+
+			++statistics.numFailedLiterals;
+			const long impliedLiteral = numImpliedAssignmentsOfPositiveLiteral.has_value() ? positiveLiteral : -positiveLiteral;
+			cube.emplace_back(impliedLiteral);
+			if (!assignAndPropagate(impliedLiteral))
+			{
+				isCubeRefuted = true;
+				return std::nullopt;
+			}
+			continue;
+		}
+
+		const std::size_t score = (*numImpliedAssignmentsOfPositiveLiteral + 1) * (*numImpliedAssignmentsOfNegativeLiteral + 1);
+		if (!branchingLiteral.has_value() || score > scoreOfBranchingLiteral)
+		{
+			branchingLiteral = *numImpliedAssignmentsOfPositiveLiteral >= *numImpliedAssignmentsOfNegativeLiteral ? positiveLiteral : -positiveLiteral;
+			scoreOfBranchingLiteral = score;
+		}
+	}
+
+	// A candidate selected before a failed literal was found might have been assigned by the propagation of the failed literal
+	if (branchingLiteral.has_value() && getLiteralValue(*branchingLiteral))
+		return determineBranchingLiteral(cube, isCubeRefuted);
+	return branchingLiteral;
+}
+
+/*
+ * The candidates of the lookahead are the unassigned variables with the highest occurrence scores in the clauses not yet satisfied by the cube, the occurrence of a literal in a clause is weighted
+ * by 2^-k with k being the number of unassigned literals of the clause, thus occurrences in short clauses are preferred. No candidate is returned if every clause is satisfied.
+ */
+std::vector<std::size_t> LookaheadCuber::preselectCandidateVariables()
+{
+	std::fill(candidateScores.begin(), candidateScores.end(), 0);
+	const long* clauseLiteralArena = sharedFormula->getClauseLiteralArena();
+	for (std::size_t clauseIndex = 0; clauseIndex < sharedFormula->getNumClauses(); ++clauseIndex)
+	{
+		const long* clauseLiterals = clauseLiteralArena + sharedFormula->getOffsetOfClause(clauseIndex);
+		const std::uint32_t numLiterals = sharedFormula->getNumLiteralsOfClause(clauseIndex);
+		if (std::any_of(clauseLiterals, clauseLiterals + numLiterals, [this](const long literal) { return getLiteralValue(literal) > 0; }))
+			continue;
+
+		const double weightOfOccurrence = 1.0 / static_cast<double>(static_cast<std::uint64_t>(1) << std::min<std::uint32_t>(numLiterals - numFalsifiedLiteralsPerClause[clauseIndex], 62));
+		for (std::uint32_t literalPosition = 0; literalPosition < numLiterals; ++literalPosition)
+		{
+			if (!getLiteralValue(clauseLiterals[literalPosition]))
+				candidateScores[literalToIndex(clauseLiterals[literalPosition])] += weightOfOccurrence;
+		}
+	}
+
+	std::vector<std::size_t> candidateVariables;
+	std::vector<double> scoresOfVariables(variableValues.size(), 0);
+	for (std::size_t variable = 1; variable < variableValues.size(); ++variable)
+	{
+		const double positiveScore = candidateScores[literalToIndex(static_cast<long>(variable))];
+		const double negativeScore = candidateScores[literalToIndex(-static_cast<long>(variable))];
+		if (variableValues[variable] || (positiveScore == 0 && negativeScore == 0))
+			continue;
+
+		// Variables occurring in both polarities split the search space more evenly
+		scoresOfVariables[variable] = (positiveScore + 1) * (negativeScore + 1);
+		candidateVariables.emplace_back(variable);
+	}
+
+	const std::size_t numCandidates = std::min(candidateVariables.size(), maximumNumLookaheadCandidates);
+	std::partial_sort(candidateVariables.begin(), candidateVariables.begin() + static_cast<std::ptrdiff_t>(numCandidates), candidateVariables.end(),
+		[&scoresOfVariables](const std::size_t lVariable, const std::size_t rVariable) { return scoresOfVariables[lVariable] > scoresOfVariables[rVariable] || (scoresOfVariables[lVariable] == scoresOfVariables[rVariable] && lVariable < rVariable); });
+	candidateVariables.resize(numCandidates);
+	return candidateVariables;
+}
+
+std::optional<std::size_t> LookaheadCuber::lookahead(long literal)
+{
+	++statistics.numLookaheads;
+	const std::size_t trailSizeBeforeLookahead = trail.size();
+	const bool isConflictFree = assignAndPropagate(literal);
+	const std::size_t numImpliedAssignments = trail.size() - trailSizeBeforeLookahead - 1;
+	undoAssignments(trailSizeBeforeLookahead);
+	return isConflictFree ? std::make_optional(numImpliedAssignments) : std::nullopt;
+}
+
+bool LookaheadCuber::assignAndPropagate(long literal)
+{
+	variableValues[static_cast<std::size_t>(std::abs(literal))] = literal > 0 ? 1 : -1;
+	trail.emplace_back(literal);
+	return propagate();
+}
+
+/*
+ * Every clause counts its falsified literals, only clauses with at most one literal that is not falsified need to be inspected. The counters of all occurrences of a propagated literal are updated
+ * even if a conflict was found, which allows the assignments to be undone symmetrically.
+ */
+bool LookaheadCuber::propagate()
+{
+	const long* clauseLiteralArena = sharedFormula->getClauseLiteralArena();
+	bool isConflictFree = true;
+	while (propagationQueueHead < trail.size() && isConflictFree)
+	{
+		const long falsifiedLiteral = -trail[propagationQueueHead++];
+		for (const std::size_t clauseIndex : literalOccurrences[literalToIndex(falsifiedLiteral)])
+		{
+			const std::uint32_t numLiterals = sharedFormula->getNumLiteralsOfClause(clauseIndex);
+			if (++numFalsifiedLiteralsPerClause[clauseIndex] + 1 < numLiterals || !isConflictFree)
+				continue;
+
+			const long* clauseLiterals = clauseLiteralArena + sharedFormula->getOffsetOfClause(clauseIndex);
+			std::optional<long> unassignedLiteral;
+			bool isClauseSatisfied = false;
+			for (std::uint32_t literalPosition = 0; literalPosition < numLiterals && !isClauseSatisfied; ++literalPosition)
+			{
+				const signed char literalValue = getLiteralValue(clauseLiterals[literalPosition]);
+				isClauseSatisfied = literalValue > 0;
+				if (!literalValue)
+					unassignedLiteral = clauseLiterals[literalPosition];
+			}
+
+			if (isClauseSatisfied)
+				continue;
+			if (!unassignedLiteral.has_value())
+				isConflictFree = false;
+			else
+			{
+				variableValues[static_cast<std::size_t>(std::abs(*unassignedLiteral))] = *unassignedLiteral > 0 ? 1 : -1;
+				trail.emplace_back(*unassignedLiteral);
+			}
+		}
+	}
+	return isConflictFree;
+}
+
+void LookaheadCuber::undoAssignments(std::size_t trailSize)
+{
+	while (trail.size() > trailSize)
+	{
+		const long literal = trail.back();
+		if (trail.size() <= propagationQueueHead)
+		{
+			for (const std::size_t clauseIndex : literalOccurrences[literalToIndex(-literal)])
+				--numFalsifiedLiteralsPerClause[clauseIndex];
+		}
+		variableValues[static_cast<std::size_t>(std::abs(literal))] = 0;
+		trail.pop_back();
+	}
+	propagationQueueHead = std::min(propagationQueueHead, trailSize);
+}
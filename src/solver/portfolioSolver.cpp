@@ -0,0 +1,140 @@
+#include "solver/portfolioSolver.hpp"
+
+#include <array>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace solver;
+
+PortfolioSolver::PortfolioSolver(SharedFormula::ptr sharedFormula, std::size_t numWorkers, Solver::SolverConfiguration baseConfiguration, bool isClauseSharingEnabled)
+	: sharedFormula(std::move(sharedFormula)), isSearchCancelled(false), resourceBudget(nullptr), result(Solver::SolverResult::Unknown)
+{
+	if (!this->sharedFormula)
+		throw std::invalid_argument("Shared formula cannot be null");
+	if (!numWorkers)
+		throw std::invalid_argument("Portfolio requires at least one worker");
+
+	configurationsOfWorkers.reserve(numWorkers);
+	for (std::size_t workerIndex = 0; workerIndex < numWorkers; ++workerIndex)
+		configurationsOfWorkers.emplace_back(diversifyConfiguration(baseConfiguration, workerIndex));
+	workers.resize(numWorkers);
+	if (isClauseSharingEnabled && numWorkers > 1)
+		clauseExchange = std::make_unique<ClauseExchange>(numWorkers);
+}
+
+Solver::SolverResult PortfolioSolver::solve()
+{
+	isSearchCancelled = false;
+	indexOfWinningWorker.reset();
+	result = Solver::SolverResult::Unknown;
+
+	std::mutex workerErrorMutex;
+	std::exception_ptr firstWorkerError;
+	std::vector<std::thread> workerThreads;
+	workerThreads.reserve(workers.size());
+	for (std::size_t workerIndex = 0; workerIndex < workers.size(); ++workerIndex)
+	{
+		workerThreads.emplace_back([this, workerIndex, &workerErrorMutex, &firstWorkerError]
+		{
+			try
+			{
+				runWorker(workerIndex);
+			}
+			catch (...)
+			{
+				const std::lock_guard<std::mutex> lock(workerErrorMutex);
+				if (!firstWorkerError)
+					firstWorkerError = std::current_exception();
+				isSearchCancelled = true;
+			}
+		});
+	}
+
+	for (std::thread& workerThread : workerThreads)
+		workerThread.join();
+
+	if (firstWorkerError)
+		std::rethrow_exception(firstWorkerError);
+	return result;
+}
+
+std::vector<long> PortfolioSolver::getModel() const
+{
+	if (!indexOfWinningWorker.has_value() || result != Solver::SolverResult::Sat)
+		return {};
+	return workers[*indexOfWinningWorker]->getModel();
+}
+
+std::size_t PortfolioSolver::getNumWorkers() const noexcept
+{
+	return workers.size();
+}
+
+std::optional<std::size_t> PortfolioSolver::getIndexOfWinningWorker() const noexcept
+{
+	return indexOfWinningWorker;
+}
+
+const Solver::SolverConfiguration& PortfolioSolver::getConfigurationOfWorker(std::size_t workerIndex) const
+{
+	if (workerIndex >= configurationsOfWorkers.size())
+		throw std::out_of_range("Worker index " + std::to_string(workerIndex) + " is out of range [0, " + std::to_string(configurationsOfWorkers.size()) + ")");
+	return configurationsOfWorkers[workerIndex];
+}
+
+const Solver::SolverStatistics& PortfolioSolver::getStatisticsOfWorker(std::size_t workerIndex) const
+{
+	if (workerIndex >= workers.size() || !workers[workerIndex])
+		throw std::out_of_range("No statistics of worker " + std::to_string(workerIndex) + " are available");
+	return workers[workerIndex]->getStatistics();
+}
+
+void PortfolioSolver::setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+{
+	this->resourceBudget = resourceBudget;
+}
+
+Solver::SolverConfiguration PortfolioSolver::diversifyConfiguration(const Solver::SolverConfiguration& baseConfiguration, std::size_t workerIndex)
+{
+	Solver::SolverConfiguration configuration = baseConfiguration;
+	if (!workerIndex)
+		return configuration;
+
+	constexpr std::array<Solver::DecisionHeuristic, 2> decisionHeuristics = { Solver::DecisionHeuristic::Evsids, Solver::DecisionHeuristic::LearningRateBranching };
+	constexpr std::array<Solver::RestartPolicy, 3> restartPolicies = { Solver::RestartPolicy::Glucose, Solver::RestartPolicy::Luby, Solver::RestartPolicy::ReluctantDoubling };
+	constexpr std::array<Solver::TargetPhaseUsage, 3> targetPhaseUsages = { Solver::TargetPhaseUsage::StableModeOnly, Solver::TargetPhaseUsage::Always, Solver::TargetPhaseUsage::Never };
+
+	configuration.randomSeed = baseConfiguration.randomSeed + static_cast<std::uint32_t>(workerIndex);
+	configuration.decisionHeuristic = decisionHeuristics[workerIndex % decisionHeuristics.size()];
+	configuration.restartPolicy = restartPolicies[workerIndex % restartPolicies.size()];
+	configuration.targetPhaseUsage = targetPhaseUsages[(workerIndex / 2) % targetPhaseUsages.size()];
+	configuration.isInitialPhasePositive = (workerIndex / 3) % 2;
+	// Every other pair of workers alternates between the focused and the stable search mode
+	if ((workerIndex / 2) % 2)
+		configuration.optionalStableModeDecisionHeuristic = decisionHeuristics[(workerIndex + 1) % decisionHeuristics.size()];
+	return configuration;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+void PortfolioSolver::runWorker(std::size_t workerIndex)
+{
+	workers[workerIndex] = std::make_unique<Solver>(sharedFormula, configurationsOfWorkers[workerIndex]);
+	workers[workerIndex]->setCancellationFlag(&isSearchCancelled);
+	workers[workerIndex]->setResourceBudget(resourceBudget);
+	if (clauseExchange)
+		workers[workerIndex]->setClauseExchange(clauseExchange.get(), workerIndex);
+
+	const Solver::SolverResult resultOfWorker = workers[workerIndex]->solve();
+	if (resultOfWorker == Solver::SolverResult::Unknown)
+		return;
+
+	// Only the first worker determining the result is recorded as the winner, the other workers are cancelled
+	if (bool expectedCancellationState = false; isSearchCancelled.compare_exchange_strong(expectedCancellationState, true))
+	{
+		indexOfWinningWorker = workerIndex;
+		result = resultOfWorker;
+	}
+}
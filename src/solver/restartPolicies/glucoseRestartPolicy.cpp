@@ -0,0 +1,63 @@
+#include "solver/restartPolicies/glucoseRestartPolicy.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using namespace restartPolicies;
+
+GlucoseRestartPolicy::GlucoseRestartPolicy(Configuration configuration)
+	: configuration(configuration), numConflicts(0), numRequiredConflictsBeforeRestart(configuration.minimumConflictsBetweenRestarts),
+	fastMovingAverageOfLiteralBlockDistance(configuration.fastMovingAverageSmoothingFactor),
+	slowMovingAverageOfLiteralBlockDistance(configuration.slowMovingAverageSmoothingFactor),
+	movingAverageOfTrailSize(configuration.trailSizeMovingAverageSmoothingFactor)
+{
+	for (const double smoothingFactor : { configuration.fastMovingAverageSmoothingFactor, configuration.slowMovingAverageSmoothingFactor, configuration.trailSizeMovingAverageSmoothingFactor })
+	{
+		if (smoothingFactor <= 0 || smoothingFactor > 1)
+			throw std::invalid_argument("Smoothing factor " + std::to_string(smoothingFactor) + " of moving average is not within the valid range (0, 1]");
+	}
+	if (configuration.slowMovingAverageSmoothingFactor > configuration.fastMovingAverageSmoothingFactor)
+		throw std::invalid_argument("Smoothing factor of slow moving average cannot be larger than the one of the fast moving average");
+}
+
+void GlucoseRestartPolicy::onConflict(std::size_t literalBlockDistanceOfLearnedClause, std::size_t trailSize)
+{
+	++numConflicts;
+	++numConflictsSinceLastRestart;
+	fastMovingAverageOfLiteralBlockDistance.update(static_cast<double>(literalBlockDistanceOfLearnedClause));
+	slowMovingAverageOfLiteralBlockDistance.update(static_cast<double>(literalBlockDistanceOfLearnedClause));
+
+	const bool shouldRestartBeBlocked = numConflicts > configuration.minimumConflictsBeforeBlocking
+		&& numConflictsSinceLastRestart >= numRequiredConflictsBeforeRestart
+		&& static_cast<double>(trailSize) > configuration.blockingMargin * movingAverageOfTrailSize.getValue();
+	movingAverageOfTrailSize.update(static_cast<double>(trailSize));
+
+	if (shouldRestartBeBlocked)
+	{
+		++numBlockedRestarts;
+		numConflictsSinceLastRestart = 0;
+		numRequiredConflictsBeforeRestart = configuration.minimumConflictsAfterBlockedRestart;
+	}
+}
+
+bool GlucoseRestartPolicy::shouldRestart() const
+{
+	return numConflictsSinceLastRestart >= numRequiredConflictsBeforeRestart
+		&& fastMovingAverageOfLiteralBlockDistance.getValue() > configuration.restartMargin * slowMovingAverageOfLiteralBlockDistance.getValue();
+}
+
+void GlucoseRestartPolicy::onRestart()
+{
+	BaseRestartPolicy::onRestart();
+	numRequiredConflictsBeforeRestart = configuration.minimumConflictsBetweenRestarts;
+}
+
+double GlucoseRestartPolicy::getFastMovingAverageOfLiteralBlockDistance() const noexcept
+{
+	return fastMovingAverageOfLiteralBlockDistance.getValue();
+}
+
+double GlucoseRestartPolicy::getSlowMovingAverageOfLiteralBlockDistance() const noexcept
+{
+	return slowMovingAverageOfLiteralBlockDistance.getValue();
+}
@@ -0,0 +1,48 @@
+#include "solver/restartPolicies/lubyRestartPolicy.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using namespace restartPolicies;
+
+LubyRestartPolicy::LubyRestartPolicy(std::size_t unitConflictInterval, std::optional<std::size_t> optionalMaximumConflictInterval)
+	: unitConflictInterval(unitConflictInterval), optionalMaximumConflictInterval(optionalMaximumConflictInterval), reluctantDoublingU(1), reluctantDoublingV(1)
+{
+	if (!unitConflictInterval)
+		throw std::invalid_argument("Unit conflict interval of luby restart policy must be larger than zero");
+	if (optionalMaximumConflictInterval.has_value() && *optionalMaximumConflictInterval < unitConflictInterval)
+		throw std::invalid_argument("Maximum conflict interval " + std::to_string(*optionalMaximumConflictInterval) + " must not be smaller than the unit conflict interval " + std::to_string(unitConflictInterval));
+}
+
+void LubyRestartPolicy::onConflict(std::size_t, std::size_t)
+{
+	++numConflictsSinceLastRestart;
+}
+
+bool LubyRestartPolicy::shouldRestart() const
+{
+	return numConflictsSinceLastRestart >= getCurrentConflictInterval();
+}
+
+void LubyRestartPolicy::onRestart()
+{
+	BaseRestartPolicy::onRestart();
+	if ((reluctantDoublingU & (~reluctantDoublingU + 1)) == reluctantDoublingV)
+	{
+		++reluctantDoublingU;
+		reluctantDoublingV = 1;
+	}
+	else
+		reluctantDoublingV <<= 1;
+
+	if (optionalMaximumConflictInterval.has_value() && getCurrentConflictInterval() > *optionalMaximumConflictInterval)
+	{
+		reluctantDoublingU = 1;
+		reluctantDoublingV = 1;
+	}
+}
+
+std::size_t LubyRestartPolicy::getCurrentConflictInterval() const noexcept
+{
+	return static_cast<std::size_t>(reluctantDoublingV) * unitConflictInterval;
+}
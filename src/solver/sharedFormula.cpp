@@ -0,0 +1,51 @@
+#include "solver/sharedFormula.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+using namespace solver;
+
+SharedFormula::SharedFormula(const dimacs::ProblemDefinition& problemDefinition)
+	: numVariables(problemDefinition.getNumDeclaredVariablesOfFormula())
+{
+	// Assignments determined by the unit propagation during the parsing of the formula are not part of the remaining clauses and need to be recorded as units
+	for (std::size_t variable = 1; variable <= numVariables; ++variable)
+	{
+		const dimacs::ProblemDefinition::VariableValue variableValue = problemDefinition.getValueOfVariable(variable).value_or(dimacs::ProblemDefinition::VariableValue::Unknown);
+		if (variableValue != dimacs::ProblemDefinition::VariableValue::Unknown)
+			unitLiterals.emplace_back(variableValue == dimacs::ProblemDefinition::VariableValue::High ? static_cast<long>(variable) : -static_cast<long>(variable));
+	}
+
+	// The clauses are stored in an unordered container in the problem definition, processing them in the order of their identifiers makes the search reproducible
+	std::vector<std::size_t> identifiersOfClauses = problemDefinition.getIdentifiersOfClauses();
+	std::sort(identifiersOfClauses.begin(), identifiersOfClauses.end());
+
+	clauseOffsets.reserve(identifiersOfClauses.size() + 1);
+	clauseOffsets.emplace_back(0);
+	std::vector<long> clauseLiterals;
+	for (const std::size_t clauseIdentifier : identifiersOfClauses)
+	{
+		const dimacs::ProblemDefinition::Clause* clause = problemDefinition.getClauseByIndexInFormula(clauseIdentifier);
+		if (!clause)
+			continue;
+
+		clauseLiterals = clause->literals;
+		std::sort(clauseLiterals.begin(), clauseLiterals.end());
+		clauseLiterals.erase(std::unique(clauseLiterals.begin(), clauseLiterals.end()), clauseLiterals.end());
+
+		bool isClauseTautology = false;
+		for (const long literal : clauseLiterals)
+		{
+			if (!literal || static_cast<std::size_t>(std::abs(literal)) > numVariables)
+				throw std::invalid_argument("Literal " + std::to_string(literal) + " is not within the valid range of literals [-" + std::to_string(numVariables) + ", -1] v [1, " + std::to_string(numVariables) + "]");
+			isClauseTautology |= std::binary_search(clauseLiterals.cbegin(), clauseLiterals.cend(), -literal);
+		}
+		if (isClauseTautology)
+			continue;
+
+		clauseLiteralArena.insert(clauseLiteralArena.end(), clauseLiterals.cbegin(), clauseLiterals.cend());
+		clauseOffsets.emplace_back(clauseLiteralArena.size());
+	}
+}
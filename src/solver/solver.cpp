@@ -0,0 +1,2199 @@
+#include "solver/solver.hpp"
+#include "budget/effortTicks.hpp"
+#include "optimizations/blockedClauseElimination/blockingLiteralGenerator.hpp"
+#include "optimizations/blockedClauseElimination/literalOccurrenceBlockedClauseEliminator.hpp"
+#include "optimizations/setBlockedClauseElimination/literalOccurrenceBlockingSetCandidateGenerator.hpp"
+#include "optimizations/setBlockedClauseElimination/literalOccurrenceSetBlockedClauseEliminator.hpp"
+#include "solver/decisionHeuristics/evsidsDecisionHeuristic.hpp"
+#include "solver/decisionHeuristics/learningRateBranchingDecisionHeuristic.hpp"
+#include "solver/decisionHeuristics/sequentialDecisionHeuristic.hpp"
+#include "solver/restartPolicies/glucoseRestartPolicy.hpp"
+#include "solver/restartPolicies/lubyRestartPolicy.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace solver;
+
+Solver::Solver(SharedFormula::ptr sharedFormula, SolverConfiguration configuration)
+	: configuration(configuration), numVariables(sharedFormula ? sharedFormula->getNumVariables() : 0), isFormulaKnownToBeUnsat(false), wasEmptyClauseAddedToProof(false), sharedFormula(sharedFormula),
+	sharedClauseLiteralArena(sharedFormula ? sharedFormula->getClauseLiteralArena() : nullptr), cancellationFlag(nullptr), resourceBudget(nullptr), clauseExchange(nullptr), proofWriter(nullptr), workerIndexInClauseExchange(0), maximumSizeOfClausesPassedToLearnedClauseCallback(0), propagationQueueHead(0),
+	perSearchModeDecisionHeuristics({ createDecisionHeuristic(configuration.decisionHeuristic), configuration.optionalStableModeDecisionHeuristic.has_value() ? createDecisionHeuristic(*configuration.optionalStableModeDecisionHeuristic) : nullptr }),
+	decisionHeuristic(perSearchModeDecisionHeuristics[SearchMode::Focused].get()),
+	perSearchModeRestartPolicies({ createRestartPolicy(configuration.restartPolicy), configuration.optionalStableModeDecisionHeuristic.has_value() ? createRestartPolicy(configuration.stableModeRestartPolicy) : nullptr }),
+	restartPolicy(perSearchModeRestartPolicies[SearchMode::Focused].get()), activeSearchMode(SearchMode::Focused),
+	searchModeSwitchConflictInterval(configuration.initialSearchModeSwitchConflictInterval), numConflictsAtNextSearchModeSwitch(configuration.initialSearchModeSwitchConflictInterval),
+	numConflictsAtNextClauseDatabaseReduction(configuration.initialClauseDatabaseReductionInterval), numLiteralsOfDeletedClauses(0),
+	numAssignmentsOfTargetPhases(0), numAssignmentsOfBestPhases(0), numRephases(0), numConflictsAtNextRephasing(configuration.optionalRephasingInterval.value_or(0)), numPropagationTicksAtLastLocalSearch(0),
+	isInitialLocalSearchPending(configuration.optionalInitialLocalSearchEffort.has_value()), randomNumberGenerator(configuration.randomSeed),
+	numConflictsAtNextInprocessing(configuration.optionalInprocessingInterval.value_or(0)), numPropagationTicksAtLastInprocessing(0), nextProbedVariable(1), currentProbingStamp(0), nextBlockedClauseEliminationCandidate(0), nextSetBlockedClauseEliminationCandidate(0),
+	wereClausesDeletedDuringInprocessing(false),
+	currentShrinkingStamp(0), currentDecisionLevelStamp(0), statistics({})
+{
+	if (!sharedFormula)
+		throw std::invalid_argument("Shared formula cannot be null");
+	if (perSearchModeDecisionHeuristics[SearchMode::Stable] && !searchModeSwitchConflictInterval)
+		throw std::invalid_argument("Initial search mode switch interval must be larger than zero");
+	if (configuration.maximumLiteralBlockDistanceOfCoreClauses > configuration.maximumLiteralBlockDistanceOfTierTwoClauses)
+		throw std::invalid_argument("Maximum LBD of core clauses cannot be larger than the maximum LBD of tier-2 clauses");
+	if (configuration.optionalRephasingInterval.has_value() && !*configuration.optionalRephasingInterval)
+		throw std::invalid_argument("Rephasing interval must be larger than zero");
+	if (configuration.optionalChronologicalBacktrackingThreshold.has_value() && !*configuration.optionalChronologicalBacktrackingThreshold)
+		throw std::invalid_argument("Threshold for chronological backtracking must be larger than zero");
+	if (configuration.maximumSizeOfExportedClauses > ClauseExchange::MAXIMUM_CLAUSE_SIZE)
+		throw std::invalid_argument("Maximum size of exported clauses cannot be larger than " + std::to_string(ClauseExchange::MAXIMUM_CLAUSE_SIZE));
+	if (configuration.optionalInprocessingInterval.has_value() && !*configuration.optionalInprocessingInterval)
+		throw std::invalid_argument("Inprocessing interval must be larger than zero");
+	if (configuration.optionalInprocessingTickInterval.has_value() && !*configuration.optionalInprocessingTickInterval)
+		throw std::invalid_argument("Inprocessing tick interval must be larger than zero");
+	if (configuration.perInprocessingPassEffortsInPerMille[InprocessingPass::SetBlockedClauseElimination] && !configuration.maximumSizeOfInprocessingBlockingSets)
+		throw std::invalid_argument("Maximum size of blocking sets searched during inprocessing must be larger than zero");
+	if (configuration.optionalInitialLocalSearchEffort.has_value() && !*configuration.optionalInitialLocalSearchEffort)
+		throw std::invalid_argument("Effort of the initial local search must be larger than zero");
+
+	statistics.perSearchModeDecisionHeuristicStatistics[SearchMode::Focused] = DecisionHeuristicStatistics({ configuration.decisionHeuristic, 0, 0, 1, std::chrono::nanoseconds::zero() });
+	statistics.perSearchModeDecisionHeuristicStatistics[SearchMode::Stable] = DecisionHeuristicStatistics({ configuration.optionalStableModeDecisionHeuristic.value_or(DecisionHeuristic::UserDefined), 0, 0, 0, std::chrono::nanoseconds::zero() });
+	for (const decisionHeuristics::BaseDecisionHeuristic::ptr& searchModeDecisionHeuristic : perSearchModeDecisionHeuristics)
+	{
+		if (searchModeDecisionHeuristic)
+			searchModeDecisionHeuristic->init(numVariables);
+	}
+
+	watchers.resize((numVariables + 1) * 2);
+	literalValues.resize((numVariables + 1) * 2, LiteralValue::Unassigned);
+	variableAssignmentData.resize(numVariables + 1, VariableAssignmentData({ 0, NO_CLAUSE, 0 }));
+	variableMarkers.resize(numVariables + 1, VariableMarker::Unmarked);
+	shrinkingStamps.resize(numVariables + 1, 0);
+	savedPhases.resize(numVariables + 1, configuration.isInitialPhasePositive);
+	targetPhases.resize(numVariables + 1, configuration.isInitialPhasePositive);
+	bestPhases.resize(numVariables + 1, configuration.isInitialPhasePositive);
+	decisionLevelStamps.resize(numVariables + 1, 0);
+	probingStamps.resize((numVariables + 1) * 2, 0);
+	perLiteralNumRootAssignmentsAtLastProbe.resize((numVariables + 1) * 2, SIZE_MAX);
+	trail.reserve(numVariables);
+
+	for (auto unitLiteralIterator = sharedFormula->getUnitLiterals().cbegin(); unitLiteralIterator != sharedFormula->getUnitLiterals().cend() && !isFormulaKnownToBeUnsat; ++unitLiteralIterator)
+		isFormulaKnownToBeUnsat |= !addOriginalClause({ *unitLiteralIterator });
+
+	for (std::size_t clauseIndexInSharedFormula = 0; clauseIndexInSharedFormula < sharedFormula->getNumClauses() && !isFormulaKnownToBeUnsat; ++clauseIndexInSharedFormula)
+		isFormulaKnownToBeUnsat |= !addOriginalClauseOfSharedFormula(clauseIndexInSharedFormula);
+}
+
+Solver::SolverResult Solver::solve()
+{
+	return solve({});
+}
+
+Solver::SolverResult Solver::solve(const std::vector<long>& assumptions)
+{
+	for (const long assumption : assumptions)
+	{
+		if (!assumption || literalToVariable(assumption) > numVariables)
+			throw std::invalid_argument("Assumption " + std::to_string(assumption) + " is not a literal of the formula");
+	}
+
+	// The clauses eliminated during inprocessing are only redundant as long as the variables of the witnesses are not constrained by the assumptions
+	if (!assumptions.empty() && !modelReconstructionStack.isEmpty() && !isFormulaKnownToBeUnsat)
+		isFormulaKnownToBeUnsat = !restoreEliminatedClauses();
+
+	this->assumptions = assumptions;
+	failedAssumptions.clear();
+	activationTimeOfSearchMode = std::chrono::steady_clock::now();
+	if (isInitialLocalSearchPending && !isFormulaKnownToBeUnsat)
+	{
+		seedPhasesByLocalSearch(*configuration.optionalInitialLocalSearchEffort);
+		targetPhases = savedPhases;
+		isInitialLocalSearchPending = false;
+	}
+	const SolverResult result = search();
+	recordDurationOfActiveSearchMode();
+	// All root level conflicts are derived by unit propagation of the recorded clauses, thus the empty clause is only added once the formula was determined to be unsatisfiable
+	if (proofWriter && isFormulaKnownToBeUnsat && !wasEmptyClauseAddedToProof)
+	{
+		proofWriter->addEmptyClause();
+		wasEmptyClauseAddedToProof = true;
+	}
+	this->assumptions.clear();
+
+	statistics.numBlockedRestarts = 0;
+	for (const restartPolicies::BaseRestartPolicy::ptr& searchModeRestartPolicy : perSearchModeRestartPolicies)
+		statistics.numBlockedRestarts += searchModeRestartPolicy ? searchModeRestartPolicy->getNumBlockedRestarts() : 0;
+	return result;
+}
+
+void Solver::addClause(const std::vector<long>& clauseLiterals)
+{
+	std::size_t maximumVariableOfClause = 0;
+	for (const long literal : clauseLiterals)
+	{
+		if (!literal)
+			throw std::invalid_argument("Literal 0 is not a valid literal of a clause");
+		maximumVariableOfClause = std::max(maximumVariableOfClause, literalToVariable(literal));
+	}
+
+	if (maximumVariableOfClause > numVariables)
+		increaseNumVariables(maximumVariableOfClause);
+	// A clause eliminated during inprocessing might no longer be redundant once another clause is added
+	if (!modelReconstructionStack.isEmpty() && !isFormulaKnownToBeUnsat)
+		isFormulaKnownToBeUnsat = !restoreEliminatedClauses();
+	if (!isFormulaKnownToBeUnsat)
+		isFormulaKnownToBeUnsat = !addOriginalClause(clauseLiterals);
+}
+
+const std::vector<long>& Solver::getFailedAssumptions() const noexcept
+{
+	return failedAssumptions;
+}
+
+bool Solver::isAssumptionFailed(long assumption) const
+{
+	return std::find(failedAssumptions.cbegin(), failedAssumptions.cend(), assumption) != failedAssumptions.cend();
+}
+
+std::optional<dimacs::ProblemDefinition::VariableValue> Solver::getValueOfVariable(std::size_t variable) const
+{
+	if (!variable || variable >= model.size())
+		return std::nullopt;
+	return model[variable];
+}
+
+std::vector<long> Solver::getModel() const
+{
+	std::vector<long> modelLiterals;
+	if (model.empty())
+		return modelLiterals;
+
+	// The model only covers the variables known during the last call of solve() if clauses with new variables were added since then
+	modelLiterals.reserve(model.size() - 1);
+	for (std::size_t variable = 1; variable < model.size(); ++variable)
+		modelLiterals.emplace_back(model[variable] == dimacs::ProblemDefinition::VariableValue::Low ? -static_cast<long>(variable) : static_cast<long>(variable));
+	return modelLiterals;
+}
+
+const Solver::SolverStatistics& Solver::getStatistics() const noexcept
+{
+	return statistics;
+}
+
+std::size_t Solver::getNumVariables() const noexcept
+{
+	return numVariables;
+}
+
+Solver::SearchMode Solver::getActiveSearchMode() const noexcept
+{
+	return activeSearchMode;
+}
+
+void Solver::setDecisionHeuristic(decisionHeuristics::BaseDecisionHeuristic::ptr decisionHeuristic, SearchMode searchMode)
+{
+	if (!decisionHeuristic)
+		throw std::invalid_argument("Decision heuristic cannot be null");
+
+	decisionHeuristic->init(numVariables);
+	perSearchModeDecisionHeuristics[searchMode] = std::move(decisionHeuristic);
+	statistics.perSearchModeDecisionHeuristicStatistics[searchMode].decisionHeuristic = DecisionHeuristic::UserDefined;
+	if (searchMode == activeSearchMode)
+		this->decisionHeuristic = perSearchModeDecisionHeuristics[searchMode].get();
+}
+
+void Solver::setCancellationFlag(const std::atomic_bool* cancellationFlag) noexcept
+{
+	this->cancellationFlag = cancellationFlag;
+}
+
+void Solver::setConflictLimit(std::optional<std::size_t> optionalConflictLimit) noexcept
+{
+	configuration.optionalConflictLimit = optionalConflictLimit;
+}
+
+void Solver::setTerminationCallback(std::function<bool()> terminationCallback)
+{
+	this->terminationCallback = std::move(terminationCallback);
+}
+
+void Solver::setResourceBudget(budget::ResourceBudget* resourceBudget) noexcept
+{
+	this->resourceBudget = resourceBudget;
+}
+
+void Solver::setLearnedClauseCallback(std::size_t maximumSizeOfPassedClauses, std::function<void(const std::vector<long>&)> learnedClauseCallback)
+{
+	maximumSizeOfClausesPassedToLearnedClauseCallback = maximumSizeOfPassedClauses;
+	this->learnedClauseCallback = std::move(learnedClauseCallback);
+}
+
+void Solver::setClauseExchange(ClauseExchange* clauseExchange, std::size_t workerIndex)
+{
+	if (clauseExchange && workerIndex >= clauseExchange->getNumWorkers())
+		throw std::invalid_argument("Worker index " + std::to_string(workerIndex) + " is out of range [0, " + std::to_string(clauseExchange->getNumWorkers()) + ")");
+
+	if (clauseExchange && proofWriter)
+		throw std::invalid_argument("Learned clauses cannot be exchanged with other workers while a proof is recorded");
+
+	this->clauseExchange = clauseExchange;
+	workerIndexInClauseExchange = workerIndex;
+}
+
+void Solver::setProofWriter(proof::ProofWriter* proofWriter)
+{
+	if (proofWriter && proofWriter->getProofFormat() != proof::ProofWriter::ProofFormat::Drat)
+		throw std::invalid_argument("Solver can only record proofs in the DRAT format");
+	if (proofWriter && clauseExchange)
+		throw std::invalid_argument("Proof cannot be recorded while learned clauses are exchanged with other workers");
+	if (proofWriter && !modelReconstructionStack.isEmpty())
+		throw std::invalid_argument("Proof cannot be recorded once clauses were eliminated during inprocessing");
+
+	this->proofWriter = proofWriter;
+}
+
+// START NON-PUBLIC FUNCTIONALITY
+Solver::SolverResult Solver::search()
+{
+	if (isFormulaKnownToBeUnsat)
+		return SolverResult::Unsat;
+
+	while (true)
+	{
+		if (const ClauseIndex conflictingClause = propagate(); conflictingClause != NO_CLAUSE)
+		{
+			++statistics.numConflicts;
+			++statistics.perSearchModeDecisionHeuristicStatistics[activeSearchMode].numConflicts;
+			if (resourceBudget)
+				resourceBudget->chargeConflicts(1);
+			if (!getCurrentDecisionLevel())
+			{
+				isFormulaKnownToBeUnsat = true;
+				return SolverResult::Unsat;
+			}
+
+			/*
+			 * With chronological backtracking the trail is no longer sorted by decision level and the conflicting clause might only contain literals of lower decision levels. The search backtracks to the
+			 * highest decision level of the conflicting clause and, if only a single literal was falsified on this level, the clause is actually a missed implication of said literal.
+			 */
+			if (configuration.optionalChronologicalBacktrackingThreshold.has_value())
+			{
+				std::size_t numLiteralsOnConflictLevel = 0;
+				long literalOnConflictLevel = 0;
+				const std::size_t conflictLevel = determineConflictLevel(conflictingClause, numLiteralsOnConflictLevel, literalOnConflictLevel);
+				if (!conflictLevel)
+				{
+					isFormulaKnownToBeUnsat = true;
+					return SolverResult::Unsat;
+				}
+
+				backtrack(conflictLevel);
+				if (numLiteralsOnConflictLevel == 1)
+				{
+					++statistics.numMissedImplications;
+					backtrack(conflictLevel - 1);
+					assignLiteral(literalOnConflictLevel, conflictingClause, determineMaximumDecisionLevelOfClause(clauses[conflictingClause], literalOnConflictLevel));
+					continue;
+				}
+			}
+
+			std::vector<long> learnedClauseLiterals = analyzeConflict(conflictingClause);
+			decisionHeuristic->onConflict();
+			const std::size_t literalBlockDistanceOfLearnedClause = computeLiteralBlockDistance(learnedClauseLiterals.data(), learnedClauseLiterals.size());
+			if (restartPolicy)
+				restartPolicy->onConflict(literalBlockDistanceOfLearnedClause, trail.size());
+			updateTargetAndBestPhases(decisionLevelStartPositionsInTrail.back());
+			std::uint32_t positionOfLiteralOnBackjumpLevel = 0;
+			const std::size_t backjumpLevel = determineBackjumpLevel(learnedClauseLiterals, positionOfLiteralOnBackjumpLevel);
+
+			std::size_t backtrackLevel = backjumpLevel;
+			if (configuration.optionalChronologicalBacktrackingThreshold.has_value() && learnedClauseLiterals.size() > 1 && getCurrentDecisionLevel() - backjumpLevel > *configuration.optionalChronologicalBacktrackingThreshold)
+			{
+				backtrackLevel = getCurrentDecisionLevel() - 1;
+				++statistics.numChronologicalBacktracks;
+				statistics.numAssignmentsRetainedByChronologicalBacktracking += decisionLevelStartPositionsInTrail[backtrackLevel] - decisionLevelStartPositionsInTrail[backjumpLevel];
+			}
+
+			++statistics.numBackjumps;
+			statistics.numSkippedDecisionLevelsDuringBackjumps += getCurrentDecisionLevel() - backtrackLevel - 1;
+			backtrack(backtrackLevel);
+
+			++statistics.numLearnedClauses;
+			statistics.numLearnedLiterals += learnedClauseLiterals.size();
+			if (proofWriter)
+				proofWriter->addClause(learnedClauseLiterals);
+			if (learnedClauseLiterals.size() == 1)
+			{
+				++statistics.numLearnedUnitClauses;
+				assignLiteral(learnedClauseLiterals.front(), NO_CLAUSE, backjumpLevel);
+			}
+			else
+			{
+				const ClauseIndex learnedClause = addClauseToArena(learnedClauseLiterals, true, positionOfLiteralOnBackjumpLevel);
+				clauses[learnedClause].literalBlockDistance = static_cast<std::uint32_t>(literalBlockDistanceOfLearnedClause);
+				moveLearnedClauseToTier(clauses[learnedClause], determineTierOfLearnedClause(literalBlockDistanceOfLearnedClause));
+				attachClause(learnedClause);
+				assignLiteral(learnedClauseLiterals.front(), learnedClause, backjumpLevel);
+			}
+			if (clauseExchange)
+				exportLearnedClause(learnedClauseLiterals, literalBlockDistanceOfLearnedClause);
+			if (learnedClauseCallback && learnedClauseLiterals.size() <= maximumSizeOfClausesPassedToLearnedClauseCallback)
+				learnedClauseCallback(learnedClauseLiterals);
+
+			if ((configuration.optionalConflictLimit.has_value() && statistics.numConflicts >= *configuration.optionalConflictLimit) || isCancellationRequested())
+			{
+				backtrack(0);
+				return SolverResult::Unknown;
+			}
+
+			bool hasRestarted = false;
+			if (isSearchModeSwitchDue())
+			{
+				switchSearchMode();
+				hasRestarted = true;
+			}
+			else if (restartPolicy && restartPolicy->shouldRestart())
+			{
+				restart();
+				hasRestarted = true;
+			}
+
+			if (hasRestarted && clauseExchange && !importClausesOfOtherWorkers())
+			{
+				isFormulaKnownToBeUnsat = true;
+				return SolverResult::Unsat;
+			}
+
+			if (hasRestarted && isInprocessingDue() && !inprocess())
+			{
+				isFormulaKnownToBeUnsat = true;
+				return SolverResult::Unsat;
+			}
+
+			if (isRephasingDue())
+				rephase();
+
+			if (isClauseDatabaseReductionDue())
+				reduceClauseDatabase();
+		}
+		else
+		{
+			if (isCancellationRequested())
+			{
+				backtrack(0);
+				return SolverResult::Unknown;
+			}
+
+			bool isAssumptionFalsified = false;
+			std::optional<long> branchingLiteral = pickAssumptionLiteral(isAssumptionFalsified);
+			if (isAssumptionFalsified)
+			{
+				determineFailedAssumptions(assumptions[getCurrentDecisionLevel()]);
+				backtrack(0);
+				return SolverResult::Unsat;
+			}
+			if (!branchingLiteral.has_value())
+				branchingLiteral = pickBranchingLiteral();
+			if (!branchingLiteral.has_value())
+			{
+				recordModel();
+				backtrack(0);
+				return SolverResult::Sat;
+			}
+
+			++statistics.numDecisions;
+			++statistics.perSearchModeDecisionHeuristicStatistics[activeSearchMode].numDecisions;
+			decisionLevelStartPositionsInTrail.emplace_back(trail.size());
+			statistics.maxDecisionLevel = std::max(statistics.maxDecisionLevel, getCurrentDecisionLevel());
+			assignLiteral(*branchingLiteral, NO_CLAUSE, getCurrentDecisionLevel());
+		}
+	}
+}
+
+bool Solver::addOriginalClause(std::vector<long> clauseLiterals)
+{
+	std::sort(clauseLiterals.begin(), clauseLiterals.end());
+	clauseLiterals.erase(std::unique(clauseLiterals.begin(), clauseLiterals.end()), clauseLiterals.end());
+
+	// Original clauses are only added on the root decision level, thus literals falsified by root level assignments can be removed while satisfied clauses can be dropped entirely.
+	bool isClauseSatisfiedOrTautology = false;
+	std::vector<long> remainingClauseLiterals;
+	remainingClauseLiterals.reserve(clauseLiterals.size());
+	for (const long literal : clauseLiterals)
+	{
+		if (!literal || literalToVariable(literal) > numVariables)
+			throw std::invalid_argument("Literal " + std::to_string(literal) + " is not within the valid range of literals [-" + std::to_string(numVariables) + ", -1] v [1, " + std::to_string(numVariables) + "]");
+
+		isClauseSatisfiedOrTautology |= getLiteralValue(literal) == LiteralValue::Satisfied || std::binary_search(clauseLiterals.cbegin(), clauseLiterals.cend(), -literal);
+		if (getLiteralValue(literal) == LiteralValue::Unassigned)
+			remainingClauseLiterals.emplace_back(literal);
+	}
+
+	if (isClauseSatisfiedOrTautology)
+		return true;
+	if (remainingClauseLiterals.empty())
+		return false;
+
+	if (remainingClauseLiterals.size() == 1)
+		assignLiteral(remainingClauseLiterals.front(), NO_CLAUSE, 0);
+	else
+		attachClause(addClauseToArena(remainingClauseLiterals, false, 1));
+	return true;
+}
+
+/*
+ * The literals of the clauses of the shared formula are already sorted and free of duplicates while tautologies were removed, literals falsified on the root decision level are kept
+ * since the clause is not copied but only its two watched literals are chosen among the non-falsified literals.
+ */
+bool Solver::addOriginalClauseOfSharedFormula(std::size_t clauseIndexInSharedFormula)
+{
+	const std::size_t literalsOffset = sharedFormula->getOffsetOfClause(clauseIndexInSharedFormula);
+	const std::uint32_t numLiterals = sharedFormula->getNumLiteralsOfClause(clauseIndexInSharedFormula);
+	const long* clauseLiterals = sharedClauseLiteralArena + literalsOffset;
+
+	std::array<std::uint32_t, 2> watchedLiteralPositions = { 0, 0 };
+	std::size_t numUnassignedLiterals = 0;
+	for (std::uint32_t literalPosition = 0; literalPosition < numLiterals; ++literalPosition)
+	{
+		const LiteralValue literalValue = getLiteralValue(clauseLiterals[literalPosition]);
+		if (literalValue == LiteralValue::Satisfied)
+			return true;
+		if (literalValue == LiteralValue::Unassigned && numUnassignedLiterals < 2)
+			watchedLiteralPositions[numUnassignedLiterals++] = literalPosition;
+	}
+
+	if (!numUnassignedLiterals)
+		return false;
+	if (numUnassignedLiterals == 1)
+	{
+		assignLiteral(clauseLiterals[watchedLiteralPositions[0]], NO_CLAUSE, 0);
+		return true;
+	}
+
+	ClauseMetadata clauseMetadata;
+	clauseMetadata.literalsOffset = literalsOffset;
+	clauseMetadata.numLiterals = numLiterals;
+	clauseMetadata.watchedLiteralPositions = watchedLiteralPositions;
+	clauseMetadata.literalBlockDistance = numLiterals;
+	clauseMetadata.tier = ClauseTier::Local;
+	clauseMetadata.isLearned = false;
+	clauseMetadata.isStoredInSharedFormula = true;
+	clauseMetadata.isUnusedImportedClause = false;
+	clauseMetadata.isDeleted = false;
+	clauseMetadata.wasUsedSinceLastReduction = false;
+	clauseMetadata.wasVivified = false;
+	clauses.emplace_back(clauseMetadata);
+	attachClause(clauses.size() - 1);
+	return true;
+}
+
+Solver::ClauseIndex Solver::addClauseToArena(const std::vector<long>& clauseLiterals, bool isLearned, std::uint32_t secondWatchedLiteralPosition)
+{
+	ClauseMetadata clauseMetadata;
+	clauseMetadata.literalsOffset = clauseLiteralArena.size();
+	clauseMetadata.numLiterals = static_cast<std::uint32_t>(clauseLiterals.size());
+	clauseMetadata.watchedLiteralPositions = { 0, secondWatchedLiteralPosition };
+	clauseMetadata.literalBlockDistance = clauseMetadata.numLiterals;
+	clauseMetadata.tier = ClauseTier::Local;
+	clauseMetadata.isLearned = isLearned;
+	clauseMetadata.isStoredInSharedFormula = false;
+	clauseMetadata.isUnusedImportedClause = false;
+	clauseMetadata.isDeleted = false;
+	clauseMetadata.wasUsedSinceLastReduction = false;
+	clauseMetadata.wasVivified = false;
+
+	clauseLiteralArena.insert(clauseLiteralArena.end(), clauseLiterals.cbegin(), clauseLiterals.cend());
+	clauses.emplace_back(clauseMetadata);
+	if (isLearned)
+		++statistics.numLearnedClausesPerTier[clauseMetadata.tier];
+	return clauses.size() - 1;
+}
+
+void Solver::attachClause(ClauseIndex clauseIndex)
+{
+	const ClauseMetadata& clause = clauses[clauseIndex];
+	const long* clauseLiterals = getLiteralsOfClause(clause);
+	const long firstWatchedLiteral = clauseLiterals[clause.watchedLiteralPositions[0]];
+	const long secondWatchedLiteral = clauseLiterals[clause.watchedLiteralPositions[1]];
+	const bool isBinaryClause = clause.numLiterals == 2;
+
+	watchers[literalToIndex(firstWatchedLiteral)].emplace_back(Watcher({ clauseIndex, secondWatchedLiteral, isBinaryClause }));
+	watchers[literalToIndex(secondWatchedLiteral)].emplace_back(Watcher({ clauseIndex, firstWatchedLiteral, isBinaryClause }));
+}
+
+void Solver::detachClause(ClauseIndex clauseIndex, std::size_t& numTicks)
+{
+	const ClauseMetadata& clause = clauses[clauseIndex];
+	const long* clauseLiterals = getLiteralsOfClause(clause);
+	for (const std::uint32_t watchedLiteralPosition : clause.watchedLiteralPositions)
+	{
+		std::vector<Watcher>& watchersOfLiteral = watchers[literalToIndex(clauseLiterals[watchedLiteralPosition])];
+		numTicks += budget::determineNumTicksOfSequentialAccess<Watcher>(watchersOfLiteral.size());
+		watchersOfLiteral.erase(std::remove_if(watchersOfLiteral.begin(), watchersOfLiteral.end(), [clauseIndex](const Watcher& watcher) { return watcher.clauseIndex == clauseIndex; }), watchersOfLiteral.end());
+	}
+}
+
+Solver::ClauseIndex Solver::propagate()
+{
+	const std::size_t numPropagationTicksPriorToPropagation = statistics.numPropagationTicks;
+	ClauseIndex conflictingClause = NO_CLAUSE;
+	while (propagationQueueHead < trail.size() && conflictingClause == NO_CLAUSE)
+	{
+		const long falsifiedLiteral = -trail[propagationQueueHead++];
+		const std::size_t decisionLevelOfFalsifiedLiteral = variableAssignmentData[literalToVariable(falsifiedLiteral)].decisionLevel;
+		++statistics.numPropagations;
+
+		std::vector<Watcher>& watchersOfFalsifiedLiteral = watchers[literalToIndex(falsifiedLiteral)];
+		// Every watcher is either visited or moved while compacting the watch list, even if a conflict is found
+		statistics.numPropagationTicks += budget::determineNumTicksOfSequentialAccess<Watcher>(watchersOfFalsifiedLiteral.size());
+		auto readIterator = watchersOfFalsifiedLiteral.begin();
+		auto writeIterator = watchersOfFalsifiedLiteral.begin();
+		while (readIterator != watchersOfFalsifiedLiteral.end())
+		{
+			Watcher watcher = *readIterator++;
+			const LiteralValue valueOfBlockingLiteral = getLiteralValue(watcher.blockingLiteral);
+			if (valueOfBlockingLiteral == LiteralValue::Satisfied)
+			{
+				*writeIterator++ = watcher;
+				continue;
+			}
+
+			if (watcher.isBinaryClause)
+			{
+				*writeIterator++ = watcher;
+				if (valueOfBlockingLiteral == LiteralValue::Falsified)
+				{
+					conflictingClause = watcher.clauseIndex;
+					break;
+				}
+				assignLiteral(watcher.blockingLiteral, watcher.clauseIndex, decisionLevelOfFalsifiedLiteral);
+				continue;
+			}
+
+			ClauseMetadata& clause = clauses[watcher.clauseIndex];
+			++statistics.numPropagationTicks;
+			if (clause.isDeleted)
+				continue;
+
+			// The literals are stored separately from the metadata of the clause
+			const long* clauseLiterals = getLiteralsOfClause(clause);
+			++statistics.numPropagationTicks;
+			const std::size_t positionOfFalsifiedWatch = clauseLiterals[clause.watchedLiteralPositions[0]] == falsifiedLiteral ? 0 : 1;
+			const long otherWatchedLiteral = clauseLiterals[clause.watchedLiteralPositions[1 - positionOfFalsifiedWatch]];
+			watcher.blockingLiteral = otherWatchedLiteral;
+
+			const LiteralValue valueOfOtherWatchedLiteral = getLiteralValue(otherWatchedLiteral);
+			if (valueOfOtherWatchedLiteral == LiteralValue::Satisfied)
+			{
+				*writeIterator++ = watcher;
+				continue;
+			}
+
+			bool foundReplacementWatch = false;
+			std::uint32_t literalPosition = 0;
+			for (; literalPosition < clause.numLiterals && !foundReplacementWatch; ++literalPosition)
+			{
+				if (literalPosition == clause.watchedLiteralPositions[0] || literalPosition == clause.watchedLiteralPositions[1] || getLiteralValue(clauseLiterals[literalPosition]) == LiteralValue::Falsified)
+					continue;
+
+				clause.watchedLiteralPositions[positionOfFalsifiedWatch] = literalPosition;
+				watchers[literalToIndex(clauseLiterals[literalPosition])].emplace_back(Watcher({ watcher.clauseIndex, otherWatchedLiteral, false }));
+				foundReplacementWatch = true;
+			}
+			// The cache line of the watched literals was already accounted for
+			statistics.numPropagationTicks += budget::determineNumTicksOfSequentialAccess<long>(literalPosition) - 1;
+			if (foundReplacementWatch)
+				continue;
+
+			*writeIterator++ = watcher;
+			if (valueOfOtherWatchedLiteral == LiteralValue::Falsified)
+			{
+				conflictingClause = watcher.clauseIndex;
+				break;
+			}
+			// The implied literal is assigned on the highest decision level of the other literals of the clause, which only differs from the current decision level for out-of-order assignments
+			assignLiteral(otherWatchedLiteral, watcher.clauseIndex, decisionLevelOfFalsifiedLiteral == getCurrentDecisionLevel() ? decisionLevelOfFalsifiedLiteral : determineMaximumDecisionLevelOfClause(clause, otherWatchedLiteral));
+		}
+
+		writeIterator = std::copy(readIterator, watchersOfFalsifiedLiteral.end(), writeIterator);
+		watchersOfFalsifiedLiteral.erase(writeIterator, watchersOfFalsifiedLiteral.end());
+	}
+	if (resourceBudget)
+		resourceBudget->chargeTicks(statistics.numPropagationTicks - numPropagationTicksPriorToPropagation);
+	return conflictingClause;
+}
+
+/*
+ * Conflict analysis according to the first unique implication point (1UIP) scheme, resolving the conflicting clause with the reasons of the literals
+ * assigned on the current decision level (in reverse order of the trail) until only one literal of the current decision level remains.
+ */
+std::vector<long> Solver::analyzeConflict(ClauseIndex conflictingClause)
+{
+	std::vector<long> learnedClauseLiterals(1, 0);
+	std::size_t numUnresolvedLiteralsOfCurrentDecisionLevel = 0;
+	std::size_t trailPosition = trail.size();
+	long resolvedLiteral = 0;
+	ClauseIndex reasonClause = conflictingClause;
+
+	do
+	{
+		markClauseAsUsedDuringConflictAnalysis(reasonClause);
+		const ClauseMetadata& clause = clauses[reasonClause];
+		const long* clauseLiterals = getLiteralsOfClause(clause);
+		for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals; ++literalPosition)
+		{
+			const long literal = clauseLiterals[literalPosition];
+			const std::size_t variable = literalToVariable(literal);
+			if (literal == resolvedLiteral || variableMarkers[variable] != VariableMarker::Unmarked || !variableAssignmentData[variable].decisionLevel)
+				continue;
+
+			variableMarkers[variable] = VariableMarker::Seen;
+			decisionHeuristic->onVariableBumpedDuringConflictAnalysis(variable);
+			if (variableAssignmentData[variable].decisionLevel >= getCurrentDecisionLevel())
+				++numUnresolvedLiteralsOfCurrentDecisionLevel;
+			else
+				learnedClauseLiterals.emplace_back(literal);
+		}
+
+		while (variableMarkers[literalToVariable(trail[--trailPosition])] != VariableMarker::Seen || variableAssignmentData[literalToVariable(trail[trailPosition])].decisionLevel != getCurrentDecisionLevel());
+		resolvedLiteral = trail[trailPosition];
+		reasonClause = variableAssignmentData[literalToVariable(resolvedLiteral)].reason;
+		variableMarkers[literalToVariable(resolvedLiteral)] = VariableMarker::Unmarked;
+		--numUnresolvedLiteralsOfCurrentDecisionLevel;
+	} while (numUnresolvedLiteralsOfCurrentDecisionLevel);
+
+	learnedClauseLiterals.front() = -resolvedLiteral;
+	for (auto literalIterator = std::next(learnedClauseLiterals.cbegin()); literalIterator != learnedClauseLiterals.cend(); ++literalIterator)
+		markedVariables.emplace_back(literalToVariable(*literalIterator));
+
+	minimizeLearnedClause(learnedClauseLiterals);
+	for (const std::size_t variable : markedVariables)
+		variableMarkers[variable] = VariableMarker::Unmarked;
+	markedVariables.clear();
+
+	return learnedClauseLiterals;
+}
+
+/*
+ * Removes the literals of the learned clause that are implied by the remaining literals of the clause (https://doi.org/10.1007/978-3-642-02777-2_23), with the check for the redundancy of a literal
+ * being performed recursively over the implication graph. Literals whose decision level is not among the decision levels of the learned clause (filtered via the abstraction of the decision levels
+ * as a bitset) cannot be redundant and the results of previous redundancy checks are cached in the markers of the variables (removable or poisoned).
+ */
+void Solver::minimizeLearnedClause(std::vector<long>& learnedClauseLiterals)
+{
+	std::uint32_t abstractDecisionLevelsOfClause = 0;
+	for (auto literalIterator = std::next(learnedClauseLiterals.cbegin()); literalIterator != learnedClauseLiterals.cend(); ++literalIterator)
+		abstractDecisionLevelsOfClause |= computeAbstractDecisionLevel(literalToVariable(*literalIterator));
+
+	if (configuration.isLearnedClauseShrinkingEnabled)
+		shrinkLearnedClause(learnedClauseLiterals, abstractDecisionLevelsOfClause);
+	if (!configuration.isLearnedClauseMinimizationEnabled)
+		return;
+
+	std::size_t numRemainingLiterals = 1;
+	for (std::size_t literalPosition = 1; literalPosition < learnedClauseLiterals.size(); ++literalPosition)
+	{
+		const long literal = learnedClauseLiterals[literalPosition];
+		if (variableAssignmentData[literalToVariable(literal)].reason == NO_CLAUSE || !isLiteralRedundant(literal, abstractDecisionLevelsOfClause))
+			learnedClauseLiterals[numRemainingLiterals++] = literal;
+	}
+	statistics.numMinimizedLiterals += learnedClauseLiterals.size() - numRemainingLiterals;
+	learnedClauseLiterals.resize(numRemainingLiterals);
+}
+
+/*
+ * Shrinking according to (https://doi.org/10.1007/978-3-030-51825-7_24): The literals of a decision level (other than the current one) with more than one literal in the learned clause are replaced
+ * by the negation of the unique implication point of the decision level with respect to these literals (block-UIP), if one can be reached by resolving only with reasons whose literals of lower decision levels
+ * are part of the learned clause or are redundant.
+ */
+void Solver::shrinkLearnedClause(std::vector<long>& learnedClauseLiterals, std::uint32_t abstractDecisionLevelsOfClause)
+{
+	std::sort(std::next(learnedClauseLiterals.begin()), learnedClauseLiterals.end(), [this](const long lLiteral, const long rLiteral)
+	{
+		return variableAssignmentData[literalToVariable(lLiteral)].decisionLevel > variableAssignmentData[literalToVariable(rLiteral)].decisionLevel;
+	});
+
+	std::vector<long> shrunkClauseLiterals(1, learnedClauseLiterals.front());
+	std::vector<long> literalsOfDecisionLevel;
+	for (std::size_t literalPosition = 1; literalPosition < learnedClauseLiterals.size();)
+	{
+		const std::size_t decisionLevel = variableAssignmentData[literalToVariable(learnedClauseLiterals[literalPosition])].decisionLevel;
+		literalsOfDecisionLevel.clear();
+		while (literalPosition < learnedClauseLiterals.size() && variableAssignmentData[literalToVariable(learnedClauseLiterals[literalPosition])].decisionLevel == decisionLevel)
+			literalsOfDecisionLevel.emplace_back(learnedClauseLiterals[literalPosition++]);
+
+		const std::optional<long> uniqueImplicationPoint = literalsOfDecisionLevel.size() > 1 ? determineUniqueImplicationPointOfDecisionLevel(literalsOfDecisionLevel, decisionLevel, abstractDecisionLevelsOfClause) : std::nullopt;
+		if (!uniqueImplicationPoint.has_value())
+		{
+			shrunkClauseLiterals.insert(shrunkClauseLiterals.end(), literalsOfDecisionLevel.cbegin(), literalsOfDecisionLevel.cend());
+			continue;
+		}
+
+		// The replaced literals are implied by the unique implication point and can thus be treated as redundant during the minimization
+		for (const long literal : literalsOfDecisionLevel)
+			variableMarkers[literalToVariable(literal)] = VariableMarker::Removable;
+		markVariable(literalToVariable(*uniqueImplicationPoint), VariableMarker::Seen);
+		shrunkClauseLiterals.emplace_back(-*uniqueImplicationPoint);
+		statistics.numShrunkLiterals += literalsOfDecisionLevel.size() - 1;
+	}
+	learnedClauseLiterals.swap(shrunkClauseLiterals);
+}
+
+std::optional<long> Solver::determineUniqueImplicationPointOfDecisionLevel(const std::vector<long>& literalsOfDecisionLevel, std::size_t decisionLevel, std::uint32_t abstractDecisionLevelsOfClause)
+{
+	++currentShrinkingStamp;
+	for (const long literal : literalsOfDecisionLevel)
+		shrinkingStamps[literalToVariable(literal)] = currentShrinkingStamp;
+
+	// Literals of the decision level can be located after the start of the next decision level on the trail due to out-of-order assignments
+	std::size_t lastTrailPositionOfLiterals = 0;
+	for (const long literal : literalsOfDecisionLevel)
+		lastTrailPositionOfLiterals = std::max(lastTrailPositionOfLiterals, variableAssignmentData[literalToVariable(literal)].trailPosition);
+
+	std::size_t numUnresolvedLiterals = literalsOfDecisionLevel.size();
+	const std::size_t firstTrailPositionOfDecisionLevel = decisionLevelStartPositionsInTrail[decisionLevel - 1];
+	for (std::size_t trailPosition = lastTrailPositionOfLiterals + 1; trailPosition-- > firstTrailPositionOfDecisionLevel;)
+	{
+		const long trailLiteral = trail[trailPosition];
+		const std::size_t variable = literalToVariable(trailLiteral);
+		if (shrinkingStamps[variable] != currentShrinkingStamp)
+			continue;
+		if (numUnresolvedLiterals == 1)
+			return trailLiteral;
+
+		const ClauseIndex reasonClause = variableAssignmentData[variable].reason;
+		if (reasonClause == NO_CLAUSE)
+			return std::nullopt;
+
+		const ClauseMetadata& clause = clauses[reasonClause];
+		const long* clauseLiterals = getLiteralsOfClause(clause);
+		for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals; ++literalPosition)
+		{
+			const long literal = clauseLiterals[literalPosition];
+			const std::size_t variableOfLiteral = literalToVariable(literal);
+			const std::size_t decisionLevelOfLiteral = variableAssignmentData[variableOfLiteral].decisionLevel;
+			if (variableOfLiteral == variable || !decisionLevelOfLiteral)
+				continue;
+
+			if (decisionLevelOfLiteral == decisionLevel)
+			{
+				if (shrinkingStamps[variableOfLiteral] != currentShrinkingStamp)
+				{
+					shrinkingStamps[variableOfLiteral] = currentShrinkingStamp;
+					++numUnresolvedLiterals;
+				}
+				continue;
+			}
+
+			const VariableMarker markerOfLiteral = variableMarkers[variableOfLiteral];
+			if (markerOfLiteral == VariableMarker::Seen || markerOfLiteral == VariableMarker::Removable)
+				continue;
+			if (!configuration.isLearnedClauseMinimizationEnabled || markerOfLiteral == VariableMarker::Poisoned || variableAssignmentData[variableOfLiteral].reason == NO_CLAUSE || !isLiteralRedundant(literal, abstractDecisionLevelsOfClause))
+				return std::nullopt;
+		}
+		--numUnresolvedLiterals;
+	}
+	return std::nullopt;
+}
+
+/*
+ * Depth-first search over the implication graph starting from the reason of the given (falsified) literal, a literal is redundant if every path ends in a literal of the learned clause,
+ * a literal assigned on the root decision level or a literal already known to be removable. On failure, every literal on the current search path is poisoned.
+ */
+bool Solver::isLiteralRedundant(long literal, std::uint32_t abstractDecisionLevelsOfClause)
+{
+	redundancyCheckStack.clear();
+	long currentLiteral = literal;
+	std::uint32_t literalPosition = 0;
+	while (true)
+	{
+		const std::size_t currentVariable = literalToVariable(currentLiteral);
+		const ClauseMetadata& reason = clauses[variableAssignmentData[currentVariable].reason];
+		if (literalPosition < reason.numLiterals)
+		{
+			const long reasonLiteral = getLiteralsOfClause(reason)[literalPosition++];
+			const std::size_t reasonVariable = literalToVariable(reasonLiteral);
+			if (reasonVariable == currentVariable || !variableAssignmentData[reasonVariable].decisionLevel || variableMarkers[reasonVariable] == VariableMarker::Seen || variableMarkers[reasonVariable] == VariableMarker::Removable)
+				continue;
+
+			if (variableAssignmentData[reasonVariable].reason == NO_CLAUSE || variableMarkers[reasonVariable] == VariableMarker::Poisoned || !(computeAbstractDecisionLevel(reasonVariable) & abstractDecisionLevelsOfClause))
+			{
+				redundancyCheckStack.emplace_back(RedundancyCheckStackEntry({ 0, currentLiteral }));
+				for (const RedundancyCheckStackEntry& stackEntry : redundancyCheckStack)
+				{
+					if (const std::size_t variableOfStackEntry = literalToVariable(stackEntry.literal); variableMarkers[variableOfStackEntry] == VariableMarker::Unmarked)
+						markVariable(variableOfStackEntry, VariableMarker::Poisoned);
+				}
+				return false;
+			}
+
+			redundancyCheckStack.emplace_back(RedundancyCheckStackEntry({ literalPosition, currentLiteral }));
+			currentLiteral = reasonLiteral;
+			literalPosition = 0;
+		}
+		else
+		{
+			if (variableMarkers[currentVariable] == VariableMarker::Unmarked)
+				markVariable(currentVariable, VariableMarker::Removable);
+			if (redundancyCheckStack.empty())
+				return true;
+
+			currentLiteral = redundancyCheckStack.back().literal;
+			literalPosition = redundancyCheckStack.back().nextLiteralPosition;
+			redundancyCheckStack.pop_back();
+		}
+	}
+}
+
+void Solver::markVariable(std::size_t variable, VariableMarker marker)
+{
+	variableMarkers[variable] = marker;
+	markedVariables.emplace_back(variable);
+}
+
+std::size_t Solver::computeLiteralBlockDistance(const long* clauseLiterals, std::size_t numLiterals)
+{
+	++currentDecisionLevelStamp;
+	std::size_t literalBlockDistance = 0;
+	for (std::size_t literalPosition = 0; literalPosition < numLiterals; ++literalPosition)
+	{
+		const std::size_t decisionLevelOfLiteral = variableAssignmentData[literalToVariable(clauseLiterals[literalPosition])].decisionLevel;
+		if (decisionLevelStamps[decisionLevelOfLiteral] != currentDecisionLevelStamp)
+		{
+			decisionLevelStamps[decisionLevelOfLiteral] = currentDecisionLevelStamp;
+			++literalBlockDistance;
+		}
+	}
+	return literalBlockDistance;
+}
+
+std::size_t Solver::determineBackjumpLevel(const std::vector<long>& learnedClauseLiterals, std::uint32_t& positionOfLiteralOnBackjumpLevel) const
+{
+	std::size_t backjumpLevel = 0;
+	positionOfLiteralOnBackjumpLevel = 0;
+	for (std::uint32_t literalPosition = 1; literalPosition < learnedClauseLiterals.size(); ++literalPosition)
+	{
+		const std::size_t decisionLevelOfLiteral = variableAssignmentData[literalToVariable(learnedClauseLiterals[literalPosition])].decisionLevel;
+		if (decisionLevelOfLiteral > backjumpLevel || !positionOfLiteralOnBackjumpLevel)
+		{
+			backjumpLevel = decisionLevelOfLiteral;
+			positionOfLiteralOnBackjumpLevel = literalPosition;
+		}
+	}
+	return backjumpLevel;
+}
+
+void Solver::backtrack(std::size_t decisionLevel)
+{
+	if (getCurrentDecisionLevel() <= decisionLevel)
+		return;
+
+	const std::size_t firstTrailPositionOfRemovedLevels = decisionLevelStartPositionsInTrail[decisionLevel];
+	std::size_t numRetainedAssignments = 0;
+	for (std::size_t trailPosition = firstTrailPositionOfRemovedLevels; trailPosition < trail.size(); ++trailPosition)
+	{
+		const long literal = trail[trailPosition];
+		const std::size_t variable = literalToVariable(literal);
+		// Out-of-order assignments of lower decision levels are kept while preserving their relative order on the trail
+		if (variableAssignmentData[variable].decisionLevel <= decisionLevel)
+		{
+			variableAssignmentData[variable].trailPosition = firstTrailPositionOfRemovedLevels + numRetainedAssignments;
+			trail[firstTrailPositionOfRemovedLevels + numRetainedAssignments++] = literal;
+			continue;
+		}
+
+		literalValues[literalToIndex(literal)] = LiteralValue::Unassigned;
+		literalValues[literalToIndex(-literal)] = LiteralValue::Unassigned;
+		variableAssignmentData[variable].reason = NO_CLAUSE;
+		if (configuration.isPhaseSavingEnabled)
+			savedPhases[variable] = literal > 0;
+		decisionHeuristic->onVariableUnassigned(variable);
+	}
+	trail.resize(firstTrailPositionOfRemovedLevels + numRetainedAssignments);
+	statistics.numRetainedOutOfOrderAssignments += numRetainedAssignments;
+	decisionLevelStartPositionsInTrail.resize(decisionLevel);
+	// The retained assignments are propagated again since the assignments of their implications might have been undone
+	propagationQueueHead = std::min(propagationQueueHead, firstTrailPositionOfRemovedLevels);
+}
+
+void Solver::assignLiteral(long literal, ClauseIndex reason, std::size_t decisionLevel)
+{
+	literalValues[literalToIndex(literal)] = LiteralValue::Satisfied;
+	literalValues[literalToIndex(-literal)] = LiteralValue::Falsified;
+	variableAssignmentData[literalToVariable(literal)] = VariableAssignmentData({ decisionLevel, reason, trail.size() });
+	trail.emplace_back(literal);
+	decisionHeuristic->onVariableAssigned(literalToVariable(literal));
+}
+
+/*
+ * Determines the highest decision level of the literals of the conflicting clause and moves the watches of the clause to the literals with the highest decision levels, thus the watch invariants hold
+ * after backtracking to (or below) the conflict level.
+ */
+std::size_t Solver::determineConflictLevel(ClauseIndex conflictingClause, std::size_t& numLiteralsOnConflictLevel, long& literalOnConflictLevel)
+{
+	watchLiteralsOfHighestDecisionLevels(conflictingClause);
+	const ClauseMetadata& clause = clauses[conflictingClause];
+	const long* clauseLiterals = getLiteralsOfClause(clause);
+
+	std::size_t conflictLevel = 0;
+	numLiteralsOnConflictLevel = 0;
+	for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals; ++literalPosition)
+	{
+		const long literal = clauseLiterals[literalPosition];
+		const std::size_t decisionLevelOfLiteral = variableAssignmentData[literalToVariable(literal)].decisionLevel;
+		if (decisionLevelOfLiteral > conflictLevel)
+		{
+			conflictLevel = decisionLevelOfLiteral;
+			numLiteralsOnConflictLevel = 1;
+			literalOnConflictLevel = literal;
+		}
+		else if (decisionLevelOfLiteral == conflictLevel)
+			++numLiteralsOnConflictLevel;
+	}
+	return conflictLevel;
+}
+
+void Solver::watchLiteralsOfHighestDecisionLevels(ClauseIndex clauseIndex)
+{
+	const ClauseMetadata& clause = clauses[clauseIndex];
+	if (clause.numLiterals == 2)
+		return;
+
+	const long* clauseLiterals = getLiteralsOfClause(clause);
+	const auto isOnHigherDecisionLevel = [&](std::uint32_t literalPosition, std::uint32_t otherLiteralPosition)
+	{
+		return variableAssignmentData[literalToVariable(clauseLiterals[literalPosition])].decisionLevel > variableAssignmentData[literalToVariable(clauseLiterals[otherLiteralPosition])].decisionLevel;
+	};
+
+	std::array<std::uint32_t, 2> positionsOfHighestDecisionLevels = clause.watchedLiteralPositions;
+	if (isOnHigherDecisionLevel(positionsOfHighestDecisionLevels[1], positionsOfHighestDecisionLevels[0]))
+		std::swap(positionsOfHighestDecisionLevels[0], positionsOfHighestDecisionLevels[1]);
+
+	for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals; ++literalPosition)
+	{
+		if (literalPosition == clause.watchedLiteralPositions[0] || literalPosition == clause.watchedLiteralPositions[1])
+			continue;
+
+		if (isOnHigherDecisionLevel(literalPosition, positionsOfHighestDecisionLevels[0]))
+		{
+			positionsOfHighestDecisionLevels[1] = positionsOfHighestDecisionLevels[0];
+			positionsOfHighestDecisionLevels[0] = literalPosition;
+		}
+		else if (isOnHigherDecisionLevel(literalPosition, positionsOfHighestDecisionLevels[1]))
+			positionsOfHighestDecisionLevels[1] = literalPosition;
+	}
+
+	for (const std::uint32_t literalPosition : positionsOfHighestDecisionLevels)
+	{
+		if (literalPosition == clause.watchedLiteralPositions[0] || literalPosition == clause.watchedLiteralPositions[1])
+			continue;
+
+		const std::size_t replacedWatchIndex = clause.watchedLiteralPositions[0] != positionsOfHighestDecisionLevels[0] && clause.watchedLiteralPositions[0] != positionsOfHighestDecisionLevels[1] ? 0 : 1;
+		replaceWatchedLiteral(clauseIndex, replacedWatchIndex, literalPosition);
+	}
+}
+
+void Solver::replaceWatchedLiteral(ClauseIndex clauseIndex, std::size_t watchIndex, std::uint32_t literalPosition)
+{
+	ClauseMetadata& clause = clauses[clauseIndex];
+	const long* clauseLiterals = getLiteralsOfClause(clause);
+	std::vector<Watcher>& watchersOfReplacedLiteral = watchers[literalToIndex(clauseLiterals[clause.watchedLiteralPositions[watchIndex]])];
+	watchersOfReplacedLiteral.erase(std::find_if(watchersOfReplacedLiteral.begin(), watchersOfReplacedLiteral.end(), [clauseIndex](const Watcher& watcher) { return watcher.clauseIndex == clauseIndex; }));
+
+	clause.watchedLiteralPositions[watchIndex] = literalPosition;
+	const long otherWatchedLiteral = clauseLiterals[clause.watchedLiteralPositions[1 - watchIndex]];
+	watchers[literalToIndex(clauseLiterals[literalPosition])].emplace_back(Watcher({ clauseIndex, otherWatchedLiteral, false }));
+}
+
+std::size_t Solver::determineMaximumDecisionLevelOfClause(const ClauseMetadata& clause, long excludedLiteral) const
+{
+	const long* clauseLiterals = getLiteralsOfClause(clause);
+	std::size_t maximumDecisionLevel = 0;
+	for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals; ++literalPosition)
+	{
+		if (clauseLiterals[literalPosition] != excludedLiteral)
+			maximumDecisionLevel = std::max(maximumDecisionLevel, variableAssignmentData[literalToVariable(clauseLiterals[literalPosition])].decisionLevel);
+	}
+	return maximumDecisionLevel;
+}
+
+std::optional<long> Solver::pickBranchingLiteral()
+{
+	const std::optional<std::size_t> branchingVariable = decisionHeuristic->pickBranchingVariable([this](std::size_t variable) { return isVariableAssigned(variable); });
+	if (!branchingVariable.has_value())
+		return std::nullopt;
+
+	const bool isPositivePolarity = areTargetPhasesUsedInActiveSearchMode() ? targetPhases[*branchingVariable] : savedPhases[*branchingVariable];
+	return isPositivePolarity ? static_cast<long>(*branchingVariable) : -static_cast<long>(*branchingVariable);
+}
+
+/*
+ * Every assumption is the decision of its own decision level, an assumption that is already satisfied opens an empty decision level instead. The search is unsatisfiable under the assumptions
+ * as soon as an assumption is falsified since its negation is implied by the formula and the prior assumptions.
+ */
+std::optional<long> Solver::pickAssumptionLiteral(bool& isAssumptionFalsified)
+{
+	while (getCurrentDecisionLevel() < assumptions.size())
+	{
+		const long assumption = assumptions[getCurrentDecisionLevel()];
+		if (getLiteralValue(assumption) == LiteralValue::Unassigned)
+			return assumption;
+		if (getLiteralValue(assumption) == LiteralValue::Falsified)
+		{
+			isAssumptionFalsified = true;
+			return std::nullopt;
+		}
+		decisionLevelStartPositionsInTrail.emplace_back(trail.size());
+	}
+	return std::nullopt;
+}
+
+/*
+ * The falsified assumption is implied by the formula and the assumptions decided on the decision levels below the current one, the assumptions (decisions) actually required for this implication are
+ * collected by following the reasons of the assignments backwards along the trail starting at the negation of the falsified assumption (https://doi.org/10.1016/S1571-0661(05)82542-3).
+ */
+void Solver::determineFailedAssumptions(long falsifiedAssumption)
+{
+	failedAssumptions.assign(1, falsifiedAssumption);
+	if (!variableAssignmentData[literalToVariable(falsifiedAssumption)].decisionLevel)
+		return;
+
+	markVariable(literalToVariable(falsifiedAssumption), VariableMarker::Seen);
+	for (std::size_t trailPosition = trail.size(); trailPosition-- > decisionLevelStartPositionsInTrail.front();)
+	{
+		const long literal = trail[trailPosition];
+		const VariableAssignmentData& assignmentData = variableAssignmentData[literalToVariable(literal)];
+		if (variableMarkers[literalToVariable(literal)] != VariableMarker::Seen)
+			continue;
+
+		// Every assignment without a reason above the root decision level is a decision and thus an assumption
+		if (assignmentData.reason == NO_CLAUSE)
+		{
+			failedAssumptions.emplace_back(literal);
+			continue;
+		}
+
+		const ClauseMetadata& reasonClause = clauses[assignmentData.reason];
+		const long* reasonClauseLiterals = getLiteralsOfClause(reasonClause);
+		for (std::uint32_t literalPosition = 0; literalPosition < reasonClause.numLiterals; ++literalPosition)
+		{
+			const std::size_t variableOfReason = literalToVariable(reasonClauseLiterals[literalPosition]);
+			if (variableMarkers[variableOfReason] == VariableMarker::Unmarked && variableAssignmentData[variableOfReason].decisionLevel)
+				markVariable(variableOfReason, VariableMarker::Seen);
+		}
+	}
+
+	for (const std::size_t variable : markedVariables)
+		variableMarkers[variable] = VariableMarker::Unmarked;
+	markedVariables.clear();
+}
+
+void Solver::increaseNumVariables(std::size_t numVariables)
+{
+	watchers.resize((numVariables + 1) * 2);
+	literalValues.resize((numVariables + 1) * 2, LiteralValue::Unassigned);
+	variableAssignmentData.resize(numVariables + 1, VariableAssignmentData({ 0, NO_CLAUSE, 0 }));
+	variableMarkers.resize(numVariables + 1, VariableMarker::Unmarked);
+	shrinkingStamps.resize(numVariables + 1, 0);
+	savedPhases.resize(numVariables + 1, configuration.isInitialPhasePositive);
+	targetPhases.resize(numVariables + 1, configuration.isInitialPhasePositive);
+	bestPhases.resize(numVariables + 1, configuration.isInitialPhasePositive);
+	decisionLevelStamps.resize(numVariables + 1, 0);
+	probingStamps.resize((numVariables + 1) * 2, 0);
+	perLiteralNumRootAssignmentsAtLastProbe.resize((numVariables + 1) * 2, SIZE_MAX);
+	for (const decisionHeuristics::BaseDecisionHeuristic::ptr& searchModeDecisionHeuristic : perSearchModeDecisionHeuristics)
+	{
+		if (searchModeDecisionHeuristic)
+			searchModeDecisionHeuristic->onNumVariablesIncreased(numVariables);
+	}
+	this->numVariables = numVariables;
+}
+
+bool Solver::areTargetPhasesUsedInActiveSearchMode() const noexcept
+{
+	return configuration.targetPhaseUsage == TargetPhaseUsage::Always || (configuration.targetPhaseUsage == TargetPhaseUsage::StableModeOnly && activeSearchMode == SearchMode::Stable);
+}
+
+/*
+ * The assignments on the trail prior to the conflicting decision level are conflict-free, the target phases record the largest such assignment since the last restart while
+ * the best phases record the largest such assignment since the last rephasing.
+ */
+void Solver::updateTargetAndBestPhases(std::size_t numConflictFreeAssignments)
+{
+	if (areTargetPhasesUsedInActiveSearchMode() && numConflictFreeAssignments > numAssignmentsOfTargetPhases)
+	{
+		for (std::size_t trailPosition = 0; trailPosition < numConflictFreeAssignments; ++trailPosition)
+			targetPhases[literalToVariable(trail[trailPosition])] = trail[trailPosition] > 0;
+		numAssignmentsOfTargetPhases = numConflictFreeAssignments;
+	}
+	if (configuration.optionalRephasingInterval.has_value() && numConflictFreeAssignments > numAssignmentsOfBestPhases)
+	{
+		for (std::size_t trailPosition = 0; trailPosition < numConflictFreeAssignments; ++trailPosition)
+			bestPhases[literalToVariable(trail[trailPosition])] = trail[trailPosition] > 0;
+		numAssignmentsOfBestPhases = numConflictFreeAssignments;
+	}
+}
+
+bool Solver::isRephasingDue() const noexcept
+{
+	return configuration.optionalRephasingInterval.has_value() && statistics.numConflicts >= numConflictsAtNextRephasing;
+}
+
+/*
+ * Rephasing according to (https://doi.org/10.1007/978-3-030-51825-7_27), the target phases are reset to the new saved phases and the tracking of the best phases starts anew.
+ */
+void Solver::rephase()
+{
+	constexpr std::array<RephasingStrategy, 5> rephasingSchedule = { RephasingStrategy::Original, RephasingStrategy::Inverted, RephasingStrategy::Best, RephasingStrategy::Walk, RephasingStrategy::Random };
+	constexpr std::array<RephasingStrategy, 4> rephasingScheduleWithoutWalk = { RephasingStrategy::Original, RephasingStrategy::Inverted, RephasingStrategy::Best, RephasingStrategy::Random };
+	const RephasingStrategy rephasingStrategy = configuration.localSearchEffortInPerMille ? rephasingSchedule[numRephases % rephasingSchedule.size()] : rephasingScheduleWithoutWalk[numRephases % rephasingScheduleWithoutWalk.size()];
+	switch (rephasingStrategy)
+	{
+		case RephasingStrategy::Original:
+			std::fill(savedPhases.begin(), savedPhases.end(), configuration.isInitialPhasePositive);
+			break;
+		case RephasingStrategy::Inverted:
+			std::fill(savedPhases.begin(), savedPhases.end(), !configuration.isInitialPhasePositive);
+			break;
+		case RephasingStrategy::Best:
+			savedPhases = bestPhases;
+			break;
+		case RephasingStrategy::Walk:
+			// The phases of the assignments above the root decision level would otherwise overwrite the determined phases once they are undone
+			backtrack(0);
+			savedPhases = bestPhases;
+			seedPhasesByLocalSearch(std::max(configuration.minimumLocalSearchEffort, (statistics.numPropagationTicks - numPropagationTicksAtLastLocalSearch) / 1000 * configuration.localSearchEffortInPerMille));
+			break;
+		case RephasingStrategy::Random:
+			for (char& savedPhase : savedPhases)
+				savedPhase = static_cast<char>(randomNumberGenerator() & 1);
+			break;
+	}
+	targetPhases = savedPhases;
+	numAssignmentsOfTargetPhases = 0;
+	numAssignmentsOfBestPhases = 0;
+
+	++numRephases;
+	++statistics.numRephasesPerStrategy[rephasingStrategy];
+	numConflictsAtNextRephasing = statistics.numConflicts + (numRephases + 1) * *configuration.optionalRephasingInterval;
+}
+
+/*
+ * Overwrites the saved phases with the assignment falsifying the fewest irredundant clauses found by a local search starting from the saved phases. The clauses satisfied on the root decision level are omitted while
+ * the literals falsified on the root decision level are removed from the remaining clauses, thus the variables assigned on the root decision level keep their phases.
+ */
+void Solver::seedPhasesByLocalSearch(std::size_t effort)
+{
+	std::size_t numTicks = 0;
+	LocalSearch::LocalSearchConfiguration localSearchConfiguration;
+	localSearchConfiguration.algorithm = configuration.localSearchAlgorithm;
+	localSearchConfiguration.randomSeed = static_cast<std::uint32_t>(randomNumberGenerator());
+	LocalSearch localSearch(numVariables, localSearchConfiguration);
+	localSearch.setResourceBudget(resourceBudget);
+
+	const auto isLiteralAssignedOnRootDecisionLevel = [this](const long literal)
+	{
+		return getLiteralValue(literal) != LiteralValue::Unassigned && !variableAssignmentData[literalToVariable(literal)].decisionLevel;
+	};
+	std::vector<long> unassignedClauseLiterals;
+	for (const ClauseMetadata& clause : clauses)
+	{
+		if (clause.isLearned || clause.isDeleted)
+			continue;
+
+		numTicks += 1 + budget::determineNumTicksOfSequentialAccess<long>(clause.numLiterals);
+		const long* clauseLiterals = getLiteralsOfClause(clause);
+		unassignedClauseLiterals.clear();
+		bool isClauseSatisfied = false;
+		for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals && !isClauseSatisfied; ++literalPosition)
+		{
+			const long literal = clauseLiterals[literalPosition];
+			isClauseSatisfied = isLiteralAssignedOnRootDecisionLevel(literal) && getLiteralValue(literal) == LiteralValue::Satisfied;
+			if (!isLiteralAssignedOnRootDecisionLevel(literal))
+				unassignedClauseLiterals.emplace_back(literal);
+		}
+		// A clause falsified on the root decision level is a conflict that is not yet analyzed by the search, which does not require better phases
+		if (!isClauseSatisfied && unassignedClauseLiterals.empty())
+			return;
+		if (!isClauseSatisfied)
+			localSearch.addClause(unassignedClauseLiterals);
+	}
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicks);
+
+	static_cast<void>(localSearch.search(savedPhases, effort > numTicks ? effort - numTicks : 0));
+	const LocalSearch::LocalSearchStatistics& localSearchStatistics = localSearch.getStatistics();
+	++statistics.localSearchStatistics.numSearches;
+	statistics.localSearchStatistics.numFlips += localSearchStatistics.numFlips;
+	statistics.localSearchStatistics.numTicks += numTicks + localSearchStatistics.numTicks;
+	statistics.localSearchStatistics.numFoundModels += localSearchStatistics.numFoundModels;
+	numPropagationTicksAtLastLocalSearch = statistics.numPropagationTicks;
+}
+
+void Solver::recordModel()
+{
+	model.assign(numVariables + 1, dimacs::ProblemDefinition::VariableValue::Unknown);
+	for (std::size_t variable = 1; variable <= numVariables; ++variable)
+	{
+		const LiteralValue valueOfPositiveLiteral = getLiteralValue(static_cast<long>(variable));
+		model[variable] = valueOfPositiveLiteral == LiteralValue::Satisfied ? dimacs::ProblemDefinition::VariableValue::High : dimacs::ProblemDefinition::VariableValue::Low;
+	}
+	if (modelReconstructionStack.isEmpty())
+		return;
+
+	// The model of the formula without the clauses eliminated during inprocessing is extended to a model of the complete formula
+	for (const long literal : modelReconstructionStack.reconstructModel(getModel()))
+		model[literalToVariable(literal)] = literal > 0 ? dimacs::ProblemDefinition::VariableValue::High : dimacs::ProblemDefinition::VariableValue::Low;
+}
+
+bool Solver::isInprocessingDue() const noexcept
+{
+	return (configuration.optionalInprocessingInterval.has_value() && statistics.numConflicts >= numConflictsAtNextInprocessing)
+		|| (configuration.optionalInprocessingTickInterval.has_value() && statistics.numPropagationTicks - numPropagationTicksAtLastInprocessing >= (statistics.numInprocessingRounds + 1) * *configuration.optionalInprocessingTickInterval);
+}
+
+/*
+ * Runs the enabled simplification passes on the root decision level. The effort of every pass is bounded by its share of the propagation ticks spent by the search since the previous round, thus the time
+ * spent on inprocessing stays proportional to the time spent on the search. Returns false if the formula was determined to be unsatisfiable.
+ */
+bool Solver::inprocess()
+{
+	backtrack(0);
+	const std::size_t numPropagationTicksOfSearch = statistics.numPropagationTicks - numPropagationTicksAtLastInprocessing;
+	std::array<std::size_t, 5> perInprocessingPassEfforts = { 0, 0, 0, 0, 0 };
+	for (std::size_t inprocessingPass = 0; inprocessingPass < perInprocessingPassEfforts.size(); ++inprocessingPass)
+	{
+		if (const std::size_t effortInPerMille = configuration.perInprocessingPassEffortsInPerMille[inprocessingPass]; effortInPerMille)
+			perInprocessingPassEfforts[inprocessingPass] = std::max(configuration.minimumInprocessingPassEffort, numPropagationTicksOfSearch / 1000 * effortInPerMille);
+	}
+	// The eliminated clauses are only redundant as long as the variables of their witnesses are not constrained by assumptions. Neither are they eliminated while a proof is recorded since their restoration
+	// cannot be justified in the DRAT proof: The witness of a set-blocked clause is a set of literals while a blocked clause is no longer a RAT on its blocking literal once learned clauses contain its negation.
+	if (!assumptions.empty() || proofWriter)
+	{
+		perInprocessingPassEfforts[InprocessingPass::BlockedClauseElimination] = 0;
+		perInprocessingPassEfforts[InprocessingPass::SetBlockedClauseElimination] = 0;
+	}
+	++statistics.numInprocessingRounds;
+	if (configuration.optionalInprocessingInterval.has_value())
+		numConflictsAtNextInprocessing = statistics.numConflicts + (statistics.numInprocessingRounds + 1) * *configuration.optionalInprocessingInterval;
+
+	wereClausesDeletedDuringInprocessing = false;
+	bool isFormulaSatisfiable = propagate() == NO_CLAUSE;
+	// The remaining passes are skipped once the search is cancelled, the search itself returns at its next poll
+	if (isFormulaSatisfiable && perInprocessingPassEfforts[InprocessingPass::Probing] && !isCancellationRequested())
+		isFormulaSatisfiable = probeLiterals(perInprocessingPassEfforts[InprocessingPass::Probing]);
+	if (isFormulaSatisfiable && perInprocessingPassEfforts[InprocessingPass::Subsumption] && !isCancellationRequested())
+		subsumeClauses(perInprocessingPassEfforts[InprocessingPass::Subsumption]);
+	if (isFormulaSatisfiable && perInprocessingPassEfforts[InprocessingPass::Vivification] && !isCancellationRequested())
+		isFormulaSatisfiable = vivifyClauses(perInprocessingPassEfforts[InprocessingPass::Vivification]);
+	if (isFormulaSatisfiable && perInprocessingPassEfforts[InprocessingPass::BlockedClauseElimination] && !isCancellationRequested())
+		eliminateBlockedClauses(perInprocessingPassEfforts[InprocessingPass::BlockedClauseElimination]);
+	if (isFormulaSatisfiable && perInprocessingPassEfforts[InprocessingPass::SetBlockedClauseElimination] && !isCancellationRequested())
+		eliminateSetBlockedClauses(perInprocessingPassEfforts[InprocessingPass::SetBlockedClauseElimination]);
+
+	if (wereClausesDeletedDuringInprocessing)
+		collectGarbage();
+	// The propagations of the probing do not contribute to the effort of the next round
+	numPropagationTicksAtLastInprocessing = statistics.numPropagationTicks;
+	return isFormulaSatisfiable;
+}
+
+/*
+ * Failed literal probing: A literal whose propagation leads to a conflict is falsified by every model of the formula, thus its negation can be assigned on the root decision level. The propagation of a
+ * successful probe p additionally yields the hyper-binary resolvents (-p l) of the literals l implied by non-binary clauses, which shortcut these implications in later propagations, as well as the literals
+ * implied by both polarities of the probed variable (lifting), which are implied by the formula.
+ *
+ * The roots of the binary implication graph (literals implying other literals by binary clauses while not being implied by any binary clause) are probed first since the probe of a root covers the probes
+ * of the literals it implies: A literal implied by a successful probe is not probed during the same pass, a literal probed in a previous pass is only probed again once further literals were assigned on the
+ * root decision level since then. Within both groups, the variables are visited in a round-robin fashion across the inprocessing rounds.
+ */
+bool Solver::probeLiterals(std::size_t effort)
+{
+	InprocessingPassStatistics& probingStatistics = statistics.perInprocessingPassStatistics[InprocessingPass::Probing];
+	const std::size_t numPropagationTicksAtStartOfProbing = statistics.numPropagationTicks;
+	std::size_t numTicks = 0;
+	// The temporary assignments of the probing should not overwrite the saved phases of the search
+	const std::vector<char> savedPhasesPriorToProbing = savedPhases;
+
+	const auto isLiteralContainedInBinaryClause = [this, &numTicks](const long literal)
+	{
+		const std::vector<Watcher>& watchersOfLiteral = watchers[literalToIndex(literal)];
+		numTicks += budget::determineNumTicksOfSequentialAccess<Watcher>(watchersOfLiteral.size());
+		return std::any_of(watchersOfLiteral.cbegin(), watchersOfLiteral.cend(), [this](const Watcher& watcher) { return watcher.isBinaryClause && !clauses[watcher.clauseIndex].isDeleted; });
+	};
+
+	// The literal of a variable that is probed first is the root literal if the variable has one
+	std::vector<long> firstProbedLiterals;
+	std::vector<long> firstProbedLiteralsOfNonRootVariables;
+	for (std::size_t i = 0; i < numVariables; ++i)
+	{
+		const std::size_t variable = (nextProbedVariable - 1 + i) % numVariables + 1;
+		if (isVariableAssigned(variable))
+			continue;
+
+		const auto positiveLiteral = static_cast<long>(variable);
+		const bool isPositiveLiteralContainedInBinaryClause = isLiteralContainedInBinaryClause(positiveLiteral);
+		const bool isNegativeLiteralContainedInBinaryClause = isLiteralContainedInBinaryClause(-positiveLiteral);
+		if (isPositiveLiteralContainedInBinaryClause != isNegativeLiteralContainedInBinaryClause)
+			firstProbedLiterals.emplace_back(isNegativeLiteralContainedInBinaryClause ? positiveLiteral : -positiveLiteral);
+		else
+			firstProbedLiteralsOfNonRootVariables.emplace_back(positiveLiteral);
+	}
+	firstProbedLiterals.insert(firstProbedLiterals.end(), firstProbedLiteralsOfNonRootVariables.cbegin(), firstProbedLiteralsOfNonRootVariables.cend());
+
+	const std::size_t stampAtStartOfProbing = currentProbingStamp;
+	std::vector<long> hyperBinaryResolventLiterals;
+	std::size_t numAddedHyperBinaryResolvents = 0;
+	std::vector<long> binaryClausePartnersOfProbe;
+	std::vector<long> commonImpliedLiterals;
+	bool isFormulaSatisfiable = true;
+	for (auto firstProbedLiteralIterator = firstProbedLiterals.cbegin(); firstProbedLiteralIterator != firstProbedLiterals.cend() && isFormulaSatisfiable; ++firstProbedLiteralIterator)
+	{
+		if (statistics.numPropagationTicks - numPropagationTicksAtStartOfProbing + numTicks >= effort || isCancellationRequested())
+			break;
+
+		const long firstProbedLiteral = *firstProbedLiteralIterator;
+		const std::size_t variable = literalToVariable(firstProbedLiteral);
+		nextProbedVariable = variable % numVariables + 1;
+
+		std::size_t stampOfFirstProbe = 0;
+		commonImpliedLiterals.clear();
+		for (const long probedLiteral : { firstProbedLiteral, -firstProbedLiteral })
+		{
+			if (isVariableAssigned(variable))
+				break;
+			if (probingStamps[literalToIndex(probedLiteral)] > stampAtStartOfProbing || perLiteralNumRootAssignmentsAtLastProbe[literalToIndex(probedLiteral)] == trail.size())
+				continue;
+
+			perLiteralNumRootAssignmentsAtLastProbe[literalToIndex(probedLiteral)] = trail.size();
+			const std::size_t stampOfProbe = ++currentProbingStamp;
+			const std::size_t trailPositionOfProbe = trail.size();
+			decisionLevelStartPositionsInTrail.emplace_back(trailPositionOfProbe);
+			assignLiteral(probedLiteral, NO_CLAUSE, 1);
+			if (propagate() != NO_CLAUSE)
+			{
+				backtrack(0);
+				commonImpliedLiterals.clear();
+				++probingStatistics.numDerivedUnitClauses;
+				if (proofWriter)
+					proofWriter->addClause({ -probedLiteral });
+				assignLiteral(-probedLiteral, NO_CLAUSE, 0);
+				isFormulaSatisfiable = propagate() == NO_CLAUSE;
+				break;
+			}
+
+			hyperBinaryResolventLiterals.clear();
+			const bool isHyperBinaryResolutionEnabled = configuration.isHyperBinaryResolutionDuringProbingEnabled && numAddedHyperBinaryResolvents < configuration.maximumNumHyperBinaryResolventsPerProbingPass;
+			const bool isFirstProbeOfVariable = probedLiteral == firstProbedLiteral;
+			for (std::size_t trailPosition = trailPositionOfProbe + 1; trailPosition < trail.size(); ++trailPosition)
+			{
+				const long impliedLiteral = trail[trailPosition];
+				if (!isFirstProbeOfVariable && stampOfFirstProbe && probingStamps[literalToIndex(impliedLiteral)] == stampOfFirstProbe)
+					commonImpliedLiterals.emplace_back(impliedLiteral);
+				probingStamps[literalToIndex(impliedLiteral)] = stampOfProbe;
+
+				// Every literal of the reason other than the implied one is falsified by the probe (or on the root decision level)
+				if (const ClauseIndex reason = variableAssignmentData[literalToVariable(impliedLiteral)].reason; isHyperBinaryResolutionEnabled && reason != NO_CLAUSE && clauses[reason].numLiterals > 2)
+					hyperBinaryResolventLiterals.emplace_back(impliedLiteral);
+			}
+			numTicks += budget::determineNumTicksOfSequentialAccess<long>(trail.size() - trailPositionOfProbe);
+			if (isFirstProbeOfVariable && configuration.isLiftingDuringProbingEnabled)
+				stampOfFirstProbe = stampOfProbe;
+			backtrack(0);
+
+			// The literals implied by a probe in a previous pass might have been implied by its hyper-binary resolvents only after their non-binary reasons (depending on the order of the watchers)
+			binaryClausePartnersOfProbe.clear();
+			if (!hyperBinaryResolventLiterals.empty())
+			{
+				const std::vector<Watcher>& watchersOfProbe = watchers[literalToIndex(-probedLiteral)];
+				numTicks += budget::determineNumTicksOfSequentialAccess<Watcher>(watchersOfProbe.size());
+				for (const Watcher& watcher : watchersOfProbe)
+				{
+					if (watcher.isBinaryClause && !clauses[watcher.clauseIndex].isDeleted)
+						binaryClausePartnersOfProbe.emplace_back(watcher.blockingLiteral);
+				}
+				std::sort(binaryClausePartnersOfProbe.begin(), binaryClausePartnersOfProbe.end());
+			}
+			/*
+			 * The resolvents are placed in the tier-2 rather than in the tier determined by their LBD, which would always be the core tier for binary clauses, thus resolvents not used during conflict analysis are
+			 * demoted to the local tier and eventually deleted by the reductions of the clause database.
+			 */
+			for (auto impliedLiteralIterator = hyperBinaryResolventLiterals.cbegin(); impliedLiteralIterator != hyperBinaryResolventLiterals.cend() && numAddedHyperBinaryResolvents < configuration.maximumNumHyperBinaryResolventsPerProbingPass; ++impliedLiteralIterator)
+			{
+				const long impliedLiteral = *impliedLiteralIterator;
+				if (std::binary_search(binaryClausePartnersOfProbe.cbegin(), binaryClausePartnersOfProbe.cend(), impliedLiteral))
+					continue;
+
+				const std::vector<long> hyperBinaryResolvent = { -probedLiteral, impliedLiteral };
+				if (proofWriter)
+					proofWriter->addClause(hyperBinaryResolvent);
+				const ClauseIndex hyperBinaryResolventIndex = addClauseToArena(hyperBinaryResolvent, true, 1);
+				moveLearnedClauseToTier(clauses[hyperBinaryResolventIndex], ClauseTier::TierTwo);
+				attachClause(hyperBinaryResolventIndex);
+				++numAddedHyperBinaryResolvents;
+				++probingStatistics.numAddedClauses;
+			}
+		}
+
+		// The common implied literal l is derived from the clauses (l -p) and (l p) which are implied by the propagations of both probes
+		for (auto commonImpliedLiteralIterator = commonImpliedLiterals.cbegin(); commonImpliedLiteralIterator != commonImpliedLiterals.cend() && isFormulaSatisfiable; ++commonImpliedLiteralIterator)
+		{
+			const long commonImpliedLiteral = *commonImpliedLiteralIterator;
+			if (getLiteralValue(commonImpliedLiteral) == LiteralValue::Satisfied)
+				continue;
+
+			++probingStatistics.numDerivedUnitClauses;
+			if (proofWriter)
+			{
+				proofWriter->addClause({ commonImpliedLiteral, -firstProbedLiteral });
+				proofWriter->addClause({ commonImpliedLiteral, firstProbedLiteral });
+				proofWriter->addClause({ commonImpliedLiteral });
+				proofWriter->deleteClause({ commonImpliedLiteral, -firstProbedLiteral });
+				proofWriter->deleteClause({ commonImpliedLiteral, firstProbedLiteral });
+			}
+			// The negation of the common implied literal might have been implied by a previously assigned common implied literal
+			if (getLiteralValue(commonImpliedLiteral) == LiteralValue::Falsified)
+				isFormulaSatisfiable = false;
+			else
+			{
+				assignLiteral(commonImpliedLiteral, NO_CLAUSE, 0);
+				isFormulaSatisfiable = propagate() == NO_CLAUSE;
+			}
+		}
+	}
+
+	savedPhases = savedPhasesPriorToProbing;
+	probingStatistics.numTicks += numTicks + statistics.numPropagationTicks - numPropagationTicksAtStartOfProbing;
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicks);
+	return isFormulaSatisfiable;
+}
+
+/*
+ * Removes the clauses (irredundant as well as learned ones) subsumed by an irredundant clause. The irredundant clauses are processed in ascending order of their size while the candidates subsumed by a clause C
+ * are the clauses containing the literal of C with the fewest occurrences.
+ */
+void Solver::subsumeClauses(std::size_t effort)
+{
+	InprocessingPassStatistics& subsumptionStatistics = statistics.perInprocessingPassStatistics[InprocessingPass::Subsumption];
+	std::size_t numTicks = 0;
+
+	std::vector<std::vector<ClauseIndex>> perLiteralOccurrences(watchers.size());
+	std::vector<ClauseIndex> subsumingClauseCandidates;
+	for (ClauseIndex clauseIndex = 0; clauseIndex < clauses.size(); ++clauseIndex)
+	{
+		const ClauseMetadata& clause = clauses[clauseIndex];
+		if (clause.isDeleted)
+			continue;
+
+		// Every appended occurrence is assumed to touch the cache line at the end of its occurrence list
+		numTicks += 1 + budget::determineNumTicksOfSequentialAccess<long>(clause.numLiterals) + clause.numLiterals;
+		const long* clauseLiterals = getLiteralsOfClause(clause);
+		for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals; ++literalPosition)
+			perLiteralOccurrences[literalToIndex(clauseLiterals[literalPosition])].emplace_back(clauseIndex);
+		if (!clause.isLearned)
+			subsumingClauseCandidates.emplace_back(clauseIndex);
+	}
+	std::stable_sort(subsumingClauseCandidates.begin(), subsumingClauseCandidates.end(), [this](const ClauseIndex lClauseIndex, const ClauseIndex rClauseIndex)
+	{
+		return clauses[lClauseIndex].numLiterals < clauses[rClauseIndex].numLiterals;
+	});
+
+	std::vector<char> isLiteralMarked(watchers.size(), 0);
+	for (auto candidateIterator = subsumingClauseCandidates.cbegin(); candidateIterator != subsumingClauseCandidates.cend() && numTicks < effort; ++candidateIterator)
+	{
+		const ClauseMetadata& subsumingClause = clauses[*candidateIterator];
+		if (subsumingClause.isDeleted)
+			continue;
+
+		const long* subsumingClauseLiterals = getLiteralsOfClause(subsumingClause);
+		const long* literalWithFewestOccurrences = std::min_element(subsumingClauseLiterals, subsumingClauseLiterals + subsumingClause.numLiterals, [&perLiteralOccurrences](const long lLiteral, const long rLiteral)
+		{
+			return perLiteralOccurrences[literalToIndex(lLiteral)].size() < perLiteralOccurrences[literalToIndex(rLiteral)].size();
+		});
+		for (std::uint32_t literalPosition = 0; literalPosition < subsumingClause.numLiterals; ++literalPosition)
+			isLiteralMarked[literalToIndex(subsumingClauseLiterals[literalPosition])] = 1;
+
+		const std::vector<ClauseIndex>& subsumedClauseCandidates = perLiteralOccurrences[literalToIndex(*literalWithFewestOccurrences)];
+		numTicks += 1 + budget::determineNumTicksOfSequentialAccess<long>(subsumingClause.numLiterals) + budget::determineNumTicksOfSequentialAccess<ClauseIndex>(subsumedClauseCandidates.size());
+		for (const ClauseIndex subsumedClauseCandidate : subsumedClauseCandidates)
+		{
+			++numTicks;
+			const ClauseMetadata& candidateClause = clauses[subsumedClauseCandidate];
+			if (subsumedClauseCandidate == *candidateIterator || candidateClause.isDeleted || candidateClause.numLiterals < subsumingClause.numLiterals)
+				continue;
+
+			numTicks += budget::determineNumTicksOfSequentialAccess<long>(candidateClause.numLiterals);
+			const long* candidateClauseLiterals = getLiteralsOfClause(candidateClause);
+			const auto numMarkedLiterals = static_cast<std::size_t>(std::count_if(candidateClauseLiterals, candidateClauseLiterals + candidateClause.numLiterals, [this, &isLiteralMarked](const long literal)
+			{
+				return isLiteralMarked[literalToIndex(literal)];
+			}));
+			if (numMarkedLiterals == subsumingClause.numLiterals)
+			{
+				deleteClause(subsumedClauseCandidate);
+				wereClausesDeletedDuringInprocessing = true;
+				++subsumptionStatistics.numRemovedClauses;
+			}
+		}
+
+		for (std::uint32_t literalPosition = 0; literalPosition < subsumingClause.numLiterals; ++literalPosition)
+			isLiteralMarked[literalToIndex(subsumingClauseLiterals[literalPosition])] = 0;
+	}
+	subsumptionStatistics.numTicks += numTicks;
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicks);
+}
+
+/*
+ * Vivification (https://doi.org/10.24963/ijcai.2017/99): The negations of the literals of a candidate clause are propagated one after another without the clause itself, a literal falsified by the propagation
+ * can be removed while a conflict or a satisfied literal shows that the literals processed so far already form a (RUP) implied subset of the clause. The literals of the candidates are ordered by their number
+ * of occurrences among the candidates and the candidates are processed in lexicographic order, thus consecutive candidates with a common prefix reuse the decision levels of its negated literals.
+ * Candidates not vivified so far are preferred, learned clauses implied by the remaining clauses without being shortened are removed. Returns false if the formula was determined to be unsatisfiable.
+ */
+bool Solver::vivifyClauses(std::size_t effort)
+{
+	InprocessingPassStatistics& vivificationStatistics = statistics.perInprocessingPassStatistics[InprocessingPass::Vivification];
+	const std::size_t numPropagationTicksAtStartOfVivification = statistics.numPropagationTicks;
+	std::size_t numTicks = 0;
+
+	std::vector<ClauseIndex> candidateClauseIndices;
+	bool wasEveryCandidateVivified = true;
+	for (ClauseIndex clauseIndex = 0; clauseIndex < clauses.size(); ++clauseIndex)
+	{
+		++numTicks;
+		const ClauseMetadata& clause = clauses[clauseIndex];
+		if (clause.isDeleted || clause.numLiterals < 3 || !(clause.isLearned ? configuration.isVivificationEnabledPerLearnedClauseTier[clause.tier] : configuration.isVivificationOfIrredundantClausesEnabled))
+			continue;
+
+		candidateClauseIndices.emplace_back(clauseIndex);
+		wasEveryCandidateVivified &= clause.wasVivified;
+	}
+	if (wasEveryCandidateVivified)
+	{
+		for (const ClauseIndex clauseIndex : candidateClauseIndices)
+			clauses[clauseIndex].wasVivified = false;
+	}
+	candidateClauseIndices.erase(std::remove_if(candidateClauseIndices.begin(), candidateClauseIndices.end(), [this](const ClauseIndex clauseIndex) { return clauses[clauseIndex].wasVivified; }), candidateClauseIndices.end());
+
+	// The literals of the clauses are read-only, thus the ordered literals of the candidates are stored separately
+	std::vector<long> orderedCandidateLiterals;
+	std::vector<std::size_t> perCandidateLiteralsOffsets;
+	std::vector<std::size_t> perLiteralNumOccurrences(watchers.size(), 0);
+	perCandidateLiteralsOffsets.reserve(candidateClauseIndices.size() + 1);
+	for (const ClauseIndex clauseIndex : candidateClauseIndices)
+	{
+		const ClauseMetadata& clause = clauses[clauseIndex];
+		const long* clauseLiterals = getLiteralsOfClause(clause);
+		numTicks += budget::determineNumTicksOfSequentialAccess<long>(clause.numLiterals) + clause.numLiterals;
+		perCandidateLiteralsOffsets.emplace_back(orderedCandidateLiterals.size());
+		orderedCandidateLiterals.insert(orderedCandidateLiterals.end(), clauseLiterals, clauseLiterals + clause.numLiterals);
+		for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals; ++literalPosition)
+			++perLiteralNumOccurrences[literalToIndex(clauseLiterals[literalPosition])];
+	}
+	perCandidateLiteralsOffsets.emplace_back(orderedCandidateLiterals.size());
+
+	const auto isLiteralOrderedFirst = [&perLiteralNumOccurrences](const long lLiteral, const long rLiteral)
+	{
+		const std::size_t lNumOccurrences = perLiteralNumOccurrences[literalToIndex(lLiteral)];
+		const std::size_t rNumOccurrences = perLiteralNumOccurrences[literalToIndex(rLiteral)];
+		return lNumOccurrences != rNumOccurrences ? lNumOccurrences > rNumOccurrences : literalToIndex(lLiteral) < literalToIndex(rLiteral);
+	};
+	for (std::size_t candidateIndex = 0; candidateIndex < candidateClauseIndices.size(); ++candidateIndex)
+		std::sort(orderedCandidateLiterals.begin() + static_cast<std::ptrdiff_t>(perCandidateLiteralsOffsets[candidateIndex]), orderedCandidateLiterals.begin() + static_cast<std::ptrdiff_t>(perCandidateLiteralsOffsets[candidateIndex + 1]), isLiteralOrderedFirst);
+
+	std::vector<std::size_t> candidateOrder(candidateClauseIndices.size());
+	std::iota(candidateOrder.begin(), candidateOrder.end(), 0);
+	std::sort(candidateOrder.begin(), candidateOrder.end(), [&orderedCandidateLiterals, &perCandidateLiteralsOffsets, &isLiteralOrderedFirst](const std::size_t lCandidateIndex, const std::size_t rCandidateIndex)
+	{
+		return std::lexicographical_compare(orderedCandidateLiterals.cbegin() + static_cast<std::ptrdiff_t>(perCandidateLiteralsOffsets[lCandidateIndex]), orderedCandidateLiterals.cbegin() + static_cast<std::ptrdiff_t>(perCandidateLiteralsOffsets[lCandidateIndex + 1]),
+			orderedCandidateLiterals.cbegin() + static_cast<std::ptrdiff_t>(perCandidateLiteralsOffsets[rCandidateIndex]), orderedCandidateLiterals.cbegin() + static_cast<std::ptrdiff_t>(perCandidateLiteralsOffsets[rCandidateIndex + 1]), isLiteralOrderedFirst);
+	});
+	numTicks += budget::determineNumTicksOfSequentialAccess<long>(orderedCandidateLiterals.size()) + candidateClauseIndices.size();
+
+	// The temporary assignments of the vivification should not overwrite the saved phases of the search
+	const std::vector<char> savedPhasesPriorToVivification = savedPhases;
+	bool isFormulaSatisfiable = true;
+	for (auto candidateIterator = candidateOrder.cbegin(); candidateIterator != candidateOrder.cend() && isFormulaSatisfiable && numTicks + statistics.numPropagationTicks - numPropagationTicksAtStartOfVivification < effort && !isCancellationRequested(); ++candidateIterator)
+	{
+		const ClauseIndex clauseIndex = candidateClauseIndices[*candidateIterator];
+		const long* orderedClauseLiterals = orderedCandidateLiterals.data() + perCandidateLiteralsOffsets[*candidateIterator];
+		const std::uint32_t numLiterals = clauses[clauseIndex].numLiterals;
+		clauses[clauseIndex].wasVivified = true;
+		++numTicks;
+		if (std::any_of(orderedClauseLiterals, orderedClauseLiterals + numLiterals, [this](const long literal) { return getLiteralValue(literal) == LiteralValue::Satisfied && !variableAssignmentData[literalToVariable(literal)].decisionLevel; }))
+			continue;
+
+		detachClause(clauseIndex, numTicks);
+		bool isClauseImplied = false;
+		const std::vector<long> vivifiedClauseLiterals = vivifyClause(clauseIndex, orderedClauseLiterals, numLiterals, isClauseImplied);
+		if (vivifiedClauseLiterals.size() == numLiterals)
+		{
+			// A learned clause implied by the remaining clauses does not strengthen the propagation
+			if (isClauseImplied && clauses[clauseIndex].isLearned)
+			{
+				deleteClause(clauseIndex);
+				wereClausesDeletedDuringInprocessing = true;
+				++vivificationStatistics.numRemovedClauses;
+			}
+			else
+				attachClause(clauseIndex);
+			continue;
+		}
+
+		backtrack(0);
+		if (proofWriter)
+			proofWriter->addClause(vivifiedClauseLiterals);
+		const ClauseMetadata vivifiedClause = clauses[clauseIndex];
+		deleteClause(clauseIndex);
+		wereClausesDeletedDuringInprocessing = true;
+		vivificationStatistics.numRemovedLiterals += numLiterals - vivifiedClauseLiterals.size();
+		if (vivifiedClauseLiterals.size() == 1)
+		{
+			++vivificationStatistics.numDerivedUnitClauses;
+			assignLiteral(vivifiedClauseLiterals.front(), NO_CLAUSE, 0);
+			isFormulaSatisfiable = propagate() == NO_CLAUSE;
+			continue;
+		}
+
+		const ClauseIndex strengthenedClauseIndex = addClauseToArena(vivifiedClauseLiterals, vivifiedClause.isLearned, 1);
+		ClauseMetadata& strengthenedClause = clauses[strengthenedClauseIndex];
+		strengthenedClause.wasVivified = true;
+		if (strengthenedClause.isLearned)
+		{
+			strengthenedClause.literalBlockDistance = std::min(vivifiedClause.literalBlockDistance, strengthenedClause.numLiterals);
+			moveLearnedClauseToTier(strengthenedClause, std::min(vivifiedClause.tier, determineTierOfLearnedClause(strengthenedClause.literalBlockDistance)));
+		}
+		attachClause(strengthenedClauseIndex);
+	}
+	backtrack(0);
+	savedPhases = savedPhasesPriorToVivification;
+
+	vivificationStatistics.numTicks += numTicks + statistics.numPropagationTicks - numPropagationTicksAtStartOfVivification;
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicks);
+	return isFormulaSatisfiable;
+}
+
+/*
+ * Determines the implied subset of the given (detached) clause, whose literals are processed in the given order: The decision levels of the previously vivified clause are reused as long as their decisions
+ * are the negations of the leading literals of the clause. Since the clause is not watched during the vivification, all implications are derived from the remaining clauses. Sets the given flag if a literal
+ * of the clause is implied by the negations of the preceding literals.
+ */
+std::vector<long> Solver::vivifyClause(ClauseIndex clauseIndex, const long* orderedClauseLiterals, std::uint32_t numLiterals, bool& isClauseImplied)
+{
+	std::size_t numReusableDecisionLevels = 0;
+	while (numReusableDecisionLevels < std::min<std::size_t>(getCurrentDecisionLevel(), numLiterals) && trail[decisionLevelStartPositionsInTrail[numReusableDecisionLevels]] == -orderedClauseLiterals[numReusableDecisionLevels])
+		++numReusableDecisionLevels;
+	// An assignment implied by the clause itself (while it was still watched) cannot be used to justify its own vivification
+	for (std::uint32_t literalPosition = 0; literalPosition < numLiterals; ++literalPosition)
+	{
+		const VariableAssignmentData& assignmentData = variableAssignmentData[literalToVariable(orderedClauseLiterals[literalPosition])];
+		if (isVariableAssigned(literalToVariable(orderedClauseLiterals[literalPosition])) && assignmentData.reason == clauseIndex)
+			numReusableDecisionLevels = std::min(numReusableDecisionLevels, assignmentData.decisionLevel - 1);
+	}
+	backtrack(numReusableDecisionLevels);
+
+	std::vector<long> vivifiedClauseLiterals;
+	isClauseImplied = false;
+	for (std::uint32_t literalPosition = 0; literalPosition < numLiterals; ++literalPosition)
+	{
+		const long literal = orderedClauseLiterals[literalPosition];
+		const LiteralValue literalValue = getLiteralValue(literal);
+		if (literalValue == LiteralValue::Satisfied)
+		{
+			vivifiedClauseLiterals.emplace_back(literal);
+			isClauseImplied = true;
+			break;
+		}
+		if (literalValue == LiteralValue::Falsified)
+		{
+			// The negated literals of the reused decision levels are the only decisions on the trail
+			const VariableAssignmentData& assignmentData = variableAssignmentData[literalToVariable(literal)];
+			if (assignmentData.decisionLevel && assignmentData.reason == NO_CLAUSE)
+				vivifiedClauseLiterals.emplace_back(literal);
+			continue;
+		}
+
+		vivifiedClauseLiterals.emplace_back(literal);
+		// A conflict caused by the negation of the last literal would not remove any further literal
+		if (literalPosition + 1 == numLiterals)
+			break;
+
+		decisionLevelStartPositionsInTrail.emplace_back(trail.size());
+		assignLiteral(-literal, NO_CLAUSE, getCurrentDecisionLevel());
+		if (propagate() != NO_CLAUSE)
+		{
+			backtrack(getCurrentDecisionLevel() - 1);
+			break;
+		}
+	}
+	return vivifiedClauseLiterals;
+}
+
+/*
+ * Blocked clause elimination on the irredundant clauses (with the literals falsified on the root decision level removed) using the literal occurrence based eliminator of the preprocessing. The learned clauses
+ * can be kept since they are implied by the original formula, whose models are derived from the models of the reduced formula by the model reconstruction stack.
+ */
+void Solver::eliminateBlockedClauses(std::size_t effort)
+{
+	InprocessingPassStatistics& blockedClauseEliminationStatistics = statistics.perInprocessingPassStatistics[InprocessingPass::BlockedClauseElimination];
+	std::size_t numTicks = 0;
+	std::vector<ClauseIndex> clauseIndicesInProblemDefinition;
+	const dimacs::ProblemDefinition::ptr problemDefinition = createProblemDefinitionOfIrredundantClauses(clauseIndicesInProblemDefinition, numTicks);
+	// The ticks of the checks of the candidates are charged to the budget by the eliminator itself
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicks);
+	blockedClauseElimination::LiteralOccurrenceBlockedClauseEliminator blockedClauseEliminator(problemDefinition);
+	blockedClauseEliminator.setResourceBudget(resourceBudget);
+	const blockedClauseElimination::BlockingLiteralGenerator::ptr blockingLiteralGenerator = blockedClauseElimination::BlockingLiteralGenerator::usingMinimumClauseOverlapForLiteralSelection();
+
+	const std::size_t numCandidates = clauseIndicesInProblemDefinition.size();
+	std::size_t numCheckedCandidates = 0;
+	for (; numCheckedCandidates < numCandidates && numTicks < effort && !isCancellationRequested(); ++numCheckedCandidates)
+	{
+		const std::size_t candidateIndex = (nextBlockedClauseEliminationCandidate + numCheckedCandidates) % numCandidates;
+		const std::vector<long>& candidateClauseLiterals = problemDefinition->getClauseByIndexInFormula(candidateIndex)->literals;
+		const std::size_t numTicksOfEliminatorPriorToCheck = blockedClauseEliminator.getNumTicks();
+		const std::optional<long> blockingLiteral = blockedClauseEliminator.determineBlockingLiteralOfClause(candidateIndex, *blockingLiteralGenerator);
+		numTicks += blockedClauseEliminator.getNumTicks() - numTicksOfEliminatorPriorToCheck;
+		if (blockingLiteral.has_value())
+		{
+			modelReconstructionStack.addBlockedClause(*blockingLiteral, candidateClauseLiterals);
+			problemDefinition->removeClause(candidateIndex);
+			deleteClause(clauseIndicesInProblemDefinition[candidateIndex]);
+			wereClausesDeletedDuringInprocessing = true;
+			++blockedClauseEliminationStatistics.numRemovedClauses;
+		}
+	}
+	nextBlockedClauseEliminationCandidate = numCandidates ? (nextBlockedClauseEliminationCandidate + numCheckedCandidates) % numCandidates : 0;
+	blockedClauseEliminationStatistics.numTicks += numTicks;
+}
+
+/*
+ * Set blocked clause elimination (https://doi.org/10.1007/978-3-030-24258-9_13) on the irredundant clauses, the search for a blocking set is restricted to candidates of limited size since the number of
+ * candidates grows exponentially with their size.
+ */
+void Solver::eliminateSetBlockedClauses(std::size_t effort)
+{
+	InprocessingPassStatistics& setBlockedClauseEliminationStatistics = statistics.perInprocessingPassStatistics[InprocessingPass::SetBlockedClauseElimination];
+	std::size_t numTicks = 0;
+	std::vector<ClauseIndex> clauseIndicesInProblemDefinition;
+	const dimacs::ProblemDefinition::ptr problemDefinition = createProblemDefinitionOfIrredundantClauses(clauseIndicesInProblemDefinition, numTicks);
+	if (resourceBudget)
+		resourceBudget->chargeTicks(numTicks);
+	setBlockedClauseElimination::LiteralOccurrenceSetBlockedClauseEliminator setBlockedClauseEliminator(problemDefinition);
+	setBlockedClauseEliminator.setResourceBudget(resourceBudget);
+	const setBlockedClauseElimination::LiteralOccurrenceBlockingSetCandidateGenerator::ptr candidateGenerator = setBlockedClauseElimination::LiteralOccurrenceBlockingSetCandidateGenerator::usingMinimumClauseOverlapForLiteralSelection();
+	const auto candidateSizeRestriction = setBlockedClauseElimination::BaseBlockingSetCandidateGenerator::CandidateSizeRestriction({ 1, configuration.maximumSizeOfInprocessingBlockingSets });
+
+	const std::size_t numCandidates = clauseIndicesInProblemDefinition.size();
+	std::size_t numCheckedCandidates = 0;
+	for (; numCheckedCandidates < numCandidates && numTicks < effort && !isCancellationRequested(); ++numCheckedCandidates)
+	{
+		const std::size_t candidateIndex = (nextSetBlockedClauseEliminationCandidate + numCheckedCandidates) % numCandidates;
+		const std::vector<long>& candidateClauseLiterals = problemDefinition->getClauseByIndexInFormula(candidateIndex)->literals;
+		const std::size_t numTicksOfEliminatorPriorToCheck = setBlockedClauseEliminator.getNumTicks();
+		const std::optional<setBlockedClauseElimination::BaseSetBlockedClauseEliminator::FoundBlockingSet> blockingSet = setBlockedClauseEliminator.determineBlockingSet(candidateIndex, *candidateGenerator, candidateSizeRestriction);
+		numTicks += setBlockedClauseEliminator.getNumTicks() - numTicksOfEliminatorPriorToCheck;
+		if (blockingSet.has_value() && !blockingSet->empty())
+		{
+			modelReconstructionStack.addSetBlockedClause(*blockingSet, candidateClauseLiterals);
+			problemDefinition->removeClause(candidateIndex);
+			deleteClause(clauseIndicesInProblemDefinition[candidateIndex]);
+			wereClausesDeletedDuringInprocessing = true;
+			++setBlockedClauseEliminationStatistics.numRemovedClauses;
+		}
+	}
+	nextSetBlockedClauseEliminationCandidate = numCandidates ? (nextSetBlockedClauseEliminationCandidate + numCheckedCandidates) % numCandidates : 0;
+	setBlockedClauseEliminationStatistics.numTicks += numTicks;
+}
+
+/*
+ * Clauses satisfied on the root decision level are omitted while the literals falsified on the root decision level are removed from the remaining clauses. Since the variables assigned on the root decision level
+ * are thus not part of any eliminated clause, their assignment is never changed by the model reconstruction.
+ */
+dimacs::ProblemDefinition::ptr Solver::createProblemDefinitionOfIrredundantClauses(std::vector<ClauseIndex>& clauseIndicesInProblemDefinition, std::size_t& numTicks) const
+{
+	std::vector<std::vector<long>> literalsOfIrredundantClauses;
+	for (ClauseIndex clauseIndex = 0; clauseIndex < clauses.size(); ++clauseIndex)
+	{
+		const ClauseMetadata& clause = clauses[clauseIndex];
+		if (clause.isLearned || clause.isDeleted)
+			continue;
+
+		numTicks += 1 + budget::determineNumTicksOfSequentialAccess<long>(clause.numLiterals);
+		const long* clauseLiterals = getLiteralsOfClause(clause);
+		std::vector<long> unassignedClauseLiterals;
+		bool isClauseSatisfied = false;
+		for (std::uint32_t literalPosition = 0; literalPosition < clause.numLiterals && !isClauseSatisfied; ++literalPosition)
+		{
+			const LiteralValue literalValue = getLiteralValue(clauseLiterals[literalPosition]);
+			isClauseSatisfied = literalValue == LiteralValue::Satisfied;
+			if (literalValue == LiteralValue::Unassigned)
+				unassignedClauseLiterals.emplace_back(clauseLiterals[literalPosition]);
+		}
+		if (isClauseSatisfied)
+			continue;
+
+		// Every literal of the added clause is recorded in the node based literal occurrence lookup of the problem definition
+		numTicks += budget::determineNumTicksOfNodeBasedAccess(unassignedClauseLiterals.size());
+		clauseIndicesInProblemDefinition.emplace_back(clauseIndex);
+		literalsOfIrredundantClauses.emplace_back(std::move(unassignedClauseLiterals));
+	}
+
+	auto problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numVariables, literalsOfIrredundantClauses.size());
+	for (std::size_t clauseIndexInProblemDefinition = 0; clauseIndexInProblemDefinition < literalsOfIrredundantClauses.size(); ++clauseIndexInProblemDefinition)
+		problemDefinition->addClause(clauseIndexInProblemDefinition, dimacs::ProblemDefinition::Clause(std::move(literalsOfIrredundantClauses[clauseIndexInProblemDefinition])));
+	return problemDefinition;
+}
+
+/*
+ * Adds the clauses eliminated during inprocessing back to the formula (in the reverse order of their elimination) and clears the model reconstruction stack. The restored clauses are not recorded in the proof
+ * since clauses are only eliminated during inprocessing while no proof is recorded.
+ */
+bool Solver::restoreEliminatedClauses()
+{
+	backtrack(0);
+	bool isFormulaSatisfiable = true;
+	for (std::size_t entryIndex = modelReconstructionStack.getNumEntries(); entryIndex > 0 && isFormulaSatisfiable; --entryIndex)
+	{
+		++statistics.numRestoredEliminatedClauses;
+		isFormulaSatisfiable = addOriginalClause(modelReconstructionStack.getClauseOfEntry(entryIndex - 1));
+	}
+	modelReconstructionStack.clear();
+	return isFormulaSatisfiable;
+}
+
+bool Solver::isSearchModeSwitchDue() const noexcept
+{
+	return perSearchModeDecisionHeuristics[SearchMode::Stable] && statistics.numConflicts >= numConflictsAtNextSearchModeSwitch;
+}
+
+/*
+ * The search restarts from the root decision level with the decision heuristic of the other search mode, the length of the next phase (in conflicts) is doubled after
+ * every phase in the stable search mode.
+ */
+void Solver::switchSearchMode()
+{
+	backtrack(0);
+	recordDurationOfActiveSearchMode();
+	if (activeSearchMode == SearchMode::Stable)
+		searchModeSwitchConflictInterval *= 2;
+
+	activeSearchMode = activeSearchMode == SearchMode::Focused ? SearchMode::Stable : SearchMode::Focused;
+	numAssignmentsOfTargetPhases = 0;
+	numConflictsAtNextSearchModeSwitch = statistics.numConflicts + searchModeSwitchConflictInterval;
+	decisionHeuristic = perSearchModeDecisionHeuristics[activeSearchMode].get();
+	decisionHeuristic->onActivation();
+	restartPolicy = perSearchModeRestartPolicies[activeSearchMode].get();
+	if (restartPolicy)
+		restartPolicy->onRestart();
+	++statistics.perSearchModeDecisionHeuristicStatistics[activeSearchMode].numActivations;
+}
+
+void Solver::recordDurationOfActiveSearchMode()
+{
+	const std::chrono::time_point<std::chrono::steady_clock> currentTime = std::chrono::steady_clock::now();
+	statistics.perSearchModeDecisionHeuristicStatistics[activeSearchMode].durationOfActivePhases += currentTime - activationTimeOfSearchMode;
+	activationTimeOfSearchMode = currentTime;
+}
+
+void Solver::restart()
+{
+	++statistics.numRestarts;
+	const std::size_t numReusableDecisionLevels = configuration.isTrailReuseEnabled ? determineNumReusableDecisionLevels() : 0;
+	if (numReusableDecisionLevels)
+	{
+		++statistics.numRestartsWithReusedTrail;
+		statistics.numReusedDecisionLevels += numReusableDecisionLevels;
+	}
+	backtrack(numReusableDecisionLevels);
+	numAssignmentsOfTargetPhases = 0;
+	restartPolicy->onRestart();
+}
+
+void Solver::exportLearnedClause(const std::vector<long>& learnedClauseLiterals, std::size_t literalBlockDistance)
+{
+	if (literalBlockDistance > configuration.maximumLiteralBlockDistanceOfExportedClauses || learnedClauseLiterals.size() > configuration.maximumSizeOfExportedClauses)
+		return;
+	if (clauseExchange->exportClause(workerIndexInClauseExchange, learnedClauseLiterals.data(), learnedClauseLiterals.size(), static_cast<std::uint32_t>(literalBlockDistance)))
+		++statistics.numExportedClauses;
+}
+
+/*
+ * Returns false if an imported clause is falsified on the root decision level, i.e. the formula is unsatisfiable.
+ */
+bool Solver::importClausesOfOtherWorkers()
+{
+	importedClauses.clear();
+	statistics.numMissedImportedClauses += clauseExchange->importClauses(workerIndexInClauseExchange, importedClauses);
+	for (const ClauseExchange::ExchangedClause& importedClause : importedClauses)
+	{
+		if (!addImportedClause(importedClause))
+			return false;
+	}
+	return true;
+}
+
+/*
+ * An imported clause is watched on two of its non-falsified literals, the search backtracks to the root decision level if the clause is unit or falsified under the current assignment
+ * since the clause would then need to be propagated on a lower decision level.
+ */
+bool Solver::addImportedClause(const ClauseExchange::ExchangedClause& importedClause)
+{
+	std::array<std::uint32_t, 2> watchedLiteralPositions = { 0, 0 };
+	std::size_t numNonFalsifiedLiterals = 0;
+	for (std::uint32_t literalPosition = 0; literalPosition < importedClause.literals.size(); ++literalPosition)
+	{
+		const long literal = importedClause.literals[literalPosition];
+		if (!literal || literalToVariable(literal) > numVariables)
+			return true;
+
+		const LiteralValue literalValue = getLiteralValue(literal);
+		if (literalValue == LiteralValue::Satisfied && !variableAssignmentData[literalToVariable(literal)].decisionLevel)
+			return true;
+		if (literalValue != LiteralValue::Falsified && numNonFalsifiedLiterals < 2)
+			watchedLiteralPositions[numNonFalsifiedLiterals++] = literalPosition;
+	}
+
+	if (numNonFalsifiedLiterals < 2 && getCurrentDecisionLevel())
+	{
+		backtrack(0);
+		return addImportedClause(importedClause);
+	}
+
+	++statistics.numImportedClauses;
+	if (!numNonFalsifiedLiterals)
+		return false;
+	if (numNonFalsifiedLiterals == 1)
+	{
+		assignLiteral(importedClause.literals[watchedLiteralPositions[0]], NO_CLAUSE, 0);
+		return true;
+	}
+
+	const ClauseIndex clauseIndex = addClauseToArena(importedClause.literals, true, 1);
+	ClauseMetadata& clause = clauses[clauseIndex];
+	clause.watchedLiteralPositions = watchedLiteralPositions;
+	clause.literalBlockDistance = std::min(importedClause.literalBlockDistance, clause.numLiterals);
+	clause.isUnusedImportedClause = true;
+	moveLearnedClauseToTier(clause, determineTierOfLearnedClause(clause.literalBlockDistance));
+	attachClause(clauseIndex);
+	return true;
+}
+
+/*
+ * Reusing the trail according to (https://www.cs.cmu.edu/~mheule/publications/ReusingTrail.pdf): Every decision level whose decision variable has a higher priority than the variable the decision heuristic
+ * would pick next would be reconstructed with the same decisions after a restart and can thus be kept.
+ */
+std::size_t Solver::determineNumReusableDecisionLevels()
+{
+	const std::optional<std::size_t> nextBranchingVariable = decisionHeuristic->peekBranchingVariable([this](std::size_t variable) { return isVariableAssigned(variable); });
+	if (!nextBranchingVariable.has_value())
+		return 0;
+
+	// The decision levels of the assumptions are always reused since their decisions do not depend on the decision heuristic
+	std::size_t numReusableDecisionLevels = std::min(assumptions.size(), getCurrentDecisionLevel());
+	while (numReusableDecisionLevels < getCurrentDecisionLevel())
+	{
+		const std::size_t decisionVariable = literalToVariable(trail[decisionLevelStartPositionsInTrail[numReusableDecisionLevels]]);
+		if (!decisionHeuristic->hasHigherPriority(decisionVariable, *nextBranchingVariable))
+			break;
+		++numReusableDecisionLevels;
+	}
+	return numReusableDecisionLevels;
+}
+
+/*
+ * The LBD of a learned clause used during conflict analysis is recomputed since the clause might connect fewer decision levels than at the time it was learned (https://www.ijcai.org/Proceedings/09/Papers/074.pdf),
+ * clauses whose LBD decreases are promoted to the corresponding tier.
+ */
+void Solver::markClauseAsUsedDuringConflictAnalysis(ClauseIndex clauseIndex)
+{
+	ClauseMetadata& clause = clauses[clauseIndex];
+	if (!clause.isLearned)
+		return;
+
+	if (clause.isUnusedImportedClause)
+	{
+		clause.isUnusedImportedClause = false;
+		++statistics.numUsefulImportedClauses;
+	}
+	clause.wasUsedSinceLastReduction = true;
+	if (clause.tier == ClauseTier::Core)
+		return;
+
+	if (const std::size_t literalBlockDistance = computeLiteralBlockDistance(getLiteralsOfClause(clause), clause.numLiterals); literalBlockDistance < clause.literalBlockDistance)
+	{
+		clause.literalBlockDistance = static_cast<std::uint32_t>(literalBlockDistance);
+		if (const ClauseTier tier = determineTierOfLearnedClause(literalBlockDistance); tier < clause.tier)
+			moveLearnedClauseToTier(clause, tier);
+	}
+}
+
+Solver::ClauseTier Solver::determineTierOfLearnedClause(std::size_t literalBlockDistance) const noexcept
+{
+	if (literalBlockDistance <= configuration.maximumLiteralBlockDistanceOfCoreClauses)
+		return ClauseTier::Core;
+	if (literalBlockDistance <= configuration.maximumLiteralBlockDistanceOfTierTwoClauses)
+		return ClauseTier::TierTwo;
+	return ClauseTier::Local;
+}
+
+void Solver::moveLearnedClauseToTier(ClauseMetadata& clause, ClauseTier tier)
+{
+	--statistics.numLearnedClausesPerTier[clause.tier];
+	++statistics.numLearnedClausesPerTier[tier];
+	clause.tier = tier;
+}
+
+bool Solver::isClauseDatabaseReductionDue() const noexcept
+{
+	return statistics.numConflicts >= numConflictsAtNextClauseDatabaseReduction;
+}
+
+/*
+ * Tier-2 clauses not used since the last reduction are demoted to the local tier while the half of the local clauses that were neither used since the last reduction nor are the reason for an assignment
+ * on the trail (locked) is deleted, preferring clauses with a larger LBD (and a larger size for equal LBDs). The interval between two reductions grows linearly.
+ */
+void Solver::reduceClauseDatabase()
+{
+	++statistics.numClauseDatabaseReductions;
+	numConflictsAtNextClauseDatabaseReduction = statistics.numConflicts + configuration.initialClauseDatabaseReductionInterval + configuration.clauseDatabaseReductionIntervalIncrement * statistics.numClauseDatabaseReductions;
+
+	std::vector<char> isClauseLocked(clauses.size(), 0);
+	for (const long literal : trail)
+	{
+		if (const ClauseIndex reason = variableAssignmentData[literalToVariable(literal)].reason; reason != NO_CLAUSE)
+			isClauseLocked[reason] = 1;
+	}
+
+	std::vector<ClauseIndex> deletionCandidates;
+	for (ClauseIndex clauseIndex = 0; clauseIndex < clauses.size(); ++clauseIndex)
+	{
+		ClauseMetadata& clause = clauses[clauseIndex];
+		if (!clause.isLearned || clause.isDeleted)
+			continue;
+
+		if (clause.tier == ClauseTier::TierTwo && !clause.wasUsedSinceLastReduction)
+			moveLearnedClauseToTier(clause, ClauseTier::Local);
+		else if (clause.tier == ClauseTier::Local && !clause.wasUsedSinceLastReduction && !isClauseLocked[clauseIndex])
+			deletionCandidates.emplace_back(clauseIndex);
+		clause.wasUsedSinceLastReduction = false;
+	}
+
+	std::sort(deletionCandidates.begin(), deletionCandidates.end(), [this](const ClauseIndex lClauseIndex, const ClauseIndex rClauseIndex)
+	{
+		const ClauseMetadata& lClause = clauses[lClauseIndex];
+		const ClauseMetadata& rClause = clauses[rClauseIndex];
+		if (lClause.literalBlockDistance != rClause.literalBlockDistance)
+			return lClause.literalBlockDistance > rClause.literalBlockDistance;
+		if (lClause.numLiterals != rClause.numLiterals)
+			return lClause.numLiterals > rClause.numLiterals;
+		return lClauseIndex < rClauseIndex;
+	});
+
+	const std::size_t numClausesToDelete = deletionCandidates.size() / 2;
+	for (std::size_t i = 0; i < numClausesToDelete; ++i)
+		deleteClause(deletionCandidates[i]);
+
+	if (numLiteralsOfDeletedClauses)
+		collectGarbage();
+}
+
+void Solver::deleteClause(ClauseIndex clauseIndex)
+{
+	ClauseMetadata& clause = clauses[clauseIndex];
+	clause.isDeleted = true;
+	if (proofWriter)
+		proofWriter->deleteClause(getLiteralsOfClause(clause), clause.numLiterals);
+	if (!clause.isStoredInSharedFormula)
+		numLiteralsOfDeletedClauses += clause.numLiterals;
+	if (clause.isLearned)
+	{
+		--statistics.numLearnedClausesPerTier[clause.tier];
+		++statistics.numDeletedLearnedClauses;
+	}
+}
+
+/*
+ * Compacts the clause arena by relocating the literals and metadata of all remaining clauses, the clause indices referenced by the watchers and by the reasons of the assignments on the trail
+ * are updated accordingly while the watchers of deleted clauses are removed.
+ */
+void Solver::collectGarbage()
+{
+	++statistics.numGarbageCollections;
+
+	std::vector<ClauseIndex> relocatedClauseIndices(clauses.size(), NO_CLAUSE);
+	std::vector<long> compactedClauseLiteralArena;
+	compactedClauseLiteralArena.reserve(clauseLiteralArena.size() - numLiteralsOfDeletedClauses);
+	std::vector<ClauseMetadata> compactedClauses;
+	compactedClauses.reserve(clauses.size());
+
+	for (ClauseIndex clauseIndex = 0; clauseIndex < clauses.size(); ++clauseIndex)
+	{
+		ClauseMetadata clause = clauses[clauseIndex];
+		if (clause.isDeleted)
+			continue;
+
+		// The literals of clauses of the shared formula are not owned by the solver and thus not relocated
+		if (!clause.isStoredInSharedFormula)
+		{
+			const long* clauseLiterals = getLiteralsOfClause(clause);
+			clause.literalsOffset = compactedClauseLiteralArena.size();
+			compactedClauseLiteralArena.insert(compactedClauseLiteralArena.end(), clauseLiterals, clauseLiterals + clause.numLiterals);
+		}
+		relocatedClauseIndices[clauseIndex] = compactedClauses.size();
+		compactedClauses.emplace_back(clause);
+	}
+	clauseLiteralArena.swap(compactedClauseLiteralArena);
+	clauses.swap(compactedClauses);
+	numLiteralsOfDeletedClauses = 0;
+
+	for (std::vector<Watcher>& watchersOfLiteral : watchers)
+	{
+		auto writeIterator = watchersOfLiteral.begin();
+		for (const Watcher& watcher : watchersOfLiteral)
+		{
+			if (relocatedClauseIndices[watcher.clauseIndex] == NO_CLAUSE)
+				continue;
+
+			*writeIterator = watcher;
+			writeIterator->clauseIndex = relocatedClauseIndices[watcher.clauseIndex];
+			++writeIterator;
+		}
+		watchersOfLiteral.erase(writeIterator, watchersOfLiteral.end());
+	}
+
+	for (const long literal : trail)
+	{
+		ClauseIndex& reason = variableAssignmentData[literalToVariable(literal)].reason;
+		if (reason != NO_CLAUSE)
+			reason = relocatedClauseIndices[reason];
+	}
+}
+
+decisionHeuristics::BaseDecisionHeuristic::ptr Solver::createDecisionHeuristic(DecisionHeuristic decisionHeuristic)
+{
+	switch (decisionHeuristic)
+	{
+		case DecisionHeuristic::Evsids:
+			return std::make_unique<decisionHeuristics::EvsidsDecisionHeuristic>();
+		case DecisionHeuristic::Sequential:
+			return std::make_unique<decisionHeuristics::SequentialDecisionHeuristic>();
+		case DecisionHeuristic::LearningRateBranching:
+			return std::make_unique<decisionHeuristics::LearningRateBranchingDecisionHeuristic>();
+		default:
+			throw std::invalid_argument("User-defined decision heuristics need to be registered via Solver::setDecisionHeuristic");
+	}
+}
+
+restartPolicies::BaseRestartPolicy::ptr Solver::createRestartPolicy(RestartPolicy restartPolicy)
+{
+	switch (restartPolicy)
+	{
+		case RestartPolicy::Luby:
+			return std::make_unique<restartPolicies::LubyRestartPolicy>();
+		case RestartPolicy::Glucose:
+			return std::make_unique<restartPolicies::GlucoseRestartPolicy>();
+		case RestartPolicy::ReluctantDoubling:
+			return std::make_unique<restartPolicies::LubyRestartPolicy>(restartPolicies::LubyRestartPolicy::DEFAULT_RELUCTANT_DOUBLING_UNIT_INTERVAL, restartPolicies::LubyRestartPolicy::DEFAULT_RELUCTANT_DOUBLING_MAXIMUM_INTERVAL);
+		default:
+			return nullptr;
+	}
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include "optimizations/modelReconstruction/modelChecker.hpp"
+#include "optimizations/subsumption/backwardSubsumptionEliminator.hpp"
+#include "proof/dratChecker.hpp"
+
+#include <map>
+#include <random>
+#include <sstream>
+
+using namespace subsumption;
+
+class BackwardSubsumptionEliminatorTests : public testing::Test {
+public:
+	static void generateProblemDefinition(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, dimacs::ProblemDefinition::ptr& problemDefinition)
+	{
+		problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numVariablesInFormula, clausesOfFormula.size());
+		ASSERT_TRUE(problemDefinition);
+
+		std::size_t clauseIdx = 0;
+		for (const auto& literalsOfClause : clausesOfFormula)
+			ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+	}
+
+	[[nodiscard]] static std::map<std::size_t, std::vector<long>> determineClausesOfFormula(const dimacs::ProblemDefinition& problemDefinition)
+	{
+		std::map<std::size_t, std::vector<long>> clausesOfFormula;
+		for (const std::size_t clauseIdentifier : problemDefinition.getIdentifiersOfClauses())
+			clausesOfFormula.emplace(clauseIdentifier, problemDefinition.getClauseByIndexInFormula(clauseIdentifier)->literals);
+		return clausesOfFormula;
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generateRandomFormula(std::size_t numVariables, std::size_t numClauses, std::size_t minimumClauseSize, std::default_random_engine& rng)
+	{
+		std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(numVariables));
+		std::uniform_int_distribution<std::size_t> clauseSizeDistribution(minimumClauseSize, 5);
+		std::bernoulli_distribution polarityDistribution(0.5);
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		while (clausesOfFormula.size() < numClauses)
+		{
+			const std::size_t clauseSize = clauseSizeDistribution(rng);
+			std::vector<long> clauseLiterals;
+			while (clauseLiterals.size() < clauseSize)
+			{
+				const long variable = variableDistribution(rng);
+				if (std::none_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [variable](const long literal) { return std::abs(literal) == variable; }))
+					clauseLiterals.emplace_back(polarityDistribution(rng) ? variable : -variable);
+			}
+			clausesOfFormula.emplace_back(clauseLiterals);
+		}
+		return clausesOfFormula;
+	}
+};
+
+TEST_F(BackwardSubsumptionEliminatorTests, InvalidConfigurationThrows)
+{
+	ASSERT_THROW(BackwardSubsumptionEliminator(nullptr, BackwardSubsumptionEliminator::SubsumptionConfiguration()), std::invalid_argument);
+
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { { 1, 2 } }, problemDefinition));
+	BackwardSubsumptionEliminator::SubsumptionConfiguration subsumptionConfiguration;
+	subsumptionConfiguration.numThreads = 0;
+	ASSERT_THROW(BackwardSubsumptionEliminator(problemDefinition, subsumptionConfiguration), std::invalid_argument);
+}
+
+TEST_F(BackwardSubsumptionEliminatorTests, SubsumedClausesAreRemovedAndOnlyLaterOfEqualClauses)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(4, { { 1, 2 }, { 1, 2, 3 }, { 2, 1 }, { -1, 3, 4 }, { 2, 3, 4 } }, problemDefinition));
+
+	BackwardSubsumptionEliminator backwardSubsumptionEliminator(problemDefinition, BackwardSubsumptionEliminator::SubsumptionConfiguration());
+	ASSERT_TRUE(backwardSubsumptionEliminator.subsumeAndStrengthenClauses());
+	ASSERT_EQ(2, backwardSubsumptionEliminator.getStatistics().numSubsumedClauses);
+	ASSERT_EQ(0, backwardSubsumptionEliminator.getStatistics().numStrengthenedClauses);
+
+	const std::map<std::size_t, std::vector<long>> expectedClauses = { { 0, { 1, 2 } }, { 3, { -1, 3, 4 } }, { 4, { 2, 3, 4 } } };
+	ASSERT_EQ(expectedClauses, determineClausesOfFormula(*problemDefinition));
+}
+
+TEST_F(BackwardSubsumptionEliminatorTests, ClausesAreStrengthenedBySelfSubsumingResolution)
+{
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1, 2 }, { -1, 2, 3 }, { -2, 3, 4 }, { 2, 4 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(4, clausesOfFormula, problemDefinition));
+
+	std::ostringstream proofStream;
+	proof::ProofWriter proofWriter(proofStream, proof::ProofWriter::ProofFormat::Drat);
+	BackwardSubsumptionEliminator backwardSubsumptionEliminator(problemDefinition, BackwardSubsumptionEliminator::SubsumptionConfiguration());
+	backwardSubsumptionEliminator.setProofWriter(&proofWriter);
+	ASSERT_TRUE(backwardSubsumptionEliminator.subsumeAndStrengthenClauses());
+	ASSERT_TRUE(proofWriter.close());
+
+	// The clauses (-1 2 3) and (-2 3 4) are strengthened by (1 2) respectively (2 4) in the first round while the second round determines no further changes
+	const std::map<std::size_t, std::vector<long>> expectedClauses = { { 0, { 1, 2 } }, { 1, { 2, 3 } }, { 2, { 3, 4 } }, { 3, { 2, 4 } } };
+	ASSERT_EQ(expectedClauses, determineClausesOfFormula(*problemDefinition));
+	ASSERT_EQ(2, backwardSubsumptionEliminator.getStatistics().numStrengthenedClauses);
+	ASSERT_EQ(2, backwardSubsumptionEliminator.getStatistics().numRounds);
+
+	proof::DratChecker dratChecker(4);
+	for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+		dratChecker.addOriginalClause(clauseLiterals);
+	std::istringstream binaryProofStream(proofStream.str());
+	const proof::DratChecker::CheckResult checkResult = dratChecker.verifyProof(binaryProofStream, proof::DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(checkResult.isProofValid);
+	ASSERT_EQ(2, checkResult.numLemmas);
+}
+
+TEST_F(BackwardSubsumptionEliminatorTests, StrengtheningToEmptyClauseDeterminesUnsatisfiability)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { { 1 }, { -1 }, { 1, 2 } }, problemDefinition));
+
+	BackwardSubsumptionEliminator backwardSubsumptionEliminator(problemDefinition, BackwardSubsumptionEliminator::SubsumptionConfiguration());
+	ASSERT_FALSE(backwardSubsumptionEliminator.subsumeAndStrengthenClauses());
+}
+
+TEST_F(BackwardSubsumptionEliminatorTests, CandidatesWithIncompatibleSignatureAreRejected)
+{
+	// The clause (1 4) is watched by the literal 1 since the variable 4 occurs more often, its signature is no subset of the signature of (1 2 3)
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(6, { { 1, 4 }, { 1, 2, 3 }, { 4, 5 }, { -4, 6 } }, problemDefinition));
+
+	BackwardSubsumptionEliminator backwardSubsumptionEliminator(problemDefinition, BackwardSubsumptionEliminator::SubsumptionConfiguration());
+	ASSERT_TRUE(backwardSubsumptionEliminator.subsumeAndStrengthenClauses());
+	ASSERT_EQ(0, backwardSubsumptionEliminator.getStatistics().numSubsumedClauses);
+	ASSERT_LE(1, backwardSubsumptionEliminator.getStatistics().numSignatureRejections);
+	ASSERT_EQ(4, problemDefinition->getNumClausesAfterOptimizations());
+}
+
+TEST_F(BackwardSubsumptionEliminatorTests, RandomFormulasRemainEquivalent)
+{
+	constexpr std::size_t numVariables = 10;
+	std::default_random_engine rng(48);
+	for (std::size_t formulaIndex = 0; formulaIndex < 100; ++formulaIndex)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomFormula(numVariables, 15 + formulaIndex % 25, 1, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariables, clausesOfFormula, problemDefinition));
+
+		BackwardSubsumptionEliminator backwardSubsumptionEliminator(problemDefinition, BackwardSubsumptionEliminator::SubsumptionConfiguration());
+		const bool wasEmptyClauseAvoided = backwardSubsumptionEliminator.subsumeAndStrengthenClauses();
+
+		modelReconstruction::ModelChecker originalModelChecker;
+		for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+			originalModelChecker.addClause(clauseLiterals);
+		modelReconstruction::ModelChecker reducedModelChecker;
+		for (const auto& [clauseIdentifier, clauseLiterals] : determineClausesOfFormula(*problemDefinition))
+			reducedModelChecker.addClause(clauseLiterals);
+
+		for (std::size_t assignment = 0; assignment < static_cast<std::size_t>(1) << numVariables; ++assignment)
+		{
+			std::vector<long> model;
+			for (std::size_t variable = 1; variable <= numVariables; ++variable)
+				model.emplace_back(assignment & (static_cast<std::size_t>(1) << (variable - 1)) ? static_cast<long>(variable) : -static_cast<long>(variable));
+
+			const bool isModelOfOriginalFormula = originalModelChecker.isModelOfFormula(model);
+			ASSERT_TRUE(wasEmptyClauseAvoided || !isModelOfOriginalFormula) << "Formula " << formulaIndex;
+			if (wasEmptyClauseAvoided)
+			{
+				ASSERT_EQ(isModelOfOriginalFormula, reducedModelChecker.isModelOfFormula(model)) << "Formula " << formulaIndex;
+			}
+		}
+	}
+}
+
+TEST_F(BackwardSubsumptionEliminatorTests, ResultIsIndependentOfNumberOfThreads)
+{
+	std::default_random_engine rng(49);
+	// Unit clauses are avoided since the formula would otherwise most likely be strengthened to the empty clause in the first round
+	const std::vector<std::vector<long>> clausesOfFormula = generateRandomFormula(150, 2000, 2, rng);
+
+	std::vector<std::map<std::size_t, std::vector<long>>> perNumThreadsClauses;
+	std::vector<BackwardSubsumptionEliminator::SubsumptionStatistics> perNumThreadsStatistics;
+	for (const std::size_t numThreads : { 1, 3, 8 })
+	{
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(150, clausesOfFormula, problemDefinition));
+
+		BackwardSubsumptionEliminator::SubsumptionConfiguration subsumptionConfiguration;
+		subsumptionConfiguration.numThreads = numThreads;
+		BackwardSubsumptionEliminator backwardSubsumptionEliminator(problemDefinition, subsumptionConfiguration);
+		static_cast<void>(backwardSubsumptionEliminator.subsumeAndStrengthenClauses());
+		perNumThreadsClauses.emplace_back(determineClausesOfFormula(*problemDefinition));
+		perNumThreadsStatistics.emplace_back(backwardSubsumptionEliminator.getStatistics());
+	}
+
+	ASSERT_LT(0, perNumThreadsStatistics.front().numSubsumedClauses);
+	ASSERT_LT(0, perNumThreadsStatistics.front().numStrengthenedClauses);
+	for (std::size_t i = 1; i < perNumThreadsClauses.size(); ++i)
+	{
+		ASSERT_EQ(perNumThreadsClauses.front(), perNumThreadsClauses[i]);
+		ASSERT_EQ(perNumThreadsStatistics.front().numSubsumedClauses, perNumThreadsStatistics[i].numSubsumedClauses);
+		ASSERT_EQ(perNumThreadsStatistics.front().numStrengthenedClauses, perNumThreadsStatistics[i].numStrengthenedClauses);
+		ASSERT_EQ(perNumThreadsStatistics.front().numTicks, perNumThreadsStatistics[i].numTicks);
+	}
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include "formulaTestUtils.hpp"
+#include "optimizations/boundedVariableElimination/boundedVariableEliminator.hpp"
+#include "solver/solver.hpp"
+
+#include <random>
+#include <sstream>
+
+using namespace boundedVariableElimination;
+using namespace formulaTestUtils;
+
+class BoundedVariableEliminatorTests : public testing::Test {};
+
+TEST_F(BoundedVariableEliminatorTests, InvalidConfigurationThrows)
+{
+	ASSERT_THROW(BoundedVariableEliminator(nullptr, BoundedVariableEliminator::EliminationConfiguration()), std::invalid_argument);
+
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { { 1, 2 } }, problemDefinition));
+	BoundedVariableEliminator::EliminationConfiguration eliminationConfiguration;
+	eliminationConfiguration.maximumResolventSize = 0;
+	ASSERT_THROW(BoundedVariableEliminator(problemDefinition, eliminationConfiguration), std::invalid_argument);
+}
+
+TEST_F(BoundedVariableEliminatorTests, VariablesExceedingOccurrenceLimitAreNotEliminated)
+{
+	// Every literal of the formula consisting of all but one of the clauses over three variables occurs at least three times
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1, 2, 3 }, { 1, 2, -3 }, { 1, -2, 3 }, { 1, -2, -3 }, { -1, 2, 3 }, { -1, 2, -3 }, { -1, -2, 3 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(3, clausesOfFormula, problemDefinition));
+
+	BoundedVariableEliminator::EliminationConfiguration eliminationConfiguration;
+	eliminationConfiguration.maximumNumOccurrencesPerLiteral = 2;
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	BoundedVariableEliminator limitedVariableEliminator(problemDefinition, eliminationConfiguration);
+	ASSERT_TRUE(limitedVariableEliminator.eliminateVariables(modelReconstructionStack));
+	ASSERT_TRUE(limitedVariableEliminator.getEliminatedVariables().empty());
+	ASSERT_EQ(clausesOfFormula.size(), problemDefinition->getNumClausesAfterOptimizations());
+	ASSERT_TRUE(modelReconstructionStack.isEmpty());
+
+	BoundedVariableEliminator variableEliminator(problemDefinition, BoundedVariableEliminator::EliminationConfiguration());
+	ASSERT_TRUE(variableEliminator.eliminateVariables(modelReconstructionStack));
+	ASSERT_EQ(3, variableEliminator.getStatistics().numEliminatedVariables);
+	ASSERT_EQ(0, problemDefinition->getNumClausesAfterOptimizations());
+	ASSERT_TRUE(initializeModelChecker(clausesOfFormula).isModelOfFormula(modelReconstructionStack.reconstructModel({ -1, -2, -3 })));
+}
+
+TEST_F(BoundedVariableEliminatorTests, VariableWithSmallestOccurrenceProductIsEliminatedFirst)
+{
+	// The occurrence products of the variables 1, 2 and 3 are 6, 2 and 4 while the variable 4 exceeds the occurrence limit
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1, 2, 4 }, { 1, -2, 4 }, { -1, 3, 4 }, { -1, -3, 4 }, { 2, 3, -4 }, { 1, -4 }, { -3, -4 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(4, clausesOfFormula, problemDefinition));
+
+	BoundedVariableEliminator::EliminationConfiguration eliminationConfiguration;
+	eliminationConfiguration.maximumNumOccurrencesPerLiteral = 3;
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	BoundedVariableEliminator variableEliminator(problemDefinition, eliminationConfiguration);
+	ASSERT_TRUE(variableEliminator.eliminateVariables(modelReconstructionStack));
+	ASSERT_FALSE(variableEliminator.getEliminatedVariables().empty());
+	ASSERT_EQ(2, variableEliminator.getEliminatedVariables().front());
+
+	// The witness of every entry is the literal of the eliminated variable contained in the replaced clause
+	for (std::size_t i = 0; i < modelReconstructionStack.getNumEntries(); ++i)
+	{
+		const std::vector<long>& witness = modelReconstructionStack.getWitnessOfEntry(i);
+		ASSERT_EQ(1, witness.size());
+		const std::vector<long>& clauseLiterals = modelReconstructionStack.getClauseOfEntry(i);
+		ASSERT_NE(clauseLiterals.cend(), std::find(clauseLiterals.cbegin(), clauseLiterals.cend(), witness.front()));
+	}
+}
+
+TEST_F(BoundedVariableEliminatorTests, ClausesSubsumedByResolventsAreRemoved)
+{
+	// Only the variable 1 is within the occurrence limit, its resolvent (2) subsumes the clauses (2 3 4) and (2 -3 -4)
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1, 2 }, { -1, 2 }, { 2, 3, 4 }, { 2, -3, -4 }, { -2, 3, -4 }, { -2, 3, 4 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(4, clausesOfFormula, problemDefinition));
+
+	BoundedVariableEliminator::EliminationConfiguration eliminationConfiguration;
+	eliminationConfiguration.maximumNumOccurrencesPerLiteral = 1;
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	BoundedVariableEliminator variableEliminator(problemDefinition, eliminationConfiguration);
+	ASSERT_TRUE(variableEliminator.eliminateVariables(modelReconstructionStack));
+	ASSERT_EQ(1, variableEliminator.getEliminatedVariables().front());
+	ASSERT_EQ(2, variableEliminator.getStatistics().numSubsumedClauses);
+	ASSERT_EQ(nullptr, problemDefinition->getClauseByIndexInFormula(2));
+	ASSERT_EQ(nullptr, problemDefinition->getClauseByIndexInFormula(3));
+
+	// Subsumed clauses are not recorded on the model reconstruction stack since they are satisfied by every model of the resolvent
+	solver::Solver solver(*problemDefinition);
+	ASSERT_EQ(solver::Solver::SolverResult::Sat, solver.solve());
+	ASSERT_TRUE(initializeModelChecker(clausesOfFormula).isModelOfFormula(modelReconstructionStack.reconstructModel(solver.getModel())));
+}
+
+TEST_F(BoundedVariableEliminatorTests, EmptyResolventIsAddedToProof)
+{
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1 }, { -1 }, { 1, 2 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, clausesOfFormula, problemDefinition));
+
+	std::ostringstream proofStream;
+	proof::ProofWriter proofWriter(proofStream, proof::ProofWriter::ProofFormat::Drat);
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	BoundedVariableEliminator variableEliminator(problemDefinition, BoundedVariableEliminator::EliminationConfiguration());
+	variableEliminator.setProofWriter(&proofWriter);
+	ASSERT_FALSE(variableEliminator.eliminateVariables(modelReconstructionStack));
+	ASSERT_TRUE(proofWriter.close());
+
+	const proof::DratChecker::CheckResult checkResult = verifyProofOfFormula(2, clausesOfFormula, proofStream.str(), proof::DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(checkResult.isProofValid);
+	ASSERT_TRUE(checkResult.wasEmptyClauseDerived);
+}
+
+TEST_F(BoundedVariableEliminatorTests, ExhaustedBudgetStopsElimination)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(3, { { 1, 2 }, { -1, 3 } }, problemDefinition));
+
+	budget::ResourceBudget resourceBudget;
+	resourceBudget.interrupt();
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	BoundedVariableEliminator variableEliminator(problemDefinition, BoundedVariableEliminator::EliminationConfiguration());
+	variableEliminator.setResourceBudget(&resourceBudget);
+	ASSERT_TRUE(variableEliminator.eliminateVariables(modelReconstructionStack));
+	ASSERT_TRUE(variableEliminator.getEliminatedVariables().empty());
+	ASSERT_EQ(2, problemDefinition->getNumClausesAfterOptimizations());
+}
+
+TEST_F(BoundedVariableEliminatorTests, EliminationOfRandomFormulasPreservesSatisfiabilityAndModelsAreReconstructed)
+{
+	constexpr std::size_t numVariables = 10;
+	std::default_random_engine rng(47);
+	for (std::size_t formulaIndex = 0; formulaIndex < 200; ++formulaIndex)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomFormula(numVariables, 20 + formulaIndex % 30, { 0, 1, 1, 1, 1 }, rng);
+		const bool isFormulaSatisfiable = isFormulaSatisfiableByBruteForce(numVariables, clausesOfFormula);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariables, clausesOfFormula, problemDefinition));
+
+		BoundedVariableEliminator::EliminationConfiguration eliminationConfiguration;
+		eliminationConfiguration.maximumNumAdditionalClauses = formulaIndex % 3;
+		modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+		BoundedVariableEliminator variableEliminator(problemDefinition, eliminationConfiguration);
+		if (!variableEliminator.eliminateVariables(modelReconstructionStack))
+		{
+			ASSERT_FALSE(isFormulaSatisfiable) << "Formula " << formulaIndex;
+			continue;
+		}
+
+		for (const std::size_t eliminatedVariable : variableEliminator.getEliminatedVariables())
+		{
+			ASSERT_FALSE(problemDefinition->getLiteralOccurrenceLookup().getNumberOfOccurrencesOfLiteral(static_cast<long>(eliminatedVariable)).value_or(0));
+			ASSERT_FALSE(problemDefinition->getLiteralOccurrenceLookup().getNumberOfOccurrencesOfLiteral(-static_cast<long>(eliminatedVariable)).value_or(0));
+		}
+
+		solver::Solver solver(*problemDefinition);
+		const solver::Solver::SolverResult solverResult = solver.solve();
+		ASSERT_EQ(isFormulaSatisfiable ? solver::Solver::SolverResult::Sat : solver::Solver::SolverResult::Unsat, solverResult) << "Formula " << formulaIndex;
+		if (isFormulaSatisfiable)
+		{
+			ASSERT_TRUE(initializeModelChecker(clausesOfFormula).isModelOfFormula(modelReconstructionStack.reconstructModel(solver.getModel()))) << "Formula " << formulaIndex;
+		}
+	}
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "solver/clauseExchange.hpp"
+
+using namespace solver;
+
+class ClauseExchangeTests : public testing::Test {
+public:
+	static void assertImportedClausesMatch(const std::vector<ClauseExchange::ExchangedClause>& actualClauses, const std::vector<std::vector<long>>& expectedClauses)
+	{
+		ASSERT_EQ(expectedClauses.size(), actualClauses.size());
+		for (std::size_t i = 0; i < expectedClauses.size(); ++i)
+			ASSERT_EQ(expectedClauses[i], actualClauses[i].literals);
+	}
+};
+
+TEST_F(ClauseExchangeTests, ExchangeWithoutWorkersThrows)
+{
+	ASSERT_THROW(ClauseExchange(0), std::invalid_argument);
+}
+
+TEST_F(ClauseExchangeTests, ExportedClausesAreImportedByEveryOtherWorker)
+{
+	ClauseExchange clauseExchange(3);
+	const std::vector<long> firstClause = { 1, -2 };
+	const std::vector<long> secondClause = { -3, 4, 5 };
+	ASSERT_TRUE(clauseExchange.exportClause(0, firstClause.data(), firstClause.size(), 2));
+	ASSERT_TRUE(clauseExchange.exportClause(0, secondClause.data(), secondClause.size(), 3));
+
+	std::vector<ClauseExchange::ExchangedClause> importedClauses;
+	ASSERT_EQ(0, clauseExchange.importClauses(1, importedClauses));
+	assertImportedClausesMatch(importedClauses, { firstClause, secondClause });
+	ASSERT_EQ(2, importedClauses.front().literalBlockDistance);
+	ASSERT_EQ(3, importedClauses.back().literalBlockDistance);
+
+	importedClauses.clear();
+	ASSERT_EQ(0, clauseExchange.importClauses(2, importedClauses));
+	assertImportedClausesMatch(importedClauses, { firstClause, secondClause });
+
+	// Clauses are only imported once per worker
+	importedClauses.clear();
+	ASSERT_EQ(0, clauseExchange.importClauses(1, importedClauses));
+	ASSERT_TRUE(importedClauses.empty());
+}
+
+TEST_F(ClauseExchangeTests, WorkerDoesNotImportOwnClauses)
+{
+	ClauseExchange clauseExchange(2);
+	const std::vector<long> clause = { 1, 2 };
+	ASSERT_TRUE(clauseExchange.exportClause(0, clause.data(), clause.size(), 2));
+
+	std::vector<ClauseExchange::ExchangedClause> importedClauses;
+	ASSERT_EQ(0, clauseExchange.importClauses(0, importedClauses));
+	ASSERT_TRUE(importedClauses.empty());
+}
+
+TEST_F(ClauseExchangeTests, DuplicateClausesAreSuppressed)
+{
+	ClauseExchange clauseExchange(3);
+	const std::vector<long> clause = { 1, -2, 3 };
+	const std::vector<long> permutationOfClause = { 3, 1, -2 };
+	ASSERT_TRUE(clauseExchange.exportClause(0, clause.data(), clause.size(), 2));
+	ASSERT_FALSE(clauseExchange.exportClause(0, permutationOfClause.data(), permutationOfClause.size(), 2));
+
+	// The same clause exported by a second worker is only imported once by the third one
+	ASSERT_TRUE(clauseExchange.exportClause(1, permutationOfClause.data(), permutationOfClause.size(), 2));
+	std::vector<ClauseExchange::ExchangedClause> importedClauses;
+	ASSERT_EQ(0, clauseExchange.importClauses(2, importedClauses));
+	assertImportedClausesMatch(importedClauses, { clause });
+
+	// A worker does not export a clause it already imported
+	ASSERT_FALSE(clauseExchange.exportClause(2, clause.data(), clause.size(), 2));
+}
+
+TEST_F(ClauseExchangeTests, ClausesLargerThanMaximumClauseSizeAreNotExported)
+{
+	ClauseExchange clauseExchange(2);
+	std::vector<long> clause(ClauseExchange::MAXIMUM_CLAUSE_SIZE + 1);
+	for (std::size_t i = 0; i < clause.size(); ++i)
+		clause[i] = static_cast<long>(i + 1);
+
+	ASSERT_FALSE(clauseExchange.exportClause(0, clause.data(), clause.size(), 2));
+	ASSERT_FALSE(clauseExchange.exportClause(0, clause.data(), 0, 0));
+	ASSERT_TRUE(clauseExchange.exportClause(0, clause.data(), ClauseExchange::MAXIMUM_CLAUSE_SIZE, 2));
+}
+
+TEST_F(ClauseExchangeTests, OverwrittenClausesAreSkipped)
+{
+	constexpr std::size_t ringCapacity = 4;
+	ClauseExchange clauseExchange(2, ringCapacity);
+
+	std::vector<std::vector<long>> exportedClauses;
+	for (long variable = 1; variable <= 10; ++variable)
+	{
+		exportedClauses.push_back({ variable, variable + 100 });
+		ASSERT_TRUE(clauseExchange.exportClause(0, exportedClauses.back().data(), exportedClauses.back().size(), 2));
+	}
+
+	std::vector<ClauseExchange::ExchangedClause> importedClauses;
+	ASSERT_EQ(exportedClauses.size() - ringCapacity, clauseExchange.importClauses(1, importedClauses));
+	assertImportedClausesMatch(importedClauses, std::vector<std::vector<long>>(exportedClauses.end() - ringCapacity, exportedClauses.end()));
+}
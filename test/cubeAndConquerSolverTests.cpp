@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include "solver/cubeAndConquerSolver.hpp"
+
+#include <random>
+
+using namespace solver;
+
+class CubeAndConquerSolverTests : public testing::Test {
+public:
+	static void generateProblemDefinition(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, dimacs::ProblemDefinition::ptr& problemDefinition)
+	{
+		problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numVariablesInFormula, clausesOfFormula.size());
+		ASSERT_TRUE(problemDefinition);
+
+		std::size_t clauseIdx = 0;
+		for (const auto& literalsOfClause : clausesOfFormula)
+			ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+	}
+
+	static void assertModelSatisfiesClauses(const std::vector<long>& model, const std::vector<std::vector<long>>& clausesOfFormula)
+	{
+		for (const auto& literalsOfClause : clausesOfFormula)
+		{
+			ASSERT_TRUE(std::any_of(
+				literalsOfClause.cbegin(),
+				literalsOfClause.cend(),
+				[&model](const long literal) { return model[std::abs(literal) - 1] == literal; }));
+		}
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generatePigeonHoleFormula(std::size_t numHoles)
+	{
+		const std::size_t numPigeons = numHoles + 1;
+		const auto determineVariable = [numHoles](std::size_t pigeon, std::size_t hole) { return static_cast<long>(pigeon * numHoles + hole + 1); };
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+		{
+			std::vector<long> pigeonIsInSomeHoleClause;
+			for (std::size_t hole = 0; hole < numHoles; ++hole)
+				pigeonIsInSomeHoleClause.emplace_back(determineVariable(pigeon, hole));
+			clausesOfFormula.emplace_back(pigeonIsInSomeHoleClause);
+		}
+
+		for (std::size_t hole = 0; hole < numHoles; ++hole)
+		{
+			for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+			{
+				for (std::size_t otherPigeon = pigeon + 1; otherPigeon < numPigeons; ++otherPigeon)
+					clausesOfFormula.emplace_back(std::vector<long>({ -determineVariable(pigeon, hole), -determineVariable(otherPigeon, hole) }));
+			}
+		}
+		return clausesOfFormula;
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generateRandomThreeSatFormula(std::size_t numVariables, std::size_t numClauses, std::default_random_engine& rng)
+	{
+		std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(numVariables));
+		std::bernoulli_distribution polarityDistribution(0.5);
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		while (clausesOfFormula.size() < numClauses)
+		{
+			std::vector<long> clauseLiterals;
+			while (clauseLiterals.size() < 3)
+			{
+				const long variable = variableDistribution(rng);
+				if (std::none_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [variable](const long literal) { return std::abs(literal) == variable; }))
+					clauseLiterals.emplace_back(polarityDistribution(rng) ? variable : -variable);
+			}
+			clausesOfFormula.emplace_back(clauseLiterals);
+		}
+		return clausesOfFormula;
+	}
+};
+
+TEST_F(CubeAndConquerSolverTests, InvalidConfigurationThrows)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { { 1, 2 } }, problemDefinition));
+
+	CubeAndConquerSolver::CubeAndConquerConfiguration cubeAndConquerConfiguration;
+	ASSERT_THROW(CubeAndConquerSolver(*problemDefinition, 0, Solver::SolverConfiguration(), cubeAndConquerConfiguration), std::invalid_argument);
+
+	cubeAndConquerConfiguration.numConflictsUntilCubeIsStalled = 0;
+	ASSERT_THROW(CubeAndConquerSolver(*problemDefinition, 2, Solver::SolverConfiguration(), cubeAndConquerConfiguration), std::invalid_argument);
+
+	cubeAndConquerConfiguration = CubeAndConquerSolver::CubeAndConquerConfiguration();
+	cubeAndConquerConfiguration.resplitCubeDepth = 0;
+	ASSERT_THROW(CubeAndConquerSolver(*problemDefinition, 2, Solver::SolverConfiguration(), cubeAndConquerConfiguration), std::invalid_argument);
+}
+
+TEST_F(CubeAndConquerSolverTests, PigeonHoleFormulaIsUnsatisfiableWithStalledCubes)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	CubeAndConquerSolver::CubeAndConquerConfiguration cubeAndConquerConfiguration;
+	cubeAndConquerConfiguration.initialCubeDepth = 2;
+	cubeAndConquerConfiguration.numConflictsUntilCubeIsStalled = 20;
+
+	CubeAndConquerSolver cubeAndConquerSolver(*problemDefinition, 3, Solver::SolverConfiguration(), cubeAndConquerConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, cubeAndConquerSolver.solve());
+	ASSERT_TRUE(cubeAndConquerSolver.getModel().empty());
+
+	const CubeAndConquerSolver::CubeAndConquerStatistics statistics = cubeAndConquerSolver.getStatistics();
+	ASSERT_LT(0, statistics.numInitialCubes);
+	ASSERT_LT(0, statistics.numStalledCubes);
+	// Every cube is either refuted by a worker or split again once it stalled
+	ASSERT_EQ(statistics.numInitialCubes + statistics.numResplitCubes, statistics.numRefutedCubes + statistics.numStalledCubes);
+}
+
+TEST_F(CubeAndConquerSolverTests, ResultOfRandomThreeSatFormulasMatchesResultOfSequentialSolver)
+{
+	constexpr std::size_t numVariablesInFormula = 50;
+	constexpr std::size_t numClausesInFormula = 213;
+	constexpr std::size_t numGeneratedFormulas = 10;
+	std::default_random_engine rng(43);
+
+	CubeAndConquerSolver::CubeAndConquerConfiguration cubeAndConquerConfiguration;
+	cubeAndConquerConfiguration.initialCubeDepth = 3;
+	cubeAndConquerConfiguration.numConflictsUntilCubeIsStalled = 50;
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomThreeSatFormula(numVariablesInFormula, numClausesInFormula, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesInFormula, clausesOfFormula, problemDefinition));
+
+		const SharedFormula::ptr sharedFormula = SharedFormula::fromProblemDefinition(*problemDefinition);
+		Solver sequentialSolver(sharedFormula, Solver::SolverConfiguration());
+		CubeAndConquerSolver cubeAndConquerSolver(sharedFormula, 2, Solver::SolverConfiguration(), cubeAndConquerConfiguration);
+		const Solver::SolverResult expectedResult = sequentialSolver.solve();
+		ASSERT_EQ(expectedResult, cubeAndConquerSolver.solve());
+		if (expectedResult == Solver::SolverResult::Sat)
+		{
+			ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(cubeAndConquerSolver.getModel(), clausesOfFormula));
+		}
+	}
+}
+
+TEST_F(CubeAndConquerSolverTests, ReachingConflictLimitInEveryWorkerReportsUnknownResult)
+{
+	constexpr std::size_t numHoles = 8;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalConflictLimit = 100;
+	CubeAndConquerSolver cubeAndConquerSolver(*problemDefinition, 2, solverConfiguration, CubeAndConquerSolver::CubeAndConquerConfiguration());
+	ASSERT_EQ(Solver::SolverResult::Unknown, cubeAndConquerSolver.solve());
+	ASSERT_FALSE(cubeAndConquerSolver.getIndexOfWinningWorker().has_value());
+}
@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+
+#include "solver/decisionHeuristics/evsidsDecisionHeuristic.hpp"
+#include "solver/decisionHeuristics/learningRateBranchingDecisionHeuristic.hpp"
+#include "solver/decisionHeuristics/sequentialDecisionHeuristic.hpp"
+#include "solver/decisionHeuristics/variableActivityHeap.hpp"
+
+#include <random>
+#include <unordered_set>
+
+using namespace decisionHeuristics;
+
+class DecisionHeuristicTests : public testing::Test {
+public:
+	[[nodiscard]] static BaseDecisionHeuristic::VariableAssignmentCheck createAssignmentCheck(const std::unordered_set<std::size_t>& assignedVariables)
+	{
+		return [&assignedVariables](std::size_t variable) { return assignedVariables.count(variable) != 0; };
+	}
+
+	static void assertHeapPopOrderMatches(VariableActivityHeap& heap, const std::vector<std::size_t>& expectedOrderOfVariables)
+	{
+		for (const std::size_t expectedVariable : expectedOrderOfVariables)
+		{
+			const std::optional<std::size_t> actualVariable = heap.popVariableWithMaximumActivity();
+			ASSERT_TRUE(actualVariable.has_value());
+			ASSERT_EQ(expectedVariable, *actualVariable);
+		}
+		ASSERT_TRUE(heap.empty());
+		ASSERT_FALSE(heap.popVariableWithMaximumActivity().has_value());
+	}
+};
+
+TEST_F(DecisionHeuristicTests, HeapReturnsVariablesOrderedByDecreasingActivity)
+{
+	VariableActivityHeap heap(6);
+	heap.insert(1, 2.0);
+	heap.insert(2, 5.0);
+	heap.insert(3, 1.0);
+	heap.insert(4, 7.5);
+	heap.insert(5, 3.0);
+	heap.insert(6, 0.5);
+	ASSERT_EQ(6, heap.size());
+	ASSERT_EQ(4, heap.getVariableWithMaximumActivity());
+	ASSERT_NO_FATAL_FAILURE(assertHeapPopOrderMatches(heap, { 4, 2, 5, 1, 3, 6 }));
+}
+
+TEST_F(DecisionHeuristicTests, HeapOrdersVariablesWithEqualActivityByIdentifier)
+{
+	VariableActivityHeap heap(5);
+	for (std::size_t variable = 5; variable > 0; --variable)
+		heap.insert(variable, 1.0);
+
+	ASSERT_NO_FATAL_FAILURE(assertHeapPopOrderMatches(heap, { 1, 2, 3, 4, 5 }));
+}
+
+TEST_F(DecisionHeuristicTests, IncreasingActivityOfVariableInHeapUpdatesOrder)
+{
+	VariableActivityHeap heap(4);
+	heap.insert(1, 4.0);
+	heap.insert(2, 3.0);
+	heap.insert(3, 2.0);
+	heap.insert(4, 1.0);
+
+	heap.increaseActivity(4, 10.0);
+	heap.increaseActivity(3, 3.5);
+	ASSERT_NO_FATAL_FAILURE(assertHeapPopOrderMatches(heap, { 4, 1, 3, 2 }));
+}
+
+TEST_F(DecisionHeuristicTests, UpdatingActivityOfVariableInHeapUpdatesOrder)
+{
+	VariableActivityHeap heap(5);
+	for (std::size_t variable = 1; variable <= 5; ++variable)
+		heap.insert(variable, static_cast<double>(variable));
+
+	heap.updateActivity(5, 0.5);
+	heap.updateActivity(1, 4.5);
+	heap.updateActivity(3, 3.0);
+	ASSERT_NO_FATAL_FAILURE(assertHeapPopOrderMatches(heap, { 1, 4, 3, 2, 5 }));
+}
+
+TEST_F(DecisionHeuristicTests, InsertionOfVariableAlreadyInHeapIsIgnored)
+{
+	VariableActivityHeap heap(2);
+	heap.insert(1, 1.0);
+	heap.insert(1, 5.0);
+	heap.insert(2, 2.0);
+	ASSERT_EQ(2, heap.size());
+	ASSERT_NO_FATAL_FAILURE(assertHeapPopOrderMatches(heap, { 2, 1 }));
+}
+
+TEST_F(DecisionHeuristicTests, InsertionOfVariableOutsideOfValidRangeThrows)
+{
+	VariableActivityHeap heap(2);
+	ASSERT_THROW(heap.insert(0, 1.0), std::invalid_argument);
+	ASSERT_THROW(heap.insert(3, 1.0), std::invalid_argument);
+}
+
+TEST_F(DecisionHeuristicTests, HeapOrderMatchesSortedActivitiesForRandomOperations)
+{
+	constexpr std::size_t numVariables = 500;
+	std::default_random_engine rng(42);
+	std::uniform_real_distribution<double> activityDistribution(0.0, 100.0);
+	std::uniform_int_distribution<std::size_t> variableDistribution(1, numVariables);
+
+	VariableActivityHeap heap(numVariables);
+	std::vector<double> activities(numVariables + 1, 0.0);
+	for (std::size_t variable = 1; variable <= numVariables; ++variable)
+	{
+		activities[variable] = activityDistribution(rng);
+		heap.insert(variable, activities[variable]);
+	}
+
+	for (std::size_t i = 0; i < 2000; ++i)
+	{
+		const std::size_t variable = variableDistribution(rng);
+		activities[variable] += activityDistribution(rng);
+		heap.increaseActivity(variable, activities[variable]);
+	}
+
+	std::vector<std::size_t> expectedOrderOfVariables;
+	for (std::size_t variable = 1; variable <= numVariables; ++variable)
+		expectedOrderOfVariables.emplace_back(variable);
+	std::stable_sort(expectedOrderOfVariables.begin(), expectedOrderOfVariables.end(), [&activities](std::size_t lVariable, std::size_t rVariable) { return activities[lVariable] > activities[rVariable]; });
+	ASSERT_NO_FATAL_FAILURE(assertHeapPopOrderMatches(heap, expectedOrderOfVariables));
+}
+
+TEST_F(DecisionHeuristicTests, EvsidsPicksMostRecentlyBumpedVariables)
+{
+	EvsidsDecisionHeuristic heuristic;
+	heuristic.init(4);
+
+	const std::unordered_set<std::size_t> assignedVariables;
+	heuristic.onVariableBumpedDuringConflictAnalysis(2);
+	heuristic.onConflict();
+	heuristic.onVariableBumpedDuringConflictAnalysis(3);
+	heuristic.onConflict();
+	ASSERT_GT(heuristic.getActivityOfVariable(3), heuristic.getActivityOfVariable(2));
+
+	ASSERT_EQ(3, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(2, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(1, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(4, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_FALSE(heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)).has_value());
+}
+
+TEST_F(DecisionHeuristicTests, EvsidsSkipsAssignedVariablesAndReinsertsThemOnceUnassigned)
+{
+	EvsidsDecisionHeuristic heuristic;
+	heuristic.init(3);
+	heuristic.onVariableBumpedDuringConflictAnalysis(3);
+
+	std::unordered_set<std::size_t> assignedVariables({ 3 });
+	ASSERT_EQ(1, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	assignedVariables.emplace(1);
+
+	assignedVariables.erase(3);
+	assignedVariables.erase(1);
+	heuristic.onVariableUnassigned(3);
+	heuristic.onVariableUnassigned(1);
+	ASSERT_EQ(3, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(1, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(2, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+}
+
+TEST_F(DecisionHeuristicTests, EvsidsRescalingOfActivitiesPreservesOrder)
+{
+	EvsidsDecisionHeuristic heuristic(0.5);
+	heuristic.init(3);
+
+	// With a decay factor of 0.5 the increment doubles on every conflict and exceeds the rescaling threshold after ~333 conflicts
+	for (std::size_t i = 0; i < 400; ++i)
+	{
+		heuristic.onVariableBumpedDuringConflictAnalysis(i % 2 ? 2 : 3);
+		heuristic.onConflict();
+	}
+	ASSERT_LT(heuristic.getActivityOfVariable(2), 1e100);
+	ASSERT_LT(heuristic.getActivityOfVariable(3), heuristic.getActivityOfVariable(2));
+	ASSERT_GT(heuristic.getActivityOfVariable(3), 0.0);
+
+	const std::unordered_set<std::size_t> assignedVariables;
+	ASSERT_EQ(2, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(3, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(1, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+}
+
+TEST_F(DecisionHeuristicTests, EvsidsWithInvalidDecayFactorThrows)
+{
+	ASSERT_THROW(EvsidsDecisionHeuristic(0.0), std::invalid_argument);
+	ASSERT_THROW(EvsidsDecisionHeuristic(1.0), std::invalid_argument);
+}
+
+TEST_F(DecisionHeuristicTests, LearningRateBranchingRewardsVariablesParticipatingInConflicts)
+{
+	LearningRateBranchingDecisionHeuristic heuristic(LearningRateBranchingDecisionHeuristic::Configuration({ 0.5, 0.5, 0, 1 }));
+	heuristic.init(3);
+
+	// Variable 2 participates in both conflicts while it is assigned, variable 3 only in one of them
+	heuristic.onVariableAssigned(2);
+	heuristic.onVariableAssigned(3);
+	heuristic.onVariableBumpedDuringConflictAnalysis(2);
+	heuristic.onVariableBumpedDuringConflictAnalysis(3);
+	heuristic.onConflict();
+	heuristic.onVariableBumpedDuringConflictAnalysis(2);
+	heuristic.onConflict();
+	heuristic.onVariableUnassigned(2);
+	heuristic.onVariableUnassigned(3);
+
+	ASSERT_DOUBLE_EQ(0.5, heuristic.getScoreOfVariable(2));
+	ASSERT_DOUBLE_EQ(0.25, heuristic.getScoreOfVariable(3));
+	ASSERT_DOUBLE_EQ(0.0, heuristic.getScoreOfVariable(1));
+
+	const std::unordered_set<std::size_t> assignedVariables;
+	ASSERT_EQ(2, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(3, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_EQ(1, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+}
+
+TEST_F(DecisionHeuristicTests, LearningRateBranchingDecreasesStepSizeUntilMinimumIsReached)
+{
+	LearningRateBranchingDecisionHeuristic heuristic(LearningRateBranchingDecisionHeuristic::Configuration({ 0.4, 0.3, 0.04, 0.95 }));
+	heuristic.init(1);
+
+	heuristic.onConflict();
+	ASSERT_DOUBLE_EQ(0.36, heuristic.getStepSize());
+	for (std::size_t i = 0; i < 10; ++i)
+		heuristic.onConflict();
+	ASSERT_DOUBLE_EQ(0.3, heuristic.getStepSize());
+}
+
+TEST_F(DecisionHeuristicTests, LearningRateBranchingLocalityDecayPrefersRecentlyUnassignedVariables)
+{
+	LearningRateBranchingDecisionHeuristic heuristic(LearningRateBranchingDecisionHeuristic::Configuration({ 0.5, 0.5, 0, 0.5 }));
+	heuristic.init(2);
+
+	// Variable 1 obtains the higher score but is not assigned during the following conflicts, its score is thus decayed below the one of variable 2
+	heuristic.onVariableAssigned(1);
+	heuristic.onVariableBumpedDuringConflictAnalysis(1);
+	heuristic.onConflict();
+	heuristic.onVariableUnassigned(1);
+	ASSERT_DOUBLE_EQ(0.5, heuristic.getScoreOfVariable(1));
+
+	heuristic.onVariableAssigned(2);
+	heuristic.onVariableBumpedDuringConflictAnalysis(2);
+	heuristic.onConflict();
+	heuristic.onConflict();
+	heuristic.onVariableUnassigned(2);
+	ASSERT_DOUBLE_EQ(0.25, heuristic.getScoreOfVariable(2));
+
+	const std::unordered_set<std::size_t> assignedVariables;
+	ASSERT_EQ(2, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	ASSERT_DOUBLE_EQ(0.125, heuristic.getScoreOfVariable(1));
+}
+
+TEST_F(DecisionHeuristicTests, LearningRateBranchingWithInvalidConfigurationThrows)
+{
+	ASSERT_THROW(LearningRateBranchingDecisionHeuristic(LearningRateBranchingDecisionHeuristic::Configuration({ 0.4, 0.5, 1e-6, 0.95 })), std::invalid_argument);
+	ASSERT_THROW(LearningRateBranchingDecisionHeuristic(LearningRateBranchingDecisionHeuristic::Configuration({ 0.4, 0, 1e-6, 0.95 })), std::invalid_argument);
+	ASSERT_THROW(LearningRateBranchingDecisionHeuristic(LearningRateBranchingDecisionHeuristic::Configuration({ 0.4, 0.06, 1e-6, 0 })), std::invalid_argument);
+}
+
+TEST_F(DecisionHeuristicTests, SequentialHeuristicPicksSmallestUnassignedVariable)
+{
+	SequentialDecisionHeuristic heuristic;
+	heuristic.init(3);
+
+	std::unordered_set<std::size_t> assignedVariables({ 1 });
+	ASSERT_EQ(2, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+	assignedVariables.emplace(2);
+	assignedVariables.emplace(3);
+	ASSERT_FALSE(heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)).has_value());
+
+	assignedVariables.erase(2);
+	heuristic.onVariableUnassigned(2);
+	ASSERT_EQ(2, heuristic.pickBranchingVariable(createAssignmentCheck(assignedVariables)));
+}
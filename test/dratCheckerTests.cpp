@@ -0,0 +1,360 @@
+#include <gtest/gtest.h>
+
+#include "formulaTestUtils.hpp"
+#include "proof/dratChecker.hpp"
+#include "proof/proofWriter.hpp"
+#include "solver/solver.hpp"
+
+#include <random>
+#include <sstream>
+
+using namespace proof;
+
+class DratCheckerTests : public testing::Test {
+public:
+	struct ProofLine
+	{
+		bool isAddition;
+		std::vector<long> literals;
+	};
+
+	[[nodiscard]] static std::string encodeBinaryDratProof(const std::vector<ProofLine>& proofLines)
+	{
+		std::ostringstream outputStream;
+		ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+		for (const ProofLine& proofLine : proofLines)
+		{
+			if (proofLine.isAddition)
+				proofWriter.addClause(proofLine.literals);
+			else
+				proofWriter.deleteClause(proofLine.literals);
+		}
+		static_cast<void>(proofWriter.close());
+		return outputStream.str();
+	}
+
+	[[nodiscard]] static DratChecker::CheckResult verifyProofOfFormula(const std::vector<std::vector<long>>& clausesOfFormula, const std::string& binaryProof, DratChecker::CheckingMode checkingMode)
+	{
+		DratChecker dratChecker(0);
+		for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+			dratChecker.addOriginalClause(clauseLiterals);
+
+		std::istringstream proofStream(binaryProof);
+		return dratChecker.verifyProof(proofStream, checkingMode);
+	}
+
+	// Every assignment of the two variables falsifies one of the clauses of the formula
+	[[nodiscard]] static std::vector<std::vector<long>> generateFormulaFalsifiedByAllAssignmentsOfTwoVariables()
+	{
+		return { { 1, 2 }, { -1, 2 }, { 1, -2 }, { -1, -2 } };
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generatePigeonHoleFormula(std::size_t numHoles)
+	{
+		const std::size_t numPigeons = numHoles + 1;
+		const auto determineVariable = [numHoles](std::size_t pigeon, std::size_t hole) { return static_cast<long>(pigeon * numHoles + hole + 1); };
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+		{
+			std::vector<long> pigeonIsInSomeHoleClause;
+			for (std::size_t hole = 0; hole < numHoles; ++hole)
+				pigeonIsInSomeHoleClause.emplace_back(determineVariable(pigeon, hole));
+			clausesOfFormula.emplace_back(pigeonIsInSomeHoleClause);
+		}
+
+		for (std::size_t hole = 0; hole < numHoles; ++hole)
+		{
+			for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+			{
+				for (std::size_t otherPigeon = pigeon + 1; otherPigeon < numPigeons; ++otherPigeon)
+					clausesOfFormula.emplace_back(std::vector<long>({ -determineVariable(pigeon, hole), -determineVariable(otherPigeon, hole) }));
+			}
+		}
+		return clausesOfFormula;
+	}
+};
+
+TEST_F(DratCheckerTests, LiteralZeroInOriginalClauseThrows)
+{
+	DratChecker dratChecker(2);
+	ASSERT_THROW(dratChecker.addOriginalClause({ 1, 0, 2 }), std::invalid_argument);
+}
+
+TEST_F(DratCheckerTests, MalformedProofThrows)
+{
+	DratChecker dratChecker(2);
+	std::istringstream proofWithUnknownLineMarker(std::string({ 'x', 2, 0 }));
+	ASSERT_THROW(static_cast<void>(dratChecker.verifyProof(proofWithUnknownLineMarker, DratChecker::CheckingMode::Forward)), std::invalid_argument);
+
+	std::istringstream truncatedProof(std::string({ 'a', 2, static_cast<char>(0x80) }));
+	ASSERT_THROW(static_cast<void>(dratChecker.verifyProof(truncatedProof, DratChecker::CheckingMode::Forward)), std::invalid_argument);
+}
+
+TEST_F(DratCheckerTests, ReverseUnitPropagationProofIsVerifiedInBothModes)
+{
+	const std::string binaryProof = encodeBinaryDratProof({ { true, { 2 } }, { false, { -1, 2 } }, { true, {} } });
+	for (const DratChecker::CheckingMode checkingMode : { DratChecker::CheckingMode::Forward, DratChecker::CheckingMode::Backward })
+	{
+		const DratChecker::CheckResult checkResult = verifyProofOfFormula(generateFormulaFalsifiedByAllAssignmentsOfTwoVariables(), binaryProof, checkingMode);
+		ASSERT_TRUE(checkResult.isProofValid);
+		ASSERT_TRUE(checkResult.wasEmptyClauseDerived);
+		ASSERT_EQ(2, checkResult.numLemmas);
+		ASSERT_EQ(2, checkResult.numCheckedLemmas);
+		ASSERT_EQ(1, checkResult.numDeletions);
+		ASSERT_EQ(0, checkResult.numResolutionAsymmetricTautologies);
+		ASSERT_FALSE(checkResult.optionalIndexOfFirstInvalidProofLine.has_value());
+	}
+}
+
+TEST_F(DratCheckerTests, InvalidLemmaIsReportedWithIndexOfProofLine)
+{
+	// The lemma (2) is no longer implied after the deletion of the clause (-1 2)
+	const std::string binaryProof = encodeBinaryDratProof({ { false, { -1, 2 } }, { true, { 2 } }, { true, {} } });
+	const DratChecker::CheckResult checkResult = verifyProofOfFormula(generateFormulaFalsifiedByAllAssignmentsOfTwoVariables(), binaryProof, DratChecker::CheckingMode::Forward);
+	ASSERT_FALSE(checkResult.isProofValid);
+	ASSERT_FALSE(checkResult.wasEmptyClauseDerived);
+	ASSERT_EQ(1, checkResult.optionalIndexOfFirstInvalidProofLine);
+}
+
+TEST_F(DratCheckerTests, BackwardModeOnlyChecksLemmasRequiredToDeriveEmptyClause)
+{
+	std::vector<std::vector<long>> clausesOfFormula = generateFormulaFalsifiedByAllAssignmentsOfTwoVariables();
+	clausesOfFormula.emplace_back(std::vector<long>({ 3, 4 }));
+
+	// The lemma (-3) is neither a RUP nor a RAT but is not required to derive the empty clause
+	const std::string binaryProof = encodeBinaryDratProof({ { true, { -3 } }, { true, { 2 } }, { true, {} } });
+	const DratChecker::CheckResult forwardCheckResult = verifyProofOfFormula(clausesOfFormula, binaryProof, DratChecker::CheckingMode::Forward);
+	ASSERT_FALSE(forwardCheckResult.isProofValid);
+	ASSERT_EQ(0, forwardCheckResult.optionalIndexOfFirstInvalidProofLine);
+
+	const DratChecker::CheckResult backwardCheckResult = verifyProofOfFormula(clausesOfFormula, binaryProof, DratChecker::CheckingMode::Backward);
+	ASSERT_TRUE(backwardCheckResult.isProofValid);
+	ASSERT_EQ(3, backwardCheckResult.numLemmas);
+	ASSERT_EQ(2, backwardCheckResult.numCheckedLemmas);
+	ASSERT_EQ(4, backwardCheckResult.numCoreOriginalClauses);
+}
+
+TEST_F(DratCheckerTests, ResolutionAsymmetricTautologyOnFirstLiteralIsAccepted)
+{
+	// The definition of the fresh variable 3 as the conjunction of the variables 1 and 2 requires RATs on the literal -3 while its last clause is already implied since the variables 1 and 2 cannot both be true
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1, 2 }, { -1, -2 } };
+	const std::string binaryProof = encodeBinaryDratProof({ { true, { -3, 1 } }, { true, { -3, 2 } }, { true, { 3, -1, -2 } } });
+	const DratChecker::CheckResult checkResult = verifyProofOfFormula(clausesOfFormula, binaryProof, DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(checkResult.isProofValid);
+	ASSERT_FALSE(checkResult.wasEmptyClauseDerived);
+	ASSERT_EQ(3, checkResult.numCheckedLemmas);
+	ASSERT_EQ(2, checkResult.numResolutionAsymmetricTautologies);
+
+	// The RAT check is only performed on the first literal of the lemma
+	const std::string binaryProofWithOtherPivot = encodeBinaryDratProof({ { true, { -3, 1 } }, { true, { 2, -3 } }, { true, { 3, -1, -2 } } });
+	ASSERT_FALSE(verifyProofOfFormula(clausesOfFormula, binaryProofWithOtherPivot, DratChecker::CheckingMode::Forward).isProofValid);
+}
+
+TEST_F(DratCheckerTests, DeletionsOfUnitAndUnknownClausesAreIgnored)
+{
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1 }, { -1, 2 } };
+	const std::string binaryProof = encodeBinaryDratProof({ { false, { 1 } }, { false, { 3, 4 } }, { true, { 2 } } });
+	const DratChecker::CheckResult checkResult = verifyProofOfFormula(clausesOfFormula, binaryProof, DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(checkResult.isProofValid);
+	ASSERT_EQ(2, checkResult.numDeletions);
+	ASSERT_EQ(2, checkResult.numIgnoredDeletions);
+}
+
+TEST_F(DratCheckerTests, DeletedClauseIsFoundIndependentOfLiteralOrder)
+{
+	DratChecker dratChecker(3);
+	dratChecker.addOriginalClause({ 1, -2, 3 });
+	dratChecker.addOriginalClause({ -1, 2 });
+
+	std::istringstream proofStream(encodeBinaryDratProof({ { false, { 3, 1, -2 } } }));
+	const DratChecker::CheckResult checkResult = dratChecker.verifyProof(proofStream, DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(checkResult.isProofValid);
+	ASSERT_EQ(0, checkResult.numIgnoredDeletions);
+	ASSERT_EQ(1, dratChecker.getNumActiveClauses());
+}
+
+TEST_F(DratCheckerTests, ProofOfSolverForPigeonHoleFormulaIsVerified)
+{
+	constexpr std::size_t numHoles = 5;
+	const std::vector<std::vector<long>> clausesOfFormula = generatePigeonHoleFormula(numHoles);
+	auto problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numHoles * (numHoles + 1), clausesOfFormula.size());
+	std::size_t clauseIdx = 0;
+	for (const auto& literalsOfClause : clausesOfFormula)
+		ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+	solver::Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.initialClauseDatabaseReductionInterval = 50;
+	solverConfiguration.clauseDatabaseReductionIntervalIncrement = 10;
+	solver::Solver solver(*problemDefinition, solverConfiguration);
+	solver.setProofWriter(&proofWriter);
+	ASSERT_EQ(solver::Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_TRUE(proofWriter.close());
+
+	const DratChecker::CheckResult forwardCheckResult = verifyProofOfFormula(clausesOfFormula, outputStream.str(), DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(forwardCheckResult.isProofValid);
+	ASSERT_TRUE(forwardCheckResult.wasEmptyClauseDerived);
+	ASSERT_EQ(proofWriter.getNumAddedClauses(), forwardCheckResult.numCheckedLemmas);
+
+	const DratChecker::CheckResult backwardCheckResult = verifyProofOfFormula(clausesOfFormula, outputStream.str(), DratChecker::CheckingMode::Backward);
+	ASSERT_TRUE(backwardCheckResult.isProofValid);
+	ASSERT_TRUE(backwardCheckResult.wasEmptyClauseDerived);
+	ASSERT_LE(backwardCheckResult.numCheckedLemmas, forwardCheckResult.numCheckedLemmas);
+	ASSERT_GT(backwardCheckResult.numCoreOriginalClauses, 0);
+	ASSERT_LE(backwardCheckResult.numCoreOriginalClauses, clausesOfFormula.size());
+}
+
+TEST_F(DratCheckerTests, SetBlockedClauseIsRedundantWithRespectToBlockingSetWitness)
+{
+	// The clause (1 2) is blocked by the set {1, 2} but neither by the literal 1 nor the literal 2
+	DratChecker dratChecker(4);
+	for (const std::vector<long>& clauseLiterals : std::vector<std::vector<long>>({ { 1, 2 }, { -1, 2 }, { 1, -2 }, { 3, 4 } }))
+		dratChecker.addOriginalClause(clauseLiterals);
+
+	ASSERT_TRUE(dratChecker.isClauseRedundantWithRespectToWitness({ 1, 2 }, { 1, 2 }));
+	ASSERT_FALSE(dratChecker.isClauseRedundantWithRespectToWitness({ 1, 2 }, { 1, -2 }));
+	ASSERT_FALSE(dratChecker.isClauseRedundantWithRespectToWitness({ 1, 2 }, { -1, 2 }));
+	// The witness needs to satisfy the clause
+	ASSERT_FALSE(dratChecker.isClauseRedundantWithRespectToWitness({ 1, 2 }, { -1, -2 }));
+	// Checking the redundancy of a clause of the formula does not remove it
+	ASSERT_EQ(4, dratChecker.getNumActiveClauses());
+	ASSERT_TRUE(dratChecker.isClauseImpliedByUnitPropagation({ 1, 2 }));
+}
+
+TEST_F(DratCheckerTests, BlockedClauseIsRedundantWithRespectToBlockingLiteralWitness)
+{
+	// The clause (1 2) is blocked by the literal 1 since its only resolvent (2 -2) is a tautology
+	DratChecker dratChecker(3);
+	for (const std::vector<long>& clauseLiterals : std::vector<std::vector<long>>({ { 1, 2 }, { -1, -2 }, { 2, 3 } }))
+		dratChecker.addOriginalClause(clauseLiterals);
+
+	ASSERT_TRUE(dratChecker.isClauseRedundantWithRespectToWitness({ 1, 2 }, { 1, -2 }));
+	ASSERT_FALSE(dratChecker.isClauseImpliedByUnitPropagation({ 1 }));
+	ASSERT_TRUE(dratChecker.isClauseImpliedByUnitPropagation({ 1, 2, 3 }));
+}
+
+TEST_F(DratCheckerTests, ProofOfSolverWithInprocessingIsVerified)
+{
+	constexpr std::size_t numHoles = 5;
+	const auto auxiliaryVariable = static_cast<long>(numHoles * (numHoles + 1) + 1);
+	std::vector<std::vector<long>> clausesOfFormula = generatePigeonHoleFormula(numHoles);
+	// The duplicate of the first clause is deleted by the subsumption during inprocessing while the blocked clauses over the auxiliary variable are kept since a proof is recorded
+	clausesOfFormula.emplace_back(std::vector<long>({ auxiliaryVariable, 1 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ -auxiliaryVariable, -1 }));
+	clausesOfFormula.emplace_back(clausesOfFormula.front());
+
+	auto problemDefinition = std::make_shared<dimacs::ProblemDefinition>(static_cast<std::size_t>(auxiliaryVariable), clausesOfFormula.size());
+	std::size_t clauseIdx = 0;
+	for (const auto& literalsOfClause : clausesOfFormula)
+		ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+	solver::Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalStableModeDecisionHeuristic = solver::Solver::DecisionHeuristic::Evsids;
+	solverConfiguration.initialSearchModeSwitchConflictInterval = 10;
+	solverConfiguration.optionalInprocessingInterval = 10;
+	// Vivified clauses are added to the proof prior to the deletion of the original clauses
+	solverConfiguration.isVivificationEnabledPerLearnedClauseTier = { true, true, true };
+	solverConfiguration.isVivificationOfIrredundantClausesEnabled = true;
+	solver::Solver solver(*problemDefinition, solverConfiguration);
+	solver.setProofWriter(&proofWriter);
+	ASSERT_EQ(solver::Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_TRUE(proofWriter.close());
+	ASSERT_GT(solver.getStatistics().numInprocessingRounds, 0);
+
+	for (const DratChecker::CheckingMode checkingMode : { DratChecker::CheckingMode::Forward, DratChecker::CheckingMode::Backward })
+	{
+		const DratChecker::CheckResult checkResult = verifyProofOfFormula(clausesOfFormula, outputStream.str(), checkingMode);
+		ASSERT_TRUE(checkResult.isProofValid);
+		ASSERT_TRUE(checkResult.wasEmptyClauseDerived);
+	}
+}
+
+TEST_F(DratCheckerTests, ProofOfProbingWithHyperBinaryResolutionAndLiftingIsVerified)
+{
+	constexpr std::size_t numHoles = 5;
+	const auto firstAuxiliaryVariable = static_cast<long>(numHoles * (numHoles + 1) + 1);
+	std::vector<std::vector<long>> clausesOfFormula = generatePigeonHoleFormula(numHoles);
+	// The variable a + 2 is implied by both polarities of a (by the ternary clauses whose implications are hyper-binary resolvents) while its negation does not fail
+	clausesOfFormula.emplace_back(std::vector<long>({ -firstAuxiliaryVariable, firstAuxiliaryVariable + 1 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ -firstAuxiliaryVariable, -(firstAuxiliaryVariable + 1), firstAuxiliaryVariable + 2 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ firstAuxiliaryVariable, firstAuxiliaryVariable + 3 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ firstAuxiliaryVariable, -(firstAuxiliaryVariable + 3), firstAuxiliaryVariable + 2 }));
+	// The literal a + 4 fails since it implies both polarities of a + 5
+	clausesOfFormula.emplace_back(std::vector<long>({ -(firstAuxiliaryVariable + 4), firstAuxiliaryVariable + 5 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ -(firstAuxiliaryVariable + 4), -(firstAuxiliaryVariable + 5) }));
+
+	auto problemDefinition = std::make_shared<dimacs::ProblemDefinition>(static_cast<std::size_t>(firstAuxiliaryVariable + 5), clausesOfFormula.size());
+	std::size_t clauseIdx = 0;
+	for (const auto& literalsOfClause : clausesOfFormula)
+		ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+	solver::Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalInprocessingInterval = 10;
+	solverConfiguration.perInprocessingPassEffortsInPerMille = { 1000, 0, 0, 0, 0 };
+	solver::Solver solver(*problemDefinition, solverConfiguration);
+	solver.setProofWriter(&proofWriter);
+	ASSERT_EQ(solver::Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_TRUE(proofWriter.close());
+
+	const solver::Solver::InprocessingPassStatistics& probingStatistics = solver.getStatistics().perInprocessingPassStatistics[solver::Solver::InprocessingPass::Probing];
+	ASSERT_GE(probingStatistics.numAddedClauses, 2);
+	ASSERT_GE(probingStatistics.numDerivedUnitClauses, 2);
+	for (const DratChecker::CheckingMode checkingMode : { DratChecker::CheckingMode::Forward, DratChecker::CheckingMode::Backward })
+	{
+		const DratChecker::CheckResult checkResult = verifyProofOfFormula(clausesOfFormula, outputStream.str(), checkingMode);
+		ASSERT_TRUE(checkResult.isProofValid);
+		ASSERT_TRUE(checkResult.wasEmptyClauseDerived);
+	}
+}
+
+TEST_F(DratCheckerTests, ProofOfIncrementalSolverWithInprocessingIsVerified)
+{
+	constexpr std::size_t numVariables = 14;
+	std::default_random_engine rng(41);
+
+	// Frequent switches of the search mode provide the restarts at which the inprocessing is performed. Blocked and set-blocked clauses are not eliminated while a proof is recorded
+	// since their restoration, once clauses are added to the formula, could not be justified in the DRAT proof.
+	solver::Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalStableModeDecisionHeuristic = solver::Solver::DecisionHeuristic::Evsids;
+	solverConfiguration.initialSearchModeSwitchConflictInterval = 2;
+	solverConfiguration.optionalInprocessingInterval = 1;
+	solverConfiguration.perInprocessingPassEffortsInPerMille = { 0, 0, 0, 1000, 1000 };
+	for (std::size_t formulaIndex = 0; formulaIndex < 200; ++formulaIndex)
+	{
+		SCOPED_TRACE("Formula " + std::to_string(formulaIndex));
+		std::vector<std::vector<long>> clausesOfFormula = formulaTestUtils::generateRandomFormula(numVariables, 40, { 0, 0, 1, 3 }, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(formulaTestUtils::generateProblemDefinition(numVariables, clausesOfFormula, problemDefinition));
+
+		std::ostringstream outputStream;
+		ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+		solver::Solver solver(*problemDefinition, solverConfiguration);
+		solver.setProofWriter(&proofWriter);
+		// Clauses are added between the calls of solve() until the formula becomes unsatisfiable, its proof then needs to be valid with respect to the original and the added clauses
+		while (solver.solve() == solver::Solver::SolverResult::Sat)
+		{
+			for (const std::vector<long>& clauseLiterals : formulaTestUtils::generateRandomFormula(numVariables, 4, { 0, 0, 1, 3 }, rng))
+			{
+				solver.addClause(clauseLiterals);
+				clausesOfFormula.emplace_back(clauseLiterals);
+			}
+		}
+		ASSERT_TRUE(proofWriter.close());
+		ASSERT_EQ(0, solver.getStatistics().perInprocessingPassStatistics[solver::Solver::InprocessingPass::BlockedClauseElimination].numRemovedClauses);
+		ASSERT_EQ(0, solver.getStatistics().perInprocessingPassStatistics[solver::Solver::InprocessingPass::SetBlockedClauseElimination].numRemovedClauses);
+		ASSERT_EQ(0, solver.getStatistics().numRestoredEliminatedClauses);
+
+		for (const DratChecker::CheckingMode checkingMode : { DratChecker::CheckingMode::Forward, DratChecker::CheckingMode::Backward })
+		{
+			const DratChecker::CheckResult checkResult = verifyProofOfFormula(clausesOfFormula, outputStream.str(), checkingMode);
+			ASSERT_TRUE(checkResult.isProofValid);
+			ASSERT_TRUE(checkResult.wasEmptyClauseDerived);
+		}
+	}
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include "formulaTestUtils.hpp"
+#include "optimizations/equivalentLiteralSubstitution/equivalentLiteralSubstitutor.hpp"
+#include "solver/solver.hpp"
+
+#include <random>
+#include <sstream>
+
+using namespace equivalentLiteralSubstitution;
+using namespace formulaTestUtils;
+
+class EquivalentLiteralSubstitutorTests : public testing::Test {};
+
+TEST_F(EquivalentLiteralSubstitutorTests, MissingProblemDefinitionThrows)
+{
+	ASSERT_THROW(EquivalentLiteralSubstitutor(nullptr), std::invalid_argument);
+}
+
+TEST_F(EquivalentLiteralSubstitutorTests, LiteralsOfComponentAreReplacedByRepresentative)
+{
+	// The cycle 3 -> 2 -> -1 -> 3 makes the literals -1, 2 and 3 equivalent, the literal -1 of the smallest variable is their representative
+	const std::vector<std::vector<long>> clausesOfFormula = { { -3, 2 }, { -2, -1 }, { 1, 3 }, { 2, 3, 4 }, { 1, 2, 5 }, { -4, -5 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(5, clausesOfFormula, problemDefinition));
+
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	EquivalentLiteralSubstitutor equivalentLiteralSubstitutor(problemDefinition);
+	ASSERT_TRUE(equivalentLiteralSubstitutor.substituteEquivalentLiterals(modelReconstructionStack));
+
+	const EquivalentLiteralSubstitutor::SubstitutionStatistics& statistics = equivalentLiteralSubstitutor.getStatistics();
+	ASSERT_EQ(1, statistics.numEquivalenceClasses);
+	ASSERT_EQ(2, statistics.numSubstitutedVariables);
+	// The binary clauses of the cycle as well as the clause (1 2 5) become tautologies
+	ASSERT_EQ(4, statistics.numRemovedClauses);
+	ASSERT_EQ(1, statistics.numRewrittenClauses);
+
+	const std::vector<long>& representativeLiterals = equivalentLiteralSubstitutor.getRepresentativeLiterals();
+	ASSERT_EQ(-1, representativeLiterals[2 * 2]);
+	ASSERT_EQ(1, representativeLiterals[2 * 2 + 1]);
+	ASSERT_EQ(-1, representativeLiterals[3 * 2]);
+	ASSERT_EQ(4, representativeLiterals[4 * 2]);
+
+	const dimacs::ProblemDefinition::Clause* rewrittenClause = problemDefinition->getClauseByIndexInFormula(3);
+	ASSERT_NE(nullptr, rewrittenClause);
+	ASSERT_EQ(std::vector<long>({ -1, 4 }), rewrittenClause->literals);
+	ASSERT_EQ(2, problemDefinition->getNumClausesAfterOptimizations());
+	for (const long substitutedLiteral : { 2, -2, 3, -3 })
+		ASSERT_FALSE(problemDefinition->getLiteralOccurrenceLookup().getNumberOfOccurrencesOfLiteral(substitutedLiteral).value_or(0));
+
+	// Both substituted variables are assigned the value of their representative
+	ASSERT_EQ(4, modelReconstructionStack.getNumEntries());
+	const std::vector<long> reconstructedModel = modelReconstructionStack.reconstructModel({ 1, -2, -3, -4, 5 });
+	ASSERT_EQ(std::vector<long>({ 1, -2, -3, -4, 5 }), reconstructedModel);
+	ASSERT_TRUE(initializeModelChecker(clausesOfFormula).isModelOfFormula(modelReconstructionStack.reconstructModel({ -1, 2, -3, 4, -5 })));
+}
+
+TEST_F(EquivalentLiteralSubstitutorTests, EquivalentLiteralsOfBinaryClauseYieldUnitClause)
+{
+	// The literals 1 and 2 are equivalent, thus the clause (1 2) is reduced to the unit clause (1)
+	const std::vector<std::vector<long>> clausesOfFormula = { { -1, 2 }, { 1, -2 }, { 1, 2 }, { -1, 3 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(3, clausesOfFormula, problemDefinition));
+
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	EquivalentLiteralSubstitutor equivalentLiteralSubstitutor(problemDefinition);
+	ASSERT_TRUE(equivalentLiteralSubstitutor.substituteEquivalentLiterals(modelReconstructionStack));
+
+	const dimacs::ProblemDefinition::Clause* unitClause = problemDefinition->getClauseByIndexInFormula(2);
+	ASSERT_NE(nullptr, unitClause);
+	ASSERT_EQ(std::vector<long>({ 1 }), unitClause->literals);
+
+	solver::Solver solver(*problemDefinition);
+	ASSERT_EQ(solver::Solver::SolverResult::Sat, solver.solve());
+	ASSERT_TRUE(initializeModelChecker(clausesOfFormula).isModelOfFormula(modelReconstructionStack.reconstructModel(solver.getModel())));
+}
+
+TEST_F(EquivalentLiteralSubstitutorTests, LiteralEquivalentToItsNegationIsAddedToProof)
+{
+	// The implications 1 -> 2 -> -1 and -1 -> 3 -> 1 place both literals of the variable 1 in the same SCC
+	const std::vector<std::vector<long>> clausesOfFormula = { { -1, 2 }, { -2, -1 }, { 1, 3 }, { -3, 1 }, { 2, 3, 4 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(4, clausesOfFormula, problemDefinition));
+
+	std::ostringstream proofStream;
+	proof::ProofWriter proofWriter(proofStream, proof::ProofWriter::ProofFormat::Drat);
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	EquivalentLiteralSubstitutor equivalentLiteralSubstitutor(problemDefinition);
+	equivalentLiteralSubstitutor.setProofWriter(&proofWriter);
+	ASSERT_FALSE(equivalentLiteralSubstitutor.substituteEquivalentLiterals(modelReconstructionStack));
+	ASSERT_TRUE(proofWriter.close());
+
+	const proof::DratChecker::CheckResult checkResult = verifyProofOfFormula(4, clausesOfFormula, proofStream.str(), proof::DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(checkResult.isProofValid);
+	ASSERT_TRUE(checkResult.wasEmptyClauseDerived);
+}
+
+TEST_F(EquivalentLiteralSubstitutorTests, ExhaustedBudgetStopsSubstitution)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(3, { { -1, 2 }, { 1, -2 }, { 2, 3 } }, problemDefinition));
+
+	budget::ResourceBudget resourceBudget;
+	resourceBudget.interrupt();
+	modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+	EquivalentLiteralSubstitutor equivalentLiteralSubstitutor(problemDefinition);
+	equivalentLiteralSubstitutor.setResourceBudget(&resourceBudget);
+	ASSERT_TRUE(equivalentLiteralSubstitutor.substituteEquivalentLiterals(modelReconstructionStack));
+	ASSERT_EQ(0, equivalentLiteralSubstitutor.getStatistics().numSubstitutedVariables);
+	ASSERT_EQ(3, problemDefinition->getNumClausesAfterOptimizations());
+	ASSERT_TRUE(modelReconstructionStack.isEmpty());
+}
+
+TEST_F(EquivalentLiteralSubstitutorTests, SubstitutionOfRandomFormulasPreservesSatisfiabilityWithValidProofsAndReconstructedModels)
+{
+	constexpr std::size_t numVariables = 10;
+	std::default_random_engine rng(49);
+	std::size_t numFormulasWithSubstitutions = 0;
+	for (std::size_t formulaIndex = 0; formulaIndex < 200; ++formulaIndex)
+	{
+		SCOPED_TRACE("Formula " + std::to_string(formulaIndex));
+		// Most clauses of the generated formulas are binary clauses, thus the binary implication graph usually contains non-trivial SCCs
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomFormula(numVariables, 8 + formulaIndex % 16, { 0, 1, 6, 3 }, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariables, clausesOfFormula, problemDefinition));
+
+		std::ostringstream proofStream;
+		proof::ProofWriter proofWriter(proofStream, proof::ProofWriter::ProofFormat::Drat);
+		modelReconstruction::ModelReconstructionStack modelReconstructionStack;
+		EquivalentLiteralSubstitutor equivalentLiteralSubstitutor(problemDefinition);
+		equivalentLiteralSubstitutor.setProofWriter(&proofWriter);
+		const bool wasSubstitutionSuccessful = equivalentLiteralSubstitutor.substituteEquivalentLiterals(modelReconstructionStack);
+		numFormulasWithSubstitutions += equivalentLiteralSubstitutor.getStatistics().numSubstitutedVariables > 0;
+		ASSERT_NO_FATAL_FAILURE(assertReducedFormulaIsSolvedWithValidProofOrModel(numVariables, clausesOfFormula, wasSubstitutionSuccessful, *problemDefinition, modelReconstructionStack, proofWriter, proofStream, proof::DratChecker::CheckingMode::Backward));
+	}
+	ASSERT_GT(numFormulasWithSubstitutions, 0);
+}
@@ -0,0 +1,124 @@
+#ifndef FORMULA_TEST_UTILS_HPP
+#define FORMULA_TEST_UTILS_HPP
+
+#include <gtest/gtest.h>
+
+#include "dimacs/problemDefinition.hpp"
+#include "optimizations/modelReconstruction/modelChecker.hpp"
+#include "optimizations/modelReconstruction/modelReconstructionStack.hpp"
+#include "proof/dratChecker.hpp"
+#include "proof/proofWriter.hpp"
+#include "solver/solver.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Helpers shared by the test suites of the simplification passes that are checked against random formulas
+namespace formulaTestUtils
+{
+	inline void generateProblemDefinition(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, dimacs::ProblemDefinition::ptr& problemDefinition)
+	{
+		problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numVariablesInFormula, clausesOfFormula.size());
+		ASSERT_TRUE(problemDefinition);
+
+		std::size_t clauseIdx = 0;
+		for (const auto& literalsOfClause : clausesOfFormula)
+			ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+	}
+
+	[[nodiscard]] inline modelReconstruction::ModelChecker initializeModelChecker(const std::vector<std::vector<long>>& clausesOfFormula)
+	{
+		modelReconstruction::ModelChecker modelChecker;
+		for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+			modelChecker.addClause(clauseLiterals);
+		return modelChecker;
+	}
+
+	[[nodiscard]] inline std::vector<long> generateModelFromAssignment(std::size_t numVariables, std::size_t assignment)
+	{
+		std::vector<long> model;
+		for (std::size_t variable = 1; variable <= numVariables; ++variable)
+			model.emplace_back(assignment & (static_cast<std::size_t>(1) << (variable - 1)) ? static_cast<long>(variable) : -static_cast<long>(variable));
+		return model;
+	}
+
+	[[nodiscard]] inline bool isFormulaSatisfiableByBruteForce(std::size_t numVariables, const std::vector<std::vector<long>>& clausesOfFormula)
+	{
+		const modelReconstruction::ModelChecker modelChecker = initializeModelChecker(clausesOfFormula);
+		for (std::size_t assignment = 0; assignment < static_cast<std::size_t>(1) << numVariables; ++assignment)
+		{
+			if (modelChecker.isModelOfFormula(generateModelFromAssignment(numVariables, assignment)))
+				return true;
+		}
+		return false;
+	}
+
+	/*
+	 * Generates clauses over distinct variables whose size is drawn from the given weights, i.e. a clause of size k is generated with a probability proportional to weightsOfClauseSizes[k].
+	 * The weight of the empty clause is expected to be zero.
+	 */
+	[[nodiscard]] inline std::vector<std::vector<long>> generateRandomFormula(std::size_t numVariables, std::size_t numClauses, const std::vector<double>& weightsOfClauseSizes, std::default_random_engine& rng)
+	{
+		std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(numVariables));
+		std::discrete_distribution<std::size_t> clauseSizeDistribution(weightsOfClauseSizes.cbegin(), weightsOfClauseSizes.cend());
+		std::bernoulli_distribution polarityDistribution(0.5);
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		while (clausesOfFormula.size() < numClauses)
+		{
+			const std::size_t clauseSize = clauseSizeDistribution(rng);
+			std::vector<long> clauseLiterals;
+			while (clauseLiterals.size() < clauseSize)
+			{
+				const long variable = variableDistribution(rng);
+				if (std::none_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [variable](const long literal) { return std::abs(literal) == variable; }))
+					clauseLiterals.emplace_back(polarityDistribution(rng) ? variable : -variable);
+			}
+			clausesOfFormula.emplace_back(clauseLiterals);
+		}
+		return clausesOfFormula;
+	}
+
+	[[nodiscard]] inline proof::DratChecker::CheckResult verifyProofOfFormula(std::size_t numVariables, const std::vector<std::vector<long>>& clausesOfFormula, const std::string& binaryProof, proof::DratChecker::CheckingMode checkingMode)
+	{
+		proof::DratChecker dratChecker(numVariables);
+		for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+			dratChecker.addOriginalClause(clauseLiterals);
+		std::istringstream binaryProofStream(binaryProof);
+		return dratChecker.verifyProof(binaryProofStream, checkingMode);
+	}
+
+	/*
+	 * Solves the formula remaining after a simplification pass that recorded its steps in the given proof and compares the result with the brute-force result of the original formula.
+	 * Models of the reduced formula need to be models of the original formula after their reconstruction while the proof of an unsatisfiable formula, which is closed by this function,
+	 * needs to derive the empty clause from the original formula.
+	 */
+	inline void assertReducedFormulaIsSolvedWithValidProofOrModel(std::size_t numVariables, const std::vector<std::vector<long>>& clausesOfFormula, bool wasSimplificationSuccessful, const dimacs::ProblemDefinition& reducedProblemDefinition,
+		const modelReconstruction::ModelReconstructionStack& modelReconstructionStack, proof::ProofWriter& proofWriter, const std::ostringstream& proofStream, proof::DratChecker::CheckingMode checkingMode)
+	{
+		const bool isFormulaSatisfiable = isFormulaSatisfiableByBruteForce(numVariables, clausesOfFormula);
+		if (wasSimplificationSuccessful)
+		{
+			solver::Solver solver(reducedProblemDefinition);
+			solver.setProofWriter(&proofWriter);
+			ASSERT_EQ(isFormulaSatisfiable ? solver::Solver::SolverResult::Sat : solver::Solver::SolverResult::Unsat, solver.solve());
+			if (isFormulaSatisfiable)
+			{
+				ASSERT_TRUE(initializeModelChecker(clausesOfFormula).isModelOfFormula(modelReconstructionStack.reconstructModel(solver.getModel())));
+				return;
+			}
+		}
+		else
+			ASSERT_FALSE(isFormulaSatisfiable);
+		ASSERT_TRUE(proofWriter.close());
+
+		const proof::DratChecker::CheckResult checkResult = verifyProofOfFormula(numVariables, clausesOfFormula, proofStream.str(), checkingMode);
+		ASSERT_TRUE(checkResult.isProofValid);
+		ASSERT_TRUE(checkResult.wasEmptyClauseDerived);
+	}
+}
+#endif
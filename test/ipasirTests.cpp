@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include "ipasir/ipasir.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+	// The allocation after the given number of further allocations fails, which triggers the internal error handling of the IPASIR layer without throwing exceptions through its C interface
+	std::atomic<long> numAllocationsUntilFailure = -1;
+}
+
+void* operator new(std::size_t size)
+{
+	if (numAllocationsUntilFailure.load() >= 0 && numAllocationsUntilFailure.fetch_sub(1) == 0)
+		throw std::bad_alloc();
+	if (void* memory = std::malloc(size ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+class IpasirTests : public testing::Test {
+public:
+	void SetUp() override
+	{
+		solver = ipasir_init();
+		ASSERT_NE(nullptr, solver);
+	}
+
+	void TearDown() override
+	{
+		ipasir_release(solver);
+	}
+
+	void addClause(const std::vector<int32_t>& clauseLiterals) const
+	{
+		for (const int32_t literal : clauseLiterals)
+			ipasir_add(solver, literal);
+		ipasir_add(solver, 0);
+	}
+
+	void addPigeonHoleFormula(int32_t numHoles) const
+	{
+		for (int32_t pigeon = 0; pigeon <= numHoles; ++pigeon)
+		{
+			for (int32_t hole = 0; hole < numHoles; ++hole)
+				ipasir_add(solver, pigeon * numHoles + hole + 1);
+			ipasir_add(solver, 0);
+		}
+
+		for (int32_t hole = 0; hole < numHoles; ++hole)
+		{
+			for (int32_t pigeon = 0; pigeon <= numHoles; ++pigeon)
+			{
+				for (int32_t otherPigeon = pigeon + 1; otherPigeon <= numHoles; ++otherPigeon)
+					addClause({ -(pigeon * numHoles + hole + 1), -(otherPigeon * numHoles + hole + 1) });
+			}
+		}
+	}
+
+protected:
+	void* solver = nullptr;
+};
+
+TEST_F(IpasirTests, SignatureIsDefined)
+{
+	ASSERT_NE(nullptr, ipasir_signature());
+}
+
+TEST_F(IpasirTests, IncrementalQueriesUnderAssumptions)
+{
+	addClause({ 1, 2 });
+	addClause({ -1, 3 });
+	ASSERT_EQ(10, ipasir_solve(solver));
+	ASSERT_TRUE(ipasir_val(solver, 1) == 1 || ipasir_val(solver, 2) == 2);
+
+	ipasir_assume(solver, -2);
+	ipasir_assume(solver, -3);
+	ASSERT_EQ(20, ipasir_solve(solver));
+	ASSERT_EQ(1, ipasir_failed(solver, -2));
+	ASSERT_EQ(1, ipasir_failed(solver, -3));
+
+	// Assumptions are only valid for a single call
+	ipasir_assume(solver, -2);
+	ASSERT_EQ(10, ipasir_solve(solver));
+	ASSERT_EQ(1, ipasir_val(solver, 1));
+	ASSERT_EQ(-2, ipasir_val(solver, -2));
+	ASSERT_EQ(3, ipasir_val(solver, -3));
+
+	addClause({ -3 });
+	ASSERT_EQ(10, ipasir_solve(solver));
+	ASSERT_EQ(2, ipasir_val(solver, 2));
+
+	addClause({ -2 });
+	ASSERT_EQ(20, ipasir_solve(solver));
+}
+
+TEST_F(IpasirTests, AssumptionOfUnknownVariable)
+{
+	addClause({ 1 });
+	ipasir_assume(solver, 5);
+	ASSERT_EQ(10, ipasir_solve(solver));
+	ASSERT_EQ(5, ipasir_val(solver, 5));
+	ASSERT_EQ(0, ipasir_failed(solver, 5));
+}
+
+TEST_F(IpasirTests, TerminationCallbackInterruptsSearch)
+{
+	ASSERT_NO_FATAL_FAILURE(addPigeonHoleFormula(7));
+	ipasir_set_terminate(solver, nullptr, [](void*) { return 1; });
+	ASSERT_EQ(0, ipasir_solve(solver));
+
+	ipasir_set_terminate(solver, nullptr, nullptr);
+	ASSERT_EQ(20, ipasir_solve(solver));
+}
+
+TEST_F(IpasirTests, LearnedClausesArePassedToCallback)
+{
+	constexpr int maximumLengthOfLearnedClauses = 2;
+	ASSERT_NO_FATAL_FAILURE(addPigeonHoleFormula(5));
+
+	std::vector<std::vector<int32_t>> learnedClauses;
+	ipasir_set_learn(solver, &learnedClauses, maximumLengthOfLearnedClauses, [](void* data, int32_t* clause)
+	{
+		std::vector<int32_t> learnedClause;
+		while (*clause)
+			learnedClause.emplace_back(*clause++);
+		static_cast<std::vector<std::vector<int32_t>>*>(data)->emplace_back(learnedClause);
+	});
+	ASSERT_EQ(20, ipasir_solve(solver));
+	ASSERT_FALSE(learnedClauses.empty());
+	for (const std::vector<int32_t>& learnedClause : learnedClauses)
+	{
+		ASSERT_FALSE(learnedClause.empty());
+		ASSERT_LE(learnedClause.size(), maximumLengthOfLearnedClauses);
+	}
+}
+
+TEST_F(IpasirTests, FailedAllocationPutsSolverIntoErrorState)
+{
+	ASSERT_NO_FATAL_FAILURE(addPigeonHoleFormula(5));
+	// The new variable of the clause requires the solver to grow its per-variable data
+	ipasir_add(solver, 100);
+	numAllocationsUntilFailure = 0;
+	ipasir_add(solver, 0);
+	numAllocationsUntilFailure = -1;
+	ASSERT_EQ(0, ipasir_solve(solver));
+
+	// Further clauses are ignored and every query remains unknown
+	ASSERT_NO_FATAL_FAILURE(addClause({ 1 }));
+	ASSERT_EQ(0, ipasir_solve(solver));
+	ASSERT_EQ(0, ipasir_solve(solver));
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include "solver/localSearch.hpp"
+#include "solver/solver.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+using namespace solver;
+
+class LocalSearchTests : public testing::Test {
+public:
+	// Every clause is satisfied by the given hidden assignment, thus the formula is satisfiable independent of its clause-to-variable ratio
+	[[nodiscard]] static std::vector<std::vector<long>> generatePlantedThreeSatFormula(const std::vector<char>& hiddenAssignment, std::size_t numClauses, std::default_random_engine& rng)
+	{
+		std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(hiddenAssignment.size() - 1));
+		std::bernoulli_distribution polarityDistribution(0.5);
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		while (clausesOfFormula.size() < numClauses)
+		{
+			std::vector<long> clauseLiterals;
+			while (clauseLiterals.size() < 3)
+			{
+				const long variable = variableDistribution(rng);
+				if (std::none_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [variable](const long literal) { return std::abs(literal) == variable; }))
+					clauseLiterals.emplace_back(polarityDistribution(rng) ? variable : -variable);
+			}
+			if (std::any_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [&hiddenAssignment](const long literal) { return hiddenAssignment[static_cast<std::size_t>(std::abs(literal))] == static_cast<char>(literal > 0); }))
+				clausesOfFormula.emplace_back(clauseLiterals);
+		}
+		return clausesOfFormula;
+	}
+
+	[[nodiscard]] static std::vector<char> generateRandomAssignment(std::size_t numVariables, std::default_random_engine& rng)
+	{
+		std::bernoulli_distribution polarityDistribution(0.5);
+		std::vector<char> assignment(numVariables + 1, 0);
+		for (std::size_t variable = 1; variable <= numVariables; ++variable)
+			assignment[variable] = static_cast<char>(polarityDistribution(rng));
+		return assignment;
+	}
+
+	[[nodiscard]] static std::size_t determineNumFalsifiedClauses(const std::vector<std::vector<long>>& clausesOfFormula, const std::vector<char>& assignment)
+	{
+		return static_cast<std::size_t>(std::count_if(clausesOfFormula.cbegin(), clausesOfFormula.cend(), [&assignment](const std::vector<long>& clauseLiterals)
+		{
+			return std::none_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [&assignment](const long literal) { return assignment[static_cast<std::size_t>(std::abs(literal))] == static_cast<char>(literal > 0); });
+		}));
+	}
+
+	static void generateProblemDefinition(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, dimacs::ProblemDefinition::ptr& problemDefinition)
+	{
+		problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numVariablesInFormula, clausesOfFormula.size());
+		ASSERT_TRUE(problemDefinition);
+
+		std::size_t clauseIdx = 0;
+		for (const auto& literalsOfClause : clausesOfFormula)
+			ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+	}
+};
+
+TEST_F(LocalSearchTests, InvalidClausesAndPhasesThrow)
+{
+	LocalSearch localSearch(3, LocalSearch::LocalSearchConfiguration());
+	ASSERT_THROW(localSearch.addClause(std::vector<long>()), std::invalid_argument);
+	ASSERT_THROW(localSearch.addClause({ 1, 0 }), std::invalid_argument);
+	ASSERT_THROW(localSearch.addClause({ 1, -4 }), std::invalid_argument);
+
+	std::vector<char> phases(3, 0);
+	ASSERT_THROW(static_cast<void>(localSearch.search(phases, 1000)), std::invalid_argument);
+
+	LocalSearch::LocalSearchConfiguration localSearchConfiguration;
+	localSearchConfiguration.algorithm = LocalSearch::Algorithm::WalkSat;
+	localSearchConfiguration.walkSatNoise = 1.5;
+	ASSERT_THROW(LocalSearch(3, localSearchConfiguration), std::invalid_argument);
+}
+
+TEST_F(LocalSearchTests, TautologiesAreIgnoredAndDuplicateLiteralsAreRemoved)
+{
+	LocalSearch localSearch(2, LocalSearch::LocalSearchConfiguration());
+	localSearch.addClause({ 1, -1, 2 });
+	ASSERT_EQ(0, localSearch.getNumClauses());
+
+	// The duplicate literal would otherwise be counted twice as a satisfied literal of the clause
+	localSearch.addClause({ 1, 1 });
+	localSearch.addClause({ -1, 2 });
+	localSearch.addClause({ -1, -2, -2 });
+	ASSERT_EQ(3, localSearch.getNumClauses());
+
+	std::vector<char> phases = { 0, 1, 1 };
+	ASSERT_EQ(1, localSearch.search(phases, 10000));
+	ASSERT_EQ(1, phases[1]);
+}
+
+TEST_F(LocalSearchTests, ModelOfSatisfiableRandomFormulasIsFoundByEveryAlgorithm)
+{
+	constexpr std::size_t numVariables = 300;
+	std::default_random_engine rng(44);
+	const std::vector<std::vector<long>> clausesOfFormula = generatePlantedThreeSatFormula(generateRandomAssignment(numVariables, rng), 1200, rng);
+
+	for (const LocalSearch::Algorithm algorithm : { LocalSearch::Algorithm::ProbSat, LocalSearch::Algorithm::WalkSat })
+	{
+		LocalSearch::LocalSearchConfiguration localSearchConfiguration;
+		localSearchConfiguration.algorithm = algorithm;
+		LocalSearch localSearch(numVariables, localSearchConfiguration);
+		for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+			localSearch.addClause(clauseLiterals);
+
+		std::vector<char> phases = generateRandomAssignment(numVariables, rng);
+		ASSERT_EQ(0, localSearch.search(phases, 50000000)) << LocalSearch::stringifyAlgorithm(algorithm);
+		ASSERT_EQ(0, determineNumFalsifiedClauses(clausesOfFormula, phases)) << LocalSearch::stringifyAlgorithm(algorithm);
+		ASSERT_EQ(1, localSearch.getStatistics().numFoundModels);
+	}
+}
+
+TEST_F(LocalSearchTests, BestAssignmentOfUnsatisfiableFormulaIsReturned)
+{
+	// Pigeon hole formula with four pigeons and three holes
+	constexpr std::size_t numHoles = 3;
+	std::vector<std::vector<long>> clausesOfFormula;
+	for (std::size_t pigeon = 0; pigeon <= numHoles; ++pigeon)
+		clausesOfFormula.emplace_back(std::vector<long>({ static_cast<long>(pigeon * numHoles + 1), static_cast<long>(pigeon * numHoles + 2), static_cast<long>(pigeon * numHoles + 3) }));
+	for (std::size_t hole = 1; hole <= numHoles; ++hole)
+	{
+		for (std::size_t pigeon = 0; pigeon <= numHoles; ++pigeon)
+		{
+			for (std::size_t otherPigeon = pigeon + 1; otherPigeon <= numHoles; ++otherPigeon)
+				clausesOfFormula.emplace_back(std::vector<long>({ -static_cast<long>(pigeon * numHoles + hole), -static_cast<long>(otherPigeon * numHoles + hole) }));
+		}
+	}
+
+	LocalSearch localSearch(numHoles * (numHoles + 1), LocalSearch::LocalSearchConfiguration());
+	for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+		localSearch.addClause(clauseLiterals);
+
+	std::vector<char> phases(numHoles * (numHoles + 1) + 1, 1);
+	const std::size_t numFalsifiedClausesOfInitialPhases = determineNumFalsifiedClauses(clausesOfFormula, phases);
+	const std::size_t numFalsifiedClausesOfBestAssignment = localSearch.search(phases, 100000);
+	ASSERT_EQ(1, numFalsifiedClausesOfBestAssignment);
+	ASSERT_LT(numFalsifiedClausesOfBestAssignment, numFalsifiedClausesOfInitialPhases);
+	ASSERT_EQ(numFalsifiedClausesOfBestAssignment, determineNumFalsifiedClauses(clausesOfFormula, phases));
+	ASSERT_GE(localSearch.getStatistics().numTicks, 100000);
+}
+
+TEST_F(LocalSearchTests, SearchesWithSameSeedAndEffortDetermineSamePhases)
+{
+	constexpr std::size_t numVariables = 200;
+	std::default_random_engine rng(45);
+	const std::vector<std::vector<long>> clausesOfFormula = generatePlantedThreeSatFormula(generateRandomAssignment(numVariables, rng), 1000, rng);
+	const std::vector<char> initialPhases = generateRandomAssignment(numVariables, rng);
+
+	std::array<std::vector<char>, 2> perSearchPhases = { initialPhases, initialPhases };
+	std::array<std::size_t, 2> perSearchNumFlips = { 0, 0 };
+	for (std::size_t searchIndex = 0; searchIndex < perSearchPhases.size(); ++searchIndex)
+	{
+		LocalSearch localSearch(numVariables, LocalSearch::LocalSearchConfiguration());
+		for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+			localSearch.addClause(clauseLiterals);
+
+		static_cast<void>(localSearch.search(perSearchPhases[searchIndex], 20000));
+		perSearchNumFlips[searchIndex] = localSearch.getStatistics().numFlips;
+	}
+	ASSERT_GT(perSearchNumFlips[0], 0);
+	ASSERT_EQ(perSearchNumFlips[0], perSearchNumFlips[1]);
+	ASSERT_EQ(perSearchPhases[0], perSearchPhases[1]);
+}
+
+TEST_F(LocalSearchTests, SolverSeededByInitialLocalSearchFindsModelWithoutConflicts)
+{
+	constexpr std::size_t numVariables = 1000;
+	std::default_random_engine rng(46);
+	const std::vector<std::vector<long>> clausesOfFormula = generatePlantedThreeSatFormula(generateRandomAssignment(numVariables, rng), 4000, rng);
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariables, clausesOfFormula, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalInitialLocalSearchEffort = 100000000;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Sat, solver.solve());
+	ASSERT_EQ(0, solver.getStatistics().numConflicts);
+	ASSERT_EQ(1, solver.getStatistics().localSearchStatistics.numFoundModels);
+
+	std::vector<char> model(numVariables + 1, 0);
+	for (const long literal : solver.getModel())
+		model[static_cast<std::size_t>(std::abs(literal))] = static_cast<char>(literal > 0);
+	ASSERT_EQ(0, determineNumFalsifiedClauses(clausesOfFormula, model));
+
+	solverConfiguration.optionalInitialLocalSearchEffort = 0;
+	ASSERT_THROW(Solver(*problemDefinition, solverConfiguration), std::invalid_argument);
+}
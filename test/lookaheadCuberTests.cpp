@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include "solver/lookaheadCuber.hpp"
+
+#include <random>
+
+using namespace solver;
+
+class LookaheadCuberTests : public testing::Test {
+public:
+	static void generateSharedFormula(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, SharedFormula::ptr& sharedFormula)
+	{
+		const auto problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numVariablesInFormula, clausesOfFormula.size());
+		ASSERT_TRUE(problemDefinition);
+
+		std::size_t clauseIdx = 0;
+		for (const auto& literalsOfClause : clausesOfFormula)
+			ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+		sharedFormula = SharedFormula::fromProblemDefinition(*problemDefinition);
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generateRandomThreeSatFormula(std::size_t numVariables, std::size_t numClauses, std::default_random_engine& rng)
+	{
+		std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(numVariables));
+		std::bernoulli_distribution polarityDistribution(0.5);
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		while (clausesOfFormula.size() < numClauses)
+		{
+			std::vector<long> clauseLiterals;
+			while (clauseLiterals.size() < 3)
+			{
+				const long variable = variableDistribution(rng);
+				if (std::none_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [variable](const long literal) { return std::abs(literal) == variable; }))
+					clauseLiterals.emplace_back(polarityDistribution(rng) ? variable : -variable);
+			}
+			clausesOfFormula.emplace_back(clauseLiterals);
+		}
+		return clausesOfFormula;
+	}
+
+	[[nodiscard]] static bool doesAssignmentSatisfyLiterals(std::size_t assignment, const std::vector<long>& literals, bool isAnyLiteralSufficient)
+	{
+		const auto isLiteralSatisfied = [assignment](const long literal)
+		{
+			const bool variableValue = (assignment >> (std::abs(literal) - 1)) & 1;
+			return literal > 0 ? variableValue : !variableValue;
+		};
+		return isAnyLiteralSufficient ? std::any_of(literals.cbegin(), literals.cend(), isLiteralSatisfied) : std::all_of(literals.cbegin(), literals.cend(), isLiteralSatisfied);
+	}
+};
+
+TEST_F(LookaheadCuberTests, CuberWithoutLookaheadCandidatesThrows)
+{
+	SharedFormula::ptr sharedFormula;
+	ASSERT_NO_FATAL_FAILURE(generateSharedFormula(2, { { 1, 2 } }, sharedFormula));
+	ASSERT_THROW(LookaheadCuber(sharedFormula, 0), std::invalid_argument);
+	ASSERT_THROW(LookaheadCuber(nullptr), std::invalid_argument);
+}
+
+TEST_F(LookaheadCuberTests, InvalidLiteralOfCubeThrows)
+{
+	SharedFormula::ptr sharedFormula;
+	ASSERT_NO_FATAL_FAILURE(generateSharedFormula(2, { { 1, 2 } }, sharedFormula));
+
+	LookaheadCuber cuber(sharedFormula);
+	ASSERT_THROW([[maybe_unused]] const auto cubes = cuber.splitCube({ 0 }, 1), std::invalid_argument);
+	ASSERT_THROW([[maybe_unused]] const auto cubes = cuber.splitCube({ 3 }, 1), std::invalid_argument);
+}
+
+TEST_F(LookaheadCuberTests, SplitWithoutDepthReturnsGivenCube)
+{
+	SharedFormula::ptr sharedFormula;
+	ASSERT_NO_FATAL_FAILURE(generateSharedFormula(3, { { 1, 2, 3 }, { -1, 2 } }, sharedFormula));
+
+	LookaheadCuber cuber(sharedFormula);
+	const std::vector<std::vector<long>> cubes = cuber.splitCube({ 1, -3 }, 0);
+	ASSERT_EQ(1, cubes.size());
+	ASSERT_EQ(std::vector<long>({ 1, -3 }), cubes.front());
+}
+
+TEST_F(LookaheadCuberTests, FormulaRefutedByUnitPropagationIsNotSplit)
+{
+	SharedFormula::ptr sharedFormula;
+	ASSERT_NO_FATAL_FAILURE(generateSharedFormula(3, { { 1, 2 }, { 1, -2 }, { -1, 3 }, { -1, -3 } }, sharedFormula));
+
+	LookaheadCuber cuber(sharedFormula);
+	ASSERT_TRUE(cuber.splitCube({}, 2).empty());
+	ASSERT_LT(0, cuber.getStatistics().numRefutedCubes);
+}
+
+TEST_F(LookaheadCuberTests, FailedLiteralIsAddedToCube)
+{
+	// Assigning variable 1 positively falsifies the last clause via unit propagation
+	SharedFormula::ptr sharedFormula;
+	ASSERT_NO_FATAL_FAILURE(generateSharedFormula(4, { { -1, 2 }, { -1, 3 }, { -2, -3 }, { 1, 4 }, { 2, 3, 4 } }, sharedFormula));
+
+	LookaheadCuber cuber(sharedFormula);
+	const std::vector<std::vector<long>> cubes = cuber.splitCube({}, 1);
+	ASSERT_FALSE(cubes.empty());
+	for (const std::vector<long>& cube : cubes)
+		ASSERT_NE(cube.cend(), std::find(cube.cbegin(), cube.cend(), -1));
+	ASSERT_LT(0, cuber.getStatistics().numFailedLiterals);
+}
+
+TEST_F(LookaheadCuberTests, CubesCoverEveryModelOfRandomThreeSatFormulasExactlyOnce)
+{
+	constexpr std::size_t numVariablesInFormula = 12;
+	constexpr std::size_t numClausesInFormula = 40;
+	constexpr std::size_t numGeneratedFormulas = 20;
+	std::default_random_engine rng(41);
+
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomThreeSatFormula(numVariablesInFormula, numClausesInFormula, rng);
+		SharedFormula::ptr sharedFormula;
+		ASSERT_NO_FATAL_FAILURE(generateSharedFormula(numVariablesInFormula, clausesOfFormula, sharedFormula));
+
+		LookaheadCuber cuber(sharedFormula, 4);
+		const std::vector<std::vector<long>> cubes = cuber.splitCube({}, 3);
+		ASSERT_LE(cubes.size(), 8);
+		for (std::size_t assignment = 0; assignment < (static_cast<std::size_t>(1) << numVariablesInFormula); ++assignment)
+		{
+			const bool isModel = std::all_of(clausesOfFormula.cbegin(), clausesOfFormula.cend(), [assignment](const std::vector<long>& clauseLiterals) { return doesAssignmentSatisfyLiterals(assignment, clauseLiterals, true); });
+			if (!isModel)
+				continue;
+
+			const auto numCubesSatisfiedByModel = std::count_if(cubes.cbegin(), cubes.cend(), [assignment](const std::vector<long>& cube) { return doesAssignmentSatisfyLiterals(assignment, cube, false); });
+			ASSERT_EQ(1, numCubesSatisfiedByModel);
+		}
+	}
+}
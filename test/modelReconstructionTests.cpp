@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include "optimizations/blockedClauseElimination/blockingLiteralGenerator.hpp"
+#include "optimizations/blockedClauseElimination/literalOccurrenceBlockedClauseEliminator.hpp"
+#include "optimizations/modelReconstruction/modelChecker.hpp"
+#include "optimizations/modelReconstruction/modelReconstructionStack.hpp"
+#include "solver/solver.hpp"
+
+using namespace modelReconstruction;
+
+class ModelReconstructionTests : public testing::Test {
+public:
+	[[nodiscard]] static ModelChecker initializeModelChecker(const std::vector<std::vector<long>>& clausesOfFormula)
+	{
+		ModelChecker modelChecker;
+		for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+			modelChecker.addClause(clauseLiterals);
+		return modelChecker;
+	}
+};
+
+TEST_F(ModelReconstructionTests, WitnessNotMatchingEliminatedClauseThrows)
+{
+	ModelReconstructionStack modelReconstructionStack;
+	ASSERT_THROW(modelReconstructionStack.addBlockedClause(3, { 1, 2 }), std::invalid_argument);
+	ASSERT_THROW(modelReconstructionStack.addSetBlockedClause({ 1, 3 }, { 1, 2 }), std::invalid_argument);
+	ASSERT_THROW(modelReconstructionStack.addSetBlockedClause({}, { 1, 2 }), std::invalid_argument);
+	ASSERT_THROW(modelReconstructionStack.addEliminatedClause({ 1 }, { 1, 0 }), std::invalid_argument);
+	ASSERT_TRUE(modelReconstructionStack.isEmpty());
+}
+
+TEST_F(ModelReconstructionTests, ModelSatisfyingEliminatedClausesIsNotModified)
+{
+	ModelReconstructionStack modelReconstructionStack;
+	modelReconstructionStack.addBlockedClause(1, { 1, 2 });
+	modelReconstructionStack.addSetBlockedClause({ -2, 3 }, { -2, 3 });
+	ASSERT_EQ(2, modelReconstructionStack.getNumEntries());
+
+	const std::vector<long> model = { -1, 2, 3 };
+	ASSERT_EQ(model, modelReconstructionStack.reconstructModel(model));
+}
+
+TEST_F(ModelReconstructionTests, FalsifiedBlockedClauseIsSatisfiedByFlippingBlockingLiteral)
+{
+	// The clause (1 2 3) is blocked by the literal 1 in the formula consisting of the clauses (1 2 3), (-1 -2) and (-1 -3)
+	ModelReconstructionStack modelReconstructionStack;
+	modelReconstructionStack.addBlockedClause(1, { 1, 2, 3 });
+
+	const std::vector<long> reconstructedModel = modelReconstructionStack.reconstructModel({ -1, -2, -3 });
+	ASSERT_EQ(std::vector<long>({ 1, -2, -3 }), reconstructedModel);
+	ASSERT_TRUE(initializeModelChecker({ { 1, 2, 3 }, { -1, -2 }, { -1, -3 } }).isModelOfFormula(reconstructedModel));
+}
+
+TEST_F(ModelReconstructionTests, FalsifiedSetBlockedClauseIsSatisfiedByFlippingAllLiteralsOfBlockingSet)
+{
+	// The clause (1 2) is blocked by the set {1, 2} but neither by the literal 1 nor by the literal 2
+	ModelReconstructionStack modelReconstructionStack;
+	modelReconstructionStack.addSetBlockedClause({ 1, 2 }, { 1, 2 });
+
+	const std::vector<long> reconstructedModel = modelReconstructionStack.reconstructModel({ -1, -2 });
+	ASSERT_EQ(std::vector<long>({ 1, 2 }), reconstructedModel);
+	ASSERT_TRUE(initializeModelChecker({ { 1, 2 }, { -1, 2 }, { 1, -2 } }).isModelOfFormula(reconstructedModel));
+}
+
+TEST_F(ModelReconstructionTests, EntriesAreProcessedInReverseOrderOfTheirAddition)
+{
+	ModelReconstructionStack modelReconstructionStack;
+	modelReconstructionStack.addBlockedClause(1, { 1, -2 });
+	modelReconstructionStack.addBlockedClause(2, { 2, 3 });
+
+	// Satisfying the second clause falsifies the first one which thus needs to be processed afterwards
+	const std::vector<long> reconstructedModel = modelReconstructionStack.reconstructModel({ -1, -2, -3 });
+	ASSERT_EQ(std::vector<long>({ 1, 2, -3 }), reconstructedModel);
+	ASSERT_TRUE(initializeModelChecker({ { 1, -2 }, { 2, 3 } }).isModelOfFormula(reconstructedModel));
+}
+
+TEST_F(ModelReconstructionTests, VariablesOnlyReferencedByEliminatedClausesAreAssigned)
+{
+	ModelReconstructionStack modelReconstructionStack;
+	modelReconstructionStack.addBlockedClause(4, { -1, 4 });
+	modelReconstructionStack.addBlockedClause(-5, { -5, 2 });
+
+	ASSERT_EQ(std::vector<long>({ 1, 2, -3, 4, -5 }), modelReconstructionStack.reconstructModel({ 1, 2 }));
+}
+
+TEST_F(ModelReconstructionTests, WitnessAndClauseOfEntriesAreAccessibleUntilStackIsCleared)
+{
+	ModelReconstructionStack modelReconstructionStack;
+	modelReconstructionStack.addBlockedClause(-2, { 1, -2 });
+	modelReconstructionStack.addSetBlockedClause({ 3, 4 }, { 3, 4, 5 });
+
+	ASSERT_EQ(std::vector<long>({ -2 }), modelReconstructionStack.getWitnessOfEntry(0));
+	ASSERT_EQ(std::vector<long>({ 1, -2 }), modelReconstructionStack.getClauseOfEntry(0));
+	ASSERT_EQ(std::vector<long>({ 3, 4 }), modelReconstructionStack.getWitnessOfEntry(1));
+	ASSERT_EQ(std::vector<long>({ 3, 4, 5 }), modelReconstructionStack.getClauseOfEntry(1));
+	ASSERT_THROW(static_cast<void>(modelReconstructionStack.getClauseOfEntry(2)), std::out_of_range);
+
+	modelReconstructionStack.clear();
+	ASSERT_TRUE(modelReconstructionStack.isEmpty());
+	ASSERT_EQ(std::vector<long>({ -1 }), modelReconstructionStack.reconstructModel({ -1 }));
+}
+
+TEST_F(ModelReconstructionTests, ModelCheckerDeterminesFirstFalsifiedClause)
+{
+	const ModelChecker modelChecker = initializeModelChecker({ { 1, 2 }, { -1, 3 }, { -2, -3 }, { 4 } });
+	ASSERT_EQ(4, modelChecker.getNumClauses());
+	ASSERT_TRUE(modelChecker.isModelOfFormula({ 1, -2, 3, 4 }));
+	ASSERT_EQ(1, modelChecker.determineFirstFalsifiedClause({ 1, -2, -3, 4 }));
+	ASSERT_EQ(2, modelChecker.determineFirstFalsifiedClause({ 1, 2, 3, 4 }));
+	// Unassigned variables falsify all of their literals
+	ASSERT_EQ(3, modelChecker.determineFirstFalsifiedClause({ 1, -2, 3 }));
+
+	ASSERT_EQ(std::vector<long>({ -2, -3 }), modelChecker.getLiteralsOfClause(2));
+	ASSERT_THROW(static_cast<void>(modelChecker.getLiteralsOfClause(4)), std::out_of_range);
+}
+
+TEST_F(ModelReconstructionTests, LiteralZeroInClauseOfModelCheckerThrows)
+{
+	ModelChecker modelChecker;
+	ASSERT_THROW(modelChecker.addClause({ 1, 0 }), std::invalid_argument);
+}
+
+TEST_F(ModelReconstructionTests, ModelOfFormulaWithEliminatedBlockedClausesIsExtendedToModelOfOriginalFormula)
+{
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1, 2, 3 }, { -1, -2 }, { -1, -3 }, { 2, -4 }, { 3, 4, -5 } };
+	auto problemDefinition = std::make_shared<dimacs::ProblemDefinition>(5, clausesOfFormula.size());
+	std::size_t clauseIdx = 0;
+	for (const auto& literalsOfClause : clausesOfFormula)
+		ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+
+	const blockedClauseElimination::LiteralOccurrenceBlockedClauseEliminator blockedClauseEliminator(problemDefinition);
+	const blockedClauseElimination::BlockingLiteralGenerator::ptr blockingLiteralGenerator = blockedClauseElimination::BlockingLiteralGenerator::usingSequentialLiteralSelectionHeuristic();
+	ModelReconstructionStack modelReconstructionStack;
+	for (std::size_t clauseIdentifier = 0; clauseIdentifier < clausesOfFormula.size(); ++clauseIdentifier)
+	{
+		if (const std::optional<long> blockingLiteral = blockedClauseEliminator.determineBlockingLiteralOfClause(clauseIdentifier, *blockingLiteralGenerator); blockingLiteral.has_value())
+		{
+			modelReconstructionStack.addBlockedClause(*blockingLiteral, problemDefinition->getClauseByIndexInFormula(clauseIdentifier)->literals);
+			ASSERT_TRUE(problemDefinition->removeClause(clauseIdentifier));
+		}
+	}
+	ASSERT_FALSE(modelReconstructionStack.isEmpty());
+
+	solver::Solver solver(*problemDefinition);
+	ASSERT_EQ(solver::Solver::SolverResult::Sat, solver.solve());
+	ASSERT_TRUE(initializeModelChecker(clausesOfFormula).isModelOfFormula(modelReconstructionStack.reconstructModel(solver.getModel())));
+}
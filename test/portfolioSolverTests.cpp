@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include "solver/portfolioSolver.hpp"
+
+#include <random>
+
+using namespace solver;
+
+class PortfolioSolverTests : public testing::Test {
+public:
+	static void generateProblemDefinition(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, dimacs::ProblemDefinition::ptr& problemDefinition)
+	{
+		problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numVariablesInFormula, clausesOfFormula.size());
+		ASSERT_TRUE(problemDefinition);
+
+		std::size_t clauseIdx = 0;
+		for (const auto& literalsOfClause : clausesOfFormula)
+			ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+	}
+
+	static void assertModelSatisfiesClauses(const std::vector<long>& model, const std::vector<std::vector<long>>& clausesOfFormula)
+	{
+		for (const auto& literalsOfClause : clausesOfFormula)
+		{
+			ASSERT_TRUE(std::any_of(
+				literalsOfClause.cbegin(),
+				literalsOfClause.cend(),
+				[&model](const long literal) { return model[std::abs(literal) - 1] == literal; }));
+		}
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generatePigeonHoleFormula(std::size_t numHoles)
+	{
+		const std::size_t numPigeons = numHoles + 1;
+		const auto determineVariable = [numHoles](std::size_t pigeon, std::size_t hole) { return static_cast<long>(pigeon * numHoles + hole + 1); };
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+		{
+			std::vector<long> pigeonIsInSomeHoleClause;
+			for (std::size_t hole = 0; hole < numHoles; ++hole)
+				pigeonIsInSomeHoleClause.emplace_back(determineVariable(pigeon, hole));
+			clausesOfFormula.emplace_back(pigeonIsInSomeHoleClause);
+		}
+
+		for (std::size_t hole = 0; hole < numHoles; ++hole)
+		{
+			for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+			{
+				for (std::size_t otherPigeon = pigeon + 1; otherPigeon < numPigeons; ++otherPigeon)
+					clausesOfFormula.emplace_back(std::vector<long>({ -determineVariable(pigeon, hole), -determineVariable(otherPigeon, hole) }));
+			}
+		}
+		return clausesOfFormula;
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generateRandomThreeSatFormula(std::size_t numVariables, std::size_t numClauses, std::default_random_engine& rng)
+	{
+		std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(numVariables));
+		std::bernoulli_distribution polarityDistribution(0.5);
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		while (clausesOfFormula.size() < numClauses)
+		{
+			std::vector<long> clauseLiterals;
+			while (clauseLiterals.size() < 3)
+			{
+				const long variable = variableDistribution(rng);
+				if (std::none_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [variable](const long literal) { return std::abs(literal) == variable; }))
+					clauseLiterals.emplace_back(polarityDistribution(rng) ? variable : -variable);
+			}
+			clausesOfFormula.emplace_back(clauseLiterals);
+		}
+		return clausesOfFormula;
+	}
+};
+
+TEST_F(PortfolioSolverTests, PortfolioWithoutWorkersThrows)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { {1, 2} }, problemDefinition));
+	ASSERT_THROW(PortfolioSolver(*problemDefinition, 0, Solver::SolverConfiguration()), std::invalid_argument);
+}
+
+TEST_F(PortfolioSolverTests, FirstWorkerUsesBaseConfigurationWhileOtherWorkersAreDiversified)
+{
+	Solver::SolverConfiguration baseConfiguration;
+	baseConfiguration.randomSeed = 7;
+
+	const Solver::SolverConfiguration configurationOfFirstWorker = PortfolioSolver::diversifyConfiguration(baseConfiguration, 0);
+	ASSERT_EQ(baseConfiguration.randomSeed, configurationOfFirstWorker.randomSeed);
+	ASSERT_EQ(baseConfiguration.decisionHeuristic, configurationOfFirstWorker.decisionHeuristic);
+	ASSERT_EQ(baseConfiguration.restartPolicy, configurationOfFirstWorker.restartPolicy);
+
+	const Solver::SolverConfiguration configurationOfSecondWorker = PortfolioSolver::diversifyConfiguration(baseConfiguration, 1);
+	ASSERT_EQ(baseConfiguration.randomSeed + 1, configurationOfSecondWorker.randomSeed);
+	ASSERT_NE(configurationOfFirstWorker.decisionHeuristic, configurationOfSecondWorker.decisionHeuristic);
+	ASSERT_NE(configurationOfFirstWorker.restartPolicy, configurationOfSecondWorker.restartPolicy);
+	ASSERT_TRUE(PortfolioSolver::diversifyConfiguration(baseConfiguration, 2).optionalStableModeDecisionHeuristic.has_value());
+}
+
+TEST_F(PortfolioSolverTests, PigeonHoleFormulaIsUnsatisfiable)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	PortfolioSolver portfolioSolver(*problemDefinition, 4, Solver::SolverConfiguration());
+	ASSERT_EQ(Solver::SolverResult::Unsat, portfolioSolver.solve());
+	ASSERT_TRUE(portfolioSolver.getIndexOfWinningWorker().has_value());
+	ASSERT_LT(*portfolioSolver.getIndexOfWinningWorker(), portfolioSolver.getNumWorkers());
+	ASSERT_TRUE(portfolioSolver.getModel().empty());
+	for (std::size_t workerIndex = 0; workerIndex < portfolioSolver.getNumWorkers(); ++workerIndex)
+		ASSERT_NO_THROW([[maybe_unused]] const Solver::SolverStatistics& statistics = portfolioSolver.getStatisticsOfWorker(workerIndex));
+}
+
+TEST_F(PortfolioSolverTests, LearnedClausesAreExchangedBetweenWorkers)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	PortfolioSolver portfolioSolver(*problemDefinition, 2, Solver::SolverConfiguration());
+	ASSERT_EQ(Solver::SolverResult::Unsat, portfolioSolver.solve());
+
+	std::size_t numExportedClauses = 0;
+	for (std::size_t workerIndex = 0; workerIndex < portfolioSolver.getNumWorkers(); ++workerIndex)
+	{
+		const Solver::SolverStatistics& statistics = portfolioSolver.getStatisticsOfWorker(workerIndex);
+		numExportedClauses += statistics.numExportedClauses;
+		ASSERT_LE(statistics.numUsefulImportedClauses, statistics.numImportedClauses);
+	}
+	ASSERT_GT(numExportedClauses, 0);
+}
+
+TEST_F(PortfolioSolverTests, DisabledClauseSharingDoesNotExchangeClauses)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	PortfolioSolver portfolioSolver(*problemDefinition, 2, Solver::SolverConfiguration(), false);
+	ASSERT_EQ(Solver::SolverResult::Unsat, portfolioSolver.solve());
+	for (std::size_t workerIndex = 0; workerIndex < portfolioSolver.getNumWorkers(); ++workerIndex)
+	{
+		ASSERT_EQ(0, portfolioSolver.getStatisticsOfWorker(workerIndex).numExportedClauses);
+		ASSERT_EQ(0, portfolioSolver.getStatisticsOfWorker(workerIndex).numImportedClauses);
+	}
+}
+
+TEST_F(PortfolioSolverTests, ResultOfRandomThreeSatFormulasMatchesResultOfSequentialSolver)
+{
+	constexpr std::size_t numVariablesInFormula = 50;
+	constexpr std::size_t numClausesInFormula = 213;
+	constexpr std::size_t numGeneratedFormulas = 20;
+	std::default_random_engine rng(31);
+
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomThreeSatFormula(numVariablesInFormula, numClausesInFormula, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesInFormula, clausesOfFormula, problemDefinition));
+
+		const SharedFormula::ptr sharedFormula = SharedFormula::fromProblemDefinition(*problemDefinition);
+		Solver sequentialSolver(sharedFormula, Solver::SolverConfiguration());
+		const Solver::SolverResult expectedResult = sequentialSolver.solve();
+		ASSERT_NE(Solver::SolverResult::Unknown, expectedResult);
+
+		PortfolioSolver portfolioSolver(sharedFormula, 3, Solver::SolverConfiguration());
+		ASSERT_EQ(expectedResult, portfolioSolver.solve());
+		if (expectedResult == Solver::SolverResult::Sat)
+		{
+			ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(portfolioSolver.getModel(), clausesOfFormula));
+		}
+	}
+}
+
+TEST_F(PortfolioSolverTests, ReachingConflictLimitInEveryWorkerReportsUnknownResult)
+{
+	constexpr std::size_t numHoles = 8;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalConflictLimit = 10;
+	PortfolioSolver portfolioSolver(*problemDefinition, 2, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unknown, portfolioSolver.solve());
+	ASSERT_FALSE(portfolioSolver.getIndexOfWinningWorker().has_value());
+}
@@ -0,0 +1,304 @@
+#include <gtest/gtest.h>
+
+#include "dimacs/dimacsParser.hpp"
+#include "proof/proofWriter.hpp"
+#include "solver/solver.hpp"
+
+#include <map>
+#include <sstream>
+
+using namespace proof;
+
+class ProofWriterTests : public testing::Test {
+public:
+	struct ProofLine
+	{
+		bool isAddition;
+		std::vector<long> literals;
+	};
+
+	[[nodiscard]] static std::vector<ProofLine> decodeBinaryDratProof(const std::string& proof)
+	{
+		std::vector<ProofLine> proofLines;
+		std::size_t position = 0;
+		while (position < proof.size())
+		{
+			ProofLine proofLine;
+			proofLine.isAddition = proof[position++] == 'a';
+			while (true)
+			{
+				std::uint64_t mappedLiteral = 0;
+				std::size_t shift = 0;
+				unsigned char byte;
+				do
+				{
+					byte = static_cast<unsigned char>(proof.at(position++));
+					mappedLiteral |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+					shift += 7;
+				} while (byte & 0x80);
+
+				if (!mappedLiteral)
+					break;
+				const auto variable = static_cast<long>(mappedLiteral >> 1);
+				proofLine.literals.emplace_back(mappedLiteral & 1 ? -variable : variable);
+			}
+			proofLines.emplace_back(proofLine);
+		}
+		return proofLines;
+	}
+
+	[[nodiscard]] static bool isClauseImpliedByUnitPropagation(const std::multimap<std::vector<long>, bool>& clauses, const std::vector<long>& clause)
+	{
+		std::map<long, bool> assignment;
+		for (const long literal : clause)
+			assignment[std::abs(literal)] = literal < 0;
+
+		bool assignedAnyLiteral = true;
+		while (assignedAnyLiteral)
+		{
+			assignedAnyLiteral = false;
+			for (const auto& [clauseLiterals, _] : clauses)
+			{
+				std::size_t numUnassignedLiterals = 0;
+				long unassignedLiteral = 0;
+				bool isSatisfied = false;
+				for (const long literal : clauseLiterals)
+				{
+					if (!assignment.count(std::abs(literal)))
+					{
+						++numUnassignedLiterals;
+						unassignedLiteral = literal;
+					}
+					else
+						isSatisfied |= assignment.at(std::abs(literal)) == (literal > 0);
+				}
+				if (isSatisfied)
+					continue;
+				if (!numUnassignedLiterals)
+					return true;
+				if (numUnassignedLiterals == 1)
+				{
+					assignment[std::abs(unassignedLiteral)] = unassignedLiteral > 0;
+					assignedAnyLiteral = true;
+				}
+			}
+		}
+		return false;
+	}
+
+	static std::vector<long> sortLiterals(std::vector<long> literals)
+	{
+		std::sort(literals.begin(), literals.end());
+		return literals;
+	}
+
+	// Checks that every added clause is a reverse unit propagation (RUP) consequence of the clauses of the formula and the prior additions of the proof while every deleted clause exists
+	static void assertProofIsValidForFormula(const std::vector<std::vector<long>>& clausesOfFormula, const std::vector<ProofLine>& proofLines, std::multimap<std::vector<long>, bool>& remainingClauses)
+	{
+		for (const std::vector<long>& clauseLiterals : clausesOfFormula)
+			remainingClauses.emplace(sortLiterals(clauseLiterals), true);
+
+		for (const ProofLine& proofLine : proofLines)
+		{
+			const std::vector<long> clauseLiterals = sortLiterals(proofLine.literals);
+			if (proofLine.isAddition)
+			{
+				ASSERT_TRUE(isClauseImpliedByUnitPropagation(remainingClauses, clauseLiterals));
+				remainingClauses.emplace(clauseLiterals, false);
+			}
+			else
+			{
+				const auto clauseIterator = remainingClauses.find(clauseLiterals);
+				ASSERT_NE(remainingClauses.end(), clauseIterator);
+				remainingClauses.erase(clauseIterator);
+			}
+		}
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generatePigeonHoleFormula(std::size_t numHoles)
+	{
+		const std::size_t numPigeons = numHoles + 1;
+		const auto determineVariable = [numHoles](std::size_t pigeon, std::size_t hole) { return static_cast<long>(pigeon * numHoles + hole + 1); };
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+		{
+			std::vector<long> pigeonIsInSomeHoleClause;
+			for (std::size_t hole = 0; hole < numHoles; ++hole)
+				pigeonIsInSomeHoleClause.emplace_back(determineVariable(pigeon, hole));
+			clausesOfFormula.emplace_back(pigeonIsInSomeHoleClause);
+		}
+
+		for (std::size_t hole = 0; hole < numHoles; ++hole)
+		{
+			for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+			{
+				for (std::size_t otherPigeon = pigeon + 1; otherPigeon < numPigeons; ++otherPigeon)
+					clausesOfFormula.emplace_back(std::vector<long>({ -determineVariable(pigeon, hole), -determineVariable(otherPigeon, hole) }));
+			}
+		}
+		return clausesOfFormula;
+	}
+};
+
+TEST_F(ProofWriterTests, EmptyBufferThrows)
+{
+	std::ostringstream outputStream;
+	ASSERT_THROW(ProofWriter(outputStream, ProofWriter::ProofFormat::Drat, 0), std::invalid_argument);
+}
+
+TEST_F(ProofWriterTests, DratProofLinesAreEncodedAsVariableLengthMappedLiterals)
+{
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+	proofWriter.addClause({ 1, -2 });
+	proofWriter.deleteClause({ -63, 64 });
+	proofWriter.addEmptyClause();
+	ASSERT_TRUE(proofWriter.close());
+
+	const std::string expectedProof = { 'a', 2, 5, 0, 'd', 0x7F, static_cast<char>(0x80), 0x01, 0, 'a', 0 };
+	ASSERT_EQ(expectedProof, outputStream.str());
+	ASSERT_EQ(2, proofWriter.getNumAddedClauses());
+	ASSERT_EQ(1, proofWriter.getNumDeletedClauses());
+	ASSERT_EQ(expectedProof.size(), proofWriter.getNumWrittenBytes());
+}
+
+TEST_F(ProofWriterTests, LratProofLinesContainClauseIdentifiersAndHints)
+{
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Lrat);
+	proofWriter.addClause(5, { 1 }, { 3, -4 });
+	proofWriter.deleteClauses({ 1, 2 });
+	ASSERT_TRUE(proofWriter.close());
+
+	const std::string expectedProof = { 'a', 10, 2, 0, 6, 9, 0, 'd', 2, 4, 0 };
+	ASSERT_EQ(expectedProof, outputStream.str());
+	ASSERT_EQ(1, proofWriter.getNumAddedClauses());
+	ASSERT_EQ(2, proofWriter.getNumDeletedClauses());
+}
+
+TEST_F(ProofWriterTests, ProofLinesNotMatchingProofFormatThrow)
+{
+	std::ostringstream outputStream;
+	ProofWriter dratProofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+	ASSERT_THROW(dratProofWriter.addClause(1, { 1 }, {}), std::invalid_argument);
+	ASSERT_THROW(dratProofWriter.deleteClauses({ 1 }), std::invalid_argument);
+
+	ProofWriter lratProofWriter(outputStream, ProofWriter::ProofFormat::Lrat);
+	ASSERT_THROW(lratProofWriter.addClause({ 1 }), std::invalid_argument);
+	ASSERT_THROW(lratProofWriter.deleteClause({ 1 }), std::invalid_argument);
+	ASSERT_THROW(lratProofWriter.addClause(0, { 1 }, {}), std::invalid_argument);
+}
+
+TEST_F(ProofWriterTests, ProofLargerThanBufferIsCompletelyWritten)
+{
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat, 16);
+
+	std::vector<ProofLine> expectedProofLines;
+	for (long i = 1; i <= 1000; ++i)
+	{
+		const std::vector<long> clauseLiterals = { i, -(i * 1000), i + 1 };
+		if (i % 3)
+			proofWriter.addClause(clauseLiterals);
+		else
+			proofWriter.deleteClause(clauseLiterals);
+		expectedProofLines.emplace_back(ProofLine({ static_cast<bool>(i % 3), clauseLiterals }));
+	}
+	ASSERT_TRUE(proofWriter.close());
+	ASSERT_EQ(outputStream.str().size(), proofWriter.getNumWrittenBytes());
+
+	const std::vector<ProofLine> actualProofLines = decodeBinaryDratProof(outputStream.str());
+	ASSERT_EQ(expectedProofLines.size(), actualProofLines.size());
+	for (std::size_t i = 0; i < expectedProofLines.size(); ++i)
+	{
+		ASSERT_EQ(expectedProofLines[i].isAddition, actualProofLines[i].isAddition);
+		ASSERT_EQ(expectedProofLines[i].literals, actualProofLines[i].literals);
+	}
+}
+
+TEST_F(ProofWriterTests, ProofOfSolverForUnsatisfiableFormulaIsValidAndEndsWithEmptyClause)
+{
+	constexpr std::size_t numHoles = 5;
+	const std::vector<std::vector<long>> clausesOfFormula = generatePigeonHoleFormula(numHoles);
+	auto problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numHoles * (numHoles + 1), clausesOfFormula.size());
+	std::size_t clauseIdx = 0;
+	for (const auto& literalsOfClause : clausesOfFormula)
+		ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat, 64);
+	solver::Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.initialClauseDatabaseReductionInterval = 50;
+	solverConfiguration.clauseDatabaseReductionIntervalIncrement = 10;
+	solver::Solver solver(*problemDefinition, solverConfiguration);
+	solver.setProofWriter(&proofWriter);
+	ASSERT_EQ(solver::Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_TRUE(proofWriter.close());
+
+	const std::vector<ProofLine> proofLines = decodeBinaryDratProof(outputStream.str());
+	ASSERT_EQ(solver.getStatistics().numLearnedClauses + 1, proofWriter.getNumAddedClauses());
+	ASSERT_EQ(solver.getStatistics().numDeletedLearnedClauses, proofWriter.getNumDeletedClauses());
+	ASSERT_GT(proofWriter.getNumDeletedClauses(), 0);
+	ASSERT_FALSE(proofLines.empty());
+	ASSERT_TRUE(proofLines.back().isAddition);
+	ASSERT_TRUE(proofLines.back().literals.empty());
+
+	std::multimap<std::vector<long>, bool> remainingClauses;
+	ASSERT_NO_FATAL_FAILURE(assertProofIsValidForFormula(clausesOfFormula, proofLines, remainingClauses));
+}
+
+TEST_F(ProofWriterTests, LratProofWriterCannotBeUsedBySolver)
+{
+	auto problemDefinition = std::make_shared<dimacs::ProblemDefinition>(1, 0);
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Lrat);
+	solver::Solver solver(*problemDefinition);
+	ASSERT_THROW(solver.setProofWriter(&proofWriter), std::invalid_argument);
+}
+
+TEST_F(ProofWriterTests, SimplificationsOfParserAreRecordedInProof)
+{
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1, 4 }, { -1, 2 }, { -2, 3, 4 }, { 1 }, { -3, 4, 5 }, { -1, 5, 6 } };
+	const std::string stringifiedCnfFormula = "p cnf 6 6\n1 4 0\n-1 2 0\n-2 3 4 0\n1 0\n-3 4 5 0\n-1 5 6 0";
+
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+	dimacs::DimacsParser parser;
+	parser.setProofWriter(&proofWriter);
+	const dimacs::DimacsParser::ParseResult parseResult = parser.readProblemFromString(stringifiedCnfFormula);
+	ASSERT_FALSE(parseResult.determinedAnyErrors);
+	ASSERT_FALSE(parseResult.wasFormulaDeterminedToBeUnsat);
+	ASSERT_TRUE(proofWriter.close());
+
+	std::multimap<std::vector<long>, bool> remainingClauses;
+	ASSERT_NO_FATAL_FAILURE(assertProofIsValidForFormula(clausesOfFormula, decodeBinaryDratProof(outputStream.str()), remainingClauses));
+
+	// Every clause of the simplified formula needs to exist in the proof to allow its later deletion
+	const dimacs::ProblemDefinition& problemDefinition = **parseResult.formula;
+	ASSERT_FALSE(problemDefinition.getIdentifiersOfClauses().empty());
+	for (const std::size_t clauseIdentifier : problemDefinition.getIdentifiersOfClauses())
+		ASSERT_EQ(1, remainingClauses.count(sortLiterals(problemDefinition.getClauseByIndexInFormula(clauseIdentifier)->literals)));
+}
+
+TEST_F(ProofWriterTests, UnsatisfiabilityDeterminedByParserIsRecordedInProof)
+{
+	const std::vector<std::vector<long>> clausesOfFormula = { { 1, 3 }, { -1, 2 }, { 1 }, { -2, -1 } };
+	const std::string stringifiedCnfFormula = "p cnf 3 4\n1 3 0\n-1 2 0\n1 0\n-2 -1 0";
+
+	std::ostringstream outputStream;
+	ProofWriter proofWriter(outputStream, ProofWriter::ProofFormat::Drat);
+	dimacs::DimacsParser parser;
+	parser.setProofWriter(&proofWriter);
+	const dimacs::DimacsParser::ParseResult parseResult = parser.readProblemFromString(stringifiedCnfFormula);
+	ASSERT_TRUE(parseResult.wasFormulaDeterminedToBeUnsat);
+	ASSERT_TRUE(proofWriter.close());
+
+	const std::vector<ProofLine> proofLines = decodeBinaryDratProof(outputStream.str());
+	ASSERT_FALSE(proofLines.empty());
+	ASSERT_TRUE(proofLines.back().isAddition);
+	ASSERT_TRUE(proofLines.back().literals.empty());
+
+	std::multimap<std::vector<long>, bool> remainingClauses;
+	ASSERT_NO_FATAL_FAILURE(assertProofIsValidForFormula(clausesOfFormula, proofLines, remainingClauses));
+}
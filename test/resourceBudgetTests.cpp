@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include "budget/resourceBudget.hpp"
+#include "dimacs/dimacsParser.hpp"
+#include "optimizations/blockedClauseElimination/blockingLiteralGenerator.hpp"
+#include "optimizations/blockedClauseElimination/literalOccurrenceBlockedClauseEliminator.hpp"
+#include "optimizations/setBlockedClauseElimination/literalOccurrenceBlockingSetCandidateGenerator.hpp"
+#include "optimizations/setBlockedClauseElimination/literalOccurrenceSetBlockedClauseEliminator.hpp"
+#include "solver/cubeAndConquerSolver.hpp"
+#include "solver/portfolioSolver.hpp"
+#include "solver/solver.hpp"
+
+#include <array>
+#include <csignal>
+
+using namespace budget;
+
+class ResourceBudgetTests : public testing::Test {
+public:
+	static void generateProblemDefinition(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, dimacs::ProblemDefinition::ptr& problemDefinition)
+	{
+		problemDefinition = std::make_shared<dimacs::ProblemDefinition>(numVariablesInFormula, clausesOfFormula.size());
+		ASSERT_TRUE(problemDefinition);
+
+		std::size_t clauseIdx = 0;
+		for (const auto& literalsOfClause : clausesOfFormula)
+			ASSERT_TRUE(problemDefinition->addClause(clauseIdx++, dimacs::ProblemDefinition::Clause(literalsOfClause)));
+	}
+
+	static void generatePigeonHoleProblemDefinition(std::size_t numHoles, dimacs::ProblemDefinition::ptr& problemDefinition)
+	{
+		const std::size_t numPigeons = numHoles + 1;
+		const auto determineVariable = [numHoles](std::size_t pigeon, std::size_t hole) { return static_cast<long>(pigeon * numHoles + hole + 1); };
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+		{
+			std::vector<long> pigeonIsInSomeHoleClause;
+			for (std::size_t hole = 0; hole < numHoles; ++hole)
+				pigeonIsInSomeHoleClause.emplace_back(determineVariable(pigeon, hole));
+			clausesOfFormula.emplace_back(pigeonIsInSomeHoleClause);
+		}
+
+		for (std::size_t hole = 0; hole < numHoles; ++hole)
+		{
+			for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+			{
+				for (std::size_t otherPigeon = pigeon + 1; otherPigeon < numPigeons; ++otherPigeon)
+					clausesOfFormula.emplace_back(std::vector<long>({ -determineVariable(pigeon, hole), -determineVariable(otherPigeon, hole) }));
+			}
+		}
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numPigeons * numHoles, clausesOfFormula, problemDefinition));
+	}
+
+	[[nodiscard]] static bool pollUntilExhausted(ResourceBudget& resourceBudget, std::size_t maximumNumPolls)
+	{
+		for (std::size_t numPolls = 0; numPolls < maximumNumPolls; ++numPolls)
+		{
+			if (resourceBudget.isExhausted())
+				return true;
+		}
+		return false;
+	}
+};
+
+TEST_F(ResourceBudgetTests, BudgetWithoutLimitsIsNeverExhausted)
+{
+	ResourceBudget resourceBudget;
+	resourceBudget.chargeConflicts(1000);
+	resourceBudget.chargeTicks(1000000);
+	ASSERT_FALSE(pollUntilExhausted(resourceBudget, 2 * ResourceBudget::NUM_POLLS_PER_MEMORY_SAMPLE));
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::None, resourceBudget.getExhaustionReason());
+}
+
+TEST_F(ResourceBudgetTests, ConflictAndTickLimitsExhaustBudget)
+{
+	ResourceBudget resourceBudget(ResourceBudget::Limits({ std::nullopt, 10, 100, std::nullopt }));
+	resourceBudget.chargeConflicts(9);
+	resourceBudget.chargeTicks(99);
+	ASSERT_FALSE(resourceBudget.isExhausted());
+
+	resourceBudget.chargeTicks(1);
+	ASSERT_TRUE(resourceBudget.isExhausted());
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::TickLimit, resourceBudget.getExhaustionReason());
+
+	// The first determined reason is kept until the budget is restarted
+	resourceBudget.chargeConflicts(1);
+	ASSERT_TRUE(resourceBudget.isExhausted());
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::TickLimit, resourceBudget.getExhaustionReason());
+
+	resourceBudget.restart();
+	ASSERT_FALSE(resourceBudget.isExhausted());
+	ASSERT_EQ(0, resourceBudget.getNumConsumedConflicts());
+	resourceBudget.chargeConflicts(10);
+	ASSERT_TRUE(resourceBudget.isExhausted());
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::ConflictLimit, resourceBudget.getExhaustionReason());
+}
+
+TEST_F(ResourceBudgetTests, SampledLimitsAreDetectedWithinSamplingInterval)
+{
+	ResourceBudget wallClockLimitedBudget(ResourceBudget::Limits({ std::chrono::milliseconds(0), std::nullopt, std::nullopt, std::nullopt }));
+	ASSERT_TRUE(pollUntilExhausted(wallClockLimitedBudget, ResourceBudget::NUM_POLLS_PER_CLOCK_SAMPLE));
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::WallClockLimit, wallClockLimitedBudget.getExhaustionReason());
+
+	if (!ResourceBudget::determineResidentSetSizeInBytes().has_value())
+		GTEST_SKIP() << "Resident set size cannot be determined on the current platform";
+
+	ResourceBudget memoryLimitedBudget(ResourceBudget::Limits({ std::nullopt, std::nullopt, std::nullopt, 1 }));
+	ASSERT_TRUE(pollUntilExhausted(memoryLimitedBudget, ResourceBudget::NUM_POLLS_PER_MEMORY_SAMPLE));
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::MemoryLimit, memoryLimitedBudget.getExhaustionReason());
+}
+
+TEST_F(ResourceBudgetTests, InvalidMemoryLimitThrows)
+{
+	ASSERT_THROW(ResourceBudget(ResourceBudget::Limits({ std::nullopt, std::nullopt, std::nullopt, 0 })), std::invalid_argument);
+}
+
+TEST_F(ResourceBudgetTests, InterruptSignalExhaustsEveryBudget)
+{
+	ResourceBudget resourceBudget;
+	ResourceBudget otherResourceBudget;
+	ResourceBudget::installInterruptSignalHandlers();
+	ASSERT_EQ(0, std::raise(SIGINT));
+	ASSERT_TRUE(ResourceBudget::wasInterruptSignalReceived());
+	ASSERT_TRUE(resourceBudget.isExhausted());
+	ASSERT_TRUE(otherResourceBudget.isExhausted());
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::Interrupted, resourceBudget.getExhaustionReason());
+
+	// The first signal restores the default handler, which would terminate the process on a further signal
+	std::signal(SIGTERM, SIG_DFL);
+	ResourceBudget::resetInterruptSignal();
+	resourceBudget.restart();
+	ASSERT_FALSE(resourceBudget.isExhausted());
+}
+
+TEST_F(ResourceBudgetTests, SolverReportsUnknownResultOnceConflictLimitOfBudgetIsReached)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generatePigeonHoleProblemDefinition(6, problemDefinition));
+
+	ResourceBudget resourceBudget(ResourceBudget::Limits({ std::nullopt, 10, std::nullopt, std::nullopt }));
+	solver::Solver solver(*problemDefinition);
+	solver.setResourceBudget(&resourceBudget);
+	ASSERT_EQ(solver::Solver::SolverResult::Unknown, solver.solve());
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::ConflictLimit, resourceBudget.getExhaustionReason());
+	ASSERT_EQ(10, solver.getStatistics().numConflicts);
+	ASSERT_EQ(solver.getStatistics().numPropagationTicks, resourceBudget.getNumConsumedTicks());
+
+	solver.setResourceBudget(nullptr);
+	ASSERT_EQ(solver::Solver::SolverResult::Unsat, solver.solve());
+}
+
+TEST_F(ResourceBudgetTests, WorkersOfParallelSolversShareBudget)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generatePigeonHoleProblemDefinition(8, problemDefinition));
+
+	ResourceBudget resourceBudget(ResourceBudget::Limits({ std::nullopt, 50, std::nullopt, std::nullopt }));
+	solver::PortfolioSolver portfolioSolver(*problemDefinition, 2, solver::Solver::SolverConfiguration());
+	portfolioSolver.setResourceBudget(&resourceBudget);
+	ASSERT_EQ(solver::Solver::SolverResult::Unknown, portfolioSolver.solve());
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::ConflictLimit, resourceBudget.getExhaustionReason());
+	ASSERT_EQ(portfolioSolver.getStatisticsOfWorker(0).numConflicts + portfolioSolver.getStatisticsOfWorker(1).numConflicts, resourceBudget.getNumConsumedConflicts());
+
+	resourceBudget.restart();
+	solver::CubeAndConquerSolver cubeAndConquerSolver(*problemDefinition, 2, solver::Solver::SolverConfiguration(), solver::CubeAndConquerSolver::CubeAndConquerConfiguration());
+	cubeAndConquerSolver.setResourceBudget(&resourceBudget);
+	ASSERT_EQ(solver::Solver::SolverResult::Unknown, cubeAndConquerSolver.solve());
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::ConflictLimit, resourceBudget.getExhaustionReason());
+}
+
+TEST_F(ResourceBudgetTests, ParsingIsAbortedOnceBudgetIsExhausted)
+{
+	ResourceBudget resourceBudget;
+	dimacs::DimacsParser dimacsParser;
+	dimacsParser.setResourceBudget(&resourceBudget);
+	ASSERT_FALSE(dimacsParser.readProblemFromString("p cnf 2 2\n1 2 0\n-1 2 0\n").determinedAnyErrors);
+
+	resourceBudget.interrupt();
+	const dimacs::DimacsParser::ParseResult parseResult = dimacsParser.readProblemFromString("p cnf 2 2\n1 2 0\n-1 2 0\n");
+	ASSERT_TRUE(parseResult.determinedAnyErrors);
+	ASSERT_FALSE(parseResult.formula.has_value());
+	ASSERT_EQ(ResourceBudget::ExhaustionReason::Interrupted, resourceBudget.getExhaustionReason());
+}
+
+TEST_F(ResourceBudgetTests, EliminatorsReportNoBlockingCandidateOnceBudgetIsExhausted)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(3, { { 1, 2, 3 }, { -1, -2 }, { -1, -3 } }, problemDefinition));
+
+	ResourceBudget resourceBudget;
+	blockedClauseElimination::LiteralOccurrenceBlockedClauseEliminator blockedClauseEliminator(problemDefinition);
+	blockedClauseEliminator.setResourceBudget(&resourceBudget);
+	const blockedClauseElimination::BlockingLiteralGenerator::ptr blockingLiteralGenerator = blockedClauseElimination::BlockingLiteralGenerator::usingSequentialLiteralSelectionHeuristic();
+	setBlockedClauseElimination::LiteralOccurrenceSetBlockedClauseEliminator setBlockedClauseEliminator(problemDefinition);
+	setBlockedClauseEliminator.setResourceBudget(&resourceBudget);
+	const setBlockedClauseElimination::LiteralOccurrenceBlockingSetCandidateGenerator::ptr candidateGenerator = setBlockedClauseElimination::LiteralOccurrenceBlockingSetCandidateGenerator::usingSequentialLiteralSelectionHeuristic();
+
+	ASSERT_TRUE(blockedClauseEliminator.determineBlockingLiteralOfClause(0, *blockingLiteralGenerator).has_value());
+	ASSERT_TRUE(setBlockedClauseEliminator.determineBlockingSet(0, *candidateGenerator).has_value());
+
+	resourceBudget.interrupt();
+	ASSERT_FALSE(blockedClauseEliminator.determineBlockingLiteralOfClause(0, *blockingLiteralGenerator).has_value());
+	ASSERT_FALSE(setBlockedClauseEliminator.determineBlockingSet(0, *candidateGenerator).has_value());
+}
+
+TEST_F(ResourceBudgetTests, EliminatorsChargeSameNumberOfTicksForSameChecks)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(3, { { 1, 2, 3 }, { -1, -2 }, { -1, -3 } }, problemDefinition));
+
+	std::array<std::size_t, 2> perRunNumTicks = { 0, 0 };
+	for (std::size_t& numTicksOfRun : perRunNumTicks)
+	{
+		ResourceBudget resourceBudget;
+		blockedClauseElimination::LiteralOccurrenceBlockedClauseEliminator blockedClauseEliminator(problemDefinition);
+		blockedClauseEliminator.setResourceBudget(&resourceBudget);
+		const blockedClauseElimination::BlockingLiteralGenerator::ptr blockingLiteralGenerator = blockedClauseElimination::BlockingLiteralGenerator::usingSequentialLiteralSelectionHeuristic();
+		setBlockedClauseElimination::LiteralOccurrenceSetBlockedClauseEliminator setBlockedClauseEliminator(problemDefinition);
+		setBlockedClauseEliminator.setResourceBudget(&resourceBudget);
+		const setBlockedClauseElimination::LiteralOccurrenceBlockingSetCandidateGenerator::ptr candidateGenerator = setBlockedClauseElimination::LiteralOccurrenceBlockingSetCandidateGenerator::usingSequentialLiteralSelectionHeuristic();
+
+		for (std::size_t clauseIdx = 0; clauseIdx < 3; ++clauseIdx)
+		{
+			static_cast<void>(blockedClauseEliminator.determineBlockingLiteralOfClause(clauseIdx, *blockingLiteralGenerator));
+			static_cast<void>(setBlockedClauseEliminator.determineBlockingSet(clauseIdx, *candidateGenerator));
+		}
+		ASSERT_GT(blockedClauseEliminator.getNumTicks(), 0);
+		ASSERT_GT(setBlockedClauseEliminator.getNumTicks(), 0);
+		ASSERT_EQ(blockedClauseEliminator.getNumTicks() + setBlockedClauseEliminator.getNumTicks(), resourceBudget.getNumConsumedTicks());
+		numTicksOfRun = resourceBudget.getNumConsumedTicks();
+	}
+	ASSERT_EQ(perRunNumTicks[0], perRunNumTicks[1]);
+}
+
+TEST_F(ResourceBudgetTests, RunsBoundedByTickLimitAreReproducible)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generatePigeonHoleProblemDefinition(7, problemDefinition));
+
+	// The inprocessing is scheduled in ticks as well, thus its passes are charged to the budget at the same points of both runs
+	solver::Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalInprocessingTickInterval = 20000;
+	std::array<solver::Solver::SolverStatistics, 2> perRunStatistics;
+	for (solver::Solver::SolverStatistics& statisticsOfRun : perRunStatistics)
+	{
+		ResourceBudget resourceBudget(ResourceBudget::Limits({ std::nullopt, std::nullopt, 500000, std::nullopt }));
+		solver::Solver solver(*problemDefinition, solverConfiguration);
+		solver.setResourceBudget(&resourceBudget);
+		ASSERT_EQ(solver::Solver::SolverResult::Unknown, solver.solve());
+		ASSERT_EQ(ResourceBudget::ExhaustionReason::TickLimit, resourceBudget.getExhaustionReason());
+		statisticsOfRun = solver.getStatistics();
+	}
+	ASSERT_GT(perRunStatistics[0].numInprocessingRounds, 0);
+	ASSERT_EQ(perRunStatistics[0].numInprocessingRounds, perRunStatistics[1].numInprocessingRounds);
+	ASSERT_EQ(perRunStatistics[0].numConflicts, perRunStatistics[1].numConflicts);
+	ASSERT_EQ(perRunStatistics[0].numDecisions, perRunStatistics[1].numDecisions);
+	ASSERT_EQ(perRunStatistics[0].numPropagationTicks, perRunStatistics[1].numPropagationTicks);
+}
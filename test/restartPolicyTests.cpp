@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "solver/restartPolicies/glucoseRestartPolicy.hpp"
+#include "solver/restartPolicies/lubyRestartPolicy.hpp"
+
+using namespace restartPolicies;
+
+class RestartPolicyTests : public testing::Test {
+public:
+	static void assertNumConflictsUntilRestartMatches(BaseRestartPolicy& restartPolicy, std::size_t expectedNumConflictsUntilRestart)
+	{
+		for (std::size_t i = 1; i < expectedNumConflictsUntilRestart; ++i)
+		{
+			restartPolicy.onConflict(1, 1);
+			ASSERT_FALSE(restartPolicy.shouldRestart());
+		}
+		restartPolicy.onConflict(1, 1);
+		ASSERT_TRUE(restartPolicy.shouldRestart());
+		restartPolicy.onRestart();
+	}
+};
+
+TEST_F(RestartPolicyTests, LubyRestartIntervalsFollowLubySequence)
+{
+	constexpr std::size_t unitConflictInterval = 3;
+	LubyRestartPolicy restartPolicy(unitConflictInterval, std::nullopt);
+
+	for (const std::size_t lubySequenceElement : { 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8, 1 })
+		ASSERT_NO_FATAL_FAILURE(assertNumConflictsUntilRestartMatches(restartPolicy, lubySequenceElement * unitConflictInterval));
+}
+
+TEST_F(RestartPolicyTests, ReluctantDoublingStartsFromBeginningOnceMaximumIntervalIsExceeded)
+{
+	LubyRestartPolicy restartPolicy(1, 2);
+	for (const std::size_t expectedConflictInterval : { 1, 1, 2, 1, 1, 2, 1, 1, 2 })
+	{
+		ASSERT_EQ(expectedConflictInterval, restartPolicy.getCurrentConflictInterval());
+		ASSERT_NO_FATAL_FAILURE(assertNumConflictsUntilRestartMatches(restartPolicy, expectedConflictInterval));
+	}
+}
+
+TEST_F(RestartPolicyTests, LubyRestartPolicyWithInvalidIntervalsThrows)
+{
+	ASSERT_THROW(LubyRestartPolicy(0, std::nullopt), std::invalid_argument);
+	ASSERT_THROW(LubyRestartPolicy(10, 5), std::invalid_argument);
+}
+
+TEST_F(RestartPolicyTests, GlucoseRestartIsTriggeredByIncreaseOfRecentLiteralBlockDistances)
+{
+	GlucoseRestartPolicy::Configuration configuration;
+	configuration.fastMovingAverageSmoothingFactor = 0.5;
+	configuration.slowMovingAverageSmoothingFactor = 0.01;
+	GlucoseRestartPolicy restartPolicy(configuration);
+
+	for (std::size_t i = 0; i < 50; ++i)
+	{
+		restartPolicy.onConflict(2, 10);
+		ASSERT_FALSE(restartPolicy.shouldRestart());
+	}
+	ASSERT_NEAR(2.0, restartPolicy.getFastMovingAverageOfLiteralBlockDistance(), 1e-9);
+	ASSERT_NEAR(2.0, restartPolicy.getSlowMovingAverageOfLiteralBlockDistance(), 1e-9);
+
+	restartPolicy.onConflict(10, 10);
+	restartPolicy.onConflict(10, 10);
+	ASSERT_TRUE(restartPolicy.shouldRestart());
+	ASSERT_GT(restartPolicy.getFastMovingAverageOfLiteralBlockDistance(), configuration.restartMargin * restartPolicy.getSlowMovingAverageOfLiteralBlockDistance());
+
+	restartPolicy.onRestart();
+	ASSERT_FALSE(restartPolicy.shouldRestart());
+}
+
+TEST_F(RestartPolicyTests, GlucoseRestartIsBlockedIfTrailIsLargerThanAverage)
+{
+	GlucoseRestartPolicy::Configuration configuration;
+	configuration.fastMovingAverageSmoothingFactor = 0.5;
+	configuration.slowMovingAverageSmoothingFactor = 0.01;
+	configuration.trailSizeMovingAverageSmoothingFactor = 0.01;
+	configuration.minimumConflictsBeforeBlocking = 10;
+	configuration.minimumConflictsAfterBlockedRestart = 5;
+	GlucoseRestartPolicy restartPolicy(configuration);
+
+	for (std::size_t i = 0; i < 20; ++i)
+		restartPolicy.onConflict(2, 10);
+
+	restartPolicy.onConflict(10, 100);
+	ASSERT_EQ(1, restartPolicy.getNumBlockedRestarts());
+	ASSERT_FALSE(restartPolicy.shouldRestart());
+
+	for (std::size_t i = 1; i < configuration.minimumConflictsAfterBlockedRestart; ++i)
+	{
+		restartPolicy.onConflict(10, 10);
+		ASSERT_FALSE(restartPolicy.shouldRestart());
+	}
+	restartPolicy.onConflict(10, 10);
+	ASSERT_TRUE(restartPolicy.shouldRestart());
+	ASSERT_EQ(1, restartPolicy.getNumBlockedRestarts());
+}
+
+TEST_F(RestartPolicyTests, GlucoseRestartPolicyWithInvalidSmoothingFactorsThrows)
+{
+	GlucoseRestartPolicy::Configuration configuration;
+	configuration.fastMovingAverageSmoothingFactor = 0;
+	ASSERT_THROW(GlucoseRestartPolicy{ configuration }, std::invalid_argument);
+
+	configuration.fastMovingAverageSmoothingFactor = 0.01;
+	configuration.slowMovingAverageSmoothingFactor = 0.1;
+	ASSERT_THROW(GlucoseRestartPolicy{ configuration }, std::invalid_argument);
+}
@@ -0,0 +1,896 @@
+#include <gtest/gtest.h>
+
+#include "dimacs/dimacsParser.hpp"
+#include "formulaTestUtils.hpp"
+#include "solver/solver.hpp"
+#include "solver/decisionHeuristics/sequentialDecisionHeuristic.hpp"
+#include "solver/restartPolicies/lubyRestartPolicy.hpp"
+
+#include <random>
+
+using namespace solver;
+using namespace formulaTestUtils;
+
+class SolverTests : public testing::Test {
+public:
+	[[nodiscard]] static Solver::SolverConfiguration createSolverConfiguration(Solver::DecisionHeuristic decisionHeuristic, std::optional<Solver::DecisionHeuristic> optionalStableModeDecisionHeuristic = std::nullopt,
+		std::optional<std::size_t> optionalInitialSearchModeSwitchConflictInterval = std::nullopt)
+	{
+		Solver::SolverConfiguration solverConfiguration;
+		solverConfiguration.decisionHeuristic = decisionHeuristic;
+		solverConfiguration.optionalStableModeDecisionHeuristic = optionalStableModeDecisionHeuristic;
+		if (optionalInitialSearchModeSwitchConflictInterval.has_value())
+			solverConfiguration.initialSearchModeSwitchConflictInterval = *optionalInitialSearchModeSwitchConflictInterval;
+		return solverConfiguration;
+	}
+
+	static void assertModelSatisfiesClauses(const Solver& solver, const std::vector<std::vector<long>>& clausesOfFormula)
+	{
+		const std::vector<long> model = solver.getModel();
+		ASSERT_EQ(solver.getNumVariables(), model.size());
+		for (const auto& literalsOfClause : clausesOfFormula)
+		{
+			ASSERT_TRUE(std::any_of(
+				literalsOfClause.cbegin(),
+				literalsOfClause.cend(),
+				[&model](const long literal) { return model[std::abs(literal) - 1] == literal; }));
+		}
+	}
+
+	static void assertSolverResultMatches(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, Solver::SolverResult expectedResult)
+	{
+		ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, Solver::SolverConfiguration()));
+	}
+
+	static void assertSolverResultMatches(const std::size_t numVariablesInFormula, const std::vector<std::vector<long>>& clausesOfFormula, Solver::SolverResult expectedResult, const Solver::SolverConfiguration& solverConfiguration)
+	{
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesInFormula, clausesOfFormula, problemDefinition));
+
+		Solver solver(*problemDefinition, solverConfiguration);
+		ASSERT_EQ(expectedResult, solver.solve());
+		if (expectedResult == Solver::SolverResult::Sat)
+		{
+			ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(solver, clausesOfFormula));
+		}
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generatePigeonHoleFormula(std::size_t numHoles)
+	{
+		const std::size_t numPigeons = numHoles + 1;
+		const auto determineVariable = [numHoles](std::size_t pigeon, std::size_t hole) { return static_cast<long>(pigeon * numHoles + hole + 1); };
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+		{
+			std::vector<long> pigeonIsInSomeHoleClause;
+			for (std::size_t hole = 0; hole < numHoles; ++hole)
+				pigeonIsInSomeHoleClause.emplace_back(determineVariable(pigeon, hole));
+			clausesOfFormula.emplace_back(pigeonIsInSomeHoleClause);
+		}
+
+		for (std::size_t hole = 0; hole < numHoles; ++hole)
+		{
+			for (std::size_t pigeon = 0; pigeon < numPigeons; ++pigeon)
+			{
+				for (std::size_t otherPigeon = pigeon + 1; otherPigeon < numPigeons; ++otherPigeon)
+					clausesOfFormula.emplace_back(std::vector<long>({ -determineVariable(pigeon, hole), -determineVariable(otherPigeon, hole) }));
+			}
+		}
+		return clausesOfFormula;
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> generateRandomKSatFormula(std::size_t numVariables, std::size_t numClauses, std::size_t clauseLength, std::default_random_engine& rng)
+	{
+		std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(numVariables));
+		std::bernoulli_distribution polarityDistribution(0.5);
+
+		std::vector<std::vector<long>> clausesOfFormula;
+		while (clausesOfFormula.size() < numClauses)
+		{
+			std::vector<long> clauseLiterals;
+			while (clauseLiterals.size() < clauseLength)
+			{
+				const long variable = variableDistribution(rng);
+				if (std::none_of(clauseLiterals.cbegin(), clauseLiterals.cend(), [variable](const long literal) { return std::abs(literal) == variable; }))
+					clauseLiterals.emplace_back(polarityDistribution(rng) ? variable : -variable);
+			}
+			clausesOfFormula.emplace_back(clauseLiterals);
+		}
+		return clausesOfFormula;
+	}
+};
+
+TEST_F(SolverTests, FormulaWithoutClausesIsSatisfiable)
+{
+	constexpr std::size_t numVariablesInFormula = 3;
+	ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, {}, Solver::SolverResult::Sat));
+}
+
+TEST_F(SolverTests, FormulaContainingEmptyClauseIsUnsatisfiable)
+{
+	constexpr std::size_t numVariablesInFormula = 2;
+	ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, { {1, 2}, {} }, Solver::SolverResult::Unsat));
+}
+
+TEST_F(SolverTests, ConflictingUnitClausesAreUnsatisfiable)
+{
+	constexpr std::size_t numVariablesInFormula = 2;
+	ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, { {1, 2}, {1}, {-1} }, Solver::SolverResult::Unsat));
+}
+
+TEST_F(SolverTests, SatisfiableFormulaRequiringConflictAnalysisProducesModel)
+{
+	constexpr std::size_t numVariablesInFormula = 5;
+	ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, {
+		{1, 2},
+		{1, -2, 3},
+		{1, -3},
+		{-1, 4, 5},
+		{-1, -4, 5},
+		{-1, 4, -5},
+		{-2, -4, -5}
+	}, Solver::SolverResult::Sat));
+}
+
+TEST_F(SolverTests, PigeonHoleFormulaIsUnsatisfiable)
+{
+	constexpr std::size_t numHoles = 5;
+	ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), Solver::SolverResult::Unsat));
+}
+
+TEST_F(SolverTests, ReachingConflictLimitReportsUnknownResult)
+{
+	constexpr std::size_t numHoles = 6;
+	const std::vector<std::vector<long>> clausesOfFormula = generatePigeonHoleFormula(numHoles);
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), clausesOfFormula, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalConflictLimit = 1;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unknown, solver.solve());
+	ASSERT_EQ(1, solver.getStatistics().numConflicts);
+	ASSERT_TRUE(solver.getModel().empty());
+}
+
+TEST_F(SolverTests, AssignmentsOfUnitPropagationDuringParsingArePartOfModel)
+{
+	const std::string stringifiedCnfFormula = "p cnf 3 3\n1 0\n-1 2 3 0\n-2 -3 0";
+	auto parserInstance = std::make_unique<dimacs::DimacsParser>();
+	const dimacs::DimacsParser::ParseResult parseResult = parserInstance->readProblemFromString(stringifiedCnfFormula);
+	ASSERT_FALSE(parseResult.determinedAnyErrors);
+	ASSERT_TRUE(parseResult.formula.has_value());
+
+	Solver solver(**parseResult.formula);
+	ASSERT_EQ(Solver::SolverResult::Sat, solver.solve());
+	ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(solver, { {1}, {-1, 2, 3}, {-2, -3} }));
+}
+
+TEST_F(SolverTests, UserDefinedDecisionHeuristicIsUsedDuringSearch)
+{
+	class CountingDecisionHeuristic : public decisionHeuristics::SequentialDecisionHeuristic {
+	public:
+		explicit CountingDecisionHeuristic(std::size_t& numPickedVariables)
+			: numPickedVariables(numPickedVariables) {}
+
+		[[nodiscard]] std::optional<std::size_t> pickBranchingVariable(const VariableAssignmentCheck& isVariableAssigned) override
+		{
+			++numPickedVariables;
+			return SequentialDecisionHeuristic::pickBranchingVariable(isVariableAssigned);
+		}
+
+	protected:
+		std::size_t& numPickedVariables;
+	};
+
+	constexpr std::size_t numHoles = 4;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	std::size_t numPickedVariables = 0;
+	Solver solver(*problemDefinition);
+	solver.setDecisionHeuristic(std::make_unique<CountingDecisionHeuristic>(numPickedVariables));
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_EQ(solver.getStatistics().numDecisions, numPickedVariables);
+	ASSERT_THROW(solver.setDecisionHeuristic(nullptr), std::invalid_argument);
+}
+
+TEST_F(SolverTests, SearchModeSwitchesAreRecordedInPerHeuristicStatistics)
+{
+	constexpr std::size_t numHoles = 5;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver solver(*problemDefinition, createSolverConfiguration(Solver::DecisionHeuristic::Evsids, Solver::DecisionHeuristic::LearningRateBranching, 10));
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+
+	const Solver::SolverStatistics& statistics = solver.getStatistics();
+	const Solver::DecisionHeuristicStatistics& focusedModeStatistics = statistics.perSearchModeDecisionHeuristicStatistics[Solver::SearchMode::Focused];
+	const Solver::DecisionHeuristicStatistics& stableModeStatistics = statistics.perSearchModeDecisionHeuristicStatistics[Solver::SearchMode::Stable];
+	ASSERT_EQ(Solver::DecisionHeuristic::Evsids, focusedModeStatistics.decisionHeuristic);
+	ASSERT_EQ(Solver::DecisionHeuristic::LearningRateBranching, stableModeStatistics.decisionHeuristic);
+	ASSERT_GT(statistics.numConflicts, 10);
+	ASSERT_GE(stableModeStatistics.numActivations, 1);
+	ASSERT_GE(focusedModeStatistics.numActivations, stableModeStatistics.numActivations);
+	ASSERT_EQ(statistics.numConflicts, focusedModeStatistics.numConflicts + stableModeStatistics.numConflicts);
+	ASSERT_EQ(statistics.numDecisions, focusedModeStatistics.numDecisions + stableModeStatistics.numDecisions);
+}
+
+TEST_F(SolverTests, SearchModeIsNotSwitchedWithoutStableModeDecisionHeuristic)
+{
+	constexpr std::size_t numHoles = 5;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver solver(*problemDefinition, createSolverConfiguration(Solver::DecisionHeuristic::LearningRateBranching, std::nullopt, 1));
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_EQ(Solver::SearchMode::Focused, solver.getActiveSearchMode());
+	ASSERT_EQ(0, solver.getStatistics().perSearchModeDecisionHeuristicStatistics[Solver::SearchMode::Stable].numActivations);
+	ASSERT_EQ(solver.getStatistics().numConflicts, solver.getStatistics().perSearchModeDecisionHeuristicStatistics[Solver::SearchMode::Focused].numConflicts);
+}
+
+TEST_F(SolverTests, RestartsAreRecordedInStatistics)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.restartPolicy = Solver::RestartPolicy::Luby;
+	solverConfiguration.isTrailReuseEnabled = false;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+
+	const Solver::SolverStatistics& statistics = solver.getStatistics();
+	ASSERT_GT(statistics.numConflicts, restartPolicies::LubyRestartPolicy::DEFAULT_UNIT_INTERVAL);
+	ASSERT_GT(statistics.numRestarts, 0);
+	ASSERT_EQ(0, statistics.numRestartsWithReusedTrail);
+	ASSERT_EQ(0, statistics.numReusedDecisionLevels);
+}
+
+TEST_F(SolverTests, DisabledRestartPolicyDoesNotRestart)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.restartPolicy = Solver::RestartPolicy::NoRestarts;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_EQ(0, solver.getStatistics().numRestarts);
+}
+
+TEST_F(SolverTests, ReductionOfClauseDatabaseDeletesLocalLearnedClauses)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.initialClauseDatabaseReductionInterval = 50;
+	solverConfiguration.clauseDatabaseReductionIntervalIncrement = 10;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+
+	const Solver::SolverStatistics& statistics = solver.getStatistics();
+	ASSERT_GT(statistics.numClauseDatabaseReductions, 0);
+	ASSERT_GT(statistics.numDeletedLearnedClauses, 0);
+	ASSERT_GT(statistics.numGarbageCollections, 0);
+	ASSERT_GE(statistics.numClauseDatabaseReductions, statistics.numGarbageCollections);
+
+	const std::size_t numRemainingLearnedClauses = statistics.numLearnedClausesPerTier[Solver::ClauseTier::Core] + statistics.numLearnedClausesPerTier[Solver::ClauseTier::TierTwo] + statistics.numLearnedClausesPerTier[Solver::ClauseTier::Local];
+	ASSERT_EQ(statistics.numLearnedClauses - statistics.numLearnedUnitClauses - statistics.numDeletedLearnedClauses, numRemainingLearnedClauses);
+}
+
+TEST_F(SolverTests, InvalidLiteralBlockDistanceLimitsOfClauseTiersThrow)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { {1, 2} }, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.maximumLiteralBlockDistanceOfCoreClauses = 7;
+	solverConfiguration.maximumLiteralBlockDistanceOfTierTwoClauses = 6;
+	ASSERT_THROW(Solver(*problemDefinition, solverConfiguration), std::invalid_argument);
+}
+
+TEST_F(SolverTests, ResultOfRandomFormulasMatchesBruteForceResultWithFrequentClauseDatabaseReductions)
+{
+	constexpr std::size_t numVariablesInFormula = 16;
+	constexpr std::size_t numClausesInFormula = 70;
+	constexpr std::size_t numGeneratedFormulas = 30;
+	std::default_random_engine rng(7);
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.initialClauseDatabaseReductionInterval = 2;
+	solverConfiguration.clauseDatabaseReductionIntervalIncrement = 0;
+	solverConfiguration.maximumLiteralBlockDistanceOfCoreClauses = 0;
+	solverConfiguration.maximumLiteralBlockDistanceOfTierTwoClauses = 0;
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, numClausesInFormula, 3, rng);
+		const Solver::SolverResult expectedResult = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula) ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat;
+		ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, solverConfiguration));
+	}
+}
+
+TEST_F(SolverTests, ResultOfRandomThreeSatFormulasMatchesBruteForceResult)
+{
+	constexpr std::size_t numVariablesInFormula = 12;
+	constexpr std::size_t numClausesInFormula = 52;
+	constexpr std::size_t numGeneratedFormulas = 100;
+	std::default_random_engine rng(42);
+
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, numClausesInFormula, 3, rng);
+		const Solver::SolverResult expectedResult = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula) ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat;
+		ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, createSolverConfiguration(Solver::DecisionHeuristic::Evsids)));
+		ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, createSolverConfiguration(Solver::DecisionHeuristic::Sequential)));
+		ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, createSolverConfiguration(Solver::DecisionHeuristic::LearningRateBranching)));
+		ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, createSolverConfiguration(Solver::DecisionHeuristic::Evsids, Solver::DecisionHeuristic::LearningRateBranching, 2)));
+	}
+}
+
+TEST_F(SolverTests, ResultOfRandomThreeSatFormulasMatchesBruteForceResultForEveryRestartPolicy)
+{
+	constexpr std::size_t numVariablesInFormula = 12;
+	constexpr std::size_t numClausesInFormula = 52;
+	constexpr std::size_t numGeneratedFormulas = 50;
+	std::default_random_engine rng(1337);
+
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, numClausesInFormula, 3, rng);
+		const Solver::SolverResult expectedResult = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula) ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat;
+		for (const Solver::RestartPolicy restartPolicy : { Solver::RestartPolicy::NoRestarts, Solver::RestartPolicy::Luby, Solver::RestartPolicy::Glucose, Solver::RestartPolicy::ReluctantDoubling })
+		{
+			for (const bool isTrailReuseEnabled : { false, true })
+			{
+				Solver::SolverConfiguration solverConfiguration;
+				solverConfiguration.restartPolicy = restartPolicy;
+				solverConfiguration.isTrailReuseEnabled = isTrailReuseEnabled;
+				ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, solverConfiguration));
+			}
+		}
+	}
+}
+
+TEST_F(SolverTests, MinimizationAndShrinkingOfLearnedClausesAreRecordedInStatistics)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver solver(*problemDefinition, Solver::SolverConfiguration());
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_GT(solver.getStatistics().numMinimizedLiterals + solver.getStatistics().numShrunkLiterals, 0);
+
+	Solver::SolverConfiguration solverConfigurationWithoutMinimization;
+	solverConfigurationWithoutMinimization.isLearnedClauseMinimizationEnabled = false;
+	solverConfigurationWithoutMinimization.isLearnedClauseShrinkingEnabled = false;
+	Solver solverWithoutMinimization(*problemDefinition, solverConfigurationWithoutMinimization);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solverWithoutMinimization.solve());
+	ASSERT_EQ(0, solverWithoutMinimization.getStatistics().numMinimizedLiterals);
+	ASSERT_EQ(0, solverWithoutMinimization.getStatistics().numShrunkLiterals);
+}
+
+TEST_F(SolverTests, ResultOfRandomThreeSatFormulasMatchesBruteForceResultForEveryLearnedClauseMinimization)
+{
+	constexpr std::size_t numVariablesInFormula = 16;
+	constexpr std::size_t numClausesInFormula = 68;
+	constexpr std::size_t numGeneratedFormulas = 30;
+	std::default_random_engine rng(4711);
+
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, numClausesInFormula, 3, rng);
+		const Solver::SolverResult expectedResult = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula) ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat;
+		for (const bool isLearnedClauseMinimizationEnabled : { false, true })
+		{
+			for (const bool isLearnedClauseShrinkingEnabled : { false, true })
+			{
+				Solver::SolverConfiguration solverConfiguration;
+				solverConfiguration.isLearnedClauseMinimizationEnabled = isLearnedClauseMinimizationEnabled;
+				solverConfiguration.isLearnedClauseShrinkingEnabled = isLearnedClauseShrinkingEnabled;
+				ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, solverConfiguration));
+			}
+		}
+	}
+}
+
+TEST_F(SolverTests, RephasingCyclesThroughEveryRephasingStrategy)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalRephasingInterval = 10;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+
+	const std::array<std::size_t, 5>& numRephasesPerStrategy = solver.getStatistics().numRephasesPerStrategy;
+	ASSERT_GT(numRephasesPerStrategy[Solver::RephasingStrategy::Random], 0);
+	ASSERT_GE(numRephasesPerStrategy[Solver::RephasingStrategy::Original], numRephasesPerStrategy[Solver::RephasingStrategy::Inverted]);
+	ASSERT_GE(numRephasesPerStrategy[Solver::RephasingStrategy::Inverted], numRephasesPerStrategy[Solver::RephasingStrategy::Best]);
+	ASSERT_GE(numRephasesPerStrategy[Solver::RephasingStrategy::Best], numRephasesPerStrategy[Solver::RephasingStrategy::Walk]);
+	ASSERT_GE(numRephasesPerStrategy[Solver::RephasingStrategy::Walk], numRephasesPerStrategy[Solver::RephasingStrategy::Random]);
+	ASSERT_EQ(numRephasesPerStrategy[Solver::RephasingStrategy::Walk], solver.getStatistics().localSearchStatistics.numSearches);
+	ASSERT_LE(numRephasesPerStrategy[Solver::RephasingStrategy::Original] - numRephasesPerStrategy[Solver::RephasingStrategy::Random], 1);
+}
+
+TEST_F(SolverTests, InvalidRephasingIntervalThrows)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { {1, 2} }, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalRephasingInterval = 0;
+	ASSERT_THROW(Solver(*problemDefinition, solverConfiguration), std::invalid_argument);
+}
+
+TEST_F(SolverTests, ResultOfRandomThreeSatFormulasMatchesBruteForceResultForEveryPhaseSelection)
+{
+	constexpr std::size_t numVariablesInFormula = 14;
+	constexpr std::size_t numClausesInFormula = 60;
+	constexpr std::size_t numGeneratedFormulas = 40;
+	std::default_random_engine rng(2020);
+
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, numClausesInFormula, 3, rng);
+		const Solver::SolverResult expectedResult = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula) ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat;
+		for (const Solver::TargetPhaseUsage targetPhaseUsage : { Solver::TargetPhaseUsage::Never, Solver::TargetPhaseUsage::StableModeOnly, Solver::TargetPhaseUsage::Always })
+		{
+			for (const bool isPhaseSavingEnabled : { false, true })
+			{
+				Solver::SolverConfiguration solverConfiguration;
+				solverConfiguration.optionalStableModeDecisionHeuristic = Solver::DecisionHeuristic::Evsids;
+				solverConfiguration.initialSearchModeSwitchConflictInterval = 3;
+				solverConfiguration.isPhaseSavingEnabled = isPhaseSavingEnabled;
+				solverConfiguration.targetPhaseUsage = targetPhaseUsage;
+				solverConfiguration.optionalRephasingInterval = 2;
+				solverConfiguration.randomSeed = static_cast<std::uint32_t>(i);
+				ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, solverConfiguration));
+			}
+		}
+	}
+}
+
+TEST_F(SolverTests, ChronologicalBacktrackingIsRecordedInStatistics)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalChronologicalBacktrackingThreshold = 1;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_GT(solver.getStatistics().numChronologicalBacktracks, 0);
+	ASSERT_GT(solver.getStatistics().numAssignmentsRetainedByChronologicalBacktracking, 0);
+
+	solverConfiguration.optionalChronologicalBacktrackingThreshold.reset();
+	Solver solverWithoutChronologicalBacktracking(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solverWithoutChronologicalBacktracking.solve());
+	ASSERT_EQ(0, solverWithoutChronologicalBacktracking.getStatistics().numChronologicalBacktracks);
+	ASSERT_EQ(0, solverWithoutChronologicalBacktracking.getStatistics().numRetainedOutOfOrderAssignments);
+}
+
+TEST_F(SolverTests, InvalidChronologicalBacktrackingThresholdThrows)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { {1, 2} }, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalChronologicalBacktrackingThreshold = 0;
+	ASSERT_THROW(Solver(*problemDefinition, solverConfiguration), std::invalid_argument);
+}
+
+TEST_F(SolverTests, ResultOfRandomThreeSatFormulasMatchesBruteForceResultWithChronologicalBacktracking)
+{
+	constexpr std::size_t numVariablesInFormula = 16;
+	constexpr std::size_t numClausesInFormula = 68;
+	constexpr std::size_t numGeneratedFormulas = 40;
+	std::default_random_engine rng(815);
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalChronologicalBacktrackingThreshold = 1;
+	solverConfiguration.initialClauseDatabaseReductionInterval = 5;
+	solverConfiguration.clauseDatabaseReductionIntervalIncrement = 1;
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, numClausesInFormula, 3, rng);
+		const Solver::SolverResult expectedResult = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula) ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat;
+		ASSERT_NO_FATAL_FAILURE(assertSolverResultMatches(numVariablesInFormula, clausesOfFormula, expectedResult, solverConfiguration));
+	}
+}
+
+TEST_F(SolverTests, SolversSharingFormulaDetermineSameResult)
+{
+	constexpr std::size_t numHoles = 5;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	const SharedFormula::ptr sharedFormula = SharedFormula::fromProblemDefinition(*problemDefinition);
+	Solver firstSolver(sharedFormula, Solver::SolverConfiguration());
+	Solver secondSolver(sharedFormula, createSolverConfiguration(Solver::DecisionHeuristic::LearningRateBranching));
+	ASSERT_EQ(Solver::SolverResult::Unsat, firstSolver.solve());
+	ASSERT_EQ(Solver::SolverResult::Unsat, secondSolver.solve());
+}
+
+TEST_F(SolverTests, SetCancellationFlagReportsUnknownResult)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	const std::atomic_bool cancellationFlag(true);
+	Solver solver(*problemDefinition);
+	solver.setCancellationFlag(&cancellationFlag);
+	ASSERT_EQ(Solver::SolverResult::Unknown, solver.solve());
+	ASSERT_EQ(0, solver.getStatistics().numDecisions);
+}
+
+TEST_F(SolverTests, ResultOfRandomThreeSatFormulasUnderAssumptionsMatchesBruteForceResult)
+{
+	constexpr std::size_t numVariablesInFormula = 12;
+	constexpr std::size_t numClausesInFormula = 45;
+	constexpr std::size_t numGeneratedFormulas = 30;
+	constexpr std::size_t numAssumptionSetsPerFormula = 5;
+	std::default_random_engine rng(37);
+	std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(numVariablesInFormula));
+	std::uniform_int_distribution<std::size_t> numAssumptionsDistribution(1, 4);
+	std::bernoulli_distribution polarityDistribution(0.5);
+
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, numClausesInFormula, 3, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesInFormula, clausesOfFormula, problemDefinition));
+
+		// The same solver is used for every set of assumptions, thus the clauses learned under previous assumptions are reused
+		Solver solver(*problemDefinition, Solver::SolverConfiguration());
+		for (std::size_t j = 0; j < numAssumptionSetsPerFormula; ++j)
+		{
+			std::vector<long> assumptions;
+			const std::size_t numAssumptions = numAssumptionsDistribution(rng);
+			while (assumptions.size() < numAssumptions)
+			{
+				const long variable = variableDistribution(rng);
+				assumptions.emplace_back(polarityDistribution(rng) ? variable : -variable);
+			}
+
+			std::vector<std::vector<long>> clausesOfFormulaWithAssumptions = clausesOfFormula;
+			for (const long assumption : assumptions)
+				clausesOfFormulaWithAssumptions.emplace_back(std::vector<long>({ assumption }));
+
+			const Solver::SolverResult expectedResult = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormulaWithAssumptions) ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat;
+			ASSERT_EQ(expectedResult, solver.solve(assumptions));
+			if (expectedResult == Solver::SolverResult::Sat)
+			{
+				ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(solver, clausesOfFormulaWithAssumptions));
+			}
+		}
+
+		const Solver::SolverResult expectedResult = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula) ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat;
+		ASSERT_EQ(expectedResult, solver.solve());
+	}
+}
+
+TEST_F(SolverTests, InvalidAssumptionThrows)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { { 1, 2 } }, problemDefinition));
+
+	Solver solver(*problemDefinition);
+	ASSERT_THROW([[maybe_unused]] const Solver::SolverResult result = solver.solve({ 0 }), std::invalid_argument);
+	ASSERT_THROW([[maybe_unused]] const Solver::SolverResult result = solver.solve({ 1, -3 }), std::invalid_argument);
+	ASSERT_EQ(Solver::SolverResult::Sat, solver.solve({ -1 }));
+	ASSERT_EQ(2, solver.getModel()[1]);
+}
+
+TEST_F(SolverTests, AddedClausesWithNewVariablesAreConsideredByLaterCalls)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { { 1, 2 } }, problemDefinition));
+
+	Solver solver(*problemDefinition);
+	ASSERT_EQ(Solver::SolverResult::Sat, solver.solve());
+
+	solver.addClause({ -1, 3 });
+	solver.addClause({ -2, 3 });
+	ASSERT_EQ(3, solver.getNumVariables());
+	ASSERT_EQ(Solver::SolverResult::Sat, solver.solve());
+	ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(solver, { { 1, 2 }, { -1, 3 }, { -2, 3 } }));
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve({ -3 }));
+
+	solver.addClause({ -3 });
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_TRUE(solver.getFailedAssumptions().empty());
+	ASSERT_THROW(solver.addClause({ 1, 0 }), std::invalid_argument);
+}
+
+TEST_F(SolverTests, FailedAssumptionsOnlyContainAssumptionsRequiredForUnsatisfiability)
+{
+	// Variable 5 is implied by the assumptions 1 and 2 while the assumption 3 is irrelevant
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(5, { { -1, 4 }, { -2, -4, 5 }, { 3, 4, 5 } }, problemDefinition));
+
+	Solver solver(*problemDefinition);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve({ 3, 1, 2, -5 }));
+	ASSERT_TRUE(solver.isAssumptionFailed(1));
+	ASSERT_TRUE(solver.isAssumptionFailed(2));
+	ASSERT_TRUE(solver.isAssumptionFailed(-5));
+	ASSERT_FALSE(solver.isAssumptionFailed(3));
+	ASSERT_EQ(3, solver.getFailedAssumptions().size());
+
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve({ 1, -1 }));
+	ASSERT_TRUE(solver.isAssumptionFailed(1));
+	ASSERT_TRUE(solver.isAssumptionFailed(-1));
+
+	ASSERT_EQ(Solver::SolverResult::Sat, solver.solve({ 3, 1, -5 }));
+	ASSERT_TRUE(solver.getFailedAssumptions().empty());
+}
+
+TEST_F(SolverTests, FailedAssumptionsOfRandomThreeSatFormulasAreSufficientForUnsatisfiability)
+{
+	constexpr std::size_t numVariablesInFormula = 12;
+	constexpr std::size_t numClausesInFormula = 40;
+	constexpr std::size_t numGeneratedFormulas = 30;
+	std::default_random_engine rng(47);
+	std::uniform_int_distribution<long> variableDistribution(1, static_cast<long>(numVariablesInFormula));
+	std::bernoulli_distribution polarityDistribution(0.5);
+
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, numClausesInFormula, 3, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesInFormula, clausesOfFormula, problemDefinition));
+
+		std::vector<long> assumptions;
+		while (assumptions.size() < 5)
+		{
+			const long variable = variableDistribution(rng);
+			assumptions.emplace_back(polarityDistribution(rng) ? variable : -variable);
+		}
+
+		Solver solver(*problemDefinition);
+		if (solver.solve(assumptions) != Solver::SolverResult::Unsat)
+			continue;
+
+		std::vector<std::vector<long>> clausesOfFormulaWithFailedAssumptions = clausesOfFormula;
+		for (const long failedAssumption : solver.getFailedAssumptions())
+		{
+			ASSERT_NE(assumptions.cend(), std::find(assumptions.cbegin(), assumptions.cend(), failedAssumption));
+			clausesOfFormulaWithFailedAssumptions.emplace_back(std::vector<long>({ failedAssumption }));
+		}
+		ASSERT_FALSE(isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormulaWithFailedAssumptions));
+	}
+}
+
+TEST_F(SolverTests, TerminationCallbackReportsUnknownResult)
+{
+	constexpr std::size_t numHoles = 6;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	std::size_t numPolls = 0;
+	Solver solver(*problemDefinition);
+	solver.setTerminationCallback([&numPolls] { return ++numPolls > 10; });
+	ASSERT_EQ(Solver::SolverResult::Unknown, solver.solve());
+	ASSERT_EQ(11, numPolls);
+
+	solver.setTerminationCallback(nullptr);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+}
+
+TEST_F(SolverTests, LearnedClausesUpToMaximumSizeArePassedToCallback)
+{
+	constexpr std::size_t numHoles = 5;
+	constexpr std::size_t maximumSizeOfPassedClauses = 3;
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numHoles * (numHoles + 1), generatePigeonHoleFormula(numHoles), problemDefinition));
+
+	std::size_t numPassedClauses = 0;
+	Solver solver(*problemDefinition);
+	solver.setLearnedClauseCallback(maximumSizeOfPassedClauses, [&numPassedClauses, maximumSizeOfPassedClauses](const std::vector<long>& learnedClauseLiterals)
+	{
+		++numPassedClauses;
+		ASSERT_LE(learnedClauseLiterals.size(), maximumSizeOfPassedClauses);
+	});
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+	ASSERT_LT(0, numPassedClauses);
+}
+
+TEST_F(SolverTests, InprocessingPassesAreRecordedInStatistics)
+{
+	constexpr std::size_t numHoles = 6;
+	const std::size_t numVariablesOfPigeonHoleFormula = numHoles * (numHoles + 1);
+	const auto firstAuxiliaryVariable = static_cast<long>(numVariablesOfPigeonHoleFormula + 1);
+	std::vector<std::vector<long>> clausesOfFormula = generatePigeonHoleFormula(numHoles);
+	// The clauses of the auxiliary variable are blocked by its literals while the duplicated clause is subsumed
+	clausesOfFormula.emplace_back(std::vector<long>({ firstAuxiliaryVariable, 1 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ -firstAuxiliaryVariable, -1 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ -1, -2, 3 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ -1, -2, 3 }));
+
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesOfPigeonHoleFormula + 1, clausesOfFormula, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalStableModeDecisionHeuristic = Solver::DecisionHeuristic::Evsids;
+	solverConfiguration.initialSearchModeSwitchConflictInterval = 10;
+	solverConfiguration.optionalInprocessingInterval = 10;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+
+	const Solver::SolverStatistics& statistics = solver.getStatistics();
+	ASSERT_GT(statistics.numInprocessingRounds, 0);
+	ASSERT_GT(statistics.numPropagationTicks, 0);
+	ASSERT_GT(statistics.perInprocessingPassStatistics[Solver::InprocessingPass::Probing].numTicks, 0);
+	ASSERT_GT(statistics.perInprocessingPassStatistics[Solver::InprocessingPass::Subsumption].numRemovedClauses, 0);
+	ASSERT_GT(statistics.perInprocessingPassStatistics[Solver::InprocessingPass::BlockedClauseElimination].numRemovedClauses, 0);
+}
+
+TEST_F(SolverTests, VivificationRemovesLiteralsImpliedByOtherClauses)
+{
+	constexpr std::size_t numHoles = 6;
+	const std::size_t numVariablesOfPigeonHoleFormula = numHoles * (numHoles + 1);
+	const auto firstAuxiliaryVariable = static_cast<long>(numVariablesOfPigeonHoleFormula + 1);
+	std::vector<std::vector<long>> clausesOfFormula = generatePigeonHoleFormula(numHoles);
+	// The first two auxiliary variables are equivalent, thus the negation of either literal falsifies the other one independent of the order of the literals during the vivification
+	clausesOfFormula.emplace_back(std::vector<long>({ firstAuxiliaryVariable, firstAuxiliaryVariable + 1, firstAuxiliaryVariable + 2 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ -firstAuxiliaryVariable, firstAuxiliaryVariable + 1 }));
+	clausesOfFormula.emplace_back(std::vector<long>({ firstAuxiliaryVariable, -(firstAuxiliaryVariable + 1) }));
+
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesOfPigeonHoleFormula + 3, clausesOfFormula, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalStableModeDecisionHeuristic = Solver::DecisionHeuristic::Evsids;
+	solverConfiguration.initialSearchModeSwitchConflictInterval = 10;
+	solverConfiguration.optionalInprocessingInterval = 10;
+	solverConfiguration.isVivificationOfIrredundantClausesEnabled = true;
+	Solver solver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, solver.solve());
+
+	const Solver::InprocessingPassStatistics& vivificationStatistics = solver.getStatistics().perInprocessingPassStatistics[Solver::InprocessingPass::Vivification];
+	ASSERT_GT(vivificationStatistics.numTicks, 0);
+	ASSERT_GT(vivificationStatistics.numRemovedLiterals, 0);
+}
+
+TEST_F(SolverTests, InvalidInprocessingConfigurationThrows)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { {1, 2} }, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalInprocessingInterval = 0;
+	ASSERT_THROW(Solver(*problemDefinition, solverConfiguration), std::invalid_argument);
+
+	solverConfiguration.optionalInprocessingInterval = 1;
+	solverConfiguration.maximumSizeOfInprocessingBlockingSets = 0;
+	ASSERT_THROW(Solver(*problemDefinition, solverConfiguration), std::invalid_argument);
+
+	solverConfiguration.maximumSizeOfInprocessingBlockingSets = 1;
+	solverConfiguration.optionalInprocessingTickInterval = 0;
+	ASSERT_THROW(Solver(*problemDefinition, solverConfiguration), std::invalid_argument);
+}
+
+TEST_F(SolverTests, NumHyperBinaryResolventsOfProbingPassIsLimited)
+{
+	constexpr std::size_t numHoles = 5;
+	constexpr std::size_t numImpliedAuxiliaryVariables = 4;
+	const std::size_t numVariablesOfPigeonHoleFormula = numHoles * (numHoles + 1);
+	const auto firstAuxiliaryVariable = static_cast<long>(numVariablesOfPigeonHoleFormula + 1);
+	std::vector<std::vector<long>> clausesOfFormula = generatePigeonHoleFormula(numHoles);
+	// The probe of the auxiliary variable a implies the variables a + 2, ..., a + 5 by ternary clauses, each of them yielding a hyper-binary resolvent
+	clausesOfFormula.emplace_back(std::vector<long>({ -firstAuxiliaryVariable, firstAuxiliaryVariable + 1 }));
+	for (std::size_t i = 0; i < numImpliedAuxiliaryVariables; ++i)
+		clausesOfFormula.emplace_back(std::vector<long>({ -firstAuxiliaryVariable, -(firstAuxiliaryVariable + 1), firstAuxiliaryVariable + 2 + static_cast<long>(i) }));
+
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesOfPigeonHoleFormula + 2 + numImpliedAuxiliaryVariables, clausesOfFormula, problemDefinition));
+
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalInprocessingInterval = 10;
+	solverConfiguration.perInprocessingPassEffortsInPerMille = { 1000, 0, 0, 0, 0 };
+	Solver unlimitedSolver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, unlimitedSolver.solve());
+	ASSERT_GE(unlimitedSolver.getStatistics().perInprocessingPassStatistics[Solver::InprocessingPass::Probing].numAddedClauses, numImpliedAuxiliaryVariables);
+
+	solverConfiguration.maximumNumHyperBinaryResolventsPerProbingPass = 1;
+	Solver limitedSolver(*problemDefinition, solverConfiguration);
+	ASSERT_EQ(Solver::SolverResult::Unsat, limitedSolver.solve());
+	const Solver::SolverStatistics& statistics = limitedSolver.getStatistics();
+	ASSERT_GT(statistics.numInprocessingRounds, 0);
+	ASSERT_LE(statistics.perInprocessingPassStatistics[Solver::InprocessingPass::Probing].numAddedClauses, statistics.numInprocessingRounds);
+}
+
+TEST_F(SolverTests, ResultOfRandomFormulasMatchesBruteForceResultWithInprocessing)
+{
+	constexpr std::size_t numVariablesInFormula = 14;
+	constexpr std::size_t numGeneratedFormulas = 60;
+	std::default_random_engine rng(2024);
+
+	// Frequent switches of the search mode provide the restarts at which the inprocessing is performed
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalStableModeDecisionHeuristic = Solver::DecisionHeuristic::Evsids;
+	solverConfiguration.initialSearchModeSwitchConflictInterval = 2;
+	solverConfiguration.optionalInprocessingInterval = 1;
+
+	std::size_t numEliminatedClauses = 0;
+	std::size_t numRestoredEliminatedClauses = 0;
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, 40, 3, rng);
+		for (const std::vector<long>& clauseLiterals : generateRandomKSatFormula(numVariablesInFormula, 12, 2, rng))
+			clausesOfFormula.emplace_back(clauseLiterals);
+
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesInFormula, clausesOfFormula, problemDefinition));
+		Solver solver(*problemDefinition, solverConfiguration);
+		const bool isFormulaSatisfiable = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula);
+		ASSERT_EQ(isFormulaSatisfiable ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat, solver.solve());
+		if (!isFormulaSatisfiable)
+			continue;
+
+		// The model of the reduced formula needs to be extended to a model of the original formula
+		ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(solver, clausesOfFormula));
+		numEliminatedClauses += solver.getStatistics().perInprocessingPassStatistics[Solver::InprocessingPass::BlockedClauseElimination].numRemovedClauses
+			+ solver.getStatistics().perInprocessingPassStatistics[Solver::InprocessingPass::SetBlockedClauseElimination].numRemovedClauses;
+
+		// Clauses eliminated during inprocessing are restored once their redundancy might be affected by added clauses
+		for (const std::vector<long>& clauseLiterals : generateRandomKSatFormula(numVariablesInFormula, 6, 3, rng))
+		{
+			solver.addClause(clauseLiterals);
+			clausesOfFormula.emplace_back(clauseLiterals);
+		}
+		const bool isExtendedFormulaSatisfiable = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula);
+		ASSERT_EQ(isExtendedFormulaSatisfiable ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat, solver.solve());
+		if (isExtendedFormulaSatisfiable)
+		{
+			ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(solver, clausesOfFormula));
+		}
+		numRestoredEliminatedClauses += solver.getStatistics().numRestoredEliminatedClauses;
+	}
+	ASSERT_GT(numEliminatedClauses, 0);
+	ASSERT_GT(numRestoredEliminatedClauses, 0);
+}
+
+TEST_F(SolverTests, ResultOfRandomFormulasMatchesBruteForceResultWithVivificationOfEveryClause)
+{
+	constexpr std::size_t numVariablesInFormula = 14;
+	constexpr std::size_t numGeneratedFormulas = 60;
+	std::default_random_engine rng(2045);
+
+	// Only the vivification is performed at the restarts provided by frequent switches of the search mode
+	Solver::SolverConfiguration solverConfiguration;
+	solverConfiguration.optionalStableModeDecisionHeuristic = Solver::DecisionHeuristic::Evsids;
+	solverConfiguration.initialSearchModeSwitchConflictInterval = 2;
+	solverConfiguration.optionalInprocessingInterval = 1;
+	solverConfiguration.perInprocessingPassEffortsInPerMille = { 0, 0, 1000, 0, 0 };
+	solverConfiguration.isVivificationEnabledPerLearnedClauseTier = { true, true, true };
+	solverConfiguration.isVivificationOfIrredundantClausesEnabled = true;
+
+	std::size_t numRemovedLiterals = 0;
+	for (std::size_t i = 0; i < numGeneratedFormulas; ++i)
+	{
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomKSatFormula(numVariablesInFormula, 60, 3, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariablesInFormula, clausesOfFormula, problemDefinition));
+
+		Solver solver(*problemDefinition, solverConfiguration);
+		const bool isFormulaSatisfiable = isFormulaSatisfiableByBruteForce(numVariablesInFormula, clausesOfFormula);
+		ASSERT_EQ(isFormulaSatisfiable ? Solver::SolverResult::Sat : Solver::SolverResult::Unsat, solver.solve());
+		if (isFormulaSatisfiable)
+		{
+			ASSERT_NO_FATAL_FAILURE(assertModelSatisfiesClauses(solver, clausesOfFormula));
+		}
+		numRemovedLiterals += solver.getStatistics().perInprocessingPassStatistics[Solver::InprocessingPass::Vivification].numRemovedLiterals;
+	}
+	ASSERT_GT(numRemovedLiterals, 0);
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include "formulaTestUtils.hpp"
+#include "optimizations/unhiding/transitiveBinaryClauseEliminator.hpp"
+#include "solver/solver.hpp"
+
+#include <map>
+#include <random>
+#include <sstream>
+
+using namespace unhiding;
+using namespace formulaTestUtils;
+
+class TransitiveBinaryClauseEliminatorTests : public testing::Test {
+public:
+	[[nodiscard]] static std::map<std::size_t, std::vector<long>> determineClausesOfFormula(const dimacs::ProblemDefinition& problemDefinition)
+	{
+		std::map<std::size_t, std::vector<long>> clausesOfFormula;
+		for (const std::size_t clauseIdentifier : problemDefinition.getIdentifiersOfClauses())
+			clausesOfFormula.emplace(clauseIdentifier, problemDefinition.getClauseByIndexInFormula(clauseIdentifier)->literals);
+		return clausesOfFormula;
+	}
+
+	[[nodiscard]] static std::vector<std::vector<long>> determineModelsOfFormula(std::size_t numVariables, const std::vector<std::vector<long>>& clausesOfFormula)
+	{
+		const modelReconstruction::ModelChecker modelChecker = initializeModelChecker(clausesOfFormula);
+		std::vector<std::vector<long>> modelsOfFormula;
+		for (std::size_t assignment = 0; assignment < static_cast<std::size_t>(1) << numVariables; ++assignment)
+		{
+			std::vector<long> model = generateModelFromAssignment(numVariables, assignment);
+			if (modelChecker.isModelOfFormula(model))
+				modelsOfFormula.emplace_back(std::move(model));
+		}
+		return modelsOfFormula;
+	}
+};
+
+TEST_F(TransitiveBinaryClauseEliminatorTests, InvalidConfigurationThrows)
+{
+	ASSERT_THROW(TransitiveBinaryClauseEliminator(nullptr, TransitiveBinaryClauseEliminator::UnhidingConfiguration()), std::invalid_argument);
+
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(2, { { 1, 2 } }, problemDefinition));
+	TransitiveBinaryClauseEliminator::UnhidingConfiguration unhidingConfiguration;
+	unhidingConfiguration.maximumNumRounds = 0;
+	ASSERT_THROW(TransitiveBinaryClauseEliminator(problemDefinition, unhidingConfiguration), std::invalid_argument);
+}
+
+TEST_F(TransitiveBinaryClauseEliminatorTests, OnlyTransitiveBinaryClauseIsRemoved)
+{
+	// The implication 1 -> 4 is implied by the chain 1 -> 2 -> 3 -> 4 while no other binary clause is implied by the remaining ones
+	const std::vector<std::vector<long>> clausesOfFormula = { { -1, 2 }, { -2, 3 }, { -3, 4 }, { -1, 4 }, { 1, 2, 5 } };
+	std::size_t numSeedsRemovingTransitiveClause = 0;
+	for (std::size_t randomSeed = 0; randomSeed < 8; ++randomSeed)
+	{
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(5, clausesOfFormula, problemDefinition));
+
+		TransitiveBinaryClauseEliminator::UnhidingConfiguration unhidingConfiguration;
+		unhidingConfiguration.randomSeed = randomSeed;
+		TransitiveBinaryClauseEliminator transitiveBinaryClauseEliminator(problemDefinition, unhidingConfiguration);
+		ASSERT_TRUE(transitiveBinaryClauseEliminator.eliminateTransitiveBinaryClausesAndFailedLiterals());
+		ASSERT_TRUE(transitiveBinaryClauseEliminator.getFailedLiterals().empty());
+
+		const TransitiveBinaryClauseEliminator::UnhidingStatistics& statistics = transitiveBinaryClauseEliminator.getStatistics();
+		ASSERT_LE(statistics.numRemovedTransitiveClauses, 1);
+		ASSERT_EQ(clausesOfFormula.size() - statistics.numRemovedTransitiveClauses, problemDefinition->getNumClausesAfterOptimizations());
+		if (statistics.numRemovedTransitiveClauses)
+		{
+			ASSERT_EQ(nullptr, problemDefinition->getClauseByIndexInFormula(3));
+			++numSeedsRemovingTransitiveClause;
+		}
+	}
+	// The transitive clause is only kept if both of its implications are edges of the search trees in every round
+	ASSERT_GT(numSeedsRemovingTransitiveClause, 0);
+}
+
+TEST_F(TransitiveBinaryClauseEliminatorTests, TransitiveClauseIsRemovedIndependentOfSearchOrder)
+{
+	/*
+	 * The implication 1 -> 4 is implied by the chain 1 -> 2 -> 3 -> 4. The chain is discovered from the root 7 while 1 and -4 only have the predecessors 5 and -6 of their cycles, thus the search trees
+	 * of the roots 7 and -8 are completed before 1 and -4 are visited. Neither implication of the clause (-1 4) is an edge of a search tree and the interval of 2 contains the interval of 4 in every order.
+	 * No other implication is transitive and no literal implies both literals of a variable.
+	 */
+	const std::vector<std::vector<long>> clausesOfFormula = { { -1, 2 }, { -2, 3 }, { -3, 4 }, { -1, 4 }, { -1, 5 }, { -5, 1 }, { -4, 6 }, { -6, 4 }, { -7, 2 }, { -1, 8 } };
+	std::map<std::size_t, std::vector<long>> expectedClauses;
+	for (std::size_t clauseIdx = 0; clauseIdx < clausesOfFormula.size(); ++clauseIdx)
+	{
+		if (clauseIdx != 3)
+			expectedClauses.emplace(clauseIdx, clausesOfFormula[clauseIdx]);
+	}
+
+	for (std::size_t randomSeed = 0; randomSeed < 16; ++randomSeed)
+	{
+		SCOPED_TRACE("Seed " + std::to_string(randomSeed));
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(8, clausesOfFormula, problemDefinition));
+
+		TransitiveBinaryClauseEliminator::UnhidingConfiguration unhidingConfiguration;
+		unhidingConfiguration.randomSeed = randomSeed;
+		TransitiveBinaryClauseEliminator transitiveBinaryClauseEliminator(problemDefinition, unhidingConfiguration);
+		ASSERT_TRUE(transitiveBinaryClauseEliminator.eliminateTransitiveBinaryClausesAndFailedLiterals());
+		ASSERT_TRUE(transitiveBinaryClauseEliminator.getFailedLiterals().empty());
+		ASSERT_EQ(1, transitiveBinaryClauseEliminator.getStatistics().numRemovedTransitiveClauses);
+		// The second round does not remove a clause and thus stops the unhiding
+		ASSERT_EQ(2, transitiveBinaryClauseEliminator.getStatistics().numRounds);
+		ASSERT_EQ(expectedClauses, determineClausesOfFormula(*problemDefinition));
+	}
+}
+
+TEST_F(TransitiveBinaryClauseEliminatorTests, NegationOfFailedLiteralIsAddedAsUnitClause)
+{
+	// The literal 1 implies 2 and 3 while 2 implies -3
+	const std::vector<std::vector<long>> clausesOfFormula = { { -1, 2 }, { -1, 3 }, { -2, -3 }, { 1, 2, 4 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(4, clausesOfFormula, problemDefinition));
+
+	std::ostringstream proofStream;
+	proof::ProofWriter proofWriter(proofStream, proof::ProofWriter::ProofFormat::Drat);
+	TransitiveBinaryClauseEliminator transitiveBinaryClauseEliminator(problemDefinition, TransitiveBinaryClauseEliminator::UnhidingConfiguration());
+	transitiveBinaryClauseEliminator.setProofWriter(&proofWriter);
+	ASSERT_TRUE(transitiveBinaryClauseEliminator.eliminateTransitiveBinaryClausesAndFailedLiterals());
+	ASSERT_TRUE(proofWriter.close());
+
+	ASSERT_EQ(std::vector<long>({ 1 }), transitiveBinaryClauseEliminator.getFailedLiterals());
+	const dimacs::ProblemDefinition::Clause* unitClause = problemDefinition->getClauseByIndexInFormula(clausesOfFormula.size());
+	ASSERT_NE(nullptr, unitClause);
+	ASSERT_EQ(std::vector<long>({ -1 }), unitClause->literals);
+
+	const proof::DratChecker::CheckResult checkResult = verifyProofOfFormula(4, clausesOfFormula, proofStream.str(), proof::DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(checkResult.isProofValid);
+	ASSERT_EQ(1, checkResult.numLemmas);
+}
+
+TEST_F(TransitiveBinaryClauseEliminatorTests, FailureOfBothLiteralsOfVariableIsAddedToProof)
+{
+	const std::vector<std::vector<long>> clausesOfFormula = { { -1, 2 }, { -1, -2 }, { 1, 3 }, { 1, -3 } };
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(3, clausesOfFormula, problemDefinition));
+
+	std::ostringstream proofStream;
+	proof::ProofWriter proofWriter(proofStream, proof::ProofWriter::ProofFormat::Drat);
+	TransitiveBinaryClauseEliminator transitiveBinaryClauseEliminator(problemDefinition, TransitiveBinaryClauseEliminator::UnhidingConfiguration());
+	transitiveBinaryClauseEliminator.setProofWriter(&proofWriter);
+	ASSERT_FALSE(transitiveBinaryClauseEliminator.eliminateTransitiveBinaryClausesAndFailedLiterals());
+	ASSERT_TRUE(proofWriter.close());
+
+	const proof::DratChecker::CheckResult checkResult = verifyProofOfFormula(3, clausesOfFormula, proofStream.str(), proof::DratChecker::CheckingMode::Forward);
+	ASSERT_TRUE(checkResult.isProofValid);
+	ASSERT_TRUE(checkResult.wasEmptyClauseDerived);
+}
+
+TEST_F(TransitiveBinaryClauseEliminatorTests, ExhaustedBudgetStopsUnhiding)
+{
+	dimacs::ProblemDefinition::ptr problemDefinition;
+	ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(3, { { -1, 2 }, { -2, 3 }, { -1, 3 } }, problemDefinition));
+
+	budget::ResourceBudget resourceBudget;
+	resourceBudget.interrupt();
+	TransitiveBinaryClauseEliminator transitiveBinaryClauseEliminator(problemDefinition, TransitiveBinaryClauseEliminator::UnhidingConfiguration());
+	transitiveBinaryClauseEliminator.setResourceBudget(&resourceBudget);
+	ASSERT_TRUE(transitiveBinaryClauseEliminator.eliminateTransitiveBinaryClausesAndFailedLiterals());
+	ASSERT_EQ(0, transitiveBinaryClauseEliminator.getStatistics().numRounds);
+	ASSERT_EQ(3, problemDefinition->getNumClausesAfterOptimizations());
+}
+
+TEST_F(TransitiveBinaryClauseEliminatorTests, UnhidingOfRandomFormulasPreservesModelsAndProducesValidProofs)
+{
+	constexpr std::size_t numVariables = 10;
+	std::default_random_engine rng(50);
+	std::size_t numRemovedTransitiveClauses = 0;
+	std::size_t numFailedLiterals = 0;
+	for (std::size_t formulaIndex = 0; formulaIndex < 200; ++formulaIndex)
+	{
+		SCOPED_TRACE("Formula " + std::to_string(formulaIndex));
+		// Most clauses of the generated formulas are binary clauses, thus their binary implication graphs contain transitive implications and failed literals
+		const std::vector<std::vector<long>> clausesOfFormula = generateRandomFormula(numVariables, 10 + formulaIndex % 20, { 0, 0, 7, 3 }, rng);
+		dimacs::ProblemDefinition::ptr problemDefinition;
+		ASSERT_NO_FATAL_FAILURE(generateProblemDefinition(numVariables, clausesOfFormula, problemDefinition));
+
+		std::ostringstream proofStream;
+		proof::ProofWriter proofWriter(proofStream, proof::ProofWriter::ProofFormat::Drat);
+		TransitiveBinaryClauseEliminator::UnhidingConfiguration unhidingConfiguration;
+		unhidingConfiguration.randomSeed = formulaIndex;
+		TransitiveBinaryClauseEliminator transitiveBinaryClauseEliminator(problemDefinition, unhidingConfiguration);
+		transitiveBinaryClauseEliminator.setProofWriter(&proofWriter);
+		const bool wasUnhidingSuccessful = transitiveBinaryClauseEliminator.eliminateTransitiveBinaryClausesAndFailedLiterals();
+		numRemovedTransitiveClauses += transitiveBinaryClauseEliminator.getStatistics().numRemovedTransitiveClauses;
+		numFailedLiterals += transitiveBinaryClauseEliminator.getStatistics().numFailedLiterals;
+
+		// The reduced formula is equivalent to the original one, thus its models do not need to be reconstructed
+		if (wasUnhidingSuccessful)
+		{
+			std::vector<std::vector<long>> clausesOfReducedFormula;
+			for (const auto& [clauseIdentifier, clauseLiterals] : determineClausesOfFormula(*problemDefinition))
+				clausesOfReducedFormula.emplace_back(clauseLiterals);
+			ASSERT_EQ(determineModelsOfFormula(numVariables, clausesOfFormula), determineModelsOfFormula(numVariables, clausesOfReducedFormula));
+		}
+
+		const modelReconstruction::ModelReconstructionStack emptyModelReconstructionStack;
+		ASSERT_NO_FATAL_FAILURE(assertReducedFormulaIsSolvedWithValidProofOrModel(numVariables, clausesOfFormula, wasUnhidingSuccessful, *problemDefinition, emptyModelReconstructionStack, proofWriter, proofStream, proof::DratChecker::CheckingMode::Forward));
+	}
+	ASSERT_GT(numRemovedTransitiveClauses, 0);
+	ASSERT_GT(numFailedLiterals, 0);
+}